@@ -0,0 +1,200 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <errno.h>
+
+/****************************************************************************
+ * Definitions
+ ****************************************************************************/
+#define USAGE                                                           \
+	"\n Sequential Throughput Test\n"                                   \
+	"\n Usage :     seqio_test <path> [size]\n"                         \
+	"\n Path :      Test File Path\n"                                   \
+	" Size :        File size in bytes (default %d)\n"                  \
+	"\n ex) seqio_test /mnt/seqio 262144\n"
+
+#define SEQIO_DEFAULT_SIZE  CONFIG_SEQIO_TEST_FILESIZE
+#define SEQIO_MAX_BLOCK     CONFIG_SEQIO_TEST_MAXBLOCK
+#define SEQIO_ALIGN         32
+#define SEQIO_IOV_LEN       512
+#define SEQIO_MAX_IOV       (SEQIO_MAX_BLOCK / SEQIO_IOV_LEN)
+
+enum SEQIO_MODE {
+	SEQIO_PLAIN,				/* One read()/write() per block */
+	SEQIO_VECTORED,				/* One readv()/writev() per block */
+};
+
+/****************************************************************************
+ * Global Variables
+ ****************************************************************************/
+static FAR uint8_t *g_buf;
+static struct iovec g_iov[SEQIO_MAX_IOV];
+
+/****************************************************************************
+ * seqio_test
+ ****************************************************************************/
+
+static inline long get_time_us(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static long kbps(size_t nbytes, long usec)
+{
+	if (usec <= 0) {
+		usec = 1;
+	}
+	return (long)((long long)nbytes * 1000000 / 1024 / usec);
+}
+
+/* Move one block with read()/write() or as SEQIO_IOV_LEN-byte pieces with
+ * readv()/writev().
+ */
+
+static ssize_t seqio_block(int fd, size_t blksize, bool write_op, enum SEQIO_MODE mode)
+{
+	int iovcnt;
+	int i;
+
+	if (mode == SEQIO_PLAIN || blksize < SEQIO_IOV_LEN) {
+		return write_op ? write(fd, g_buf, blksize) : read(fd, g_buf, blksize);
+	}
+
+	iovcnt = blksize / SEQIO_IOV_LEN;
+	for (i = 0; i < iovcnt; i++) {
+		g_iov[i].iov_base = g_buf + i * SEQIO_IOV_LEN;
+		g_iov[i].iov_len = SEQIO_IOV_LEN;
+	}
+
+	return write_op ? writev(fd, g_iov, iovcnt) : readv(fd, g_iov, iovcnt);
+}
+
+static int seqio_pass(FAR const char *path, size_t size, size_t blksize, bool write_op, enum SEQIO_MODE mode, FAR long *usec)
+{
+	size_t total = 0;
+	ssize_t ret;
+	long start;
+	int fd;
+
+	if (write_op) {
+		fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	} else {
+		fd = open(path, O_RDONLY);
+	}
+
+	if (fd < 0) {
+		printf("Fail to open %s: %d\n", path, errno);
+		return ERROR;
+	}
+
+	/* The close is timed too, so that buffered writes reach the media */
+
+	start = get_time_us();
+	while (total < size) {
+		ret = seqio_block(fd, blksize, write_op, mode);
+		if (ret <= 0) {
+			printf("Fail to %s at %d: %d\n", write_op ? "write" : "read", (int)total, errno);
+			close(fd);
+			return ERROR;
+		}
+		total += ret;
+	}
+	close(fd);
+	*usec = get_time_us() - start;
+
+	return OK;
+}
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int seqio_test_main(int argc, char *argv[])
+#endif
+{
+	FAR const char *path;
+	size_t size = SEQIO_DEFAULT_SIZE;
+	size_t blksize;
+	long wusec;
+	long rusec;
+	int mode;
+	int ret = OK;
+	int i;
+
+	if (argc < 2 || argc > 3) {
+		printf(USAGE, SEQIO_DEFAULT_SIZE);
+		return ERROR;
+	}
+
+	path = argv[1];
+	if (argc == 3) {
+		size = atoi(argv[2]);
+		if (size < SEQIO_MAX_BLOCK) {
+			printf("Size should be at least %d\n", SEQIO_MAX_BLOCK);
+			return ERROR;
+		}
+	}
+
+	/* An aligned buffer lets a DMA-capable driver take it in place */
+
+	g_buf = memalign(SEQIO_ALIGN, SEQIO_MAX_BLOCK);
+	if (g_buf == NULL) {
+		printf("Fail to allocate %d bytes\n", SEQIO_MAX_BLOCK);
+		return ERROR;
+	}
+
+	for (i = 0; i < SEQIO_MAX_BLOCK; i++) {
+		g_buf[i] = (uint8_t)i;
+	}
+
+	printf("Sequential I/O on %s, %d bytes per pass\n", path, (int)size);
+	printf("%8s %10s %10s %10s\n", "block", "mode", "write KB/s", "read KB/s");
+
+	for (blksize = 256; blksize <= SEQIO_MAX_BLOCK && ret == OK; blksize <<= 1) {
+		for (mode = SEQIO_PLAIN; mode <= SEQIO_VECTORED && ret == OK; mode++) {
+			if (mode == SEQIO_VECTORED && blksize < 2 * SEQIO_IOV_LEN) {
+				continue;
+			}
+
+			ret = seqio_pass(path, size, blksize, true, mode, &wusec);
+			if (ret == OK) {
+				ret = seqio_pass(path, size, blksize, false, mode, &rusec);
+			}
+			if (ret == OK) {
+				printf("%8d %10s %10ld %10ld\n", (int)blksize, mode == SEQIO_PLAIN ? "rw" : "rwv", kbps(size, wusec), kbps(size, rusec));
+			}
+		}
+	}
+
+	unlink(path);
+	free(g_buf);
+	return ret;
+}
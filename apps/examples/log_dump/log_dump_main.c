@@ -22,6 +22,8 @@
 
 #include <tinyara/config.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <tinyara/log_dump/log_dump.h>
@@ -32,6 +34,34 @@
 
 #define READ_BUFFER_SIZE	1024	/* user configurable read size */
 
+#ifdef CONFIG_LOG_DUMP_STORE
+/* log_dump store [boots back] [seconds] [severity mask] */
+
+static int log_dump_store(int fd, int argc, char *argv[])
+{
+	char query[32];
+	char buf[READ_BUFFER_SIZE];
+	int total_read = 0;
+	int ret;
+
+	snprintf(query, sizeof(query), LOGDUMP_STORE_QUERY_FMT, argc > 2 ? atoi(argv[2]) : 0, argc > 3 ? atoi(argv[3]) : 0, argc > 4 ? atoi(argv[4]) : 0);
+	if (QUERY_LOGDUMP_STORE(fd, query) < 0) {
+		printf("Failed to query log dump store, errno %d\n", get_errno());
+		return -1;
+	}
+
+	while ((ret = READ_LOGDUMP(fd, buf, sizeof(buf))) > 0) {
+		total_read += ret;
+		for (int i = 0; i < ret; i++) {
+			printf("%c", buf[i]);
+		}
+	}
+	printf("\nlog_dump store query '%s' read %d bytes\n", query, total_read);
+
+	return 0;
+}
+#endif
+
 /****************************************************************************
  * log_dump_main
  ****************************************************************************/
@@ -52,6 +82,14 @@ int log_dump_main(int argc, char *argv[])
 		return -1;
 	}
 
+#ifdef CONFIG_LOG_DUMP_STORE
+	if (argc > 1 && strcmp(argv[1], "store") == 0) {
+		ret = log_dump_store(fd, argc, argv);
+		CLOSE_LOGDUMP(fd);
+		return ret;
+	}
+#endif
+
 	/* Log dump starts automatically from boot up.
 	 * To test start, intentionally add to stop. */
 	if (STOP_LOGDUMP_SAVE(fd) < 0) {
@@ -0,0 +1,335 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <aio.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define FILEPATH        CONFIG_EXAMPLES_AIO_RING_PERFORMANCE_FILEPATH
+#define FILESIZE        CONFIG_EXAMPLES_AIO_RING_PERFORMANCE_FILESIZE
+#define REQSIZE         CONFIG_EXAMPLES_AIO_RING_PERFORMANCE_REQSIZE
+#define DEPTH           CONFIG_EXAMPLES_AIO_RING_PERFORMANCE_DEPTH
+#define NREQS           (FILESIZE / REQSIZE)
+
+/* The ring size is the depth rounded up to a power of two */
+
+#define RING_ENTRIES    (DEPTH <= 4 ? 4 : DEPTH <= 8 ? 8 : DEPTH <= 16 ? 16 : 32)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+typedef int (*bench_t)(int fd);
+
+struct method_s {
+	FAR const char *name;
+	bench_t bench;
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int bench_pread(int fd);
+static int bench_aio(int fd);
+static int bench_ring(int fd);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct method_s g_methods[] = {
+	{"pread", bench_pread},
+	{"aio_read", bench_aio},
+	{"aio_ring", bench_ring},
+};
+
+#define NMETHODS (sizeof(g_methods) / sizeof(g_methods[0]))
+
+static uint8_t g_buf[DEPTH][REQSIZE];
+static struct aiocb g_aiocb[DEPTH];
+static struct aio_sqe g_sq[RING_ENTRIES];
+static struct aio_cqe g_cq[RING_ENTRIES];
+static struct aio_ring g_ring;
+static off_t g_offset[DEPTH];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+/* Every byte of the file holds the low bits of its offset */
+
+static int check_block(FAR const uint8_t *buf, off_t offset)
+{
+	int i;
+
+	for (i = 0; i < REQSIZE; i++) {
+		if (buf[i] != (uint8_t)(offset + i)) {
+			printf("Bad data at offset %d\n", (int)(offset + i));
+			return ERROR;
+		}
+	}
+
+	return OK;
+}
+
+static int bench_pread(int fd)
+{
+	int i;
+
+	for (i = 0; i < NREQS; i++) {
+		if (pread(fd, g_buf[0], REQSIZE, i * REQSIZE) != REQSIZE) {
+			printf("Fail to pread: %d\n", errno);
+			return ERROR;
+		}
+		if (check_block(g_buf[0], i * REQSIZE) != OK) {
+			return ERROR;
+		}
+	}
+
+	return OK;
+}
+
+/* Keep DEPTH aio_read() requests going and wait for the oldest one */
+
+static int bench_aio(int fd)
+{
+	FAR const struct aiocb *list[1];
+	int next = 0;
+	int done;
+	int slot;
+
+	for (slot = 0; slot < DEPTH && next < NREQS; slot++, next++) {
+		memset(&g_aiocb[slot], 0, sizeof(struct aiocb));
+		g_aiocb[slot].aio_fildes = fd;
+		g_aiocb[slot].aio_buf = g_buf[slot];
+		g_aiocb[slot].aio_nbytes = REQSIZE;
+		g_aiocb[slot].aio_offset = next * REQSIZE;
+		g_aiocb[slot].aio_sigevent.sigev_notify = SIGEV_NONE;
+		if (aio_read(&g_aiocb[slot]) != OK) {
+			printf("Fail to queue aio_read: %d\n", errno);
+			return ERROR;
+		}
+	}
+
+	for (done = 0; done < NREQS; done++) {
+		slot = done % DEPTH;
+		list[0] = &g_aiocb[slot];
+		while (aio_error(&g_aiocb[slot]) == EINPROGRESS) {
+			aio_suspend(list, 1, NULL);
+		}
+
+		if (aio_return(&g_aiocb[slot]) != REQSIZE || check_block(g_buf[slot], done * REQSIZE) != OK) {
+			printf("aio_read %d failed\n", done);
+			return ERROR;
+		}
+
+		if (next < NREQS) {
+			g_aiocb[slot].aio_offset = next++ * REQSIZE;
+			if (aio_read(&g_aiocb[slot]) != OK) {
+				printf("Fail to queue aio_read: %d\n", errno);
+				return ERROR;
+			}
+		}
+	}
+
+	return OK;
+}
+
+/* Keep DEPTH ring requests going; the buffer slot travels in user_data */
+
+static void ring_queue(int fd, int slot, int req)
+{
+	FAR struct aio_sqe *sqe;
+
+	/* There is a free entry for every free slot */
+
+	sqe = aio_ring_get_sqe(&g_ring);
+	sqe->opcode = LIO_READ;
+	sqe->fildes = fd;
+	sqe->offset = req * REQSIZE;
+	sqe->buf = g_buf[slot];
+	sqe->nbytes = REQSIZE;
+	sqe->user_data = slot;
+	g_offset[slot] = sqe->offset;
+}
+
+static int bench_ring(int fd)
+{
+	FAR struct aio_cqe *cqe;
+	int inflight = 0;
+	int next = 0;
+	int done = 0;
+	int slot;
+	int ret = OK;
+	int n;
+
+	if (aio_ring_setup(&g_ring, g_sq, g_cq, RING_ENTRIES) != OK) {
+		printf("Fail to set up the ring: %d\n", errno);
+		return ERROR;
+	}
+
+	for (slot = 0; slot < DEPTH && next < NREQS; slot++) {
+		ring_queue(fd, slot, next++);
+	}
+
+	while (done < NREQS && ret == OK) {
+		n = aio_ring_submit(&g_ring);
+		if (n < 0 && errno != EBUSY && errno != EAGAIN) {
+			printf("Fail to submit: %d\n", errno);
+			ret = ERROR;
+			break;
+		}
+		inflight += n > 0 ? n : 0;
+
+		if (aio_ring_wait(&g_ring, 1, NULL) < 0) {
+			printf("Fail to wait: %d\n", errno);
+			ret = ERROR;
+			break;
+		}
+
+		/* Reap everything that is ready and reuse the slots at once.
+		 * Merged requests may complete in any order.
+		 */
+
+		while ((cqe = aio_ring_peek_cqe(&g_ring)) != NULL) {
+			slot = (int)cqe->user_data;
+			n = (int)cqe->result;
+			aio_ring_cqe_seen(&g_ring);
+			inflight--;
+			done++;
+
+			if (n != REQSIZE || check_block(g_buf[slot], g_offset[slot]) != OK) {
+				printf("Ring read at %d failed: %d\n", (int)g_offset[slot], n);
+				ret = ERROR;
+				break;
+			}
+
+			if (next < NREQS) {
+				ring_queue(fd, slot, next++);
+			}
+		}
+	}
+
+	/* The ring must not go away while requests are in flight */
+
+	while (inflight > 0) {
+		aio_ring_wait(&g_ring, 1, NULL);
+		while (aio_ring_peek_cqe(&g_ring) != NULL) {
+			aio_ring_cqe_seen(&g_ring);
+			inflight--;
+		}
+	}
+
+	aio_ring_teardown(&g_ring);
+	return ret;
+}
+
+static int make_file(void)
+{
+	int fd;
+	int i;
+	int j;
+
+	fd = open(FILEPATH, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (fd < 0) {
+		printf("Fail to create %s: %d\n", FILEPATH, errno);
+		return ERROR;
+	}
+
+	for (i = 0; i < NREQS; i++) {
+		for (j = 0; j < REQSIZE; j++) {
+			g_buf[0][j] = (uint8_t)(i * REQSIZE + j);
+		}
+
+		if (write(fd, g_buf[0], REQSIZE) != REQSIZE) {
+			printf("Fail to write %s: %d\n", FILEPATH, errno);
+			close(fd);
+			return ERROR;
+		}
+	}
+
+	close(fd);
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int aioring_perf_main(int argc, char *argv[])
+#endif
+{
+	struct timespec start;
+	struct timespec end;
+	double usec;
+	int ret = OK;
+	int fd;
+	int i;
+
+	if (make_file() != OK) {
+		return ERROR;
+	}
+
+	fd = open(FILEPATH, O_RDONLY);
+	if (fd < 0) {
+		printf("Fail to open %s: %d\n", FILEPATH, errno);
+		unlink(FILEPATH);
+		return ERROR;
+	}
+
+	printf("Reading %d bytes of %s in %d-byte requests, %d in flight\n", FILESIZE, FILEPATH, REQSIZE, DEPTH);
+	printf("  %-10s %10s %10s\n", "method", "usec", "KB/s");
+
+	for (i = 0; i < NMETHODS && ret == OK; i++) {
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		ret = g_methods[i].bench(fd);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		if (ret == OK) {
+			usec = elapsed_usec(&start, &end);
+			printf("  %-10s %10.0f %10.1f\n", g_methods[i].name, usec, FILESIZE / usec * 1000000.0 / 1024.0);
+		}
+	}
+
+	close(fd);
+	unlink(FILEPATH);
+	return ret;
+}
@@ -22,11 +22,19 @@
 
 #include <tinyara/config.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <sched.h>
 #include <time.h>
+#include <semaphore.h>
 #include <sys/types.h>
 
 #define SWITCHING_ITERATIONS 1000000
+#define READY_ITERATIONS     20000
+#define READY_STACKSIZE      1024
+
+static sem_t g_ready_done;
+static volatile int g_ready_running;
+static struct timespec g_ready_end;
 
 static int yield_task_1(int a, char *b[])
 {
@@ -61,12 +69,91 @@ static int yield_task_2(int a, char *b[])
 	return 0;
 }
 
+/* All tasks of one round share a priority, so every sched_yield() puts the
+ * caller behind all other ready tasks of that priority.
+ */
+static int yield_ready_task(int a, char *b[])
+{
+	int cnt = READY_ITERATIONS;
+
+	while (cnt--) {
+		sched_yield();
+	}
+
+	sched_lock();
+	if (--g_ready_running == 0) {
+		clock_gettime(CLOCK_MONOTONIC, &g_ready_end);
+		sem_post(&g_ready_done);
+	}
+	sched_unlock();
+
+	return 0;
+}
+
+static int measure_ready_tasks(int ntasks)
+{
+	struct timespec start;
+	double diff_time;
+	int i;
+
+	g_ready_running = ntasks;
+
+	sched_lock();
+	for (i = 0; i < ntasks; i++) {
+		if (task_create("R_Task", SCHED_PRIORITY_MAX, READY_STACKSIZE, yield_ready_task, NULL) < 0) {
+			printf("Fail to create task %d\n", i);
+			g_ready_running -= ntasks - i;
+			sched_unlock();
+			if (i > 0) {
+				while (sem_wait(&g_ready_done) != OK) ;
+			}
+			return ERROR;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	sched_unlock();
+
+	while (sem_wait(&g_ready_done) != OK) ;
+
+	diff_time = ((double)g_ready_end.tv_sec + 1.0e-9 * g_ready_end.tv_nsec) - ((double)start.tv_sec + 1.0e-9 * start.tv_nsec);
+	printf("%4d ready tasks: Average Context Switching Time is %.10f seconds\n", ntasks,
+		   diff_time / ((double)ntasks * READY_ITERATIONS));
+
+	return OK;
+}
+
 #ifdef CONFIG_BUILD_KERNEL
 int main(int argc, FAR char *argv[])
 #else
 int ctx_switch_main(int argc, char *argv[])
 #endif
 {
+	int max_tasks;
+	int ntasks;
+
+	if (argc > 1) {
+		/* Sweep the number of ready tasks to show how the switch time
+		 * depends on the length of the ready-to-run list.
+		 */
+
+		max_tasks = atoi(argv[1]);
+		if (max_tasks < 2) {
+			printf("usage: %s [max ready tasks]\n", argv[0]);
+			return ERROR;
+		}
+
+		printf("Context Switching Latency vs Ready Tasks (%d yields per task)\n", READY_ITERATIONS);
+		sem_init(&g_ready_done, 0, 0);
+		for (ntasks = 2; ntasks <= max_tasks; ntasks *= 2) {
+			if (measure_ready_tasks(ntasks) != OK) {
+				break;
+			}
+		}
+		sem_destroy(&g_ready_done);
+
+		return OK;
+	}
+
 	printf("Context Switching Performance Measurement\n");
 
 	/* Do not context switching until making two tasks */
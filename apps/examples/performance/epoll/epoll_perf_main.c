@@ -0,0 +1,291 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <poll.h>
+#include <time.h>
+#include <sys/epoll.h>
+#ifdef CONFIG_NET_LWIP
+#include <string.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define DEFAULT_COUNT   1000
+#define MAX_PIPES       CONFIG_EXAMPLES_EPOLL_PERFORMANCE_NPIPES
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const int g_npipes[] = {1, 8, MAX_PIPES};
+
+#define NSIZES (sizeof(g_npipes) / sizeof(g_npipes[0]))
+
+/* The reading and the writing end of every pipe or socket pair */
+
+static int g_rfd[MAX_PIPES];
+static int g_wfd[MAX_PIPES];
+static struct pollfd g_pfds[MAX_PIPES];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+static void close_pairs(int npairs)
+{
+	int i;
+
+	for (i = 0; i < npairs; i++) {
+		close(g_rfd[i]);
+		close(g_wfd[i]);
+	}
+}
+
+static int open_pipes(int npipes)
+{
+	int fds[2];
+	int i;
+
+	for (i = 0; i < npipes; i++) {
+		if (pipe(fds) != OK) {
+			printf("Fail to create pipe %d: %d\n", i, errno);
+			close_pairs(i);
+			return ERROR;
+		}
+		g_rfd[i] = fds[0];
+		g_wfd[i] = fds[1];
+	}
+
+	return OK;
+}
+
+#ifdef CONFIG_NET_LWIP
+/* A pair is a UDP socket bound on the loopback and one connected to it,
+ * so that write() and read() move a datagram just like a pipe byte.
+ */
+
+static int open_sockets(int nsocks)
+{
+	struct sockaddr_in addr;
+	socklen_t addrlen;
+	int i;
+
+	for (i = 0; i < nsocks; i++) {
+		g_rfd[i] = socket(AF_INET, SOCK_DGRAM, 0);
+		if (g_rfd[i] < 0) {
+			printf("Fail to create socket %d: %d\n", i, errno);
+			close_pairs(i);
+			return ERROR;
+		}
+
+		memset(&addr, 0, sizeof(addr));
+		addr.sin_family = AF_INET;
+		addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		addrlen = sizeof(addr);
+		if (bind(g_rfd[i], (struct sockaddr *)&addr, sizeof(addr)) != OK || getsockname(g_rfd[i], (struct sockaddr *)&addr, &addrlen) != OK) {
+			printf("Fail to bind socket %d: %d\n", i, errno);
+			close(g_rfd[i]);
+			close_pairs(i);
+			return ERROR;
+		}
+
+		g_wfd[i] = socket(AF_INET, SOCK_DGRAM, 0);
+		if (g_wfd[i] < 0 || connect(g_wfd[i], (struct sockaddr *)&addr, sizeof(addr)) != OK) {
+			printf("Fail to connect socket %d: %d\n", i, errno);
+			if (g_wfd[i] >= 0) {
+				close(g_wfd[i]);
+			}
+			close(g_rfd[i]);
+			close_pairs(i);
+			return ERROR;
+		}
+	}
+
+	return OK;
+}
+#endif
+
+/* Every pass makes one pipe or socket readable and waits for it among all
+ * of them
+ */
+
+static int bench_poll(int npipes, int count, double *usec)
+{
+	struct timespec start;
+	struct timespec end;
+	char c = 0;
+	int ready;
+	int i;
+	int j;
+
+	for (i = 0; i < npipes; i++) {
+		g_pfds[i].fd = g_rfd[i];
+		g_pfds[i].events = POLLIN;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < count; i++) {
+		write(g_wfd[i % npipes], &c, 1);
+		if (poll(g_pfds, npipes, -1) != 1) {
+			printf("Fail to poll: %d\n", errno);
+			return ERROR;
+		}
+
+		for (ready = 0, j = 0; j < npipes; j++) {
+			if (g_pfds[j].revents & POLLIN) {
+				ready = g_pfds[j].fd;
+				break;
+			}
+		}
+		read(ready, &c, 1);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	*usec = elapsed_usec(&start, &end) / count;
+	return OK;
+}
+
+static int bench_epoll(int npipes, int count, double *usec)
+{
+	struct epoll_event ev;
+	struct timespec start;
+	struct timespec end;
+	char c = 0;
+	int epfd;
+	int ret = OK;
+	int i;
+
+	epfd = epoll_create1(0);
+	if (epfd < 0) {
+		printf("Fail to create the epoll instance: %d\n", errno);
+		return ERROR;
+	}
+
+	for (i = 0; i < npipes; i++) {
+		ev.events = EPOLLIN;
+		ev.data.fd = g_rfd[i];
+		if (epoll_ctl(epfd, EPOLL_CTL_ADD, g_rfd[i], &ev) != OK) {
+			printf("Fail to register descriptor %d: %d\n", g_rfd[i], errno);
+			close(epfd);
+			return ERROR;
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < count; i++) {
+		write(g_wfd[i % npipes], &c, 1);
+		if (epoll_wait(epfd, &ev, 1, -1) != 1) {
+			printf("Fail to wait: %d\n", errno);
+			ret = ERROR;
+			break;
+		}
+		read(ev.data.fd, &c, 1);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	close(epfd);
+	*usec = elapsed_usec(&start, &end) / count;
+	return ret;
+}
+
+static int bench_table(const char *name, int (*open_pairs)(int npairs), int count)
+{
+	double poll_usec;
+	double epoll_usec;
+	int last = 0;
+	int ret = OK;
+	int i;
+
+	printf("poll() versus epoll_wait() (%d wake-ups, one ready %s)\n", count, name);
+	printf("  %6s %12s %12s\n", name, "poll us", "epoll us");
+
+	for (i = 0; i < NSIZES && ret == OK; i++) {
+		/* The sizes run up to MAX_PIPES, which may be smaller than 8 */
+
+		if (g_npipes[i] > MAX_PIPES || g_npipes[i] <= last) {
+			continue;
+		}
+		last = g_npipes[i];
+
+		if (open_pairs(g_npipes[i]) != OK) {
+			return ERROR;
+		}
+
+		ret = bench_poll(g_npipes[i], count, &poll_usec);
+		if (ret == OK) {
+			ret = bench_epoll(g_npipes[i], count, &epoll_usec);
+		}
+		if (ret == OK) {
+			printf("  %6d %12.2f %12.2f\n", g_npipes[i], poll_usec, epoll_usec);
+		}
+
+		close_pairs(g_npipes[i]);
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int epoll_perf_main(int argc, char *argv[])
+#endif
+{
+	int count = DEFAULT_COUNT;
+	int ret;
+
+	if (argc > 1) {
+		count = atoi(argv[1]);
+		if (count <= 0) {
+			printf("usage: %s [count]\n", argv[0]);
+			return ERROR;
+		}
+	}
+
+	ret = bench_table("pipe", open_pipes, count);
+#ifdef CONFIG_NET_LWIP
+	if (ret == OK) {
+		ret = bench_table("socket", open_sockets, count);
+	}
+#endif
+
+	return ret;
+}
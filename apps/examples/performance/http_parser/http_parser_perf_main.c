@@ -0,0 +1,282 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <protocols/webserver/http_err.h>
+#include <protocols/webserver/http_parser.h>
+
+#define DEFAULT_ITERATIONS 10000
+#define FUZZ_ITERATIONS    2000
+#define SLICE_SIZE         16
+#define BUF_SIZE           1024
+
+struct parse_result_s {
+	int done;
+	int headers;
+	int body_len;
+	uint32_t hash;
+};
+
+static const char *g_samples[] = {
+	"GET /device/0/light?state=on HTTP/1.1\r\n"
+	"Host: 192.168.0.10\r\n"
+	"User-Agent: curl/7.58.0\r\n"
+	"Accept: */*\r\n"
+	"Connection: Keep-Alive\r\n"
+	"\r\n",
+
+	"POST /api/v1/telemetry HTTP/1.1\r\n"
+	"Host: 192.168.0.10\r\n"
+	"Content-Type: application/json\r\n"
+	"Content-Length: 47\r\n"
+	"\r\n"
+	"{\"temp\":23.5,\"humidity\":41,\"battery\":87,\"ok\":1}",
+
+	"PUT /upload HTTP/1.1\r\n"
+	"Host: 192.168.0.10\r\n"
+	"Transfer-Encoding: chunked\r\n"
+	"Trailer: X-Checksum\r\n"
+	"\r\n"
+	"10\r\n0123456789abcdef\r\n"
+	"8;name=value\r\n01234567\r\n"
+	"0\r\n"
+	"X-Checksum: 1234\r\n"
+	"\r\n",
+};
+
+#define NSAMPLES (sizeof(g_samples) / sizeof(g_samples[0]))
+
+static uint32_t hash_bytes(uint32_t hash, const char *data, int len)
+{
+	while (len-- > 0) {
+		hash = (hash ^ (unsigned char)*data++) * 16777619u;
+	}
+	return hash;
+}
+
+static int on_request_line(struct http_parser_t *parser, const struct http_slice_t *url)
+{
+	struct parse_result_s *res = (struct parse_result_s *)parser->priv;
+
+	res->hash = hash_bytes(res->hash, url->ptr, url->len) + parser->method;
+	return HTTP_OK;
+}
+
+static int on_header(struct http_parser_t *parser, int id, const struct http_slice_t *name, const struct http_slice_t *value)
+{
+	struct parse_result_s *res = (struct parse_result_s *)parser->priv;
+
+	res->headers++;
+	res->hash = hash_bytes(res->hash + id, name->ptr, name->len);
+	res->hash = hash_bytes(res->hash, value->ptr, value->len);
+	return HTTP_OK;
+}
+
+static int on_body(struct http_parser_t *parser, const struct http_slice_t *data)
+{
+	struct parse_result_s *res = (struct parse_result_s *)parser->priv;
+
+	res->body_len += data->len;
+	res->hash = hash_bytes(res->hash, data->ptr, data->len);
+	return HTTP_OK;
+}
+
+static int on_message_complete(struct http_parser_t *parser)
+{
+	struct parse_result_s *res = (struct parse_result_s *)parser->priv;
+
+	res->done = 1;
+	return HTTP_OK;
+}
+
+static const struct http_parser_cb_t g_cb = {
+	on_request_line,
+	on_header,
+	NULL,
+	on_body,
+	on_message_complete
+};
+
+/* Feed req to the parser in slices of 'slice' bytes (0 means all at once)
+ * the way the webserver does: unconsumed bytes stay at the end of buf and
+ * data already delivered in chunked bodies is dropped.
+ */
+static int parse_request(const char *req, int len, int slice, struct parse_result_s *res)
+{
+	struct http_parser_t parser;
+	char buf[BUF_SIZE];
+	int buf_len = 0;
+	int parsed = 0;
+	int pos = 0;
+	int n;
+
+	memset(res, 0, sizeof(struct parse_result_s));
+	http_parser_init(&parser, &g_cb, res);
+
+	while (parser.state != HTTP_PARSER_DONE && pos < len) {
+		n = (slice == 0 || len - pos < slice) ? len - pos : slice;
+		if (buf_len + n > BUF_SIZE) {
+			return HTTP_ERROR;
+		}
+		memcpy(buf + buf_len, req + pos, n);
+		buf_len += n;
+		pos += n;
+
+		n = http_parser_execute(&parser, buf + parsed, buf_len - parsed);
+		if (n < 0) {
+			return HTTP_ERROR;
+		}
+		parsed += n;
+
+		if (parser.encoding == HTTP_CHUNKED_ENCODING && parser.state >= HTTP_PARSER_CHUNK_SIZE) {
+			buf_len -= parsed;
+			memmove(buf, buf + parsed, buf_len);
+			parsed = 0;
+		}
+	}
+
+	return HTTP_OK;
+}
+
+static double elapsed_sec(struct timespec *start, struct timespec *end)
+{
+	return ((double)end->tv_sec + 1.0e-9 * end->tv_nsec) - ((double)start->tv_sec + 1.0e-9 * start->tv_nsec);
+}
+
+static int run_throughput(int iterations, int slice)
+{
+	struct parse_result_s res;
+	struct timespec start;
+	struct timespec end;
+	double diff_time;
+	int i;
+	int j;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (i = 0; i < iterations; i++) {
+		for (j = 0; j < NSAMPLES; j++) {
+			if (parse_request(g_samples[j], strlen(g_samples[j]), slice, &res) != HTTP_OK || !res.done) {
+				printf("Fail to parse sample %d\n", j);
+				return ERROR;
+			}
+		}
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	diff_time = elapsed_sec(&start, &end);
+	if (diff_time > 0) {
+		printf("%s: %d requests in %.6f seconds, %.1f requests/second\n",
+			   slice ? "16-byte slices" : "whole request", iterations * (int)NSAMPLES,
+			   diff_time, (iterations * NSAMPLES) / diff_time);
+	}
+
+	return OK;
+}
+
+static int run_fuzz(int iterations)
+{
+	char req[BUF_SIZE];
+	struct parse_result_s whole;
+	struct parse_result_s split;
+	int ret_whole;
+	int ret_split;
+	int mismatch = 0;
+	int rejected = 0;
+	int len;
+	int i;
+	int k;
+
+	srand(1);
+
+	for (i = 0; i < iterations; i++) {
+		len = strlen(g_samples[i % NSAMPLES]);
+		memcpy(req, g_samples[i % NSAMPLES], len);
+
+		/* Flip, drop or duplicate a few random bytes */
+		for (k = rand() % 4; k > 0; k--) {
+			int pos = rand() % len;
+
+			switch (rand() % 3) {
+			case 0:
+				req[pos] = (char)rand();
+				break;
+			case 1:
+				memmove(req + pos, req + pos + 1, len - pos - 1);
+				len--;
+				break;
+			default:
+				if (len < BUF_SIZE - 1) {
+					memmove(req + pos + 1, req + pos, len - pos);
+					len++;
+				}
+				break;
+			}
+		}
+
+		ret_whole = parse_request(req, len, 0, &whole);
+		ret_split = parse_request(req, len, 1 + rand() % SLICE_SIZE, &split);
+
+		if (ret_whole != ret_split) {
+			mismatch++;
+		} else if (ret_whole != HTTP_OK) {
+			rejected++;
+		} else if (whole.done != split.done || whole.headers != split.headers ||
+				   whole.body_len != split.body_len || whole.hash != split.hash) {
+			mismatch++;
+		}
+	}
+
+	printf("fuzz: %d inputs, %d rejected, %d mismatches\n", iterations, rejected, mismatch);
+
+	return mismatch ? ERROR : OK;
+}
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int http_parser_perf_main(int argc, char *argv[])
+#endif
+{
+	int iterations = DEFAULT_ITERATIONS;
+
+	if (argc > 1) {
+		iterations = atoi(argv[1]);
+		if (iterations <= 0) {
+			printf("usage: %s [iterations]\n", argv[0]);
+			return ERROR;
+		}
+	}
+
+	printf("HTTP Request Parser Performance Measurement\n");
+
+	if (run_throughput(iterations, 0) != OK || run_throughput(iterations, SLICE_SIZE) != OK) {
+		return ERROR;
+	}
+
+	return run_fuzz(FUZZ_ITERATIONS);
+}
@@ -0,0 +1,312 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <json/cJSON.h>
+
+#define DEFAULT_ITERATIONS 1000
+#define ARENA_SIZE         2048
+#define PRINT_SIZE         512
+
+struct payload_s {
+	const char *name;
+	const char *json;
+};
+
+struct sax_count_s {
+	int values;
+	int keys;
+};
+
+static const struct payload_s g_payloads[] = {
+	{"telemetry",
+	 "{\"deviceId\":\"3f2a9c10-5be1-4a2e-9c1d-7a41f0e2b6d3\",\"ts\":1700000000,"
+	 "\"sensors\":[{\"type\":\"temperature\",\"value\":23.5,\"unit\":\"C\"},"
+	 "{\"type\":\"humidity\",\"value\":41,\"unit\":\"%\"},"
+	 "{\"type\":\"illuminance\",\"value\":312.25,\"unit\":\"lx\"}],"
+	 "\"status\":{\"battery\":87,\"charging\":false,\"rssi\":-61,\"fw\":\"3.1.0\"}}"},
+
+	{"resource",
+	 "{\"href\":\"/light/0\",\"rt\":[\"oic.r.switch.binary\",\"oic.r.light.dimming\"],"
+	 "\"if\":[\"oic.if.a\",\"oic.if.baseline\"],\"rep\":{\"value\":true,\"dimmingSetting\":75,"
+	 "\"range\":[0,100],\"step\":1,\"name\":\"Living room \\\"main\\\" light\"}}"},
+
+	{"command",
+	 "{\"id\":1042,\"method\":\"set\",\"params\":{\"component\":\"main\",\"capability\":\"switchLevel\","
+	 "\"command\":\"setLevel\",\"arguments\":[50,{\"rate\":\"fast\"}]},\"ack\":null}"},
+};
+
+#define NPAYLOADS (sizeof(g_payloads) / sizeof(g_payloads[0]))
+
+static unsigned int g_mallocs;
+static unsigned int g_frees;
+static char g_arena_buffer[ARENA_SIZE];
+
+static void *count_malloc(size_t size)
+{
+	g_mallocs++;
+	return malloc(size);
+}
+
+static void count_free(void *ptr)
+{
+	if (ptr != NULL) {
+		g_frees++;
+	}
+	free(ptr);
+}
+
+static cJSON_bool sax_value(struct sax_count_s *count)
+{
+	count->values++;
+	return 1;
+}
+
+static cJSON_bool sax_null(void *context)
+{
+	return sax_value((struct sax_count_s *)context);
+}
+
+static cJSON_bool sax_bool(void *context, cJSON_bool boolean)
+{
+	return sax_value((struct sax_count_s *)context);
+}
+
+static cJSON_bool sax_number(void *context, double number)
+{
+	return sax_value((struct sax_count_s *)context);
+}
+
+static cJSON_bool sax_string(void *context, const char *string, size_t length)
+{
+	return sax_value((struct sax_count_s *)context);
+}
+
+static cJSON_bool sax_key(void *context, const char *key, size_t length)
+{
+	((struct sax_count_s *)context)->keys++;
+	return 1;
+}
+
+static const cJSON_SaxHandler g_sax_handler = {
+	sax_null,
+	sax_bool,
+	sax_number,
+	sax_string,
+	sax_key,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+static void report(const char *name, int iterations, struct timespec *start, struct timespec *end)
+{
+	printf("  %-14s %10.2f us/msg %8.2f mallocs/msg %8.2f frees/msg\n", name,
+		   elapsed_usec(start, end) / iterations,
+		   (double)g_mallocs / iterations, (double)g_frees / iterations);
+	g_mallocs = 0;
+	g_frees = 0;
+}
+
+static int bench_parse(const struct payload_s *payload, int iterations)
+{
+	struct sax_count_s count;
+	struct timespec start;
+	struct timespec end;
+	cJSON_Arena arena;
+	cJSON *root;
+	size_t len = strlen(payload->json);
+	int i;
+
+	g_mallocs = 0;
+	g_frees = 0;
+
+	/* cJSON tree: one allocation per item and per string */
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < iterations; i++) {
+		root = cJSON_Parse(payload->json);
+		if (root == NULL) {
+			printf("Fail to parse %s\n", payload->name);
+			return ERROR;
+		}
+		cJSON_Delete(root);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	report("tree", iterations, &start, &end);
+
+	/* cJSON tree in an arena: all items come from one static block */
+	cJSON_InitArena(&arena, g_arena_buffer, sizeof(g_arena_buffer));
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < iterations; i++) {
+		root = cJSON_ParseInArena(payload->json, &arena);
+		if (root == NULL) {
+			printf("Fail to parse %s in arena\n", payload->name);
+			cJSON_FreeArena(&arena);
+			return ERROR;
+		}
+		cJSON_ResetArena(&arena);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	cJSON_FreeArena(&arena);
+	report("arena", iterations, &start, &end);
+
+	/* SAX: no tree at all */
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < iterations; i++) {
+		memset(&count, 0, sizeof(struct sax_count_s));
+		if (!cJSON_ParseSax(payload->json, len, &g_sax_handler, &count)) {
+			printf("Fail to parse %s with SAX at %s\n", payload->name, cJSON_GetErrorPtr());
+			return ERROR;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	report("sax", iterations, &start, &end);
+
+	return OK;
+}
+
+/* Build the telemetry message, once as a tree and once with the writer */
+static int bench_print(int iterations)
+{
+	static char buffer[PRINT_SIZE];
+	const char *types[] = {"temperature", "humidity"};
+	const double values[] = {23.5, 41};
+	struct timespec start;
+	struct timespec end;
+	cJSON *root;
+	cJSON *sensors;
+	cJSON *sensor;
+	cJSON_Writer writer;
+	char *printed;
+	int len;
+	int i;
+	int j;
+
+	g_mallocs = 0;
+	g_frees = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < iterations; i++) {
+		root = cJSON_CreateObject();
+		cJSON_AddStringToObject(root, "deviceId", "3f2a9c10");
+		cJSON_AddNumberToObject(root, "ts", 1700000000);
+		sensors = cJSON_CreateArray();
+		cJSON_AddItemToObject(root, "sensors", sensors);
+		for (j = 0; j < 2; j++) {
+			sensor = cJSON_CreateObject();
+			cJSON_AddStringToObject(sensor, "type", types[j]);
+			cJSON_AddNumberToObject(sensor, "value", values[j]);
+			cJSON_AddItemToArray(sensors, sensor);
+		}
+		cJSON_AddFalseToObject(root, "charging");
+		printed = cJSON_PrintUnformatted(root);
+		cJSON_Delete(root);
+		if (printed == NULL) {
+			printf("Fail to print the tree\n");
+			return ERROR;
+		}
+		cJSON_free(printed);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	report("tree print", iterations, &start, &end);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < iterations; i++) {
+		cJSON_InitWriter(&writer, buffer, sizeof(buffer));
+		cJSON_WriteStartObject(&writer);
+		cJSON_WriteKey(&writer, "deviceId");
+		cJSON_WriteString(&writer, "3f2a9c10");
+		cJSON_WriteKey(&writer, "ts");
+		cJSON_WriteNumber(&writer, 1700000000);
+		cJSON_WriteKey(&writer, "sensors");
+		cJSON_WriteStartArray(&writer);
+		for (j = 0; j < 2; j++) {
+			cJSON_WriteStartObject(&writer);
+			cJSON_WriteKey(&writer, "type");
+			cJSON_WriteString(&writer, types[j]);
+			cJSON_WriteKey(&writer, "value");
+			cJSON_WriteNumber(&writer, values[j]);
+			cJSON_WriteEndObject(&writer);
+		}
+		cJSON_WriteEndArray(&writer);
+		cJSON_WriteKey(&writer, "charging");
+		cJSON_WriteBool(&writer, 0);
+		cJSON_WriteEndObject(&writer);
+		len = cJSON_FinishWriter(&writer);
+		if (len < 0) {
+			printf("Fail to write the message\n");
+			return ERROR;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	report("writer", iterations, &start, &end);
+
+	return OK;
+}
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int json_perf_main(int argc, char *argv[])
+#endif
+{
+	cJSON_Hooks hooks = {count_malloc, count_free};
+	int iterations = DEFAULT_ITERATIONS;
+	int ret = OK;
+	int i;
+
+	if (argc > 1) {
+		iterations = atoi(argv[1]);
+		if (iterations <= 0) {
+			printf("usage: %s [iterations]\n", argv[0]);
+			return ERROR;
+		}
+	}
+
+	printf("JSON Parser/Serializer Performance Measurement (%d iterations)\n", iterations);
+
+	cJSON_InitHooks(&hooks);
+
+	for (i = 0; i < NPAYLOADS && ret == OK; i++) {
+		printf("%s (%d bytes)\n", g_payloads[i].name, (int)strlen(g_payloads[i].json));
+		ret = bench_parse(&g_payloads[i], iterations);
+	}
+
+	if (ret == OK) {
+		printf("print\n");
+		ret = bench_print(iterations);
+	}
+
+	cJSON_InitHooks(NULL);
+
+	return ret;
+}
@@ -0,0 +1,335 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/mount.h>
+
+#include <tinyara/fs/mtd.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define LFS_PERF_DEVSIZE    (CONFIG_EXAMPLES_LITTLEFS_PERFORMANCE_NEBLOCKS * CONFIG_RAMMTD_ERASESIZE)
+#define LFS_PERF_MOUNTPT    "/lfs_perf"
+
+#define LFS_PERF_NFILES     8
+#define LFS_PERF_CHUNK      128
+
+/* Each file gets an eighth of the device, littlefs needs the rest for
+ * metadata and copy-on-write.
+ */
+
+#define LFS_PERF_FILESIZE   (LFS_PERF_DEVSIZE / LFS_PERF_NFILES / 8)
+
+#define LFS_PERF_OPTSIZE    64
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* A setting is given in MTD blocks for the cache and in lines for the block
+ * cache, 0 leaves the mount default.
+ */
+
+struct lfs_perf_setting_s {
+	int cache_blocks;
+	int lookahead;
+	int bcache;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct lfs_perf_setting_s g_settings[] = {
+	{1, 0, 0},
+	{1, 8, 0},
+	{2, 0, 0},
+	{CONFIG_RAMMTD_ERASESIZE / CONFIG_RAMMTD_BLOCKSIZE, 0, 0},
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	{1, 0, 16},
+	{2, 0, 16},
+#endif
+};
+
+#define NSETTINGS (sizeof(g_settings) / sizeof(g_settings[0]))
+
+static FAR uint8_t *g_simflash;
+static char g_devpath[16];
+static char g_chunk[LFS_PERF_CHUNK];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+static double kbytes_per_sec(size_t nbytes, double usec)
+{
+	return usec > 0 ? (double)nbytes * 1000000.0 / 1024.0 / usec : 0.0;
+}
+
+/* The RAM MTD device and its littlefs block driver can not be removed
+ * again, they are created on the first run and reused afterwards.
+ */
+
+static int lfs_perf_initdev(void)
+{
+	FAR struct mtd_dev_s *mtd;
+	int ret;
+
+	if (g_simflash != NULL) {
+		return OK;
+	}
+
+	g_simflash = malloc(LFS_PERF_DEVSIZE);
+	if (g_simflash == NULL) {
+		printf("Fail to allocate %d bytes of RAM MTD\n", LFS_PERF_DEVSIZE);
+		return ERROR;
+	}
+
+	mtd = rammtd_initialize(g_simflash, LFS_PERF_DEVSIZE);
+	if (mtd == NULL) {
+		printf("Fail to create the RAM MTD device\n");
+		goto errout;
+	}
+
+	ret = little_initialize(CONFIG_EXAMPLES_LITTLEFS_PERFORMANCE_MINOR, mtd, NULL);
+	if (ret < 0) {
+		printf("Fail to register the littlefs block driver: %d\n", ret);
+		goto errout;
+	}
+
+	snprintf(g_devpath, sizeof(g_devpath), "/dev/little%d", CONFIG_EXAMPLES_LITTLEFS_PERFORMANCE_MINOR);
+	return OK;
+
+errout:
+	free(g_simflash);
+	g_simflash = NULL;
+	return ERROR;
+}
+
+static void lfs_perf_fill(int file, int pos)
+{
+	int i;
+
+	for (i = 0; i < LFS_PERF_CHUNK; i++) {
+		g_chunk[i] = (char)(file * 31 + pos + i);
+	}
+}
+
+static int lfs_perf_open_all(int *fds, int oflags)
+{
+	char path[32];
+	int i;
+
+	for (i = 0; i < LFS_PERF_NFILES; i++) {
+		snprintf(path, sizeof(path), LFS_PERF_MOUNTPT "/file%d", i);
+		fds[i] = open(path, oflags, 0666);
+		if (fds[i] < 0) {
+			printf("Fail to open %s: %d\n", path, errno);
+			while (--i >= 0) {
+				close(fds[i]);
+			}
+			return ERROR;
+		}
+	}
+
+	return OK;
+}
+
+static void lfs_perf_close_all(int *fds)
+{
+	int i;
+
+	for (i = 0; i < LFS_PERF_NFILES; i++) {
+		close(fds[i]);
+	}
+}
+
+static int lfs_perf_create(void)
+{
+	struct timespec start;
+	struct timespec end;
+	int fds[LFS_PERF_NFILES];
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (lfs_perf_open_all(fds, O_WRONLY | O_CREAT | O_TRUNC) != OK) {
+		return ERROR;
+	}
+	lfs_perf_close_all(fds);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	printf(" %11.1f", elapsed_usec(&start, &end) / LFS_PERF_NFILES);
+	return OK;
+}
+
+static int lfs_perf_append(void)
+{
+	struct timespec start;
+	struct timespec end;
+	int fds[LFS_PERF_NFILES];
+	int pos;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (lfs_perf_open_all(fds, O_WRONLY | O_APPEND) != OK) {
+		return ERROR;
+	}
+
+	for (pos = 0; pos < LFS_PERF_FILESIZE; pos += LFS_PERF_CHUNK) {
+		for (i = 0; i < LFS_PERF_NFILES; i++) {
+			lfs_perf_fill(i, pos);
+			if (write(fds[i], g_chunk, LFS_PERF_CHUNK) != LFS_PERF_CHUNK) {
+				printf("\nFail to write file%d at %d: %d\n", i, pos, errno);
+				lfs_perf_close_all(fds);
+				return ERROR;
+			}
+		}
+	}
+
+	lfs_perf_close_all(fds);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	printf(" %11.1f", kbytes_per_sec(LFS_PERF_NFILES * LFS_PERF_FILESIZE, elapsed_usec(&start, &end)));
+	return OK;
+}
+
+static int lfs_perf_read(void)
+{
+	struct timespec start;
+	struct timespec end;
+	char buf[LFS_PERF_CHUNK];
+	int fds[LFS_PERF_NFILES];
+	int errors = 0;
+	int pos;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (lfs_perf_open_all(fds, O_RDONLY) != OK) {
+		return ERROR;
+	}
+
+	for (pos = 0; pos < LFS_PERF_FILESIZE; pos += LFS_PERF_CHUNK) {
+		for (i = 0; i < LFS_PERF_NFILES; i++) {
+			if (read(fds[i], buf, LFS_PERF_CHUNK) != LFS_PERF_CHUNK) {
+				printf("\nFail to read file%d at %d: %d\n", i, pos, errno);
+				lfs_perf_close_all(fds);
+				return ERROR;
+			}
+
+			lfs_perf_fill(i, pos);
+			if (memcmp(buf, g_chunk, LFS_PERF_CHUNK) != 0) {
+				errors++;
+			}
+		}
+	}
+
+	lfs_perf_close_all(fds);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	printf(" %11.1f", kbytes_per_sec(LFS_PERF_NFILES * LFS_PERF_FILESIZE, elapsed_usec(&start, &end)));
+	if (errors > 0) {
+		printf("  (%d bad chunks)", errors);
+		return ERROR;
+	}
+
+	return OK;
+}
+
+static int lfs_perf_run(FAR const char *options)
+{
+	char data[LFS_PERF_OPTSIZE];
+	int ret;
+
+	snprintf(data, sizeof(data), "forceformat%s%s", options[0] ? "," : "", options);
+	ret = mount(g_devpath, LFS_PERF_MOUNTPT, "littlefs", 0, data);
+	if (ret != OK) {
+		printf("  %-36s mount failed: %d\n", options[0] ? options : "(default)", errno);
+		return ERROR;
+	}
+
+	printf("  %-36s", options[0] ? options : "(default)");
+	ret = lfs_perf_create();
+	if (ret == OK) {
+		ret = lfs_perf_append();
+	}
+	if (ret == OK) {
+		ret = lfs_perf_read();
+	}
+	printf("\n");
+
+	umount(LFS_PERF_MOUNTPT);
+	return ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int lfs_perf_main(int argc, char *argv[])
+#endif
+{
+	char options[LFS_PERF_OPTSIZE];
+	int len;
+	int ret = OK;
+	int i;
+
+	if (lfs_perf_initdev() != OK) {
+		return ERROR;
+	}
+
+	printf("littlefs throughput (%d KB RAM MTD, block %d, erase block %d, %d files of %d bytes)\n", LFS_PERF_DEVSIZE / 1024, CONFIG_RAMMTD_BLOCKSIZE, CONFIG_RAMMTD_ERASESIZE, LFS_PERF_NFILES, LFS_PERF_FILESIZE);
+	printf("  %-36s %11s %11s %11s\n", "mount options", "create us", "append KB/s", "read KB/s");
+
+	if (argc > 1) {
+		return lfs_perf_run(argv[1]);
+	}
+
+	for (i = 0; i < NSETTINGS && ret == OK; i++) {
+		len = snprintf(options, sizeof(options), "cache=%d", g_settings[i].cache_blocks * CONFIG_RAMMTD_BLOCKSIZE);
+		if (g_settings[i].lookahead > 0) {
+			len += snprintf(options + len, sizeof(options) - len, ",lookahead=%d", g_settings[i].lookahead);
+		}
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+		snprintf(options + len, sizeof(options) - len, ",bcache=%d", g_settings[i].bcache);
+#endif
+
+		ret = lfs_perf_run(options);
+	}
+
+	return ret;
+}
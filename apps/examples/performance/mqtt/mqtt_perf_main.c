@@ -0,0 +1,354 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <network/mqtt/mqtt_api.h>
+
+#define BROKER_PORT        18830
+#define BROKER_BUFSIZE     1024
+#define DEFAULT_COUNT      500
+#define PAYLOAD_SIZE       64
+#define WAIT_TIMEOUT_SEC   30
+
+#define MQTT_CONNECT       1
+#define MQTT_PUBLISH       3
+#define MQTT_PINGREQ       12
+#define MQTT_DISCONNECT    14
+
+/* Just enough of an MQTT broker to acknowledge one publishing client */
+struct broker_s {
+	int listen_fd;
+	int delay_ms;
+	int reads;
+	int packets;
+	sem_t closed;
+};
+
+static struct broker_s g_broker;
+static sem_t g_connected;
+static sem_t g_done;
+static volatile int g_published;
+static int g_target;
+
+/****************************************************************************
+ * Broker stand-in
+ ****************************************************************************/
+
+/* Returns the length of the packet at buf or 0 if it is not complete yet */
+static int broker_packet_len(const unsigned char *buf, int len, int *header)
+{
+	int remaining = 0;
+	int mult = 1;
+	int i;
+
+	for (i = 1; i < len && i < 5; i++) {
+		remaining += (buf[i] & 0x7f) * mult;
+		mult *= 128;
+		if ((buf[i] & 0x80) == 0) {
+			*header = i + 1;
+			return (i + 1 + remaining <= len) ? i + 1 + remaining : 0;
+		}
+	}
+
+	return 0;
+}
+
+static void broker_session(int fd)
+{
+	unsigned char in[BROKER_BUFSIZE];
+	unsigned char out[BROKER_BUFSIZE];
+	int in_len = 0;
+	int out_len;
+	int pkt_len;
+	int header;
+	int topic_len;
+	int pos;
+	int ret;
+
+	while (1) {
+		ret = recv(fd, in + in_len, sizeof(in) - in_len, 0);
+		if (ret <= 0) {
+			return;
+		}
+		g_broker.reads++;
+		in_len += ret;
+
+		/* Answer everything that arrived with this read in one send */
+		out_len = 0;
+		pos = 0;
+		while ((pkt_len = broker_packet_len(in + pos, in_len - pos, &header)) > 0) {
+			unsigned char *pkt = in + pos;
+
+			g_broker.packets++;
+			switch (pkt[0] >> 4) {
+			case MQTT_CONNECT:
+				out[out_len++] = 0x20;
+				out[out_len++] = 2;
+				out[out_len++] = 0;
+				out[out_len++] = 0;
+				break;
+			case MQTT_PUBLISH:
+				if (((pkt[0] >> 1) & 0x03) == 1) {
+					topic_len = (pkt[header] << 8) | pkt[header + 1];
+					out[out_len++] = 0x40;
+					out[out_len++] = 2;
+					out[out_len++] = pkt[header + 2 + topic_len];
+					out[out_len++] = pkt[header + 3 + topic_len];
+				}
+				break;
+			case MQTT_PINGREQ:
+				out[out_len++] = 0xd0;
+				out[out_len++] = 0;
+				break;
+			case MQTT_DISCONNECT:
+				return;
+			default:
+				break;
+			}
+			pos += pkt_len;
+
+			if (out_len > sizeof(out) - 4) {
+				send(fd, out, out_len, 0);
+				out_len = 0;
+			}
+		}
+		memmove(in, in + pos, in_len - pos);
+		in_len -= pos;
+
+		if (out_len > 0) {
+			/* Emulate the round trip time to a remote broker */
+			if (g_broker.delay_ms > 0) {
+				usleep(g_broker.delay_ms * 1000);
+			}
+			send(fd, out, out_len, 0);
+		}
+	}
+}
+
+static void *broker_main(void *arg)
+{
+	int fd;
+
+	while (1) {
+		fd = accept(g_broker.listen_fd, NULL, NULL);
+		if (fd < 0) {
+			break;
+		}
+		g_broker.reads = 0;
+		g_broker.packets = 0;
+		broker_session(fd);
+		close(fd);
+		sem_post(&g_broker.closed);
+	}
+
+	return NULL;
+}
+
+static int broker_start(pthread_t *tid)
+{
+	struct sockaddr_in addr;
+	int opt = 1;
+
+	g_broker.listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+	if (g_broker.listen_fd < 0) {
+		printf("Fail to create broker socket: %d\n", errno);
+		return ERROR;
+	}
+	setsockopt(g_broker.listen_fd, SOL_SOCKET, SO_REUSEADDR, &opt, sizeof(opt));
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(BROKER_PORT);
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if (bind(g_broker.listen_fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(g_broker.listen_fd, 1) < 0) {
+		printf("Fail to listen on port %d: %d\n", BROKER_PORT, errno);
+		close(g_broker.listen_fd);
+		return ERROR;
+	}
+
+	if (pthread_create(tid, NULL, broker_main, NULL) != 0) {
+		printf("Fail to create broker thread\n");
+		close(g_broker.listen_fd);
+		return ERROR;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Publisher
+ ****************************************************************************/
+
+static void on_connect(void *client, int result)
+{
+	sem_post(&g_connected);
+}
+
+static void on_publish(void *client, int msg_id)
+{
+	if (++g_published == g_target) {
+		sem_post(&g_done);
+	}
+}
+
+static int wait_sem(sem_t *sem)
+{
+	struct timespec abstime;
+
+	clock_gettime(CLOCK_REALTIME, &abstime);
+	abstime.tv_sec += WAIT_TIMEOUT_SEC;
+
+	while (sem_timedwait(sem, &abstime) != 0) {
+		if (errno != EINTR) {
+			return ERROR;
+		}
+	}
+
+	return OK;
+}
+
+static int run_publish(int count, int qos, int window)
+{
+	static char payload[PAYLOAD_SIZE];
+	mqtt_client_config_t config;
+	mqtt_client_t *client;
+	struct timespec start;
+	struct timespec end;
+	double usec;
+	int ret = ERROR;
+	int i;
+
+	memset(&config, 0, sizeof(config));
+	memset(payload, 'x', sizeof(payload));
+	config.client_id = "mqtt_perf";
+	config.clean_session = true;
+	config.protocol_version = MQTT_PROTOCOL_VERSION_311;
+	config.on_connect = on_connect;
+	config.on_publish = on_publish;
+	config.max_inflight = window;
+
+	client = mqtt_init_client(&config);
+	if (client == NULL) {
+		printf("Fail to init mqtt client\n");
+		return ERROR;
+	}
+
+	if (mqtt_connect(client, "127.0.0.1", BROKER_PORT, MQTT_DEFAULT_KEEP_ALIVE_TIME) != 0 || wait_sem(&g_connected) != OK) {
+		printf("Fail to connect to the broker stand-in\n");
+		mqtt_deinit_client(client);
+		return ERROR;
+	}
+
+	g_published = 0;
+	g_target = count;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < count; i++) {
+		if (mqtt_publish(client, "perf/telemetry", payload, sizeof(payload), qos, 0) != 0) {
+			printf("Fail to publish message %d\n", i);
+			goto out;
+		}
+	}
+	if (wait_sem(&g_done) != OK) {
+		printf("Timeout, %d of %d messages completed\n", g_published, count);
+		goto out;
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	usec = (end.tv_sec - start.tv_sec) * 1000000.0 + (end.tv_nsec - start.tv_nsec) / 1000.0;
+	ret = OK;
+
+out:
+	mqtt_disconnect(client);
+	wait_sem(&g_broker.closed);
+	mqtt_deinit_client(client);
+
+	if (ret == OK) {
+		printf("  qos %d window %5d: %10.1f msg/s %8.2f packets/read\n", qos, window,
+			   count * 1000000.0 / usec, g_broker.reads ? (double)g_broker.packets / g_broker.reads : 0.0);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int mqtt_perf_main(int argc, char *argv[])
+#endif
+{
+	pthread_t broker;
+	int count = DEFAULT_COUNT;
+	int ret;
+
+	memset(&g_broker, 0, sizeof(g_broker));
+	if (argc > 1) {
+		count = atoi(argv[1]);
+	}
+	if (argc > 2) {
+		g_broker.delay_ms = atoi(argv[2]);
+	}
+	if (count <= 0 || g_broker.delay_ms < 0) {
+		printf("usage: %s [count] [ack delay ms]\n", argv[0]);
+		return ERROR;
+	}
+
+	sem_init(&g_connected, 0, 0);
+	sem_init(&g_done, 0, 0);
+	sem_init(&g_broker.closed, 0, 0);
+
+	if (broker_start(&broker) != OK) {
+		return ERROR;
+	}
+
+	printf("MQTT Publish Performance Measurement (%d messages of %d bytes, %d ms ack delay)\n",
+		   count, PAYLOAD_SIZE, g_broker.delay_ms);
+
+	ret = run_publish(count, 0, CONFIG_NETUTILS_MQTT_MAX_INFLIGHT);
+	if (ret == OK) {
+		ret = run_publish(count, 1, 1);
+	}
+	if (ret == OK) {
+		ret = run_publish(count, 1, CONFIG_NETUTILS_MQTT_MAX_INFLIGHT);
+	}
+
+	shutdown(g_broker.listen_fd, SHUT_RDWR);
+	close(g_broker.listen_fd);
+	pthread_join(broker, NULL);
+
+	sem_destroy(&g_connected);
+	sem_destroy(&g_done);
+	sem_destroy(&g_broker.closed);
+
+	return ret;
+}
@@ -0,0 +1,262 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <mqueue.h>
+#include <pthread.h>
+#include <time.h>
+
+#define DEFAULT_COUNT   1000
+#define QUEUE_NAME      "mq_perf"
+#define QUEUE_DEPTH     8
+#define MAX_PAYLOAD     4096
+
+#ifdef CONFIG_MQ_ZEROCOPY
+#define QUEUE_MSGSIZE   CONFIG_MQ_ZEROCOPY_BUFSIZE
+#else
+#define QUEUE_MSGSIZE   CONFIG_MQ_MAXMSGSIZE
+#endif
+
+struct receiver_s {
+	mqd_t mqdes;
+	int count;			/* Payloads to receive */
+	size_t size;		/* Payload size */
+	bool zerocopy;
+	int errors;
+};
+
+static const size_t g_sizes[] = {32, 128, 512, 1024, 4096};
+
+#define NSIZES (sizeof(g_sizes) / sizeof(g_sizes[0]))
+
+static char g_source[MAX_PAYLOAD];
+static char g_payload[MAX_PAYLOAD];
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+static void *receiver(void *arg)
+{
+	struct receiver_s *rcv = (struct receiver_s *)arg;
+	char *msg;
+	ssize_t len;
+	size_t got;
+	int i;
+
+	msg = (char *)malloc(QUEUE_MSGSIZE);
+	if (msg == NULL) {
+		rcv->errors = rcv->count;
+		return NULL;
+	}
+
+	for (i = 0; i < rcv->count; i++) {
+#ifdef CONFIG_MQ_ZEROCOPY
+		if (rcv->zerocopy) {
+			void *buf;
+
+			len = mq_receive_buf(rcv->mqdes, &buf, NULL);
+			if (len != rcv->size) {
+				rcv->errors++;
+			}
+			if (len >= 0) {
+				mq_buf_free(buf);
+			}
+			continue;
+		}
+#endif
+
+		/* Put the fragments of the payload back together */
+
+		for (got = 0; got < rcv->size; got += len) {
+			len = mq_receive(rcv->mqdes, msg, QUEUE_MSGSIZE, NULL);
+			if (len <= 0) {
+				rcv->errors++;
+				break;
+			}
+			memcpy(g_payload + got, msg, len);
+		}
+	}
+
+	free(msg);
+	return NULL;
+}
+
+static int send_copy(mqd_t mqdes, size_t size)
+{
+	size_t sent;
+	size_t len;
+
+	for (sent = 0; sent < size; sent += len) {
+		len = size - sent;
+		if (len > CONFIG_MQ_MAXMSGSIZE) {
+			len = CONFIG_MQ_MAXMSGSIZE;
+		}
+		if (mq_send(mqdes, g_source + sent, len, 0) != OK) {
+			return ERROR;
+		}
+	}
+
+	return OK;
+}
+
+#ifdef CONFIG_MQ_ZEROCOPY
+static int send_zerocopy(mqd_t mqdes, size_t size)
+{
+	void *buf;
+
+	/* The payload would be built in place in the buffer */
+
+	buf = mq_buf_alloc(size);
+	if (buf == NULL) {
+		return ERROR;
+	}
+
+	if (mq_send_buf(mqdes, buf, size, 0) != OK) {
+		mq_buf_free(buf);
+		return ERROR;
+	}
+
+	return OK;
+}
+#endif
+
+static int bench(const char *name, mqd_t txdes, mqd_t rxdes, size_t size, int count, bool zerocopy)
+{
+	struct receiver_s rcv;
+	struct timespec start;
+	struct timespec end;
+	pthread_t thread;
+	double usec;
+	int ret = OK;
+	int i;
+
+	rcv.mqdes = rxdes;
+	rcv.count = count;
+	rcv.size = size;
+	rcv.zerocopy = zerocopy;
+	rcv.errors = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (pthread_create(&thread, NULL, receiver, &rcv) != 0) {
+		printf("Fail to create the receiver\n");
+		return ERROR;
+	}
+
+	for (i = 0; i < count && ret == OK; i++) {
+#ifdef CONFIG_MQ_ZEROCOPY
+		if (zerocopy) {
+			ret = send_zerocopy(txdes, size);
+			continue;
+		}
+#endif
+		ret = send_copy(txdes, size);
+	}
+
+	if (ret != OK) {
+		/* The receiver waits for payloads that will never come */
+
+		printf("Fail to send %s payload %d: %d\n", name, i, errno);
+		pthread_cancel(thread);
+		pthread_join(thread, NULL);
+		return ERROR;
+	}
+
+	pthread_join(thread, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	usec = elapsed_usec(&start, &end);
+	printf("  %-10s %10.2f us/payload %10.2f MB/s", name, usec / count, (double)size * count / usec);
+	if (rcv.errors) {
+		printf(" (%d errors)", rcv.errors);
+		ret = ERROR;
+	}
+	printf("\n");
+
+	return ret;
+}
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int mq_perf_main(int argc, char *argv[])
+#endif
+{
+	struct mq_attr attr;
+	mqd_t txdes;
+	mqd_t rxdes;
+	int count = DEFAULT_COUNT;
+	int ret = OK;
+	int i;
+
+	if (argc > 1) {
+		count = atoi(argv[1]);
+		if (count <= 0) {
+			printf("usage: %s [count]\n", argv[0]);
+			return ERROR;
+		}
+	}
+
+	memset(&attr, 0, sizeof(struct mq_attr));
+	attr.mq_maxmsg = QUEUE_DEPTH;
+	attr.mq_msgsize = QUEUE_MSGSIZE;
+
+	txdes = mq_open(QUEUE_NAME, O_WRONLY | O_CREAT, 0666, &attr);
+	if (txdes == (mqd_t)ERROR) {
+		printf("Fail to open the queue: %d\n", errno);
+		return ERROR;
+	}
+
+	rxdes = mq_open(QUEUE_NAME, O_RDONLY);
+	if (rxdes == (mqd_t)ERROR) {
+		printf("Fail to open the queue: %d\n", errno);
+		mq_close(txdes);
+		mq_unlink(QUEUE_NAME);
+		return ERROR;
+	}
+
+	memset(g_source, 0xa5, sizeof(g_source));
+
+	printf("Message Queue Performance Measurement (%d payloads, %d byte messages)\n", count, CONFIG_MQ_MAXMSGSIZE);
+
+	for (i = 0; i < NSIZES && ret == OK; i++) {
+		printf("%d bytes\n", (int)g_sizes[i]);
+		ret = bench("copy", txdes, rxdes, g_sizes[i], count, false);
+#ifdef CONFIG_MQ_ZEROCOPY
+		if (ret == OK && g_sizes[i] <= CONFIG_MQ_ZEROCOPY_BUFSIZE) {
+			ret = bench("zero-copy", txdes, rxdes, g_sizes[i], count, true);
+		}
+#endif
+	}
+
+	mq_close(rxdes);
+	mq_close(txdes);
+	mq_unlink(QUEUE_NAME);
+
+	return ret;
+}
@@ -0,0 +1,222 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <pthread.h>
+#include <time.h>
+
+#include <tinyara/semaphore.h>
+
+#define DEFAULT_COUNT   10000
+#define MAX_HELD        16
+
+#define PRIORITY_LOW    90
+#define PRIORITY_HIGH   110
+
+struct handoff_s {
+	sem_t mutex;		/* Passed from the low to the high priority thread */
+	sem_t ready;		/* Tells the high priority thread to take it */
+	int count;
+};
+
+static const int g_nheld[] = {0, 4, MAX_HELD};
+
+#define NHELD (sizeof(g_nheld) / sizeof(g_nheld[0]))
+
+static sem_t g_held[MAX_HELD];
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+/* sem_wait()/sem_post() on a free semaphore while nheld other semaphores
+ * are held by the caller.
+ */
+
+static int bench_roundtrip(int nheld, int count)
+{
+	struct timespec start;
+	struct timespec end;
+	sem_t sem;
+	int ret = OK;
+	int i;
+
+	sem_init(&sem, 0, 1);
+	for (i = 0; i < nheld; i++) {
+		sem_init(&g_held[i], 0, 1);
+		sem_wait(&g_held[i]);
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < count; i++) {
+		if (sem_wait(&sem) != OK || sem_post(&sem) != OK) {
+			printf("Fail to take the semaphore: %d\n", errno);
+			ret = ERROR;
+			break;
+		}
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	for (i = 0; i < nheld; i++) {
+		sem_post(&g_held[i]);
+		sem_destroy(&g_held[i]);
+	}
+	sem_destroy(&sem);
+
+	if (ret == OK) {
+		printf("  round-trip  %2d held   %8.3f us\n", nheld, elapsed_usec(&start, &end) / count);
+	}
+
+	return ret;
+}
+
+static void *handoff_low(void *arg)
+{
+	struct handoff_s *ho = (struct handoff_s *)arg;
+	int i;
+
+	for (i = 0; i < ho->count; i++) {
+		sem_wait(&ho->mutex);
+
+		/* The high priority thread preempts us, blocks on the mutex and
+		 * boosts our priority until we post it.
+		 */
+
+		sem_post(&ho->ready);
+		sem_post(&ho->mutex);
+	}
+
+	return NULL;
+}
+
+static void *handoff_high(void *arg)
+{
+	struct handoff_s *ho = (struct handoff_s *)arg;
+	int i;
+
+	for (i = 0; i < ho->count; i++) {
+		sem_wait(&ho->ready);
+		sem_wait(&ho->mutex);
+		sem_post(&ho->mutex);
+	}
+
+	return NULL;
+}
+
+static int start_thread(pthread_t *thread, int priority, pthread_startroutine_t entry, void *arg)
+{
+	struct sched_param param;
+	pthread_attr_t attr;
+	int ret;
+
+	pthread_attr_init(&attr);
+	param.sched_priority = priority;
+	pthread_attr_setschedparam(&attr, &param);
+	ret = pthread_create(thread, &attr, entry, arg);
+	pthread_attr_destroy(&attr);
+
+	return ret;
+}
+
+/* A low priority thread holds the semaphore that a high priority thread
+ * waits for, every pass boosts and restores the low priority thread.
+ */
+
+static int bench_handoff(int count)
+{
+	struct handoff_s ho;
+	struct timespec start;
+	struct timespec end;
+	pthread_t low;
+	pthread_t high;
+
+	sem_init(&ho.mutex, 0, 1);
+	sem_init(&ho.ready, 0, 0);
+#ifdef CONFIG_PRIORITY_INHERITANCE
+	sem_setprotocol(&ho.ready, SEM_PRIO_NONE);
+#endif
+	ho.count = count;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	if (start_thread(&high, PRIORITY_HIGH, handoff_high, &ho) != OK) {
+		printf("Fail to create the high priority thread\n");
+		return ERROR;
+	}
+
+	if (start_thread(&low, PRIORITY_LOW, handoff_low, &ho) != OK) {
+		printf("Fail to create the low priority thread\n");
+		pthread_cancel(high);
+		pthread_join(high, NULL);
+		return ERROR;
+	}
+
+	pthread_join(low, NULL);
+	pthread_join(high, NULL);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	sem_destroy(&ho.ready);
+	sem_destroy(&ho.mutex);
+
+	printf("  hand-off               %8.3f us\n", elapsed_usec(&start, &end) / count);
+	return OK;
+}
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int sem_perf_main(int argc, char *argv[])
+#endif
+{
+	int count = DEFAULT_COUNT;
+	int ret = OK;
+	int i;
+
+	if (argc > 1) {
+		count = atoi(argv[1]);
+		if (count <= 0) {
+			printf("usage: %s [count]\n", argv[0]);
+			return ERROR;
+		}
+	}
+
+#ifdef CONFIG_PRIORITY_INHERITANCE
+	printf("Semaphore Performance Measurement (%d iterations, priority inheritance)\n", count);
+#else
+	printf("Semaphore Performance Measurement (%d iterations)\n", count);
+#endif
+
+	for (i = 0; i < NHELD && ret == OK; i++) {
+		ret = bench_roundtrip(g_nheld[i], count);
+	}
+
+	if (ret == OK) {
+		ret = bench_handoff(count);
+	}
+
+	return ret;
+}
@@ -0,0 +1,337 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/socket.h>
+#include <sys/sendfile.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define FILEPATH        CONFIG_EXAMPLES_SPLICE_PERFORMANCE_FILEPATH
+#define FILESIZE        CONFIG_EXAMPLES_SPLICE_PERFORMANCE_FILESIZE
+#define PORT            CONFIG_EXAMPLES_SPLICE_PERFORMANCE_PORT
+#define IOBUFSIZE       512
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+typedef ssize_t (*xfer_t)(int infd, int sockfd, size_t size);
+
+struct method_s {
+	FAR const char *name;
+	xfer_t xfer;
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static ssize_t xfer_readwrite(int infd, int sockfd, size_t size);
+static ssize_t xfer_sendfile(int infd, int sockfd, size_t size);
+static ssize_t xfer_splice(int infd, int sockfd, size_t size);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct method_s g_methods[] = {
+	{"read/write", xfer_readwrite},
+	{"sendfile", xfer_sendfile},
+	{"splice+pipe", xfer_splice},
+};
+
+#define NMETHODS (sizeof(g_methods) / sizeof(g_methods[0]))
+
+static uint8_t g_iobuf[IOBUFSIZE];
+static uint8_t g_rxbuf[IOBUFSIZE];
+static sem_t g_done;
+static size_t g_received;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+/* Copy through a user buffer, as an application would without sendfile() */
+
+static ssize_t xfer_readwrite(int infd, int sockfd, size_t size)
+{
+	size_t total = 0;
+	ssize_t nread;
+	ssize_t nwritten;
+	ssize_t n;
+
+	while (total < size) {
+		nread = read(infd, g_iobuf, size - total < IOBUFSIZE ? size - total : IOBUFSIZE);
+		if (nread <= 0) {
+			break;
+		}
+
+		for (nwritten = 0; nwritten < nread; nwritten += n) {
+			n = write(sockfd, g_iobuf + nwritten, nread - nwritten);
+			if (n <= 0) {
+				return ERROR;
+			}
+		}
+		total += nread;
+	}
+
+	return total;
+}
+
+static ssize_t xfer_sendfile(int infd, int sockfd, size_t size)
+{
+	off_t offset = 0;
+
+	return sendfile(sockfd, infd, &offset, size);
+}
+
+/* The linux idiom: the file is spliced into a pipe and the pipe into the
+ * socket, so the data is only ever copied into and out of the pipe ring.
+ */
+
+static ssize_t xfer_splice(int infd, int sockfd, size_t size)
+{
+	size_t total = 0;
+	ssize_t nin;
+	ssize_t nout;
+	int fds[2];
+
+	if (pipe(fds) != OK) {
+		printf("Fail to create pipe: %d\n", errno);
+		return ERROR;
+	}
+
+	while (total < size) {
+		nin = splice(infd, NULL, fds[1], NULL, size - total, 0);
+		if (nin <= 0) {
+			break;
+		}
+
+		while (nin > 0) {
+			nout = splice(fds[0], NULL, sockfd, NULL, nin, 0);
+			if (nout <= 0) {
+				close(fds[0]);
+				close(fds[1]);
+				return ERROR;
+			}
+			nin -= nout;
+			total += nout;
+		}
+	}
+
+	close(fds[0]);
+	close(fds[1]);
+	return total;
+}
+
+/* Accept one connection per method and drain it */
+
+static pthread_addr_t sink_thread(pthread_addr_t arg)
+{
+	int listenfd = (int)(intptr_t)arg;
+	size_t total;
+	ssize_t n;
+	int fd;
+	int i;
+
+	for (i = 0; i < NMETHODS; i++) {
+		fd = accept(listenfd, NULL, NULL);
+		if (fd < 0) {
+			printf("Fail to accept: %d\n", errno);
+			break;
+		}
+
+		total = 0;
+		while ((n = recv(fd, g_rxbuf, IOBUFSIZE, 0)) > 0) {
+			total += n;
+		}
+
+		close(fd);
+		g_received = total;
+		sem_post(&g_done);
+	}
+
+	return NULL;
+}
+
+static int make_file(void)
+{
+	size_t total;
+	int fd;
+	int i;
+
+	for (i = 0; i < IOBUFSIZE; i++) {
+		g_iobuf[i] = (uint8_t)i;
+	}
+
+	fd = open(FILEPATH, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	if (fd < 0) {
+		printf("Fail to create %s: %d\n", FILEPATH, errno);
+		return ERROR;
+	}
+
+	for (total = 0; total < FILESIZE; total += IOBUFSIZE) {
+		if (write(fd, g_iobuf, FILESIZE - total < IOBUFSIZE ? FILESIZE - total : IOBUFSIZE) < 0) {
+			printf("Fail to write %s: %d\n", FILEPATH, errno);
+			close(fd);
+			return ERROR;
+		}
+	}
+
+	close(fd);
+	return OK;
+}
+
+static int run_method(FAR const struct method_s *method, FAR struct sockaddr_in *addr)
+{
+	struct timespec start;
+	struct timespec end;
+	double usec;
+	ssize_t sent;
+	int sockfd;
+	int infd;
+
+	infd = open(FILEPATH, O_RDONLY);
+	if (infd < 0) {
+		printf("Fail to open %s: %d\n", FILEPATH, errno);
+		return ERROR;
+	}
+
+	sockfd = socket(AF_INET, SOCK_STREAM, 0);
+	if (sockfd < 0) {
+		printf("Fail to create socket: %d\n", errno);
+		close(infd);
+		return ERROR;
+	}
+
+	if (connect(sockfd, (FAR struct sockaddr *)addr, sizeof(*addr)) != OK) {
+		printf("Fail to connect: %d\n", errno);
+		close(sockfd);
+		close(infd);
+		return ERROR;
+	}
+
+	/* The time runs until the receiver has seen the end of the stream */
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	sent = method->xfer(infd, sockfd, FILESIZE);
+	close(sockfd);
+	sem_wait(&g_done);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	close(infd);
+
+	if (sent != FILESIZE || g_received != FILESIZE) {
+		printf("  %-12s sent %d received %d of %d bytes\n", method->name, (int)sent, (int)g_received, FILESIZE);
+		return ERROR;
+	}
+
+	usec = elapsed_usec(&start, &end);
+	printf("  %-12s %10.0f %10.1f\n", method->name, usec, FILESIZE / usec * 1000000.0 / 1024.0);
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int splice_perf_main(int argc, char *argv[])
+#endif
+{
+	struct sockaddr_in addr;
+	pthread_t sink;
+	int listenfd;
+	int ret = OK;
+	int i;
+
+	if (make_file() != OK) {
+		return ERROR;
+	}
+
+	listenfd = socket(AF_INET, SOCK_STREAM, 0);
+	if (listenfd < 0) {
+		printf("Fail to create socket: %d\n", errno);
+		unlink(FILEPATH);
+		return ERROR;
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(PORT);
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	if (bind(listenfd, (FAR struct sockaddr *)&addr, sizeof(addr)) != OK || listen(listenfd, 1) != OK) {
+		printf("Fail to listen on port %d: %d\n", PORT, errno);
+		close(listenfd);
+		unlink(FILEPATH);
+		return ERROR;
+	}
+
+	sem_init(&g_done, 0, 0);
+	if (pthread_create(&sink, NULL, sink_thread, (pthread_addr_t)(intptr_t)listenfd) != 0) {
+		printf("Fail to create the receiver\n");
+		close(listenfd);
+		unlink(FILEPATH);
+		return ERROR;
+	}
+
+	printf("Streaming %d bytes of %s to 127.0.0.1:%d\n", FILESIZE, FILEPATH, PORT);
+	printf("  %-12s %10s %10s\n", "method", "usec", "KB/s");
+
+	for (i = 0; i < NMETHODS && ret == OK; i++) {
+		ret = run_method(&g_methods[i], &addr);
+	}
+
+	/* The receiver waits for one connection per method */
+
+	if (ret != OK) {
+		pthread_cancel(sink);
+	}
+
+	pthread_join(sink, NULL);
+	sem_destroy(&g_done);
+	close(listenfd);
+	unlink(FILEPATH);
+	return ret;
+}
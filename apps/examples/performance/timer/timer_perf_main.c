@@ -0,0 +1,220 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <time.h>
+#include <unistd.h>
+
+#define DEFAULT_MAX_TIMERS 2048
+#define TIMER_SIGNO        SIGUSR1
+#define STRESS_SPREAD_MS   2000
+
+static const int g_sizes[] = {16, 256, 1024};
+
+#define NSIZES (sizeof(g_sizes) / sizeof(g_sizes[0]))
+
+static volatile int g_fired;
+
+static void timer_handler(int signo, siginfo_t *info, void *context)
+{
+	g_fired++;
+}
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+static void set_msec(struct itimerspec *spec, int msec)
+{
+	memset(spec, 0, sizeof(struct itimerspec));
+	spec->it_value.tv_sec = msec / 1000;
+	spec->it_value.tv_nsec = (msec % 1000) * 1000000;
+}
+
+static int create_timers(timer_t *timers, int count)
+{
+	struct sigevent event;
+	int i;
+
+	memset(&event, 0, sizeof(struct sigevent));
+	event.sigev_notify = SIGEV_SIGNAL;
+	event.sigev_signo = TIMER_SIGNO;
+
+	for (i = 0; i < count; i++) {
+		if (timer_create(CLOCK_REALTIME, &event, &timers[i]) != OK) {
+			printf("Fail to create timer %d\n", i);
+			while (--i >= 0) {
+				timer_delete(timers[i]);
+			}
+			return ERROR;
+		}
+	}
+
+	return OK;
+}
+
+static void delete_timers(timer_t *timers, int count)
+{
+	int i;
+
+	for (i = 0; i < count; i++) {
+		timer_delete(timers[i]);
+	}
+}
+
+/* Arm 'count' timers far in the future, re-arm them, then disarm them. Each
+ * arm inserts a watchdog among the ones already active, each re-arm cancels
+ * and inserts one, each disarm cancels one.
+ */
+
+static int bench_arm(timer_t *timers, int count)
+{
+	struct itimerspec spec;
+	struct timespec start;
+	struct timespec end;
+	double arm;
+	double rearm;
+	double disarm;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < count; i++) {
+		set_msec(&spec, 60000 + (rand() % 60000));
+		timer_settime(timers[i], 0, &spec, NULL);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	arm = elapsed_usec(&start, &end) / count;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < count; i++) {
+		set_msec(&spec, 60000 + (rand() % 60000));
+		timer_settime(timers[i], 0, &spec, NULL);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	rearm = elapsed_usec(&start, &end) / count;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < count; i++) {
+		set_msec(&spec, 0);
+		timer_settime(timers[i], 0, &spec, NULL);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	disarm = elapsed_usec(&start, &end) / count;
+
+	printf("  %6d timers %10.2f us/arm %10.2f us/rearm %10.2f us/disarm\n", count, arm, rearm, disarm);
+
+	return OK;
+}
+
+/* Let all timers expire within STRESS_SPREAD_MS and check that each fired */
+
+static int bench_stress(timer_t *timers, int count)
+{
+	struct itimerspec spec;
+	struct timespec start;
+	struct timespec end;
+	int i;
+
+	g_fired = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (i = 0; i < count; i++) {
+		set_msec(&spec, 1 + (rand() % STRESS_SPREAD_MS));
+		timer_settime(timers[i], 0, &spec, NULL);
+	}
+
+	/* Signals interrupt the sleep, wait until the spread has passed */
+
+	do {
+		usleep(100000);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+	} while (elapsed_usec(&start, &end) < (STRESS_SPREAD_MS + 500) * 1000.0);
+
+	printf("  %6d timers %10d fired\n", count, g_fired);
+
+	return g_fired == count ? OK : ERROR;
+}
+
+#ifdef CONFIG_BUILD_KERNEL
+int main(int argc, FAR char *argv[])
+#else
+int timer_perf_main(int argc, char *argv[])
+#endif
+{
+	struct sigaction act;
+	struct sigaction oact;
+	timer_t *timers;
+	int max = DEFAULT_MAX_TIMERS;
+	int ret = OK;
+	int i;
+
+	if (argc > 1) {
+		max = atoi(argv[1]);
+		if (max <= 0) {
+			printf("usage: %s [max timers]\n", argv[0]);
+			return ERROR;
+		}
+	}
+
+	timers = (timer_t *)malloc(max * sizeof(timer_t));
+	if (timers == NULL) {
+		printf("Fail to allocate %d timers\n", max);
+		return ERROR;
+	}
+
+	memset(&act, 0, sizeof(struct sigaction));
+	act.sa_sigaction = timer_handler;
+	act.sa_flags = SA_SIGINFO;
+	sigemptyset(&act.sa_mask);
+	sigaction(TIMER_SIGNO, &act, &oact);
+
+	if (create_timers(timers, max) != OK) {
+		sigaction(TIMER_SIGNO, &oact, NULL);
+		free(timers);
+		return ERROR;
+	}
+
+	printf("Watchdog Timer Performance Measurement (up to %d timers)\n", max);
+
+	printf("arm/cancel\n");
+	for (i = 0; i < NSIZES && g_sizes[i] < max; i++) {
+		bench_arm(timers, g_sizes[i]);
+	}
+	bench_arm(timers, max);
+
+	printf("stress\n");
+	ret = bench_stress(timers, max);
+	if (ret != OK) {
+		printf("Fail: %d of %d timers fired\n", g_fired, max);
+	}
+
+	delete_timers(timers, max);
+	sigaction(TIMER_SIGNO, &oact, NULL);
+	free(timers);
+
+	return ret;
+}
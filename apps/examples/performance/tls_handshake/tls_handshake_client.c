@@ -29,12 +29,22 @@
 
 #include <string.h>
 
+#ifdef CONFIG_NETUTILS_WEBSERVER
+#include <protocols/webserver/http_tls_session.h>
+#endif
+
 #define SERVER_PORT "4433"
 static char *SERVER_ADDR = NULL;
 #define GET_REQUEST "GET / HTTP/1.0\r\n\r\n"
 
 #define DEBUG_LEVEL 0
 
+#ifdef CONFIG_CLOCK_MONOTONIC
+#define HANDSHAKE_CLOCK CLOCK_MONOTONIC
+#else
+#define HANDSHAKE_CLOCK CLOCK_REALTIME
+#endif
+
 #define mbedtls_printf printf
 
 static void my_debug(void *ctx, int level,
@@ -66,67 +76,35 @@ static unsigned char rootca[] =
 
 static int rootca_len = sizeof(rootca);
 
-int tls_handshake_client(char *ipaddr)
+#ifdef CONFIG_NETUTILS_WEBSERVER
+/* Sessions kept across connections so that later handshakes can be resumed */
+static struct http_tls_session_cache_t g_sessions;
+#endif
+
+static double elapsed_msec(struct timespec *start, struct timespec *end)
 {
-	mbedtls_net_context server_fd;
-	uint32_t flags;
-	unsigned char buf[1024];
-	const char *pers = "ssl_client1";
+	return (end->tv_sec - start->tv_sec) * 1000.0 + (end->tv_nsec - start->tv_nsec) / 1000000.0;
+}
 
-	mbedtls_entropy_context entropy;
-	mbedtls_ctr_drbg_context ctr_drbg;
+static int tls_handshake_connect(mbedtls_ssl_config *conf, int verbose, double *msec, int *resumed)
+{
+	mbedtls_net_context server_fd;
 	mbedtls_ssl_context ssl;
-	mbedtls_ssl_config conf;
-	mbedtls_x509_crt cacert;
-	int ret = 1;
+	unsigned char buf[1024];
+	struct timespec start;
+	struct timespec end;
+	uint32_t flags;
+	int ret;
 	int len = 0;
-	struct timespec ts;
-	SERVER_ADDR = ipaddr;
-	ts.tv_sec = 1633074152; // 2021-10-01
-	ts.tv_nsec = 0;
-
-	clock_settime(CLOCK_REALTIME, &ts);
-
-#if defined(MBEDTLS_DEBUG_C)
-	mbedtls_debug_set_threshold(DEBUG_LEVEL);
+#ifdef CONFIG_NETUTILS_WEBSERVER
+	struct http_tls_session_stats_t before;
+	struct http_tls_session_stats_t after;
 #endif
 
-	/*
-	 * 0. Initialize the RNG and the session data
-	 */
+	*resumed = 0;
+
 	mbedtls_net_init(&server_fd);
 	mbedtls_ssl_init(&ssl);
-	mbedtls_ssl_config_init(&conf);
-	mbedtls_x509_crt_init(&cacert);
-	mbedtls_ctr_drbg_init(&ctr_drbg);
-
-	mbedtls_printf("\n	. Seeding the random number generator...");
-	fflush(stdout);
-
-	mbedtls_entropy_init(&entropy);
-	if ((ret = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, &entropy,
-									 (const unsigned char *)pers,
-									 strlen(pers))) != 0) {
-		mbedtls_printf(" failed\n	 ! mbedtls_ctr_drbg_seed returned %d\n", ret);
-		goto exit;
-	}
-
-	mbedtls_printf(" ok\n");
-
-	/*
-		 * 0. Initialize certificates
-		 */
-	mbedtls_printf("	. Loading the CA root certificate ...");
-	fflush(stdout);
-
-	ret = mbedtls_x509_crt_parse(&cacert, (const unsigned char *)rootca,
-								 rootca_len);
-	if (ret < 0) {
-		mbedtls_printf(" failed\n	 !	mbedtls_x509_crt_parse returned -0x%x\n\n", (unsigned int)-ret);
-		goto exit;
-	}
-
-	mbedtls_printf(" ok (%d skipped)\n", ret);
 
 	/*
 		 * 1. Start the connection
@@ -142,30 +120,7 @@ int tls_handshake_client(char *ipaddr)
 
 	mbedtls_printf(" ok\n");
 
-	/*
-		 * 2. Setup stuff
-		 */
-	mbedtls_printf("	. Setting up the SSL/TLS structure...");
-	fflush(stdout);
-
-	if ((ret = mbedtls_ssl_config_defaults(&conf,
-										   MBEDTLS_SSL_IS_CLIENT,
-										   MBEDTLS_SSL_TRANSPORT_STREAM,
-										   MBEDTLS_SSL_PRESET_DEFAULT)) != 0) {
-		mbedtls_printf(" failed\n	 ! mbedtls_ssl_config_defaults returned %d\n\n", ret);
-		goto exit;
-	}
-
-	mbedtls_printf(" ok\n");
-
-	/* OPTIONAL is not optimal for security,
-		 * but makes interop easier in this simplified example */
-	mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_REQUIRED);
-	mbedtls_ssl_conf_ca_chain(&conf, &cacert, NULL);
-	mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &ctr_drbg);
-	mbedtls_ssl_conf_dbg(&conf, my_debug, stdout);
-
-	if ((ret = mbedtls_ssl_setup(&ssl, &conf)) != 0) {
+	if ((ret = mbedtls_ssl_setup(&ssl, conf)) != 0) {
 		mbedtls_printf(" failed\n	 ! mbedtls_ssl_setup returned %d\n\n", ret);
 		goto exit;
 	}
@@ -178,14 +133,32 @@ int tls_handshake_client(char *ipaddr)
 	mbedtls_printf("	. Performing the SSL/TLS handshake...");
 	fflush(stdout);
 
+	clock_gettime(HANDSHAKE_CLOCK, &start);
+
+#ifdef CONFIG_NETUTILS_WEBSERVER
+	http_tls_session_get_stats(&g_sessions, &before);
+	http_tls_session_load(&g_sessions, SERVER_ADDR, &ssl);
+
+	while ((ret = http_tls_session_handshake(&g_sessions, &ssl)) != 0) {
+#else
 	while ((ret = mbedtls_ssl_handshake(&ssl)) != 0) {
+#endif
 		if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
 			mbedtls_printf(" failed\n	 ! mbedtls_ssl_handshake returned -0x%x\n\n", (unsigned int)-ret);
 			goto exit;
 		}
 	}
 
-	mbedtls_printf(" ok\n");
+	clock_gettime(HANDSHAKE_CLOCK, &end);
+	*msec = elapsed_msec(&start, &end);
+
+#ifdef CONFIG_NETUTILS_WEBSERVER
+	http_tls_session_save(&g_sessions, SERVER_ADDR, &ssl);
+	http_tls_session_get_stats(&g_sessions, &after);
+	*resumed = after.resumed_handshakes != before.resumed_handshakes;
+#endif
+
+	mbedtls_printf(" ok (%s, %.3f ms)\n", *resumed ? "resumed" : "full", *msec);
 
 	/*
 		 * 5. Verify the server certificate
@@ -250,11 +223,131 @@ int tls_handshake_client(char *ipaddr)
 		}
 
 		len = ret;
-		mbedtls_printf(" %d bytes read\n\n%s", len, (char *)buf);
+		if (verbose) {
+			mbedtls_printf(" %d bytes read\n\n%s", len, (char *)buf);
+		}
 	} while (1);
 
 	mbedtls_ssl_close_notify(&ssl);
 
+exit:
+	mbedtls_net_free(&server_fd);
+	mbedtls_ssl_free(&ssl);
+
+	return ret;
+}
+
+int tls_handshake_client(char *ipaddr, int count)
+{
+	const char *pers = "ssl_client1";
+
+	mbedtls_entropy_context entropy;
+	mbedtls_ctr_drbg_context ctr_drbg;
+	mbedtls_ssl_config conf;
+	mbedtls_x509_crt cacert;
+	int ret = 1;
+	struct timespec ts;
+	double msec;
+	double full_msec = 0;
+	double resumed_msec = 0;
+	int nfull = 0;
+	int nresumed = 0;
+	int resumed;
+	int i;
+	SERVER_ADDR = ipaddr;
+	ts.tv_sec = 1633074152; // 2021-10-01
+	ts.tv_nsec = 0;
+
+	clock_settime(CLOCK_REALTIME, &ts);
+
+#if defined(MBEDTLS_DEBUG_C)
+	mbedtls_debug_set_threshold(DEBUG_LEVEL);
+#endif
+
+	/*
+	 * 0. Initialize the RNG and the session data
+	 */
+	mbedtls_ssl_config_init(&conf);
+	mbedtls_x509_crt_init(&cacert);
+	mbedtls_ctr_drbg_init(&ctr_drbg);
+#ifdef CONFIG_NETUTILS_WEBSERVER
+	http_tls_session_cache_init(&g_sessions, 1, 0);
+#endif
+
+	mbedtls_printf("\n	. Seeding the random number generator...");
+	fflush(stdout);
+
+	mbedtls_entropy_init(&entropy);
+	if ((ret = mbedtls_ctr_drbg_seed(&ctr_drbg, mbedtls_entropy_func, &entropy,
+									 (const unsigned char *)pers,
+									 strlen(pers))) != 0) {
+		mbedtls_printf(" failed\n	 ! mbedtls_ctr_drbg_seed returned %d\n", ret);
+		goto exit;
+	}
+
+	mbedtls_printf(" ok\n");
+
+	/*
+		 * 0. Initialize certificates
+		 */
+	mbedtls_printf("	. Loading the CA root certificate ...");
+	fflush(stdout);
+
+	ret = mbedtls_x509_crt_parse(&cacert, (const unsigned char *)rootca,
+								 rootca_len);
+	if (ret < 0) {
+		mbedtls_printf(" failed\n	 !	mbedtls_x509_crt_parse returned -0x%x\n\n", (unsigned int)-ret);
+		goto exit;
+	}
+
+	mbedtls_printf(" ok (%d skipped)\n", ret);
+
+	/*
+		 * 2. Setup stuff
+		 */
+	mbedtls_printf("	. Setting up the SSL/TLS structure...");
+	fflush(stdout);
+
+	if ((ret = mbedtls_ssl_config_defaults(&conf,
+										   MBEDTLS_SSL_IS_CLIENT,
+										   MBEDTLS_SSL_TRANSPORT_STREAM,
+										   MBEDTLS_SSL_PRESET_DEFAULT)) != 0) {
+		mbedtls_printf(" failed\n	 ! mbedtls_ssl_config_defaults returned %d\n\n", ret);
+		goto exit;
+	}
+
+	mbedtls_printf(" ok\n");
+
+	/* OPTIONAL is not optimal for security,
+		 * but makes interop easier in this simplified example */
+	mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+	mbedtls_ssl_conf_ca_chain(&conf, &cacert, NULL);
+	mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &ctr_drbg);
+	mbedtls_ssl_conf_dbg(&conf, my_debug, stdout);
+
+	/* The first handshake is a full one, the following ones are resumed if the server allows */
+	for (i = 0; i < count; i++) {
+		if ((ret = tls_handshake_connect(&conf, count == 1, &msec, &resumed)) != 0) {
+			break;
+		}
+		if (resumed) {
+			resumed_msec += msec;
+			nresumed++;
+		} else {
+			full_msec += msec;
+			nfull++;
+		}
+	}
+
+	mbedtls_printf("\n	Handshakes: %d full, %d resumed (hit rate %d%%)\n",
+				   nfull, nresumed, (nfull + nresumed) ? nresumed * 100 / (nfull + nresumed) : 0);
+	if (nfull) {
+		mbedtls_printf("	Average full handshake   : %.3f ms\n", full_msec / nfull);
+	}
+	if (nresumed) {
+		mbedtls_printf("	Average resumed handshake: %.3f ms\n", resumed_msec / nresumed);
+	}
+
 exit:
 
 #ifdef MBEDTLS_ERROR_C
@@ -265,10 +358,10 @@ exit:
 	}
 #endif
 
-	mbedtls_net_free(&server_fd);
-
+#ifdef CONFIG_NETUTILS_WEBSERVER
+	http_tls_session_cache_free(&g_sessions);
+#endif
 	mbedtls_x509_crt_free(&cacert);
-	mbedtls_ssl_free(&ssl);
 	mbedtls_ssl_config_free(&conf);
 	mbedtls_ctr_drbg_free(&ctr_drbg);
 	mbedtls_entropy_free(&entropy);
@@ -25,16 +25,20 @@
 #include "tls_handshake_usage.h"
 
 extern int tls_handshake_server(void);
-extern int tls_handshake_client(char *ipaddr);
+extern int tls_handshake_client(char *ipaddr, int count);
 
 int tls_handshake_main(int argc, char **argv)
 {
 	if (argc == 2 && !strncmp("-s", argv[1], 3)) {
 		tls_handshake_server();
 		return 0;
-	} else if (argc == 3 && !strncmp("-c", argv[1], 3)) {
-		tls_handshake_client(argv[2]);
-		return 0;
+	} else if ((argc == 3 || argc == 4) && !strncmp("-c", argv[1], 3)) {
+		int count = (argc == 4) ? atoi(argv[3]) : 1;
+
+		if (count > 0) {
+			tls_handshake_client(argv[2], count);
+			return 0;
+		}
 	}
 
 	printf("%s\n", TLS_HANDSHAKE_USAGE);
@@ -87,7 +87,9 @@ int main(void)
 #include "mbedtls/error.h"
 #include "mbedtls/debug.h"
 
-#if defined(MBEDTLS_SSL_CACHE_C)
+#if defined(CONFIG_NETUTILS_WEBSERVER)
+#include <protocols/webserver/http_tls_session.h>
+#elif defined(MBEDTLS_SSL_CACHE_C)
 #include "mbedtls/ssl_cache.h"
 #endif
 
@@ -184,7 +186,10 @@ int tls_handshake_server(void)
 	mbedtls_ssl_config conf;
 	mbedtls_x509_crt srvcert;
 	mbedtls_pk_context pkey;
-#if defined(MBEDTLS_SSL_CACHE_C)
+#if defined(CONFIG_NETUTILS_WEBSERVER)
+	struct http_tls_session_cache_t cache;
+	struct http_tls_session_stats_t stats;
+#elif defined(MBEDTLS_SSL_CACHE_C)
 	mbedtls_ssl_cache_context cache;
 #endif
 
@@ -192,7 +197,9 @@ int tls_handshake_server(void)
 	mbedtls_net_init(&client_fd);
 	mbedtls_ssl_init(&ssl);
 	mbedtls_ssl_config_init(&conf);
-#if defined(MBEDTLS_SSL_CACHE_C)
+#if defined(CONFIG_NETUTILS_WEBSERVER)
+	http_tls_session_cache_init(&cache, HTTP_TLS_SESSION_CACHE_SIZE, HTTP_TLS_SESSION_TIMEOUT);
+#elif defined(MBEDTLS_SSL_CACHE_C)
 	mbedtls_ssl_cache_init(&cache);
 #endif
 	mbedtls_x509_crt_init(&srvcert);
@@ -290,7 +297,14 @@ int tls_handshake_server(void)
 	mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &ctr_drbg);
 	mbedtls_ssl_conf_dbg(&conf, my_debug, stdout);
 
-#if defined(MBEDTLS_SSL_CACHE_C)
+#if defined(CONFIG_NETUTILS_WEBSERVER)
+	/* Resume by session id and by session tickets */
+	if (http_tls_session_cache_conf(&cache, &conf, mbedtls_ctr_drbg_random, &ctr_drbg) != 0) {
+		mbedtls_printf(" failed\n  ! http_tls_session_cache_conf failed\n\n");
+		ret = -1;
+		goto exit;
+	}
+#elif defined(MBEDTLS_SSL_CACHE_C)
 	mbedtls_ssl_conf_session_cache(&conf, &cache,
 								   mbedtls_ssl_cache_get,
 								   mbedtls_ssl_cache_set);
@@ -352,7 +366,11 @@ reset:
 	mbedtls_printf("  . Performing the SSL/TLS handshake...");
 	fflush(stdout);
 
+#if defined(CONFIG_NETUTILS_WEBSERVER)
+	while ((ret = http_tls_session_handshake(&cache, &ssl)) != 0) {
+#else
 	while ((ret = mbedtls_ssl_handshake(&ssl)) != 0) {
+#endif
 		if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
 			mbedtls_printf(" failed\n  ! mbedtls_ssl_handshake returned %d\n\n", ret);
 			goto reset;
@@ -361,6 +379,13 @@ reset:
 
 	mbedtls_printf(" ok\n");
 
+#if defined(CONFIG_NETUTILS_WEBSERVER)
+	http_tls_session_get_stats(&cache, &stats);
+	mbedtls_printf("  . Handshakes: %u full, %u resumed, cache hits %u/%u, tickets issued %u accepted %u\n",
+				   stats.full_handshakes, stats.resumed_handshakes, stats.hits, stats.lookups,
+				   stats.tickets_issued, stats.tickets_accepted);
+#endif
+
 	/*
      * 6. Read the HTTP Request
      */
@@ -479,7 +504,9 @@ exit:
 	mbedtls_pk_free(&pkey);
 	mbedtls_ssl_free(&ssl);
 	mbedtls_ssl_config_free(&conf);
-#if defined(MBEDTLS_SSL_CACHE_C)
+#if defined(CONFIG_NETUTILS_WEBSERVER)
+	http_tls_session_cache_free(&cache);
+#elif defined(MBEDTLS_SSL_CACHE_C)
 	mbedtls_ssl_cache_free(&cache);
 #endif
 	mbedtls_ctr_drbg_free(&ctr_drbg);
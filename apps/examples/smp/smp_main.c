@@ -60,6 +60,17 @@
 #define CPU_ZERO(s) do { *(s) = 0; } while (0)
 #define CPU_SET(c,s) do { *(s) |= (1 << (c)); } while (0)
 
+/****************************************************************************
+ * External Function Prototypes
+ ****************************************************************************/
+
+#ifdef CONFIG_TESTING_SMP_MUTEX_BENCH
+int smp_mutex_bench(int argc, FAR char *argv[]);
+#endif
+#ifdef CONFIG_TESTING_SMP_RWLOCK_BENCH
+int smp_rwlock_bench(int argc, FAR char *argv[]);
+#endif
+
 /****************************************************************************
  * Private Data
  ****************************************************************************/
@@ -421,6 +432,16 @@ int smp_main_task(int argc, FAR char *argv[])
 
 int smp_main(int argc, FAR char *argv[])
 {
+#ifdef CONFIG_TESTING_SMP_MUTEX_BENCH
+	if (argc > 1 && strcmp(argv[1], "mutex") == 0) {
+		return smp_mutex_bench(argc, argv);
+	}
+#endif
+#ifdef CONFIG_TESTING_SMP_RWLOCK_BENCH
+	if (argc > 1 && strcmp(argv[1], "rwlock") == 0) {
+		return smp_rwlock_bench(argc, argv);
+	}
+#endif
 #ifdef CONFIG_SMP_TEST_PTHREAD
 	smp_main_prthread(argc, argv);
 #else
@@ -0,0 +1,187 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define MUTEX_DEFAULT_LOOPS 10000
+
+/* Work done while holding the mutex, a short critical section is where
+ * spinning pays off.
+ */
+
+#define MUTEX_HOLD_WORK     32
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct mutex_bench_s {
+	pthread_mutex_t mutex;
+	volatile uint32_t counter;
+	int loops;
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+static pthread_addr_t mutex_thread(pthread_addr_t arg)
+{
+	struct mutex_bench_s *bench = (struct mutex_bench_s *)arg;
+	volatile int work;
+	int i;
+	int j;
+
+	for (i = 0; i < bench->loops; i++) {
+		pthread_mutex_lock(&bench->mutex);
+		for (j = 0, work = 0; j < MUTEX_HOLD_WORK; j++) {
+			work += j;
+		}
+		bench->counter++;
+		pthread_mutex_unlock(&bench->mutex);
+	}
+
+	return NULL;
+}
+
+static int mutex_run(const char *name, int type, int loops)
+{
+	pthread_t threads[CONFIG_SMP_NCPUS];
+	struct mutex_bench_s bench;
+	pthread_mutexattr_t mattr;
+	pthread_attr_t attr;
+	struct timespec start;
+	struct timespec end;
+	cpu_set_t cpuset;
+	uint32_t expected;
+	double usec;
+	int nthreads;
+	int ret;
+	int i;
+
+	pthread_mutexattr_init(&mattr);
+	ret = pthread_mutexattr_settype(&mattr, type);
+	if (ret != OK) {
+		printf("  %-9s unsupported mutex type: %d\n", name, ret);
+		return ERROR;
+	}
+
+	ret = pthread_mutex_init(&bench.mutex, &mattr);
+	pthread_mutexattr_destroy(&mattr);
+	if (ret != OK) {
+		printf("  %-9s pthread_mutex_init failed: %d\n", name, ret);
+		return ERROR;
+	}
+
+	bench.counter = 0;
+	bench.loops = loops;
+
+	/* One contender pinned to each CPU */
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (nthreads = 0; nthreads < CONFIG_SMP_NCPUS; nthreads++) {
+		pthread_attr_init(&attr);
+		ret = pthread_create(&threads[nthreads], &attr, mutex_thread, &bench);
+		pthread_attr_destroy(&attr);
+		if (ret != OK) {
+			printf("  %-9s pthread_create failed: %d\n", name, ret);
+			break;
+		}
+
+		CPU_ZERO(&cpuset);
+		CPU_SET(nthreads, &cpuset);
+		pthread_setaffinity_np(threads[nthreads], sizeof(cpu_set_t), &cpuset);
+	}
+
+	for (i = 0; i < nthreads; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	pthread_mutex_destroy(&bench.mutex);
+
+	expected = (uint32_t)nthreads * loops;
+	usec = elapsed_usec(&start, &end);
+	printf("  %-9s %2d threads %10.2f us %12.0f lock/s", name, nthreads, usec, usec > 0 ? expected * 1000000.0 / usec : 0.0);
+	if (bench.counter != expected) {
+		printf(" (counter %u, expected %u)\n", (unsigned int)bench.counter, (unsigned int)expected);
+		return ERROR;
+	}
+	printf("\n");
+
+	return ret == OK ? OK : ERROR;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * smp_mutex_bench
+ *
+ * Description:
+ *   Measure the throughput of a contended mutex with one thread per CPU,
+ *   comparing a normal sleeping mutex with an adaptive one.
+ *
+ ****************************************************************************/
+
+int smp_mutex_bench(int argc, FAR char *argv[])
+{
+	int loops = MUTEX_DEFAULT_LOOPS;
+	int ret;
+
+	if (argc > 2) {
+		loops = atoi(argv[2]);
+		if (loops <= 0) {
+			printf("usage: %s mutex [loops]\n", argv[0]);
+			return ERROR;
+		}
+	}
+
+	printf("Mutex contention (%d CPUs, %d lock/unlock per thread)\n", CONFIG_SMP_NCPUS, loops);
+
+	ret = mutex_run("normal", PTHREAD_MUTEX_NORMAL, loops);
+#ifdef PTHREAD_MUTEX_ADAPTIVE_NP
+	if (ret == OK) {
+		ret = mutex_run("adaptive", PTHREAD_MUTEX_ADAPTIVE_NP, loops);
+	}
+#else
+	printf("  adaptive  not configured, enable CONFIG_PTHREAD_MUTEX_ADAPTIVE\n");
+#endif
+
+	return ret;
+}
@@ -0,0 +1,185 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define RWLOCK_DEFAULT_LOOPS 10000
+
+/* One write for every RWLOCK_WRITE_RATIO reads in the mixed run */
+
+#define RWLOCK_WRITE_RATIO   64
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct rwlock_bench_s {
+	pthread_rwlock_t lock;
+	volatile uint32_t value;
+	volatile uint32_t writes;
+	int loops;
+	bool mixed;
+	int errors;
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static double elapsed_usec(struct timespec *start, struct timespec *end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000.0 + (end->tv_nsec - start->tv_nsec) / 1000.0;
+}
+
+static pthread_addr_t rwlock_thread(pthread_addr_t arg)
+{
+	struct rwlock_bench_s *bench = (struct rwlock_bench_s *)arg;
+	uint32_t value;
+	int i;
+
+	for (i = 0; i < bench->loops; i++) {
+		if (bench->mixed && (i % RWLOCK_WRITE_RATIO) == 0) {
+			pthread_rwlock_wrlock(&bench->lock);
+			bench->value++;
+			bench->writes++;
+			pthread_rwlock_unlock(&bench->lock);
+			continue;
+		}
+
+		/* A writer never leaves 'value' and 'writes' apart */
+
+		pthread_rwlock_rdlock(&bench->lock);
+		value = bench->value;
+		if (value != bench->writes) {
+			bench->errors++;
+		}
+		pthread_rwlock_unlock(&bench->lock);
+	}
+
+	return NULL;
+}
+
+static int rwlock_run(int nthreads, int loops, bool mixed)
+{
+	pthread_t threads[CONFIG_SMP_NCPUS];
+	struct rwlock_bench_s bench;
+	struct timespec start;
+	struct timespec end;
+	cpu_set_t cpuset;
+	double usec;
+	int created;
+	int ret = OK;
+	int i;
+
+	ret = pthread_rwlock_init(&bench.lock, NULL);
+	if (ret != OK) {
+		printf("  pthread_rwlock_init failed: %d\n", ret);
+		return ERROR;
+	}
+
+	bench.value = 0;
+	bench.writes = 0;
+	bench.loops = loops;
+	bench.mixed = mixed;
+	bench.errors = 0;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (created = 0; created < nthreads; created++) {
+		ret = pthread_create(&threads[created], NULL, rwlock_thread, &bench);
+		if (ret != OK) {
+			printf("  pthread_create failed: %d\n", ret);
+			break;
+		}
+
+		CPU_ZERO(&cpuset);
+		CPU_SET(created, &cpuset);
+		pthread_setaffinity_np(threads[created], sizeof(cpu_set_t), &cpuset);
+	}
+
+	for (i = 0; i < created; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	pthread_rwlock_destroy(&bench.lock);
+
+	usec = elapsed_usec(&start, &end);
+	printf("  %-6s %2d threads %10.2f us %12.0f lock/s", mixed ? "mixed" : "read", created, usec, usec > 0 ? (double)created * loops * 1000000.0 / usec : 0.0);
+	if (bench.errors > 0) {
+		printf(" (%d inconsistent reads)\n", bench.errors);
+		return ERROR;
+	}
+	printf("\n");
+
+	return ret == OK ? OK : ERROR;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * smp_rwlock_bench
+ *
+ * Description:
+ *   Measure how the read lock throughput of a read/write lock scales with
+ *   the number of CPUs, with only readers and with an occasional writer.
+ *
+ ****************************************************************************/
+
+int smp_rwlock_bench(int argc, FAR char *argv[])
+{
+	int loops = RWLOCK_DEFAULT_LOOPS;
+	int nthreads;
+	int ret = OK;
+
+	if (argc > 2) {
+		loops = atoi(argv[2]);
+		if (loops <= 0) {
+			printf("usage: %s rwlock [loops]\n", argv[0]);
+			return ERROR;
+		}
+	}
+
+	printf("Read/write lock scaling (%d CPUs, %d locks per thread)\n", CONFIG_SMP_NCPUS, loops);
+
+	for (nthreads = 1; nthreads <= CONFIG_SMP_NCPUS && ret == OK; nthreads++) {
+		ret = rwlock_run(nthreads, loops, false);
+	}
+
+	for (nthreads = 1; nthreads <= CONFIG_SMP_NCPUS && ret == OK; nthreads++) {
+		ret = rwlock_run(nthreads, loops, true);
+	}
+
+	return ret;
+}
@@ -88,16 +88,14 @@ static void itc_libc_pthread_pthread_rwlock_init_destroy_p_multitime(void)
 	int status;
 	int exec_index;
 	pthread_rwlock_t rw_lock;
-	rw_lock.num_readers = NUM_READER;
-	rw_lock.num_writers = NUM_WRITER;
-	rw_lock.write_in_progress = true;
+	rw_lock.state = NUM_READER;
+	rw_lock.writer = NUM_WRITER;
 
 	for (exec_index = 0; exec_index < LOOP_SIZE; exec_index++) {
 		status = pthread_rwlock_init(&rw_lock, NULL);
 		TC_ASSERT_EQ("pthread_rwlock_init", status, OK);
-		TC_ASSERT_EQ("pthread_rwlock_init", rw_lock.num_readers, 0);
-		TC_ASSERT_EQ("pthread_rwlock_init", rw_lock.num_writers, 0);
-		TC_ASSERT_EQ("pthread_rwlock_init", rw_lock.write_in_progress, false);
+		TC_ASSERT_EQ("pthread_rwlock_init", rw_lock.state, 0);
+		TC_ASSERT_EQ("pthread_rwlock_init", rw_lock.writer, -1);
 
 		status = pthread_rwlock_destroy(&rw_lock);
 		TC_ASSERT_EQ("pthread_rwlock_destroy", status, OK);
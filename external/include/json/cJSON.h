@@ -116,6 +116,50 @@ typedef struct cJSON_Hooks
 
 typedef int cJSON_bool;
 
+/* Arena for cJSON_ParseInArena: items and strings are carved out of one block
+ * and released together by cJSON_ResetArena/cJSON_FreeArena.
+ * Members are private, initialize with cJSON_InitArena. */
+typedef struct cJSON_Arena
+{
+    unsigned char *buffer;
+    size_t size;
+    unsigned char *current;
+    unsigned char *end;
+    void *overflow; /* blocks allocated when the first one is exhausted */
+    cJSON_bool owned;
+} cJSON_Arena;
+
+/* Callbacks of cJSON_ParseSax. Any of them may be NULL, returning false aborts the parse.
+ * Strings and keys are not zero terminated and are only valid during the call. */
+typedef struct cJSON_SaxHandler
+{
+    cJSON_bool (*null_fn)(void *context);
+    cJSON_bool (*bool_fn)(void *context, cJSON_bool boolean);
+    cJSON_bool (*number_fn)(void *context, double number);
+    cJSON_bool (*string_fn)(void *context, const char *string, size_t length);
+    cJSON_bool (*key_fn)(void *context, const char *key, size_t length);
+    cJSON_bool (*start_object_fn)(void *context);
+    cJSON_bool (*end_object_fn)(void *context);
+    cJSON_bool (*start_array_fn)(void *context);
+    cJSON_bool (*end_array_fn)(void *context);
+} cJSON_SaxHandler;
+
+/* Limits how deeply nested arrays/objects can be written with cJSON_Writer */
+#define CJSON_WRITER_NESTING_LIMIT 32
+
+/* Writer state for the cJSON_Write* functions. Members are private, initialize with cJSON_InitWriter. */
+typedef struct cJSON_Writer
+{
+    unsigned char *buffer;
+    size_t length;
+    size_t offset;
+    size_t depth;
+    unsigned long has_items; /* bit per depth: a value was written at that level */
+    unsigned long is_object; /* bit per depth: that level is an object */
+    cJSON_bool expect_value;
+    cJSON_bool failed;
+} cJSON_Writer;
+
 #if !defined(__WINDOWS__) && (defined(WIN32) || defined(WIN64) || defined(_MSC_VER) || defined(_WIN32))
 #define __WINDOWS__
 #endif
@@ -295,6 +339,38 @@ CJSON_PUBLIC(double) cJSON_SetNumberHelper(cJSON *object, double number);
 CJSON_PUBLIC(void *) cJSON_malloc(size_t size);
 CJSON_PUBLIC(void) cJSON_free(void *object);
 
+/* Arena mode: parse into items allocated from an arena instead of one heap block per item.
+ * If buffer is NULL, a block of size bytes is allocated with the cJSON hooks.
+ * Never call cJSON_Delete on a tree parsed into an arena, reset or free the arena instead. */
+CJSON_PUBLIC(cJSON_bool) cJSON_InitArena(cJSON_Arena *arena, void *buffer, size_t size);
+CJSON_PUBLIC(cJSON *) cJSON_ParseInArena(const char *value, cJSON_Arena *arena);
+CJSON_PUBLIC(cJSON *) cJSON_ParseInArenaWithOpts(const char *value, cJSON_Arena *arena, const char **return_parse_end, cJSON_bool require_null_terminated);
+/* Release all trees parsed into the arena, keeping the first block for reuse */
+CJSON_PUBLIC(void) cJSON_ResetArena(cJSON_Arena *arena);
+CJSON_PUBLIC(void) cJSON_FreeArena(cJSON_Arena *arena);
+
+/* Streaming reader: parse length bytes of value and report each element to handler without building a tree.
+ * Only strings with escape sequences are copied. On failure, cJSON_GetErrorPtr points at the error. */
+CJSON_PUBLIC(cJSON_bool) cJSON_ParseSax(const char *value, size_t length, const cJSON_SaxHandler *handler, void *context);
+
+/* Direct-to-buffer writer: print JSON into buffer without building a tree.
+ * Inside objects, every value is preceded by cJSON_WriteKey. Once a call fails,
+ * the following calls fail too. cJSON_FinishWriter returns the printed length,
+ * or -1 if the buffer was too small or the document is incomplete. */
+CJSON_PUBLIC(void) cJSON_InitWriter(cJSON_Writer *writer, char *buffer, size_t length);
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteStartObject(cJSON_Writer *writer);
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteEndObject(cJSON_Writer *writer);
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteStartArray(cJSON_Writer *writer);
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteEndArray(cJSON_Writer *writer);
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteKey(cJSON_Writer *writer, const char *key);
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteString(cJSON_Writer *writer, const char *string);
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteNumber(cJSON_Writer *writer, double number);
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteBool(cJSON_Writer *writer, cJSON_bool boolean);
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteNull(cJSON_Writer *writer);
+/* Print an existing item (and its children) as the next value */
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteItem(cJSON_Writer *writer, const cJSON *item);
+CJSON_PUBLIC(int) cJSON_FinishWriter(cJSON_Writer *writer);
+
 #ifdef __cplusplus
 // *INDENT-OFF*
 }
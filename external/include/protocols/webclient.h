@@ -51,6 +51,7 @@
 #include "mbedtls/error.h"
 #include "mbedtls/debug.h"
 #include "mbedtls/ssl_cache.h"
+#include <protocols/webserver/http_tls_session.h>
 #endif
 
 #include <protocols/webserver/http_keyvalue_list.h>
@@ -217,6 +218,20 @@ int http_client_response_init(struct http_client_response_t *response);
 
 void http_client_response_release(struct http_client_response_t *response);
 
+#ifdef CONFIG_NET_SECURITY_TLS
+/**
+ * @brief http_client_get_tls_session_stats() reads the session resumption
+ *                                            counters of the webclient.
+ *
+ * @param[out] stats a structure pointer to be filled with the counters.
+ * @return On success, OK(0) is returned.
+ *         On failure, negative value is returned.
+ * @since TizenRT v5.0
+ */
+
+int http_client_get_tls_session_stats(struct http_tls_session_stats_t *stats);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -0,0 +1,187 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/**
+ * @addtogroup HTTP_SERVER
+ * @{
+ */
+
+/**
+ * @file protocols/webserver/http_parser.h
+ * @brief Incremental HTTP request parser working on receive buffer slices.
+ */
+
+#ifndef __http_parser_h__
+#define __http_parser_h__
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <protocols/webserver/http_server.h>
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/**
+ * @brief Interned ids of the header names the webserver looks at.
+ *        Any other header is reported as HTTP_HEADER_UNKNOWN.
+ */
+enum http_header_id_e {
+	HTTP_HEADER_UNKNOWN = 0,
+	HTTP_HEADER_ACCEPT,
+	HTTP_HEADER_ACCEPT_ENCODING,
+	HTTP_HEADER_AUTHORIZATION,
+	HTTP_HEADER_CACHE_CONTROL,
+	HTTP_HEADER_CONNECTION,
+	HTTP_HEADER_CONTENT_LENGTH,
+	HTTP_HEADER_CONTENT_TYPE,
+	HTTP_HEADER_HOST,
+	HTTP_HEADER_KEEP_ALIVE,
+	HTTP_HEADER_SEC_WEBSOCKET_KEY,
+	HTTP_HEADER_SEC_WEBSOCKET_VERSION,
+	HTTP_HEADER_TRAILER,
+	HTTP_HEADER_TRANSFER_ENCODING,
+	HTTP_HEADER_UPGRADE,
+	HTTP_HEADER_USER_AGENT,
+	HTTP_HEADER_MAX
+};
+
+/**
+ * @brief Parser states. A message is complete in HTTP_PARSER_DONE.
+ */
+enum http_parser_state_e {
+	HTTP_PARSER_REQUEST_LINE,
+	HTTP_PARSER_HEADER,
+	HTTP_PARSER_BODY,
+	HTTP_PARSER_CHUNK_SIZE,
+	HTTP_PARSER_CHUNK_DATA,
+	HTTP_PARSER_CHUNK_END,
+	HTTP_PARSER_TRAILER,
+	HTTP_PARSER_DONE,
+	HTTP_PARSER_ERROR
+};
+
+/**
+ * @brief A read-only view into the buffer given to http_parser_execute().
+ *        It is not NUL terminated and is valid only during the callback.
+ */
+struct http_slice_t {
+	const char *ptr;
+	int len;
+};
+
+struct http_parser_t;
+
+/**
+ * @brief Parser callbacks. Any of them may be NULL.
+ *        Returning HTTP_ERROR from a callback aborts the parse.
+ */
+struct http_parser_cb_t {
+	int (*on_request_line)(struct http_parser_t *parser, const struct http_slice_t *url);
+	int (*on_header)(struct http_parser_t *parser, int id, const struct http_slice_t *name, const struct http_slice_t *value);
+	int (*on_headers_complete)(struct http_parser_t *parser);
+	int (*on_body)(struct http_parser_t *parser, const struct http_slice_t *data);
+	int (*on_message_complete)(struct http_parser_t *parser);
+};
+
+/**
+ * @brief Incremental HTTP request parser state.
+ */
+struct http_parser_t {
+	int state;
+	int method;
+	int httpver;
+	int encoding;
+	uint32_t content_len;
+	bool has_content_len;
+	uint32_t remaining;
+	const struct http_parser_cb_t *cb;
+	void *priv;
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/**
+ * @brief http_parser_init() resets the parser for a new request.
+ *
+ * @param[in] parser the parser to be initialized.
+ * @param[in] cb callbacks to be invoked while parsing.
+ * @param[in] priv user data, available as parser->priv in callbacks.
+ * @return none
+ */
+void  http_parser_init(struct http_parser_t *parser, const struct http_parser_cb_t *cb, void *priv);
+
+/**
+ * @brief http_parser_execute() parses as much of buf as possible.
+ *        Incomplete lines are left unconsumed; the caller keeps them and
+ *        calls again with the same bytes followed by newly received data.
+ *        Body data is passed to on_body as soon as it is available.
+ *
+ * @param[in] parser the parser initialized by http_parser_init().
+ * @param[in] buf received data.
+ * @param[in] len length of buf.
+ * @return On success, the number of bytes consumed is returned.
+ *         On failure, HTTP_ERROR(-1) is returned.
+ */
+int   http_parser_execute(struct http_parser_t *parser, const char *buf, int len);
+
+/**
+ * @brief http_header_intern() maps a header name to its interned id.
+ *
+ * @param[in] name header name, not necessarily NUL terminated.
+ * @param[in] len length of name.
+ * @return the id of the header, HTTP_HEADER_UNKNOWN if it is not interned.
+ */
+int   http_header_intern(const char *name, int len);
+
+/**
+ * @brief http_header_name() returns the canonical name of an interned id.
+ *
+ * @param[in] id a value of enum http_header_id_e.
+ * @return the header name, NULL for HTTP_HEADER_UNKNOWN or invalid ids.
+ */
+const char *http_header_name(int id);
+
+/**
+ * @brief http_slice_equal() compares a slice with a string, ignoring case.
+ *
+ * @param[in] slice the slice to compare.
+ * @param[in] str NUL terminated string.
+ * @return true if they are equal, false otherwise.
+ */
+bool  http_slice_equal(const struct http_slice_t *slice, const char *str);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/** @} */
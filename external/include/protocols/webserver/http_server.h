@@ -63,6 +63,7 @@
 #include "mbedtls/error.h"
 #include "mbedtls/debug.h"
 #include "mbedtls/ssl_cache.h"
+#include <protocols/webserver/http_tls_session.h>
 #endif
 
 /****************************************************************************
@@ -192,7 +193,7 @@ struct http_server_t {
 	mbedtls_ctr_drbg_context  tls_ctr_drbg;
 	mbedtls_x509_crt          tls_srvcert;
 	mbedtls_pk_context        tls_pkey;
-	mbedtls_ssl_cache_context tls_cache;
+	struct http_tls_session_cache_t tls_cache;
 	mbedtls_net_context       tls_ctx;
 #endif
 
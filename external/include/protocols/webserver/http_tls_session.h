@@ -0,0 +1,203 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/**
+ * @addtogroup HTTP_SERVER
+ * @{
+ */
+
+/**
+ * @file protocols/webserver/http_tls_session.h
+ * @brief TLS session resumption cache shared by the webserver and webclient.
+ */
+
+#ifndef __http_tls_session_h__
+#define __http_tls_session_h__
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <stdint.h>
+#include <pthread.h>
+#include <queue.h>
+
+#include "mbedtls/ssl.h"
+#if defined(MBEDTLS_SSL_TICKET_C)
+#include "mbedtls/ssl_ticket.h"
+#endif
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifdef CONFIG_NETUTILS_TLS_SESSION_CACHE_SIZE
+#define HTTP_TLS_SESSION_CACHE_SIZE     CONFIG_NETUTILS_TLS_SESSION_CACHE_SIZE
+#else
+#define HTTP_TLS_SESSION_CACHE_SIZE     4
+#endif
+
+#ifdef CONFIG_NETUTILS_TLS_SESSION_TIMEOUT
+#define HTTP_TLS_SESSION_TIMEOUT        CONFIG_NETUTILS_TLS_SESSION_TIMEOUT
+#else
+#define HTTP_TLS_SESSION_TIMEOUT        86400
+#endif
+
+#define HTTP_TLS_SESSION_CACHE_INITIALIZER(max, timeout) \
+	{PTHREAD_MUTEX_INITIALIZER, {NULL, NULL}, 0, (max), (timeout), {0, }}
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/**
+ * @brief Session resumption counters.
+ */
+struct http_tls_session_stats_t {
+	uint32_t lookups;
+	uint32_t hits;
+	uint32_t stores;
+	uint32_t evictions;
+	uint32_t expired;
+	uint32_t tickets_issued;
+	uint32_t tickets_accepted;
+	uint32_t full_handshakes;
+	uint32_t resumed_handshakes;
+};
+
+/**
+ * @brief Bounded LRU cache of serialized TLS sessions.
+ *        Servers key entries by session id, clients by peer name.
+ */
+struct http_tls_session_cache_t {
+	pthread_mutex_t lock;
+	dq_queue_t lru;
+	int nentries;
+	int max_entries;
+	int timeout;
+	struct http_tls_session_stats_t stats;
+#if defined(MBEDTLS_SSL_TICKET_C)
+	mbedtls_ssl_ticket_context ticket;
+	int ticket_init;
+#endif
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/**
+ * @brief http_tls_session_cache_init() initializes an empty cache.
+ *
+ * @param[in] cache the cache to be initialized.
+ * @param[in] max_entries maximum number of sessions kept, older ones are evicted.
+ * @param[in] timeout lifetime of a session in seconds, 0 for no expiry.
+ * @return none
+ */
+void http_tls_session_cache_init(struct http_tls_session_cache_t *cache, int max_entries, int timeout);
+
+/**
+ * @brief http_tls_session_cache_free() frees all sessions and ticket keys.
+ *
+ * @param[in] cache the cache to be freed.
+ * @return none
+ */
+void http_tls_session_cache_free(struct http_tls_session_cache_t *cache);
+
+/**
+ * @brief http_tls_session_cache_conf() makes a server configuration resume
+ *        sessions from cache, by session id and, if enabled, by RFC 5077
+ *        session tickets.
+ *
+ * @param[in] cache the cache used by the server.
+ * @param[in] conf server side mbedtls configuration.
+ * @param[in] f_rng RNG function used to generate ticket keys.
+ * @param[in] p_rng RNG context.
+ * @return On success, HTTP_OK(0) is returned.
+ *         On failure, HTTP_ERROR(-1) is returned.
+ */
+int  http_tls_session_cache_conf(struct http_tls_session_cache_t *cache, mbedtls_ssl_config *conf,
+								 int (*f_rng)(void *, unsigned char *, size_t), void *p_rng);
+
+/**
+ * @brief http_tls_session_cache_get() is the mbedtls session cache get callback.
+ */
+int  http_tls_session_cache_get(void *data, unsigned char const *session_id,
+								size_t session_id_len, mbedtls_ssl_session *session);
+
+/**
+ * @brief http_tls_session_cache_set() is the mbedtls session cache set callback.
+ */
+int  http_tls_session_cache_set(void *data, unsigned char const *session_id,
+								size_t session_id_len, const mbedtls_ssl_session *session);
+
+/**
+ * @brief http_tls_session_load() offers a cached session to a client context
+ *        before the handshake.
+ *
+ * @param[in] cache the client side cache.
+ * @param[in] key peer identifier such as "host:port".
+ * @param[in] ssl client context set up by mbedtls_ssl_setup().
+ * @return HTTP_OK(0) if a session is offered, HTTP_ERROR(-1) otherwise.
+ */
+int  http_tls_session_load(struct http_tls_session_cache_t *cache, const char *key, mbedtls_ssl_context *ssl);
+
+/**
+ * @brief http_tls_session_save() stores the session of a client context
+ *        after a successful handshake.
+ *
+ * @param[in] cache the client side cache.
+ * @param[in] key peer identifier such as "host:port".
+ * @param[in] ssl client context which finished the handshake.
+ * @return On success, HTTP_OK(0) is returned.
+ *         On failure, HTTP_ERROR(-1) is returned.
+ */
+int  http_tls_session_save(struct http_tls_session_cache_t *cache, const char *key, mbedtls_ssl_context *ssl);
+
+/**
+ * @brief http_tls_session_handshake() performs the handshake like
+ *        mbedtls_ssl_handshake() and counts full and resumed handshakes.
+ *
+ * @param[in] cache the cache to account the handshake to, may be NULL.
+ * @param[in] ssl the context to perform the handshake on.
+ * @return the return value of mbedtls_ssl_handshake().
+ */
+int  http_tls_session_handshake(struct http_tls_session_cache_t *cache, mbedtls_ssl_context *ssl);
+
+/**
+ * @brief http_tls_session_get_stats() copies the counters of a cache.
+ *
+ * @param[in] cache the cache to read.
+ * @param[out] stats counters of the cache.
+ * @return none
+ */
+void http_tls_session_get_stats(struct http_tls_session_cache_t *cache, struct http_tls_session_stats_t *stats);
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/** @} */
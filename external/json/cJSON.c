@@ -125,9 +125,68 @@ typedef struct internal_hooks
     void *(*allocate)(size_t size);
     void (*deallocate)(void *pointer);
     void *(*reallocate)(void *pointer, size_t size);
+    cJSON_Arena *arena; /* if set, parsed items are carved out of the arena and never freed one by one */
 } internal_hooks;
 
-static internal_hooks global_hooks = { malloc, free, realloc };
+static internal_hooks global_hooks = { malloc, free, realloc, NULL };
+
+/* arena blocks are handed out aligned for the double in cJSON */
+#define CJSON_ARENA_ALIGNMENT sizeof(double)
+#define arena_align(pointer) ((unsigned char*)((((size_t)(pointer)) + (CJSON_ARENA_ALIGNMENT - 1)) & ~(size_t)(CJSON_ARENA_ALIGNMENT - 1)))
+
+/* extra blocks are chained in front of their data when the first block is exhausted */
+typedef struct arena_block
+{
+    struct arena_block *next;
+    double align;
+} arena_block;
+
+static void *arena_allocate(cJSON_Arena * const arena, size_t size)
+{
+    unsigned char *pointer = arena_align(arena->current);
+    arena_block *block = NULL;
+    size_t block_size = 0;
+
+    if ((pointer != NULL) && (pointer <= arena->end) && (size <= (size_t)(arena->end - pointer)))
+    {
+        arena->current = pointer + size;
+        return pointer;
+    }
+
+    block_size = (size > arena->size) ? size : arena->size;
+    block = (arena_block*)global_hooks.allocate(sizeof(arena_block) + block_size);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    block->next = (arena_block*)arena->overflow;
+    arena->overflow = block;
+
+    pointer = (unsigned char*)(block + 1);
+    arena->current = pointer + size;
+    arena->end = pointer + block_size;
+
+    return pointer;
+}
+
+static void *internal_allocate(const internal_hooks * const hooks, size_t size)
+{
+    if (hooks->arena != NULL)
+    {
+        return arena_allocate(hooks->arena, size);
+    }
+
+    return hooks->allocate(size);
+}
+
+static void internal_deallocate(const internal_hooks * const hooks, void *pointer)
+{
+    /* memory of an arena is only released as a whole */
+    if (hooks->arena == NULL)
+    {
+        hooks->deallocate(pointer);
+    }
+}
 
 static unsigned char* cJSON_strdup(const unsigned char* string, const internal_hooks * const hooks)
 {
@@ -183,7 +242,7 @@ CJSON_PUBLIC(void) cJSON_InitHooks(cJSON_Hooks* hooks)
 /* Internal constructor. */
 static cJSON *cJSON_New_Item(const internal_hooks * const hooks)
 {
-    cJSON* node = (cJSON*)hooks->allocate(sizeof(cJSON));
+    cJSON* node = (cJSON*)internal_allocate(hooks, sizeof(cJSON));
     if (node)
     {
         memset(node, '\0', sizeof(cJSON));
@@ -193,6 +252,14 @@ static cJSON *cJSON_New_Item(const internal_hooks * const hooks)
 }
 
 /* Delete a cJSON structure. */
+static void internal_delete(cJSON *item, const internal_hooks * const hooks)
+{
+    if (hooks->arena == NULL)
+    {
+        cJSON_Delete(item);
+    }
+}
+
 CJSON_PUBLIC(void) cJSON_Delete(cJSON *item)
 {
     cJSON *next = NULL;
@@ -667,110 +734,139 @@ fail:
     return 0;
 }
 
-/* Parse the input text into an unescaped cinput, and populate item. */
-static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_buffer)
+/* Find the closing quote of the string literal at the current offset.
+ * skipped_bytes counts the backslashes of escape sequences. */
+static const unsigned char *find_string_end(const parse_buffer * const input_buffer, size_t * const skipped_bytes)
 {
-    const unsigned char *input_pointer = buffer_at_offset(input_buffer) + 1;
     const unsigned char *input_end = buffer_at_offset(input_buffer) + 1;
-    unsigned char *output_pointer = NULL;
-    unsigned char *output = NULL;
-
-    /* not a string */
-    if (buffer_at_offset(input_buffer)[0] != '\"')
-    {
-        goto fail;
-    }
 
+    *skipped_bytes = 0;
+    while (((size_t)(input_end - input_buffer->content) < input_buffer->length) && (*input_end != '\"'))
     {
-        /* calculate approximate size of the output (overestimate) */
-        size_t allocation_length = 0;
-        size_t skipped_bytes = 0;
-        while (((size_t)(input_end - input_buffer->content) < input_buffer->length) && (*input_end != '\"'))
+        /* is escape sequence */
+        if (input_end[0] == '\\')
         {
-            /* is escape sequence */
-            if (input_end[0] == '\\')
+            if ((size_t)(input_end + 1 - input_buffer->content) >= input_buffer->length)
             {
-                if ((size_t)(input_end + 1 - input_buffer->content) >= input_buffer->length)
-                {
-                    /* prevent buffer overflow when last input character is a backslash */
-                    goto fail;
-                }
-                skipped_bytes++;
-                input_end++;
+                /* prevent buffer overflow when last input character is a backslash */
+                return NULL;
             }
+            (*skipped_bytes)++;
             input_end++;
         }
-        if (((size_t)(input_end - input_buffer->content) >= input_buffer->length) || (*input_end != '\"'))
-        {
-            goto fail; /* string ended unexpectedly */
-        }
-
-        /* This is at most how much we need for the output */
-        allocation_length = (size_t) (input_end - buffer_at_offset(input_buffer)) - skipped_bytes;
-        output = (unsigned char*)input_buffer->hooks.allocate(allocation_length + sizeof(""));
-        if (output == NULL)
-        {
-            goto fail; /* allocation failure */
-        }
+        input_end++;
+    }
+    if (((size_t)(input_end - input_buffer->content) >= input_buffer->length) || (*input_end != '\"'))
+    {
+        return NULL; /* string ended unexpectedly */
     }
 
-    output_pointer = output;
-    /* loop through the string literal */
-    while (input_pointer < input_end)
+    return input_end;
+}
+
+/* Unescape the string literal between input_pointer and input_end into output_pointer.
+ * On failure input_pointer is left at the offending escape sequence. */
+static cJSON_bool unescape_string(const unsigned char **input_pointer, const unsigned char * const input_end, unsigned char **output_pointer)
+{
+    while (*input_pointer < input_end)
     {
-        if (*input_pointer != '\\')
+        if (**input_pointer != '\\')
         {
-            *output_pointer++ = *input_pointer++;
+            *(*output_pointer)++ = *(*input_pointer)++;
         }
         /* escape sequence */
         else
         {
             unsigned char sequence_length = 2;
-            if ((input_end - input_pointer) < 1)
+            if ((input_end - *input_pointer) < 1)
             {
-                goto fail;
+                return false;
             }
 
-            switch (input_pointer[1])
+            switch ((*input_pointer)[1])
             {
                 case 'b':
-                    *output_pointer++ = '\b';
+                    *(*output_pointer)++ = '\b';
                     break;
                 case 'f':
-                    *output_pointer++ = '\f';
+                    *(*output_pointer)++ = '\f';
                     break;
                 case 'n':
-                    *output_pointer++ = '\n';
+                    *(*output_pointer)++ = '\n';
                     break;
                 case 'r':
-                    *output_pointer++ = '\r';
+                    *(*output_pointer)++ = '\r';
                     break;
                 case 't':
-                    *output_pointer++ = '\t';
+                    *(*output_pointer)++ = '\t';
                     break;
                 case '\"':
                 case '\\':
                 case '/':
-                    *output_pointer++ = input_pointer[1];
+                    *(*output_pointer)++ = (*input_pointer)[1];
                     break;
 
                 /* UTF-16 literal */
                 case 'u':
-                    sequence_length = utf16_literal_to_utf8(input_pointer, input_end, &output_pointer);
+                    sequence_length = utf16_literal_to_utf8(*input_pointer, input_end, output_pointer);
                     if (sequence_length == 0)
                     {
                         /* failed to convert UTF16-literal to UTF-8 */
-                        goto fail;
+                        return false;
                     }
                     break;
 
                 default:
-                    goto fail;
+                    return false;
             }
-            input_pointer += sequence_length;
+            *input_pointer += sequence_length;
+        }
+    }
+
+    return true;
+}
+
+/* Parse the input text into an unescaped cinput, and populate item. */
+static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_buffer)
+{
+    const unsigned char *input_pointer = buffer_at_offset(input_buffer) + 1;
+    const unsigned char *input_end = buffer_at_offset(input_buffer) + 1;
+    unsigned char *output_pointer = NULL;
+    unsigned char *output = NULL;
+
+    /* not a string */
+    if (buffer_at_offset(input_buffer)[0] != '\"')
+    {
+        goto fail;
+    }
+
+    {
+        /* calculate approximate size of the output (overestimate) */
+        size_t allocation_length = 0;
+        size_t skipped_bytes = 0;
+        const unsigned char *string_end = find_string_end(input_buffer, &skipped_bytes);
+        if (string_end == NULL)
+        {
+            goto fail;
+        }
+        input_end = string_end;
+
+        /* This is at most how much we need for the output */
+        allocation_length = (size_t) (input_end - buffer_at_offset(input_buffer)) - skipped_bytes;
+        output = (unsigned char*)internal_allocate(&input_buffer->hooks, allocation_length + sizeof(""));
+        if (output == NULL)
+        {
+            goto fail; /* allocation failure */
         }
     }
 
+    output_pointer = output;
+    /* loop through the string literal */
+    if (!unescape_string(&input_pointer, input_end, &output_pointer))
+    {
+        goto fail;
+    }
+
     /* zero terminate the output */
     *output_pointer = '\0';
 
@@ -785,7 +881,7 @@ static cJSON_bool parse_string(cJSON * const item, parse_buffer * const input_bu
 fail:
     if (output != NULL)
     {
-        input_buffer->hooks.deallocate(output);
+        internal_deallocate(&input_buffer->hooks, output);
     }
 
     if (input_pointer != NULL)
@@ -954,9 +1050,9 @@ static parse_buffer *buffer_skip_whitespace(parse_buffer * const buffer)
 }
 
 /* Parse an object - create a new root, and populate. */
-CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated)
+static cJSON *parse_with_hooks(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated, const internal_hooks * const hooks)
 {
-    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0 } };
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0, 0 } };
     cJSON *item = NULL;
 
     /* reset error position */
@@ -971,9 +1067,9 @@ CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return
     buffer.content = (const unsigned char*)value;
     buffer.length = strlen((const char*)value) + sizeof("");
     buffer.offset = 0;
-    buffer.hooks = global_hooks;
+    buffer.hooks = *hooks;
 
-    item = cJSON_New_Item(&global_hooks);
+    item = cJSON_New_Item(hooks);
     if (item == NULL) /* memory fail */
     {
         goto fail;
@@ -1004,7 +1100,7 @@ CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return
 fail:
     if (item != NULL)
     {
-        cJSON_Delete(item);
+        internal_delete(item, hooks);
     }
 
     if (value != NULL)
@@ -1035,12 +1131,99 @@ fail:
     return NULL;
 }
 
+CJSON_PUBLIC(cJSON *) cJSON_ParseWithOpts(const char *value, const char **return_parse_end, cJSON_bool require_null_terminated)
+{
+    return parse_with_hooks(value, return_parse_end, require_null_terminated, &global_hooks);
+}
+
 /* Default options for cJSON_Parse */
 CJSON_PUBLIC(cJSON *) cJSON_Parse(const char *value)
 {
     return cJSON_ParseWithOpts(value, 0, 0);
 }
 
+CJSON_PUBLIC(cJSON_bool) cJSON_InitArena(cJSON_Arena *arena, void *buffer, size_t size)
+{
+    if ((arena == NULL) || (size == 0))
+    {
+        return false;
+    }
+
+    memset(arena, 0, sizeof(cJSON_Arena));
+    arena->owned = (buffer == NULL);
+    if (arena->owned)
+    {
+        buffer = global_hooks.allocate(size);
+        if (buffer == NULL)
+        {
+            return false;
+        }
+    }
+
+    arena->buffer = (unsigned char*)buffer;
+    arena->size = size;
+    arena->current = arena->buffer;
+    arena->end = arena->buffer + size;
+
+    return true;
+}
+
+CJSON_PUBLIC(void) cJSON_ResetArena(cJSON_Arena *arena)
+{
+    arena_block *block = NULL;
+
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    while (arena->overflow != NULL)
+    {
+        block = (arena_block*)arena->overflow;
+        arena->overflow = block->next;
+        global_hooks.deallocate(block);
+    }
+
+    arena->current = arena->buffer;
+    arena->end = arena->buffer + arena->size;
+}
+
+CJSON_PUBLIC(void) cJSON_FreeArena(cJSON_Arena *arena)
+{
+    if (arena == NULL)
+    {
+        return;
+    }
+
+    cJSON_ResetArena(arena);
+    if (arena->owned && (arena->buffer != NULL))
+    {
+        global_hooks.deallocate(arena->buffer);
+    }
+    arena->buffer = NULL;
+    arena->size = 0;
+    arena->current = NULL;
+    arena->end = NULL;
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseInArenaWithOpts(const char *value, cJSON_Arena *arena, const char **return_parse_end, cJSON_bool require_null_terminated)
+{
+    internal_hooks hooks = global_hooks;
+
+    if (arena == NULL)
+    {
+        return NULL;
+    }
+    hooks.arena = arena;
+
+    return parse_with_hooks(value, return_parse_end, require_null_terminated, &hooks);
+}
+
+CJSON_PUBLIC(cJSON *) cJSON_ParseInArena(const char *value, cJSON_Arena *arena)
+{
+    return cJSON_ParseInArenaWithOpts(value, arena, 0, 0);
+}
+
 #define cjson_min(a, b) ((a < b) ? a : b)
 
 static unsigned char *print(const cJSON * const item, cJSON_bool format, const internal_hooks * const hooks)
@@ -1118,7 +1301,7 @@ CJSON_PUBLIC(char *) cJSON_PrintUnformatted(const cJSON *item)
 
 CJSON_PUBLIC(char *) cJSON_PrintBuffered(const cJSON *item, int prebuffer, cJSON_bool fmt)
 {
-    printbuffer p = { 0, 0, 0, 0, 0, 0, { 0, 0, 0 } };
+    printbuffer p = { 0, 0, 0, 0, 0, 0, { 0, 0, 0, 0 } };
 
     if (prebuffer < 0)
     {
@@ -1148,7 +1331,7 @@ CJSON_PUBLIC(char *) cJSON_PrintBuffered(const cJSON *item, int prebuffer, cJSON
 
 CJSON_PUBLIC(cJSON_bool) cJSON_PrintPreallocated(cJSON *item, char *buf, const int len, const cJSON_bool fmt)
 {
-    printbuffer p = { 0, 0, 0, 0, 0, 0, { 0, 0, 0 } };
+    printbuffer p = { 0, 0, 0, 0, 0, 0, { 0, 0, 0, 0 } };
 
     if ((len < 0) || (buf == NULL))
     {
@@ -1387,7 +1570,7 @@ success:
 fail:
     if (head != NULL)
     {
-        cJSON_Delete(head);
+        internal_delete(head, &input_buffer->hooks);
     }
 
     return false;
@@ -1558,7 +1741,7 @@ success:
 fail:
     if (head != NULL)
     {
-        cJSON_Delete(head);
+        internal_delete(head, &input_buffer->hooks);
     }
 
     return false;
@@ -2723,3 +2906,615 @@ CJSON_PUBLIC(void) cJSON_free(void *object)
 {
     global_hooks.deallocate(object);
 }
+
+/* Streaming (SAX) reader: reports values to callbacks instead of building a tree. */
+typedef struct
+{
+    const cJSON_SaxHandler *handler;
+    void *context;
+    unsigned char *scratch; /* unescaped copy of the last string that contained escape sequences */
+    size_t scratch_length;
+} sax_state;
+
+static cJSON_bool sax_parse_value(parse_buffer * const input_buffer, sax_state * const state);
+
+static cJSON_bool sax_parse_string(parse_buffer * const input_buffer, sax_state * const state, cJSON_bool is_key)
+{
+    const unsigned char *input_pointer = buffer_at_offset(input_buffer) + 1;
+    const unsigned char *input_end = NULL;
+    const unsigned char *string = input_pointer;
+    unsigned char *output_pointer = NULL;
+    size_t skipped_bytes = 0;
+    size_t length = 0;
+    cJSON_bool result = true;
+
+    if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != '\"'))
+    {
+        return false; /* not a string */
+    }
+
+    input_end = find_string_end(input_buffer, &skipped_bytes);
+    if (input_end == NULL)
+    {
+        input_buffer->offset++;
+        return false;
+    }
+    length = (size_t)(input_end - input_pointer);
+
+    /* strings without escape sequences are passed straight from the input */
+    if (skipped_bytes > 0)
+    {
+        if (state->scratch_length < length + sizeof(""))
+        {
+            if (state->scratch != NULL)
+            {
+                global_hooks.deallocate(state->scratch);
+            }
+            state->scratch_length = 0;
+            state->scratch = (unsigned char*)global_hooks.allocate(length + sizeof(""));
+            if (state->scratch == NULL)
+            {
+                return false; /* allocation failure */
+            }
+            state->scratch_length = length + sizeof("");
+        }
+
+        output_pointer = state->scratch;
+        if (!unescape_string(&input_pointer, input_end, &output_pointer))
+        {
+            input_buffer->offset = (size_t)(input_pointer - input_buffer->content);
+            return false;
+        }
+        *output_pointer = '\0';
+        string = state->scratch;
+        length = (size_t)(output_pointer - state->scratch);
+    }
+
+    if (is_key)
+    {
+        if (state->handler->key_fn != NULL)
+        {
+            result = state->handler->key_fn(state->context, (const char*)string, length);
+        }
+    }
+    else if (state->handler->string_fn != NULL)
+    {
+        result = state->handler->string_fn(state->context, (const char*)string, length);
+    }
+
+    if (result)
+    {
+        input_buffer->offset = (size_t)(input_end - input_buffer->content) + 1;
+    }
+
+    return result;
+}
+
+static cJSON_bool sax_parse_array(parse_buffer * const input_buffer, sax_state * const state)
+{
+    const cJSON_SaxHandler *handler = state->handler;
+
+    if (input_buffer->depth >= CJSON_NESTING_LIMIT)
+    {
+        return false; /* to deeply nested */
+    }
+    input_buffer->depth++;
+
+    if ((handler->start_array_fn != NULL) && !handler->start_array_fn(state->context))
+    {
+        return false;
+    }
+
+    input_buffer->offset++;
+    buffer_skip_whitespace(input_buffer);
+    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == ']'))
+    {
+        goto success; /* empty array */
+    }
+
+    /* check if we skipped to the end of the buffer */
+    if (cannot_access_at_index(input_buffer, 0))
+    {
+        input_buffer->offset--;
+        return false;
+    }
+
+    /* step back to character in front of the first element */
+    input_buffer->offset--;
+    do
+    {
+        input_buffer->offset++;
+        buffer_skip_whitespace(input_buffer);
+        if (!sax_parse_value(input_buffer, state))
+        {
+            return false; /* failed to parse value */
+        }
+        buffer_skip_whitespace(input_buffer);
+    }
+    while (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == ','));
+
+    if (cannot_access_at_index(input_buffer, 0) || buffer_at_offset(input_buffer)[0] != ']')
+    {
+        return false; /* expected end of array */
+    }
+
+success:
+    input_buffer->depth--;
+    input_buffer->offset++;
+
+    return (handler->end_array_fn == NULL) || handler->end_array_fn(state->context);
+}
+
+static cJSON_bool sax_parse_object(parse_buffer * const input_buffer, sax_state * const state)
+{
+    const cJSON_SaxHandler *handler = state->handler;
+
+    if (input_buffer->depth >= CJSON_NESTING_LIMIT)
+    {
+        return false; /* to deeply nested */
+    }
+    input_buffer->depth++;
+
+    if ((handler->start_object_fn != NULL) && !handler->start_object_fn(state->context))
+    {
+        return false;
+    }
+
+    input_buffer->offset++;
+    buffer_skip_whitespace(input_buffer);
+    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == '}'))
+    {
+        goto success; /* empty object */
+    }
+
+    /* check if we skipped to the end of the buffer */
+    if (cannot_access_at_index(input_buffer, 0))
+    {
+        input_buffer->offset--;
+        return false;
+    }
+
+    /* step back to character in front of the first element */
+    input_buffer->offset--;
+    do
+    {
+        /* parse the name of the child */
+        input_buffer->offset++;
+        buffer_skip_whitespace(input_buffer);
+        if (!sax_parse_string(input_buffer, state, true))
+        {
+            return false; /* failed to parse name */
+        }
+        buffer_skip_whitespace(input_buffer);
+
+        if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != ':'))
+        {
+            return false; /* invalid object */
+        }
+
+        /* parse the value */
+        input_buffer->offset++;
+        buffer_skip_whitespace(input_buffer);
+        if (!sax_parse_value(input_buffer, state))
+        {
+            return false; /* failed to parse value */
+        }
+        buffer_skip_whitespace(input_buffer);
+    }
+    while (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == ','));
+
+    if (cannot_access_at_index(input_buffer, 0) || (buffer_at_offset(input_buffer)[0] != '}'))
+    {
+        return false; /* expected end of object */
+    }
+
+success:
+    input_buffer->depth--;
+    input_buffer->offset++;
+
+    return (handler->end_object_fn == NULL) || handler->end_object_fn(state->context);
+}
+
+static cJSON_bool sax_parse_value(parse_buffer * const input_buffer, sax_state * const state)
+{
+    const cJSON_SaxHandler *handler = state->handler;
+    cJSON number;
+
+    if ((input_buffer == NULL) || (input_buffer->content == NULL))
+    {
+        return false; /* no input */
+    }
+
+    /* null */
+    if (can_read(input_buffer, 4) && (strncmp((const char*)buffer_at_offset(input_buffer), "null", 4) == 0))
+    {
+        if ((handler->null_fn != NULL) && !handler->null_fn(state->context))
+        {
+            return false;
+        }
+        input_buffer->offset += 4;
+        return true;
+    }
+    /* false */
+    if (can_read(input_buffer, 5) && (strncmp((const char*)buffer_at_offset(input_buffer), "false", 5) == 0))
+    {
+        if ((handler->bool_fn != NULL) && !handler->bool_fn(state->context, false))
+        {
+            return false;
+        }
+        input_buffer->offset += 5;
+        return true;
+    }
+    /* true */
+    if (can_read(input_buffer, 4) && (strncmp((const char*)buffer_at_offset(input_buffer), "true", 4) == 0))
+    {
+        if ((handler->bool_fn != NULL) && !handler->bool_fn(state->context, true))
+        {
+            return false;
+        }
+        input_buffer->offset += 4;
+        return true;
+    }
+    /* string */
+    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == '\"'))
+    {
+        return sax_parse_string(input_buffer, state, false);
+    }
+    /* number */
+    if (can_access_at_index(input_buffer, 0) && ((buffer_at_offset(input_buffer)[0] == '-') || ((buffer_at_offset(input_buffer)[0] >= '0') && (buffer_at_offset(input_buffer)[0] <= '9'))))
+    {
+        if (!parse_number(&number, input_buffer))
+        {
+            return false;
+        }
+        return (handler->number_fn == NULL) || handler->number_fn(state->context, number.valuedouble);
+    }
+    /* array */
+    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == '['))
+    {
+        return sax_parse_array(input_buffer, state);
+    }
+    /* object */
+    if (can_access_at_index(input_buffer, 0) && (buffer_at_offset(input_buffer)[0] == '{'))
+    {
+        return sax_parse_object(input_buffer, state);
+    }
+
+    return false;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_ParseSax(const char *value, size_t length, const cJSON_SaxHandler *handler, void *context)
+{
+    parse_buffer buffer = { 0, 0, 0, 0, { 0, 0, 0, 0 } };
+    sax_state state = { 0, 0, 0, 0 };
+    cJSON_bool result = false;
+
+    /* reset error position */
+    global_error.json = NULL;
+    global_error.position = 0;
+
+    if ((value == NULL) || (length == 0) || (handler == NULL))
+    {
+        return false;
+    }
+
+    buffer.content = (const unsigned char*)value;
+    buffer.length = length;
+    buffer.offset = 0;
+    buffer.hooks = global_hooks;
+
+    state.handler = handler;
+    state.context = context;
+
+    result = sax_parse_value(buffer_skip_whitespace(&buffer), &state);
+
+    if (state.scratch != NULL)
+    {
+        global_hooks.deallocate(state.scratch);
+    }
+
+    if (!result)
+    {
+        global_error.json = (const unsigned char*)value;
+        global_error.position = (buffer.offset < buffer.length) ? buffer.offset : buffer.length - 1;
+    }
+
+    return result;
+}
+
+/* Direct-to-buffer writer: prints values into a caller supplied buffer without building a tree. */
+static unsigned char *writer_ensure(cJSON_Writer * const writer, printbuffer * const p, size_t needed)
+{
+    memset(p, 0, sizeof(printbuffer));
+    p->buffer = writer->buffer;
+    p->length = writer->length;
+    p->offset = writer->offset;
+    p->noalloc = true;
+    p->hooks = global_hooks;
+
+    return ensure(p, needed);
+}
+
+/* emit the separator in front of the next key or value */
+static cJSON_bool writer_begin_value(cJSON_Writer * const writer, cJSON_bool is_key)
+{
+    printbuffer p;
+    unsigned char *output = NULL;
+    unsigned long level = 0;
+
+    if (writer->failed)
+    {
+        return false;
+    }
+
+    if (writer->depth == 0)
+    {
+        /* only a single value at top level */
+        if (is_key || (writer->offset > 0))
+        {
+            writer->failed = true;
+        }
+        return !writer->failed;
+    }
+
+    level = 1UL << (writer->depth - 1);
+    if (writer->expect_value)
+    {
+        /* a value after a key */
+        if (is_key)
+        {
+            writer->failed = true;
+        }
+        writer->expect_value = false;
+        return !writer->failed;
+    }
+
+    /* values in objects need a key first */
+    if (((writer->is_object & level) != 0) != is_key)
+    {
+        writer->failed = true;
+        return false;
+    }
+
+    if (writer->has_items & level)
+    {
+        output = writer_ensure(writer, &p, 1);
+        if (output == NULL)
+        {
+            writer->failed = true;
+            return false;
+        }
+        *output = ',';
+        writer->offset++;
+    }
+    writer->has_items |= level;
+
+    return true;
+}
+
+static cJSON_bool writer_put(cJSON_Writer * const writer, const char *text, size_t length)
+{
+    printbuffer p;
+    unsigned char *output = writer_ensure(writer, &p, length);
+
+    if (output == NULL)
+    {
+        writer->failed = true;
+        return false;
+    }
+    memcpy(output, text, length);
+    writer->offset += length;
+
+    return true;
+}
+
+static cJSON_bool writer_open(cJSON_Writer * const writer, char bracket, cJSON_bool is_object)
+{
+    unsigned long level = 0;
+
+    if (!writer_begin_value(writer, false))
+    {
+        return false;
+    }
+    if (writer->depth >= CJSON_WRITER_NESTING_LIMIT)
+    {
+        writer->failed = true;
+        return false;
+    }
+    if (!writer_put(writer, &bracket, 1))
+    {
+        return false;
+    }
+
+    writer->depth++;
+    level = 1UL << (writer->depth - 1);
+    writer->has_items &= ~level;
+    if (is_object)
+    {
+        writer->is_object |= level;
+    }
+    else
+    {
+        writer->is_object &= ~level;
+    }
+
+    return true;
+}
+
+static cJSON_bool writer_close(cJSON_Writer * const writer, char bracket, cJSON_bool is_object)
+{
+    unsigned long level = 0;
+
+    if (writer->failed || (writer->depth == 0) || writer->expect_value)
+    {
+        writer->failed = true;
+        return false;
+    }
+
+    level = 1UL << (writer->depth - 1);
+    if (((writer->is_object & level) != 0) != is_object)
+    {
+        writer->failed = true;
+        return false;
+    }
+    if (!writer_put(writer, &bracket, 1))
+    {
+        return false;
+    }
+    writer->depth--;
+
+    return true;
+}
+
+CJSON_PUBLIC(void) cJSON_InitWriter(cJSON_Writer *writer, char *buffer, size_t length)
+{
+    memset(writer, 0, sizeof(cJSON_Writer));
+    writer->buffer = (unsigned char*)buffer;
+    writer->length = length;
+    writer->failed = ((buffer == NULL) || (length == 0));
+    if (!writer->failed)
+    {
+        writer->buffer[0] = '\0';
+    }
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteStartObject(cJSON_Writer *writer)
+{
+    return writer_open(writer, '{', true);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteEndObject(cJSON_Writer *writer)
+{
+    return writer_close(writer, '}', true);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteStartArray(cJSON_Writer *writer)
+{
+    return writer_open(writer, '[', false);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteEndArray(cJSON_Writer *writer)
+{
+    return writer_close(writer, ']', false);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteKey(cJSON_Writer *writer, const char *key)
+{
+    printbuffer p;
+
+    if ((key == NULL) || !writer_begin_value(writer, true))
+    {
+        writer->failed = true;
+        return false;
+    }
+
+    writer_ensure(writer, &p, 0);
+    if (!print_string_ptr((const unsigned char*)key, &p))
+    {
+        writer->failed = true;
+        return false;
+    }
+    update_offset(&p);
+    writer->offset = p.offset;
+    writer->expect_value = true;
+
+    return writer_put(writer, ":", 1);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteString(cJSON_Writer *writer, const char *string)
+{
+    printbuffer p;
+
+    if (!writer_begin_value(writer, false))
+    {
+        return false;
+    }
+
+    writer_ensure(writer, &p, 0);
+    if (!print_string_ptr((const unsigned char*)string, &p))
+    {
+        writer->failed = true;
+        return false;
+    }
+    update_offset(&p);
+    writer->offset = p.offset;
+
+    return true;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteNumber(cJSON_Writer *writer, double number)
+{
+    printbuffer p;
+    cJSON item;
+
+    if (!writer_begin_value(writer, false))
+    {
+        return false;
+    }
+
+    memset(&item, 0, sizeof(cJSON));
+    item.valuedouble = number;
+    writer_ensure(writer, &p, 0);
+    if (!print_number(&item, &p))
+    {
+        writer->failed = true;
+        return false;
+    }
+    writer->offset = p.offset;
+
+    return true;
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteBool(cJSON_Writer *writer, cJSON_bool boolean)
+{
+    if (!writer_begin_value(writer, false))
+    {
+        return false;
+    }
+
+    return boolean ? writer_put(writer, "true", 4) : writer_put(writer, "false", 5);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteNull(cJSON_Writer *writer)
+{
+    if (!writer_begin_value(writer, false))
+    {
+        return false;
+    }
+
+    return writer_put(writer, "null", 4);
+}
+
+CJSON_PUBLIC(cJSON_bool) cJSON_WriteItem(cJSON_Writer *writer, const cJSON *item)
+{
+    printbuffer p;
+
+    if ((item == NULL) || !writer_begin_value(writer, false))
+    {
+        writer->failed = true;
+        return false;
+    }
+
+    writer_ensure(writer, &p, 0);
+    if (!print_value(item, &p))
+    {
+        writer->failed = true;
+        return false;
+    }
+    update_offset(&p);
+    writer->offset = p.offset;
+
+    return true;
+}
+
+CJSON_PUBLIC(int) cJSON_FinishWriter(cJSON_Writer *writer)
+{
+    if ((writer == NULL) || writer->failed || (writer->depth != 0) || (writer->offset == 0))
+    {
+        return -1;
+    }
+
+    writer->buffer[writer->offset] = '\0';
+
+    return (int)writer->offset;
+}
@@ -141,6 +141,19 @@ ifeq ($(CONFIG_NETUTILS_MQTT_SECURITY),y)
 	LIB_CFLAGS:=$(LIB_CFLAGS) -DWITH_MBEDTLS
 endif
 
+ifneq ($(CONFIG_NETUTILS_MQTT_TX_BATCH_SIZE),)
+ifneq ($(CONFIG_NETUTILS_MQTT_TX_BATCH_SIZE),0)
+	LIB_CFLAGS:=$(LIB_CFLAGS) -DWITH_TX_BATCH=$(CONFIG_NETUTILS_MQTT_TX_BATCH_SIZE)
+endif
+endif
+
+ifneq ($(CONFIG_NETUTILS_MQTT_PACKET_POOL_SIZE),)
+ifneq ($(CONFIG_NETUTILS_MQTT_PACKET_POOL_SIZE),0)
+	LIB_CFLAGS:=$(LIB_CFLAGS) -DWITH_PACKET_POOL=$(CONFIG_NETUTILS_MQTT_PACKET_POOL_SIZE)
+	LIB_CFLAGS:=$(LIB_CFLAGS) -DPACKET_POOL_PAYLOAD=$(CONFIG_NETUTILS_MQTT_PACKET_POOL_PAYLOAD)
+endif
+endif
+
 MQTT_LIB_CFLAGS := $(LIB_CFLAGS) -D__TINYARA__ -DVERSION="\"${VERSION}\""
 MQTT_LIB_CFLAGS += -I$(MQTT_TOP) -I$(MQTT_INCLUDE)
 CFLAGS += $(MQTT_LIB_CFLAGS)
@@ -395,6 +395,10 @@ void mosquitto__destroy(struct mosquitto *mosq)
 		mosq->connect_ainfo_bind = NULL;
 	}
 #endif
+#ifdef WITH_TX_BATCH
+	mosquitto__free(mosq->out_batch);
+	mosq->out_batch = NULL;
+#endif
 }
 
 void mosquitto_destroy(struct mosquitto *mosq)
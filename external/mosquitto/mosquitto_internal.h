@@ -400,6 +400,9 @@ struct mosquitto {
 	struct addrinfo *connect_ainfo;
 	struct addrinfo *connect_ainfo_bind;
 #endif
+#ifdef WITH_TX_BATCH
+	uint8_t *out_batch;
+#endif
 };
 
 #define STREMPTY(str) (str[0] == '\0')
@@ -47,6 +47,80 @@ Contributors:
 #  define G_PUB_MSGS_SENT_INC(A)
 #endif
 
+#ifdef WITH_PACKET_POOL
+/* Outgoing packets are taken from a static pool shared by all clients. Each
+ * entry carries a small payload buffer so that typical telemetry PUBLISH and
+ * PUBACK packets need no heap allocation at all. */
+#ifndef PACKET_POOL_PAYLOAD
+#  define PACKET_POOL_PAYLOAD 128
+#endif
+
+struct packet__pool_entry{
+	struct mosquitto__packet packet;
+	uint8_t buf[PACKET_POOL_PAYLOAD];
+};
+
+static struct packet__pool_entry packet__pool[WITH_PACKET_POOL];
+static struct mosquitto__packet *packet__pool_free;
+static bool packet__pool_ready = false;
+#ifdef WITH_THREADING
+static pthread_mutex_t packet__pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static bool packet__in_pool(const void *ptr)
+{
+	return (const uint8_t *)ptr >= (const uint8_t *)packet__pool
+			&& (const uint8_t *)ptr < (const uint8_t *)&packet__pool[WITH_PACKET_POOL];
+}
+#endif
+
+
+struct mosquitto__packet *packet__new(void)
+{
+#ifdef WITH_PACKET_POOL
+	struct mosquitto__packet *packet;
+	int i;
+
+	pthread_mutex_lock(&packet__pool_mutex);
+	if(!packet__pool_ready){
+		for(i=0; i<WITH_PACKET_POOL; i++){
+			packet__pool[i].packet.next = packet__pool_free;
+			packet__pool_free = &packet__pool[i].packet;
+		}
+		packet__pool_ready = true;
+	}
+	packet = packet__pool_free;
+	if(packet){
+		packet__pool_free = packet->next;
+	}
+	pthread_mutex_unlock(&packet__pool_mutex);
+
+	if(packet){
+		memset(packet, 0, sizeof(struct mosquitto__packet));
+		return packet;
+	}
+#endif
+	return mosquitto__calloc(1, sizeof(struct mosquitto__packet));
+}
+
+
+void packet__free(struct mosquitto__packet *packet)
+{
+	if(!packet) return;
+
+#ifdef WITH_PACKET_POOL
+	if(packet__in_pool(packet)){
+		pthread_mutex_lock(&packet__pool_mutex);
+		packet->next = packet__pool_free;
+		packet__pool_free = packet;
+		pthread_mutex_unlock(&packet__pool_mutex);
+		return;
+	}
+#endif
+	mosquitto__free(packet);
+}
+
+
 int packet__alloc(struct mosquitto__packet *packet)
 {
 	uint8_t remaining_bytes[5], byte;
@@ -73,7 +147,15 @@ int packet__alloc(struct mosquitto__packet *packet)
 #ifdef WITH_WEBSOCKETS
 	packet->payload = mosquitto__malloc(sizeof(uint8_t)*packet->packet_length + LWS_PRE);
 #else
+#  ifdef WITH_PACKET_POOL
+	if(packet__in_pool(packet) && packet->packet_length <= PACKET_POOL_PAYLOAD){
+		packet->payload = ((struct packet__pool_entry *)packet)->buf;
+	}else{
+		packet->payload = mosquitto__malloc(sizeof(uint8_t)*packet->packet_length);
+	}
+#  else
 	packet->payload = mosquitto__malloc(sizeof(uint8_t)*packet->packet_length);
+#  endif
 #endif
 	if(!packet->payload) return MOSQ_ERR_NOMEM;
 
@@ -95,7 +177,13 @@ void packet__cleanup(struct mosquitto__packet *packet)
 	packet->remaining_count = 0;
 	packet->remaining_mult = 1;
 	packet->remaining_length = 0;
+#ifdef WITH_PACKET_POOL
+	if(!packet__in_pool(packet->payload)){
+		mosquitto__free(packet->payload);
+	}
+#else
 	mosquitto__free(packet->payload);
+#endif
 	packet->payload = NULL;
 	packet->to_process = 0;
 	packet->pos = 0;
@@ -120,7 +208,7 @@ void packet__cleanup_all_no_locks(struct mosquitto *mosq)
 		}
 
 		packet__cleanup(packet);
-		mosquitto__free(packet);
+		packet__free(packet);
 	}
 	mosq->out_packet_count = 0;
 
@@ -208,6 +296,64 @@ int packet__check_oversize(struct mosquitto *mosq, uint32_t remaining_length)
 }
 
 
+#ifdef WITH_TX_BATCH
+/* Send the rest of the current packet together with as many whole queued
+ * packets as fit in WITH_TX_BATCH bytes, so a burst of small PUBLISH packets
+ * goes out in one write instead of one write and TCP segment each. Bytes
+ * written beyond the current packet are accounted to the queued packets in
+ * order; only the part that belongs to the current packet is returned. */
+static ssize_t packet__write_batch(struct mosquitto *mosq, struct mosquitto__packet *packet)
+{
+	struct mosquitto__packet *next;
+	ssize_t write_length;
+	uint32_t len;
+	uint32_t consumed;
+
+	pthread_mutex_lock(&mosq->out_packet_mutex);
+	next = mosq->out_packet;
+	if(!next || packet->to_process + next->to_process > WITH_TX_BATCH){
+		pthread_mutex_unlock(&mosq->out_packet_mutex);
+		return net__write(mosq, &(packet->payload[packet->pos]), packet->to_process);
+	}
+	if(!mosq->out_batch){
+		mosq->out_batch = mosquitto__malloc(WITH_TX_BATCH);
+		if(!mosq->out_batch){
+			pthread_mutex_unlock(&mosq->out_packet_mutex);
+			return net__write(mosq, &(packet->payload[packet->pos]), packet->to_process);
+		}
+	}
+
+	memcpy(mosq->out_batch, &(packet->payload[packet->pos]), packet->to_process);
+	len = packet->to_process;
+	while(next && len + next->to_process <= WITH_TX_BATCH){
+		memcpy(&(mosq->out_batch[len]), &(next->payload[next->pos]), next->to_process);
+		len += next->to_process;
+		next = next->next;
+	}
+	pthread_mutex_unlock(&mosq->out_packet_mutex);
+
+	write_length = net__write(mosq, mosq->out_batch, len);
+	if(write_length <= (ssize_t)packet->to_process){
+		return write_length;
+	}
+
+	/* Queued packets are only removed while current_out_packet_mutex is
+	 * held, so the ones copied above are still at the head of the queue. */
+	consumed = (uint32_t)write_length - packet->to_process;
+	pthread_mutex_lock(&mosq->out_packet_mutex);
+	for(next = mosq->out_packet; next && consumed > 0; next = next->next){
+		len = consumed < next->to_process ? consumed : next->to_process;
+		next->to_process -= len;
+		next->pos += len;
+		consumed -= len;
+	}
+	pthread_mutex_unlock(&mosq->out_packet_mutex);
+
+	return (ssize_t)packet->to_process;
+}
+#endif
+
+
 int packet__write(struct mosquitto *mosq)
 {
 	ssize_t write_length;
@@ -249,7 +395,11 @@ int packet__write(struct mosquitto *mosq)
 		packet = mosq->current_out_packet;
 
 		while(packet->to_process > 0){
+#ifdef WITH_TX_BATCH
+			write_length = packet__write_batch(mosq, packet);
+#else
 			write_length = net__write(mosq, &(packet->payload[packet->pos]), packet->to_process);
+#endif
 			if(write_length > 0){
 				G_BYTES_SENT_INC(write_length);
 				packet->to_process -= (uint32_t)write_length;
@@ -300,7 +450,7 @@ int packet__write(struct mosquitto *mosq)
 		}else if(((packet->command)&0xF0) == CMD_DISCONNECT){
 			do_client_disconnect(mosq, MOSQ_ERR_SUCCESS, NULL);
 			packet__cleanup(packet);
-			mosquitto__free(packet);
+			packet__free(packet);
 			return MOSQ_ERR_SUCCESS;
 #endif
 		}else if(((packet->command)&0xF0) == CMD_PUBLISH){
@@ -320,7 +470,7 @@ int packet__write(struct mosquitto *mosq)
 		pthread_mutex_unlock(&mosq->out_packet_mutex);
 
 		packet__cleanup(packet);
-		mosquitto__free(packet);
+		packet__free(packet);
 
 #ifdef WITH_BROKER
 		mosq->next_msg_out = db.now_s + mosq->keepalive;
@@ -21,6 +21,8 @@ Contributors:
 #include "mosquitto_internal.h"
 #include "mosquitto.h"
 
+struct mosquitto__packet *packet__new(void);
+void packet__free(struct mosquitto__packet *packet);
 int packet__alloc(struct mosquitto__packet *packet);
 void packet__cleanup(struct mosquitto__packet *packet);
 void packet__cleanup_all(struct mosquitto *mosq);
@@ -182,7 +182,7 @@ int send__real_publish(struct mosquitto *mosq, uint16_t mid, const char *topic,
 		return MOSQ_ERR_OVERSIZE_PACKET;
 	}
 
-	packet = mosquitto__calloc(1, sizeof(struct mosquitto__packet));
+	packet = packet__new();
 	if(!packet) return MOSQ_ERR_NOMEM;
 
 	packet->mid = mid;
@@ -190,7 +190,7 @@ int send__real_publish(struct mosquitto *mosq, uint16_t mid, const char *topic,
 	packet->remaining_length = packetlen;
 	rc = packet__alloc(packet);
 	if(rc){
-		mosquitto__free(packet);
+		packet__free(packet);
 		return rc;
 	}
 	/* Variable header (topic string) */
@@ -134,7 +134,7 @@ int socks5__send(struct mosquitto *mosq)
 	state = mosquitto__get_state(mosq);
 
 	if(state == mosq_cs_socks5_new){
-		packet = mosquitto__calloc(1, sizeof(struct mosquitto__packet));
+		packet = packet__new();
 		if(!packet) return MOSQ_ERR_NOMEM;
 
 		if(mosq->socks5_username){
@@ -162,13 +162,13 @@ int socks5__send(struct mosquitto *mosq)
 		mosq->in_packet.payload = mosquitto__malloc(sizeof(uint8_t)*2);
 		if(!mosq->in_packet.payload){
 			mosquitto__free(packet->payload);
-			mosquitto__free(packet);
+			packet__free(packet);
 			return MOSQ_ERR_NOMEM;
 		}
 
 		return packet__queue(mosq, packet);
 	}else if(state == mosq_cs_socks5_auth_ok){
-		packet = mosquitto__calloc(1, sizeof(struct mosquitto__packet));
+		packet = packet__new();
 		if(!packet) return MOSQ_ERR_NOMEM;
 
 		ipv4_pton_result = inet_pton(AF_INET, mosq->host, &addr_ipv4);
@@ -178,7 +178,7 @@ int socks5__send(struct mosquitto *mosq)
 			packet->packet_length = 10;
 			packet->payload = mosquitto__malloc(sizeof(uint8_t)*packet->packet_length);
 			if(!packet->payload){
-				mosquitto__free(packet);
+				packet__free(packet);
 				return MOSQ_ERR_NOMEM;
 			}
 			packet->payload[3] = SOCKS_ATYPE_IP_V4;
@@ -190,7 +190,7 @@ int socks5__send(struct mosquitto *mosq)
 			packet->packet_length = 22;
 			packet->payload = mosquitto__malloc(sizeof(uint8_t)*packet->packet_length);
 			if(!packet->payload){
-				mosquitto__free(packet);
+				packet__free(packet);
 				return MOSQ_ERR_NOMEM;
 			}
 			packet->payload[3] = SOCKS_ATYPE_IP_V6;
@@ -201,13 +201,13 @@ int socks5__send(struct mosquitto *mosq)
 		}else{
 			slen = strlen(mosq->host);
 			if(slen > UCHAR_MAX){
-				mosquitto__free(packet);
+				packet__free(packet);
 				return MOSQ_ERR_NOMEM;
 			}
 			packet->packet_length = 7U + (uint32_t)slen;
 			packet->payload = mosquitto__malloc(sizeof(uint8_t)*packet->packet_length);
 			if(!packet->payload){
-				mosquitto__free(packet);
+				packet__free(packet);
 				return MOSQ_ERR_NOMEM;
 			}
 			packet->payload[3] = SOCKS_ATYPE_DOMAINNAME;
@@ -228,13 +228,13 @@ int socks5__send(struct mosquitto *mosq)
 		mosq->in_packet.payload = mosquitto__malloc(sizeof(uint8_t)*5);
 		if(!mosq->in_packet.payload){
 			mosquitto__free(packet->payload);
-			mosquitto__free(packet);
+			packet__free(packet);
 			return MOSQ_ERR_NOMEM;
 		}
 
 		return packet__queue(mosq, packet);
 	}else if(state == mosq_cs_socks5_send_userpass){
-		packet = mosquitto__calloc(1, sizeof(struct mosquitto__packet));
+		packet = packet__new();
 		if(!packet) return MOSQ_ERR_NOMEM;
 
 		ulen = (uint8_t)strlen(mosq->socks5_username);
@@ -257,7 +257,7 @@ int socks5__send(struct mosquitto *mosq)
 		mosq->in_packet.payload = mosquitto__malloc(sizeof(uint8_t)*2);
 		if(!mosq->in_packet.payload){
 			mosquitto__free(packet->payload);
-			mosquitto__free(packet);
+			packet__free(packet);
 			return MOSQ_ERR_NOMEM;
 		}
 
@@ -215,6 +215,12 @@ static const char g_httpcontsize[] = "Content-Length: ";
 static const char g_httpchunked[] = "Transfer-Encoding: chunked";
 const char *tlsname = "araweb_tls_client";
 
+#ifdef CONFIG_NET_SECURITY_TLS
+/* Sessions of the servers we talked to, keyed by "host:port" */
+static struct http_tls_session_cache_t g_tls_sessions =
+	HTTP_TLS_SESSION_CACHE_INITIALIZER(HTTP_TLS_SESSION_CACHE_SIZE, HTTP_TLS_SESSION_TIMEOUT);
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -602,8 +608,9 @@ void wget_tls_ssl_release(struct http_client_tls_t *client)
 	mbedtls_ssl_free(&(client->tls_ssl));
 }
 
-int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname)
+int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname, uint16_t port)
 {
+	char key[CONFIG_WEBCLIENT_MAXHOSTNAME + 7];
 	int result = 0;
 
 	mbedtls_net_init(&(client->tls_client_fd));
@@ -641,8 +648,12 @@ int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname)
 	mbedtls_ssl_set_bio(&(client->tls_ssl), &(client->tls_client_fd),
 						mbedtls_net_send, mbedtls_net_recv, NULL);
 
+	/* Offer the last session with this server to skip a full handshake */
+	snprintf(key, sizeof(key), "%s:%u", hostname, port);
+	http_tls_session_load(&g_tls_sessions, key, &(client->tls_ssl));
+
 	/* Handshake */
-	while ((result = mbedtls_ssl_handshake(&(client->tls_ssl))) != 0) {
+	while ((result = http_tls_session_handshake(&g_tls_sessions, &(client->tls_ssl))) != 0) {
 		if (result != MBEDTLS_ERR_SSL_WANT_READ &&
 			result != MBEDTLS_ERR_SSL_WANT_WRITE) {
 			printf("Error: TLS Handshake fail returned -%4x\n", -result);
@@ -650,12 +661,25 @@ int wget_tls_handshake(struct http_client_tls_t *client, const char *hostname)
 		}
 	}
 
+	http_tls_session_save(&g_tls_sessions, key, &(client->tls_ssl));
+
 	printf("TLS Handshake Success\n");
 
 	return 0;
 HANDSHAKE_FAIL:
 	return result;
 }
+
+int http_client_get_tls_session_stats(struct http_tls_session_stats_t *stats)
+{
+	if (stats == NULL) {
+		return -1;
+	}
+
+	http_tls_session_get_stats(&g_tls_sessions, stats);
+
+	return 0;
+}
 #endif
 
 static int wget_msg_construct(char *buf, struct http_client_request_t *param, struct wget_s *ws)
@@ -992,7 +1016,7 @@ retry:
 	}
 
 	client_tls->client_fd = sockfd;
-	if (param->tls && (ret = wget_tls_handshake(client_tls, ws.hostname))) {
+	if (param->tls && (ret = wget_tls_handshake(client_tls, ws.hostname, ws.port))) {
 		if (handshake_retry-- > 0) {
 			if (ret == MBEDTLS_ERR_NET_SEND_FAILED ||
 				ret == MBEDTLS_ERR_NET_RECV_FAILED ||
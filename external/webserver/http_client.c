@@ -19,6 +19,9 @@
 #include <fcntl.h>
 #include <protocols/webserver/http_err.h>
 #include <protocols/webserver/http_keyvalue_list.h>
+#ifdef CONFIG_NETUTILS_WEBSERVER_INCREMENTAL_PARSER
+#include <protocols/webserver/http_parser.h>
+#endif
 #include <protocols/webclient.h>
 #include <protocols/websocket.h>
 #include <tinyara/fs/fs.h>
@@ -595,38 +598,246 @@ int http_parse_message(char *buf, int buf_len, int *method, char *url,
 	return read_finish;
 }
 
+static int http_client_recv(struct http_client_t *client, char *buf, int len)
+{
+#ifdef CONFIG_NET_SECURITY_TLS
+	if (client->server->tls_init) {
+		return mbedtls_ssl_read(&(client->tls_ssl), (unsigned char *)buf, len);
+	}
+#endif
+	return recv(client->client_fd, buf, len, 0);
+}
+
+#ifdef CONFIG_NETUTILS_WEBSERVER_INCREMENTAL_PARSER
+struct http_request_ctx_t {
+	struct http_client_t *client;
+	struct http_req_message *req;
+	struct http_keyvalue_list_t *params;
+	char *url;
+	char *body;
+	char eom;
+};
+
+/* Dispatch a slice of the receive buffer as the entity of req. The byte
+ * following the slice is always inside the buffer, so it is replaced by
+ * NUL for the duration of the callback instead of copying the slice.
+ */
+static void http_dispatch_slice(struct http_request_ctx_t *ctx, const struct http_slice_t *data)
+{
+	char *end = (char *)data->ptr + data->len;
+	char saved = *end;
+
+	*end = '\0';
+	ctx->req->entity = (char *)data->ptr;
+	ctx->req->entity_len = data->len;
+	http_dispatch_url(ctx->client, ctx->req);
+	*end = saved;
+}
+
+static int http_request_on_request_line(struct http_parser_t *parser, const struct http_slice_t *url)
+{
+	struct http_request_ctx_t *ctx = (struct http_request_ctx_t *)parser->priv;
+
+	HTTP_MEMCPY(ctx->url, url->ptr, url->len);
+	ctx->url[url->len] = '\0';
+	ctx->req->method = parser->method;
+
+	HTTP_LOGD("Request Method : %d\n", parser->method);
+	HTTP_LOGD("Request URI : %s\n", ctx->url);
+	HTTP_LOGD("Request Protocol : %d\n", parser->httpver);
+	return HTTP_OK;
+}
+
+static int http_request_on_header(struct http_parser_t *parser, int id, const struct http_slice_t *name, const struct http_slice_t *value)
+{
+	struct http_request_ctx_t *ctx = (struct http_request_ctx_t *)parser->priv;
+	struct http_client_t *client = ctx->client;
+	char key[HTTP_CONF_MAX_KEY_LENGTH];
+	char val[HTTP_CONF_MAX_VALUE_LENGTH];
+	char *trailer;
+	struct http_slice_t line;
+
+	HTTP_MEMCPY(key, name->ptr, name->len);
+	key[name->len] = '\0';
+
+	if (parser->state == HTTP_PARSER_TRAILER) {
+		/* Deliver the trailer announced by the "Trailer" header as an entity */
+		trailer = http_keyvalue_list_find(ctx->params, "Trailer");
+		if (strcmp(trailer, key) == 0) {
+			HTTP_LOGD("Trailer header: %s\n", key);
+			line.ptr = name->ptr;
+			line.len = value->ptr + value->len - name->ptr;
+			http_dispatch_slice(ctx, &line);
+		}
+		return HTTP_OK;
+	}
+
+	HTTP_MEMCPY(val, value->ptr, value->len);
+	val[value->len] = '\0';
+	HTTP_LOGD("[HTTP Parameter] Key: %s / Value: %s\n", key, val);
+
+	if (http_keyvalue_list_add(ctx->params, key, val) != HTTP_OK) {
+		return HTTP_ERROR;
+	}
+
+	switch (id) {
+	case HTTP_HEADER_CONNECTION:
+		if (http_slice_equal(value, "Upgrade")) {
+			++client->ws_state;
+		}
+		break;
+	case HTTP_HEADER_UPGRADE:
+		if (http_slice_equal(value, "websocket")) {
+			++client->ws_state;
+		}
+		break;
+	case HTTP_HEADER_SEC_WEBSOCKET_KEY:
+		strncpy((char *)client->ws_key, val, WEBSOCKET_CLIENT_KEY_LEN);
+		break;
+	case HTTP_HEADER_KEEP_ALIVE:
+		parse_keep_alive_header(client, ctx->params);
+		break;
+	default:
+		break;
+	}
+
+	return HTTP_OK;
+}
+
+static int http_request_on_body(struct http_parser_t *parser, const struct http_slice_t *data)
+{
+	struct http_request_ctx_t *ctx = (struct http_request_ctx_t *)parser->priv;
+
+	if (parser->encoding == HTTP_CHUNKED_ENCODING) {
+		/* Stream chunk data to the handler straight from the receive buffer */
+		ctx->req->encoding = HTTP_CHUNKED_ENCODING;
+		http_dispatch_slice(ctx, data);
+	} else if (ctx->body == NULL) {
+		/* The body is kept contiguous in the receive buffer */
+		ctx->body = (char *)data->ptr;
+	}
+
+	return HTTP_OK;
+}
+
+static int http_request_on_message_complete(struct http_parser_t *parser)
+{
+	struct http_request_ctx_t *ctx = (struct http_request_ctx_t *)parser->priv;
+
+	if (parser->encoding == HTTP_CHUNKED_ENCODING) {
+		/* Notify the end of chunked entity with an empty entity */
+		ctx->req->entity = &ctx->eom;
+		ctx->req->entity_len = 0;
+		http_dispatch_url(ctx->client, ctx->req);
+	} else if (ctx->body) {
+		ctx->body[parser->content_len] = '\0';
+		ctx->req->entity_len = parser->content_len;
+	}
+
+	return HTTP_OK;
+}
+
+static const struct http_parser_cb_t g_http_request_cb = {
+	http_request_on_request_line,
+	http_request_on_header,
+	NULL,
+	http_request_on_body,
+	http_request_on_message_complete
+};
+
+/* Receive and parse a request without copying lines out of buf. buf must
+ * have room for HTTP_CONF_MAX_REQUEST_LENGTH + 1 bytes.
+ */
+static int http_recv_request_incremental(struct http_client_t *client, char *buf, char *url,
+					 struct http_req_message *req, struct http_keyvalue_list_t *params,
+					 int *method, int *enc, char **body)
+{
+	struct http_parser_t parser;
+	struct http_request_ctx_t ctx;
+	int buf_len = 0;
+	int parsed = 0;
+	int len;
+
+	HTTP_MEMSET(&ctx, 0, sizeof(struct http_request_ctx_t));
+	ctx.client = client;
+	ctx.req = req;
+	ctx.params = params;
+	ctx.url = url;
+
+	http_parser_init(&parser, &g_http_request_cb, &ctx);
+
+	while (parser.state != HTTP_PARSER_DONE) {
+		if (buf_len >= HTTP_CONF_MAX_REQUEST_LENGTH) {
+			HTTP_LOGE("Error: Request size is too large!!\n");
+			http_send_response(client, 413, "Payload Too Large\r\n", NULL);
+			return HTTP_ERROR;
+		}
+
+		len = http_client_recv(client, buf + buf_len, HTTP_CONF_MAX_REQUEST_LENGTH - buf_len);
+		if (len < 0) {
+			HTTP_LOGE("Error: Receive Fail %d errno:[%s-%d] \n", len, strerror(errno), errno);
+			return HTTP_ERROR;
+		} else if (len == 0) {
+			HTTP_LOGD("Finish read\n");
+			return HTTP_ERROR;
+		}
+		buf_len += len;
+
+		len = http_parser_execute(&parser, buf + parsed, buf_len - parsed);
+		if (len < 0) {
+			return HTTP_ERROR;
+		}
+		parsed += len;
+
+		/* Chunks already handed to the handler can be dropped from buf */
+		if (parser.encoding == HTTP_CHUNKED_ENCODING && parser.state >= HTTP_PARSER_CHUNK_SIZE) {
+			buf_len -= parsed;
+			memmove(buf, buf + parsed, buf_len);
+			parsed = 0;
+		}
+	}
+
+	*method = parser.method;
+	*enc = parser.encoding;
+	*body = ctx.body;
+
+	return HTTP_OK;
+}
+#endif
+
 int http_recv_and_handle_request(struct http_client_t *client, struct http_keyvalue_list_t *request_params)
 {
 	char *buf;
-	int len = 0;
 	char *body = NULL;
-	int read_finish = false;
-
 	int method = HTTP_METHOD_UNKNOWN;
 	char url[HTTP_CONF_MAX_REQUEST_HEADER_URL_LENGTH] = { 0, };
-	int buf_len = 0;
-	int remain = HTTP_CONF_MAX_REQUEST_LENGTH;
 	int enc = HTTP_CONTENT_LENGTH;
 	struct http_req_message req = {0, };
-	int state = HTTP_REQUEST_HEADER;
-	struct http_message_len_t mlen = {0,};
 	struct sockaddr_in addr;
 	socklen_t addr_len;
 	char *conn_type = NULL;
+#ifndef CONFIG_NETUTILS_WEBSERVER_INCREMENTAL_PARSER
+	int len = 0;
+	int read_finish = false;
+	int buf_len = 0;
+	int remain = HTTP_CONF_MAX_REQUEST_LENGTH;
+	int state = HTTP_REQUEST_HEADER;
+	struct http_message_len_t mlen = {0,};
 	int chunk_processed = 0;
 	int unprocessed = 0;
 	int i = 0;
+#endif
 
 	client->ws_state = 0;
 
-	buf = HTTP_MALLOC(HTTP_CONF_MAX_REQUEST_LENGTH);
+	buf = HTTP_MALLOC(HTTP_CONF_MAX_REQUEST_LENGTH + 1);
 	if (buf == NULL) {
 		HTTP_LOGE("Error: Fail to malloc buf\n");
 		close(client->client_fd);
 		return HTTP_ERROR;
 	}
 
-	memset(buf, 0, HTTP_CONF_MAX_REQUEST_LENGTH);
+	memset(buf, 0, HTTP_CONF_MAX_REQUEST_LENGTH + 1);
 
 	if (getpeername(client->client_fd, (struct sockaddr *)&addr, &addr_len) < 0) {
 		HTTP_LOGE("Error: Fail to getpeername\n");
@@ -638,19 +849,17 @@ int http_recv_and_handle_request(struct http_client_t *client, struct http_keyva
 	req.client_ip = addr.sin_addr.s_addr;
 	req.encoding = HTTP_CONTENT_LENGTH;
 
+#ifdef CONFIG_NETUTILS_WEBSERVER_INCREMENTAL_PARSER
+	if (http_recv_request_incremental(client, buf, url, &req, request_params, &method, &enc, &body) != HTTP_OK) {
+		goto errout;
+	}
+#else
 	while (!read_finish) {
 		if (remain <= 0) {
 			HTTP_LOGE("Error: Request size is too large!!\n");
 			goto err_large_request;
 		}
-#ifdef CONFIG_NET_SECURITY_TLS
-		if (client->server->tls_init) {
-			len = mbedtls_ssl_read(&(client->tls_ssl), (unsigned char *)buf + buf_len, HTTP_CONF_MAX_REQUEST_LENGTH - buf_len);
-		} else
-#endif
-		{
-			len = recv(client->client_fd, buf + buf_len, HTTP_CONF_MAX_REQUEST_LENGTH - buf_len, 0);
-		}
+		len = http_client_recv(client, buf + buf_len, HTTP_CONF_MAX_REQUEST_LENGTH - buf_len);
 		if (len < 0) {
 			HTTP_LOGE("Error: Receive Fail %d errno:[%s-%d] \n", len, strerror(errno), errno);
 			goto errout;
@@ -687,6 +896,7 @@ int http_recv_and_handle_request(struct http_client_t *client, struct http_keyva
                         memset(&mlen, 0x0, sizeof(struct http_message_len_t));
 		}
 	}
+#endif
 
 	// Check "Connection" header value
 	conn_type = http_keyvalue_list_find(request_params, "Connection");
@@ -765,8 +975,10 @@ int http_recv_and_handle_request(struct http_client_t *client, struct http_keyva
 	}
 	return HTTP_OK;
 
+#ifndef CONFIG_NETUTILS_WEBSERVER_INCREMENTAL_PARSER
 err_large_request:
 	http_send_response(client, 413, "Payload Too Large\r\n", NULL);
+#endif
 
 errout:
 	close(client->client_fd);
@@ -45,7 +45,7 @@ int http_client_tls_init(struct http_client_t *client)
 	/* Handshake */
 	HTTP_LOGD("  . Performing the SSL/TLS handshake...");
 
-	while ((result = mbedtls_ssl_handshake(&(client->tls_ssl))) != 0) {
+	while ((result = http_tls_session_handshake(&(client->server->tls_cache), &(client->tls_ssl))) != 0) {
 		if (result != MBEDTLS_ERR_SSL_WANT_READ && result != MBEDTLS_ERR_SSL_WANT_WRITE) {
 			HTTP_LOGE("Error: mbedtls_ssl_handshake returned -%4x\n", -result);
 			return HTTP_ERROR;
@@ -0,0 +1,419 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#include <protocols/webserver/http_err.h>
+#include <protocols/webserver/http_server.h>
+#include <protocols/webserver/http_parser.h>
+
+#include "http_arch.h"
+#include "http_log.h"
+
+#define HTTP_MAX_CHUNK_SIZE_DIGITS 8
+
+struct http_header_entry_t {
+	const char *name;
+	int len;
+};
+
+/* Indexed by enum http_header_id_e */
+static const struct http_header_entry_t g_http_headers[HTTP_HEADER_MAX] = {
+	{NULL, 0},
+	{"Accept", 6},
+	{"Accept-Encoding", 15},
+	{"Authorization", 13},
+	{"Cache-Control", 13},
+	{"Connection", 10},
+	{"Content-Length", 14},
+	{"Content-Type", 12},
+	{"Host", 4},
+	{"Keep-Alive", 10},
+	{"Sec-WebSocket-Key", 17},
+	{"Sec-WebSocket-Version", 21},
+	{"Trailer", 7},
+	{"Transfer-Encoding", 17},
+	{"Upgrade", 7},
+	{"User-Agent", 10},
+};
+
+int http_header_intern(const char *name, int len)
+{
+	int i;
+	int first = tolower((unsigned char)name[0]);
+
+	for (i = HTTP_HEADER_UNKNOWN + 1; i < HTTP_HEADER_MAX; i++) {
+		/* Length and first letter reject almost every candidate cheaply */
+		if (g_http_headers[i].len == len && tolower((unsigned char)g_http_headers[i].name[0]) == first &&
+			strncasecmp(g_http_headers[i].name, name, len) == 0) {
+			return i;
+		}
+	}
+
+	return HTTP_HEADER_UNKNOWN;
+}
+
+const char *http_header_name(int id)
+{
+	if (id <= HTTP_HEADER_UNKNOWN || id >= HTTP_HEADER_MAX) {
+		return NULL;
+	}
+
+	return g_http_headers[id].name;
+}
+
+bool http_slice_equal(const struct http_slice_t *slice, const char *str)
+{
+	return (int)strlen(str) == slice->len && strncasecmp(slice->ptr, str, slice->len) == 0;
+}
+
+static void http_parser_fail(struct http_parser_t *parser)
+{
+	parser->state = HTTP_PARSER_ERROR;
+}
+
+/* Returns the length of the line at buf without its line terminator and
+ * stores the length including the terminator to *consumed, or -1 if
+ * the line is not complete yet.
+ */
+static int http_parser_getline(const char *buf, int len, int *consumed)
+{
+	const char *lf = memchr(buf, '\n', len);
+	int line_len;
+
+	if (lf == NULL) {
+		return -1;
+	}
+
+	line_len = lf - buf;
+	*consumed = line_len + 1;
+	if (line_len > 0 && buf[line_len - 1] == '\r') {
+		line_len--;
+	}
+
+	return line_len;
+}
+
+static int http_parser_request_line(struct http_parser_t *parser, const char *line, int len)
+{
+	const char *sp1;
+	const char *sp2;
+	struct http_slice_t url;
+	int method_len;
+
+	sp1 = memchr(line, ' ', len);
+	if (sp1 == NULL) {
+		HTTP_LOGE("Error: Not HTTP Header!!\n");
+		return HTTP_ERROR;
+	}
+	method_len = sp1 - line;
+
+	if (method_len == 3 && strncmp(line, "GET", 3) == 0) {
+		parser->method = HTTP_METHOD_GET;
+	} else if (method_len == 3 && strncmp(line, "PUT", 3) == 0) {
+		parser->method = HTTP_METHOD_PUT;
+	} else if (method_len == 4 && strncmp(line, "POST", 4) == 0) {
+		parser->method = HTTP_METHOD_POST;
+	} else if (method_len == 6 && strncmp(line, "DELETE", 6) == 0) {
+		parser->method = HTTP_METHOD_DELETE;
+	} else {
+		HTTP_LOGE("Error: Invalid request method!!\n");
+		return HTTP_ERROR;
+	}
+
+	url.ptr = sp1 + 1;
+	sp2 = memchr(url.ptr, ' ', len - method_len - 1);
+	url.len = (sp2 ? sp2 : line + len) - url.ptr;
+	if (url.len <= 0 || url.len >= HTTP_CONF_MAX_REQUEST_HEADER_URL_LENGTH) {
+		HTTP_LOGE("Error: Invalid url length!!\n");
+		return HTTP_ERROR;
+	}
+
+	parser->httpver = HTTP_HTTP_VERSION_UNKNOWN;
+	if (sp2 && line + len - (sp2 + 1) == 8) {
+		if (strncmp(sp2 + 1, "HTTP/1.1", 8) == 0) {
+			parser->httpver = HTTP_HTTP_VERSION_11;
+		} else if (strncmp(sp2 + 1, "HTTP/1.0", 8) == 0) {
+			parser->httpver = HTTP_HTTP_VERSION_10;
+		} else if (strncmp(sp2 + 1, "HTTP/0.9", 8) == 0) {
+			parser->httpver = HTTP_HTTP_VERSION_09;
+		}
+	}
+
+	if (parser->cb->on_request_line && parser->cb->on_request_line(parser, &url) != HTTP_OK) {
+		return HTTP_ERROR;
+	}
+
+	return HTTP_OK;
+}
+
+/* Content-Length must be all digits and fit in 32 bits.  A repeated
+ * header is only accepted with the same value.
+ */
+static int http_parser_content_length(struct http_parser_t *parser, const struct http_slice_t *value)
+{
+	uint32_t len = 0;
+	int i;
+
+	if (value->len == 0) {
+		return HTTP_ERROR;
+	}
+
+	for (i = 0; i < value->len; i++) {
+		int c = value->ptr[i];
+
+		if (c < '0' || c > '9') {
+			return HTTP_ERROR;
+		}
+		c -= '0';
+
+		if (len > (UINT32_MAX - c) / 10) {
+			return HTTP_ERROR;
+		}
+		len = len * 10 + c;
+	}
+
+	if (parser->has_content_len && parser->content_len != len) {
+		return HTTP_ERROR;
+	}
+
+	parser->content_len = len;
+	parser->has_content_len = true;
+
+	return HTTP_OK;
+}
+
+static int http_parser_header_line(struct http_parser_t *parser, const char *line, int len)
+{
+	const char *colon;
+	struct http_slice_t name;
+	struct http_slice_t value;
+	int id;
+
+	colon = memchr(line, ':', len);
+	if (colon == NULL || colon == line || colon - line >= HTTP_CONF_MAX_KEY_LENGTH) {
+		HTTP_LOGE("Error: Invalid header line\n");
+		return HTTP_ERROR;
+	}
+
+	name.ptr = line;
+	name.len = colon - line;
+
+	value.ptr = colon + 1;
+	value.len = line + len - value.ptr;
+	while (value.len > 0 && (*value.ptr == ' ' || *value.ptr == '\t')) {
+		value.ptr++;
+		value.len--;
+	}
+	while (value.len > 0 && (value.ptr[value.len - 1] == ' ' || value.ptr[value.len - 1] == '\t')) {
+		value.len--;
+	}
+	if (value.len >= HTTP_CONF_MAX_VALUE_LENGTH) {
+		HTTP_LOGE("Error: The value length is over the value buffer size.\n");
+		return HTTP_ERROR;
+	}
+
+	id = http_header_intern(name.ptr, name.len);
+
+	/* Framing headers are only honoured in the header section, not in trailers */
+	if (parser->state == HTTP_PARSER_HEADER) {
+		if (id == HTTP_HEADER_CONTENT_LENGTH) {
+			if (http_parser_content_length(parser, &value) != HTTP_OK) {
+				HTTP_LOGE("Error: Invalid Content-Length\n");
+				return HTTP_ERROR;
+			}
+		} else if (id == HTTP_HEADER_TRANSFER_ENCODING && http_slice_equal(&value, "chunked")) {
+			parser->encoding = HTTP_CHUNKED_ENCODING;
+		}
+	}
+
+	if (parser->cb->on_header && parser->cb->on_header(parser, id, &name, &value) != HTTP_OK) {
+		return HTTP_ERROR;
+	}
+
+	return HTTP_OK;
+}
+
+static int http_parser_chunk_size(struct http_parser_t *parser, const char *line, int len)
+{
+	uint32_t size = 0;
+	int i;
+
+	for (i = 0; i < len; i++) {
+		int c = line[i];
+
+		if (c >= '0' && c <= '9') {
+			c -= '0';
+		} else if (c >= 'a' && c <= 'f') {
+			c -= 'a' - 10;
+		} else if (c >= 'A' && c <= 'F') {
+			c -= 'A' - 10;
+		} else if (c == ';' || c == ' ') {
+			/* Chunk extensions are ignored */
+			break;
+		} else {
+			return HTTP_ERROR;
+		}
+
+		if (i >= HTTP_MAX_CHUNK_SIZE_DIGITS) {
+			return HTTP_ERROR;
+		}
+		size = (size << 4) | c;
+	}
+
+	if (i == 0) {
+		return HTTP_ERROR;
+	}
+
+	parser->remaining = size;
+	parser->state = size ? HTTP_PARSER_CHUNK_DATA : HTTP_PARSER_TRAILER;
+
+	return HTTP_OK;
+}
+
+static int http_parser_complete(struct http_parser_t *parser)
+{
+	parser->state = HTTP_PARSER_DONE;
+	if (parser->cb->on_message_complete) {
+		return parser->cb->on_message_complete(parser);
+	}
+	return HTTP_OK;
+}
+
+static int http_parser_headers_done(struct http_parser_t *parser)
+{
+	if (parser->cb->on_headers_complete && parser->cb->on_headers_complete(parser) != HTTP_OK) {
+		return HTTP_ERROR;
+	}
+
+	if (parser->encoding == HTTP_CHUNKED_ENCODING) {
+		parser->state = HTTP_PARSER_CHUNK_SIZE;
+	} else if (parser->content_len > 0) {
+		parser->remaining = parser->content_len;
+		parser->state = HTTP_PARSER_BODY;
+	} else {
+		return http_parser_complete(parser);
+	}
+
+	return HTTP_OK;
+}
+
+void http_parser_init(struct http_parser_t *parser, const struct http_parser_cb_t *cb, void *priv)
+{
+	HTTP_MEMSET(parser, 0, sizeof(struct http_parser_t));
+	parser->state = HTTP_PARSER_REQUEST_LINE;
+	parser->method = HTTP_METHOD_UNKNOWN;
+	parser->encoding = HTTP_CONTENT_LENGTH;
+	parser->cb = cb;
+	parser->priv = priv;
+}
+
+int http_parser_execute(struct http_parser_t *parser, const char *buf, int len)
+{
+	int pos = 0;
+	int line_len;
+	int consumed;
+	int ret;
+	struct http_slice_t data;
+
+	while (pos < len && parser->state != HTTP_PARSER_DONE) {
+		switch (parser->state) {
+		case HTTP_PARSER_REQUEST_LINE:
+		case HTTP_PARSER_HEADER:
+		case HTTP_PARSER_CHUNK_SIZE:
+		case HTTP_PARSER_TRAILER:
+			line_len = http_parser_getline(buf + pos, len - pos, &consumed);
+			if (line_len < 0) {
+				/* Wait for the rest of the line */
+				return pos;
+			}
+
+			if (parser->state == HTTP_PARSER_REQUEST_LINE) {
+				/* Tolerate empty lines before the request line (RFC 7230 3.5) */
+				ret = line_len ? http_parser_request_line(parser, buf + pos, line_len) : HTTP_OK;
+				if (ret == HTTP_OK && line_len) {
+					parser->state = HTTP_PARSER_HEADER;
+				}
+			} else if (parser->state == HTTP_PARSER_CHUNK_SIZE) {
+				ret = http_parser_chunk_size(parser, buf + pos, line_len);
+			} else if (line_len > 0) {
+				ret = http_parser_header_line(parser, buf + pos, line_len);
+			} else if (parser->state == HTTP_PARSER_HEADER) {
+				ret = http_parser_headers_done(parser);
+			} else {
+				ret = http_parser_complete(parser);
+			}
+
+			if (ret != HTTP_OK) {
+				http_parser_fail(parser);
+				return HTTP_ERROR;
+			}
+			pos += consumed;
+			break;
+
+		case HTTP_PARSER_BODY:
+		case HTTP_PARSER_CHUNK_DATA:
+			data.ptr = buf + pos;
+			data.len = len - pos;
+			if ((uint32_t)data.len > parser->remaining) {
+				data.len = parser->remaining;
+			}
+
+			if (parser->cb->on_body && parser->cb->on_body(parser, &data) != HTTP_OK) {
+				http_parser_fail(parser);
+				return HTTP_ERROR;
+			}
+			pos += data.len;
+			parser->remaining -= data.len;
+
+			if (parser->remaining == 0) {
+				if (parser->state == HTTP_PARSER_CHUNK_DATA) {
+					parser->state = HTTP_PARSER_CHUNK_END;
+				} else if (http_parser_complete(parser) != HTTP_OK) {
+					http_parser_fail(parser);
+					return HTTP_ERROR;
+				}
+			}
+			break;
+
+		case HTTP_PARSER_CHUNK_END:
+			line_len = http_parser_getline(buf + pos, len - pos, &consumed);
+			if (line_len < 0) {
+				return pos;
+			}
+			if (line_len != 0) {
+				HTTP_LOGE("Error: Not accord with chunked encoding\n");
+				http_parser_fail(parser);
+				return HTTP_ERROR;
+			}
+			pos += consumed;
+			parser->state = HTTP_PARSER_CHUNK_SIZE;
+			break;
+
+		default:
+			return HTTP_ERROR;
+		}
+	}
+
+	return pos;
+}
@@ -49,7 +49,7 @@ int http_tls_init(struct http_server_t *server, struct ssl_config_t *ssl_config)
 	mbedtls_entropy_init(&(server->tls_entropy));
 	mbedtls_ctr_drbg_init(&(server->tls_ctr_drbg));
 	mbedtls_net_init(&(server->tls_ctx));
-	mbedtls_ssl_cache_init(&(server->tls_cache));
+	http_tls_session_cache_init(&(server->tls_cache), HTTP_TLS_SESSION_CACHE_SIZE, HTTP_TLS_SESSION_TIMEOUT);
 
 #ifdef MBEDTLS_DEBUG_C
 	mbedtls_debug_set_threshold(MBED_DEBUG_LEVEL);
@@ -109,7 +109,6 @@ int http_tls_init(struct http_server_t *server, struct ssl_config_t *ssl_config)
 
 	mbedtls_ssl_conf_rng(&(server->tls_conf), mbedtls_ctr_drbg_random, &(server->tls_ctr_drbg));
 	mbedtls_ssl_conf_dbg(&(server->tls_conf), http_tls_debug, stdout);
-	mbedtls_ssl_conf_session_cache(&(server->tls_conf), &(server->tls_cache), mbedtls_ssl_cache_get, mbedtls_ssl_cache_set);
 
 	/*
 	 * 3. Setup ssl stuffs
@@ -127,6 +126,11 @@ int http_tls_init(struct http_server_t *server, struct ssl_config_t *ssl_config)
 
 	HTTP_LOGD("Ok\n");
 
+	/* Resume sessions by session id and by session tickets */
+	if (http_tls_session_cache_conf(&(server->tls_cache), &(server->tls_conf), mbedtls_ctr_drbg_random, &(server->tls_ctr_drbg)) != HTTP_OK) {
+		return HTTP_ERROR;
+	}
+
 	mbedtls_ssl_conf_authmode(&server->tls_conf, ssl_config->auth_mode);
 
 	server->tls_init = 1;
@@ -135,7 +139,7 @@ int http_tls_init(struct http_server_t *server, struct ssl_config_t *ssl_config)
 
 int http_server_tls_release(struct http_server_t *server)
 {
-	mbedtls_ssl_cache_free(&(server->tls_cache));
+	http_tls_session_cache_free(&(server->tls_cache));
 	mbedtls_x509_crt_free(&(server->tls_srvcert));
 	mbedtls_pk_free(&(server->tls_pkey));
 	mbedtls_ssl_config_free(&(server->tls_conf));
@@ -0,0 +1,338 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <protocols/webserver/http_err.h>
+#include <protocols/webserver/http_tls_session.h>
+
+#include "mbedtls/ssl_misc.h"
+#include "http_log.h"
+
+#ifdef CONFIG_NETUTILS_TLS_SESSION_TICKET_LIFETIME
+#define HTTP_TLS_TICKET_LIFETIME CONFIG_NETUTILS_TLS_SESSION_TICKET_LIFETIME
+#else
+#define HTTP_TLS_TICKET_LIFETIME 86400
+#endif
+
+/* An entry keeps the key followed by the serialized session in data[] */
+struct http_tls_session_entry_t {
+	dq_entry_t node;
+	time_t timestamp;
+	size_t key_len;
+	size_t session_len;
+	unsigned char data[1];
+};
+
+static struct http_tls_session_entry_t *http_tls_session_find(struct http_tls_session_cache_t *cache,
+															  const unsigned char *key, size_t key_len)
+{
+	struct http_tls_session_entry_t *entry;
+	time_t now = time(NULL);
+
+	entry = (struct http_tls_session_entry_t *)dq_peek(&cache->lru);
+	while (entry) {
+		if (entry->key_len == key_len && memcmp(entry->data, key, key_len) == 0) {
+			if (cache->timeout != 0 && now - entry->timestamp > cache->timeout) {
+				dq_rem(&entry->node, &cache->lru);
+				cache->nentries--;
+				cache->stats.expired++;
+				free(entry);
+				return NULL;
+			}
+			return entry;
+		}
+		entry = (struct http_tls_session_entry_t *)dq_next(&entry->node);
+	}
+
+	return NULL;
+}
+
+static int http_tls_session_store(struct http_tls_session_cache_t *cache, const unsigned char *key,
+								  size_t key_len, const mbedtls_ssl_session *session)
+{
+	struct http_tls_session_entry_t *entry;
+	size_t len = 0;
+
+	if (cache->max_entries <= 0) {
+		return HTTP_ERROR;
+	}
+
+	if (mbedtls_ssl_session_save(session, NULL, 0, &len) != MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL) {
+		return HTTP_ERROR;
+	}
+
+	entry = (struct http_tls_session_entry_t *)malloc(sizeof(struct http_tls_session_entry_t) + key_len + len);
+	if (entry == NULL) {
+		HTTP_LOGE("Error: Cannot allocate session entry!!\n");
+		return HTTP_ERROR;
+	}
+
+	memcpy(entry->data, key, key_len);
+	if (mbedtls_ssl_session_save(session, entry->data + key_len, len, &len) != 0) {
+		free(entry);
+		return HTTP_ERROR;
+	}
+	entry->key_len = key_len;
+	entry->session_len = len;
+	entry->timestamp = time(NULL);
+
+	pthread_mutex_lock(&cache->lock);
+
+	/* A new session for the same key replaces the old one */
+	{
+		struct http_tls_session_entry_t *old = http_tls_session_find(cache, key, key_len);
+
+		if (old) {
+			dq_rem(&old->node, &cache->lru);
+			cache->nentries--;
+			free(old);
+		}
+	}
+
+	while (cache->nentries >= cache->max_entries) {
+		struct http_tls_session_entry_t *last = (struct http_tls_session_entry_t *)dq_tail(&cache->lru);
+
+		dq_rem(&last->node, &cache->lru);
+		cache->nentries--;
+		cache->stats.evictions++;
+		free(last);
+	}
+
+	dq_addfirst(&entry->node, &cache->lru);
+	cache->nentries++;
+	cache->stats.stores++;
+
+	pthread_mutex_unlock(&cache->lock);
+
+	return HTTP_OK;
+}
+
+static int http_tls_session_fetch(struct http_tls_session_cache_t *cache, const unsigned char *key,
+								  size_t key_len, mbedtls_ssl_session *session)
+{
+	struct http_tls_session_entry_t *entry;
+	int result = HTTP_ERROR;
+
+	pthread_mutex_lock(&cache->lock);
+
+	cache->stats.lookups++;
+	entry = http_tls_session_find(cache, key, key_len);
+	if (entry && mbedtls_ssl_session_load(session, entry->data + key_len, entry->session_len) == 0) {
+		/* Most recently used sessions stay at the head */
+		dq_rem(&entry->node, &cache->lru);
+		dq_addfirst(&entry->node, &cache->lru);
+		cache->stats.hits++;
+		result = HTTP_OK;
+	}
+
+	pthread_mutex_unlock(&cache->lock);
+
+	return result;
+}
+
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(CONFIG_NETUTILS_TLS_SESSION_TICKETS)
+static int http_tls_ticket_write(void *p_ticket, const mbedtls_ssl_session *session, unsigned char *start,
+								 const unsigned char *end, size_t *tlen, uint32_t *lifetime)
+{
+	struct http_tls_session_cache_t *cache = (struct http_tls_session_cache_t *)p_ticket;
+	int result;
+
+	result = mbedtls_ssl_ticket_write(&cache->ticket, session, start, end, tlen, lifetime);
+	if (result == 0) {
+		pthread_mutex_lock(&cache->lock);
+		cache->stats.tickets_issued++;
+		pthread_mutex_unlock(&cache->lock);
+	}
+
+	return result;
+}
+
+static int http_tls_ticket_parse(void *p_ticket, mbedtls_ssl_session *session, unsigned char *buf, size_t len)
+{
+	struct http_tls_session_cache_t *cache = (struct http_tls_session_cache_t *)p_ticket;
+	int result;
+
+	result = mbedtls_ssl_ticket_parse(&cache->ticket, session, buf, len);
+	if (result == 0) {
+		pthread_mutex_lock(&cache->lock);
+		cache->stats.tickets_accepted++;
+		pthread_mutex_unlock(&cache->lock);
+	}
+
+	return result;
+}
+#endif
+
+void http_tls_session_cache_init(struct http_tls_session_cache_t *cache, int max_entries, int timeout)
+{
+	memset(cache, 0, sizeof(struct http_tls_session_cache_t));
+	pthread_mutex_init(&cache->lock, NULL);
+	dq_init(&cache->lru);
+	cache->max_entries = max_entries;
+	cache->timeout = timeout;
+}
+
+void http_tls_session_cache_free(struct http_tls_session_cache_t *cache)
+{
+	struct http_tls_session_entry_t *entry;
+
+	pthread_mutex_lock(&cache->lock);
+	while ((entry = (struct http_tls_session_entry_t *)dq_remfirst(&cache->lru)) != NULL) {
+		free(entry);
+	}
+	cache->nentries = 0;
+	pthread_mutex_unlock(&cache->lock);
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+	if (cache->ticket_init) {
+		mbedtls_ssl_ticket_free(&cache->ticket);
+		cache->ticket_init = 0;
+	}
+#endif
+	pthread_mutex_destroy(&cache->lock);
+}
+
+int http_tls_session_cache_conf(struct http_tls_session_cache_t *cache, mbedtls_ssl_config *conf,
+								int (*f_rng)(void *, unsigned char *, size_t), void *p_rng)
+{
+	mbedtls_ssl_conf_session_cache(conf, cache, http_tls_session_cache_get, http_tls_session_cache_set);
+
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(CONFIG_NETUTILS_TLS_SESSION_TICKETS)
+	{
+		int result;
+
+		mbedtls_ssl_ticket_init(&cache->ticket);
+		if ((result = mbedtls_ssl_ticket_setup(&cache->ticket, f_rng, p_rng,
+											   MBEDTLS_CIPHER_AES_256_GCM, HTTP_TLS_TICKET_LIFETIME)) != 0) {
+			HTTP_LOGE("Error: mbedtls_ssl_ticket_setup returned -%4x\n", -result);
+			mbedtls_ssl_ticket_free(&cache->ticket);
+			return HTTP_ERROR;
+		}
+		cache->ticket_init = 1;
+
+		mbedtls_ssl_conf_session_tickets_cb(conf, http_tls_ticket_write, http_tls_ticket_parse, cache);
+	}
+#endif
+
+	return HTTP_OK;
+}
+
+int http_tls_session_cache_get(void *data, unsigned char const *session_id,
+							   size_t session_id_len, mbedtls_ssl_session *session)
+{
+	struct http_tls_session_cache_t *cache = (struct http_tls_session_cache_t *)data;
+
+	if (session_id_len == 0) {
+		return HTTP_ERROR;
+	}
+
+	return http_tls_session_fetch(cache, session_id, session_id_len, session) == HTTP_OK ? 0 : HTTP_ERROR;
+}
+
+int http_tls_session_cache_set(void *data, unsigned char const *session_id,
+							   size_t session_id_len, const mbedtls_ssl_session *session)
+{
+	struct http_tls_session_cache_t *cache = (struct http_tls_session_cache_t *)data;
+
+	if (session_id_len == 0) {
+		return HTTP_ERROR;
+	}
+
+	return http_tls_session_store(cache, session_id, session_id_len, session) == HTTP_OK ? 0 : HTTP_ERROR;
+}
+
+int http_tls_session_load(struct http_tls_session_cache_t *cache, const char *key, mbedtls_ssl_context *ssl)
+{
+	mbedtls_ssl_session session;
+	int result = HTTP_ERROR;
+
+	mbedtls_ssl_session_init(&session);
+
+	if (http_tls_session_fetch(cache, (const unsigned char *)key, strlen(key), &session) == HTTP_OK) {
+		if (mbedtls_ssl_set_session(ssl, &session) == 0) {
+			result = HTTP_OK;
+		}
+	}
+
+	mbedtls_ssl_session_free(&session);
+
+	return result;
+}
+
+int http_tls_session_save(struct http_tls_session_cache_t *cache, const char *key, mbedtls_ssl_context *ssl)
+{
+	mbedtls_ssl_session session;
+	int result = HTTP_ERROR;
+
+	mbedtls_ssl_session_init(&session);
+
+	if (mbedtls_ssl_get_session(ssl, &session) == 0) {
+		result = http_tls_session_store(cache, (const unsigned char *)key, strlen(key), &session);
+	}
+
+	mbedtls_ssl_session_free(&session);
+
+	return result;
+}
+
+int http_tls_session_handshake(struct http_tls_session_cache_t *cache, mbedtls_ssl_context *ssl)
+{
+	int result = 0;
+	int stepped = 0;
+	int resumed = 0;
+
+	if (ssl == NULL || ssl->conf == NULL) {
+		return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+	}
+
+	/*
+	 * Step through the handshake so the resume flag can be sampled before
+	 * the wrapup step releases the handshake parameters.
+	 */
+	while (!mbedtls_ssl_is_handshake_over(ssl)) {
+		if (ssl->handshake) {
+			resumed = ssl->handshake->resume;
+		}
+		stepped = 1;
+		if ((result = mbedtls_ssl_handshake_step(ssl)) != 0) {
+			return result;
+		}
+	}
+
+	if (cache && stepped) {
+		pthread_mutex_lock(&cache->lock);
+		if (resumed) {
+			cache->stats.resumed_handshakes++;
+		} else {
+			cache->stats.full_handshakes++;
+		}
+		pthread_mutex_unlock(&cache->lock);
+	}
+
+	return result;
+}
+
+void http_tls_session_get_stats(struct http_tls_session_cache_t *cache, struct http_tls_session_stats_t *stats)
+{
+	pthread_mutex_lock(&cache->lock);
+	memcpy(stats, &cache->stats, sizeof(struct http_tls_session_stats_t));
+	pthread_mutex_unlock(&cache->lock);
+}
@@ -132,6 +132,7 @@ struct _mqtt_client_config_s {
 	/**< on_unsubscribe call back function */
 
 	void *user_data; /**< user defined data */
+	int max_inflight; /**< maximum number of unacknowledged QoS 1 and 2 messages, 0 for CONFIG_NETUTILS_MQTT_MAX_INFLIGHT */
 };
 
 typedef struct _mqtt_client_config_s mqtt_client_config_t;
@@ -198,6 +199,9 @@ int mqtt_disconnect(mqtt_client_t *handle);
  * @brief mqtt_publish() pusblishes message to a MQTT broker on the given topic
  *
  * @details @b #include <network/mqtt/mqtt_api.h>
+ * The message is queued and the call returns without waiting for the broker.
+ * Up to max_inflight QoS 1 and 2 messages are sent before their
+ * acknowledgements arrive, on_publish reports each completed message.
  * @param[in] handle the handle of MQTT client object
  * @param[in] topic the topic on which the message to be published
  * @param[in] data the message to publish
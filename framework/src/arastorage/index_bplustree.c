@@ -62,7 +62,6 @@
 #include "db_debug.h"
 #include "storage.h"
 #include "random.h"
-#include "rw_locks.h"
 
 /****************************************************************************
  * Pre-processor Definitions
@@ -245,7 +244,7 @@ struct tree_s {
 	pthread_mutex_t node_cache_lock;	/*  Maintains concurrency control over Node Cache  */
 	pthread_mutex_t buck_cache_lock;	/*  Maintains concurrency control over Bucket Cache  */
 	pthread_mutex_t bucket_lock;	/*  Maintains serialisability over in RAM Tree Structure  */
-	struct rw_lock_s tree_lock;	/*  A Reader Writer Lock used to maintain consistency in tree structure */
+	pthread_rwlock_t tree_lock;	/*  A Reader Writer Lock used to maintain consistency in tree structure */
 };
 typedef struct tree_s tree_t;
 
@@ -518,7 +517,7 @@ static db_result_t create(index_t *index)
 	pthread_mutex_init(&(tree->node_cache_lock), NULL);
 	pthread_mutex_init(&(tree->bucket_lock), NULL);
 	pthread_mutex_init(&(tree->buck_cache_lock), NULL);
-	rw_init(&(tree->tree_lock));
+	pthread_rwlock_init(&(tree->tree_lock), NULL);
 
 	tree->off_nodes = tree->off_buckets = 0;
 
@@ -843,7 +842,7 @@ static tuple_id_t get_next(index_iterator_t *iterator, uint8_t matched_condition
 	/* To initialize the iterator_cache */
 	if (iterator->next_item_no == 0) {	/* removed the condition of iterator inequality */
 		if (iterator->found_items == 0) {
-			rw_lock_write(&(tree->tree_lock));
+			pthread_rwlock_wrlock(&(tree->tree_lock));
 			pair_t *path = tree_find(tree, key_min);
 			if (path == NULL) {
 				return INVALID_TUPLE;
@@ -919,7 +918,7 @@ static tuple_id_t get_next(index_iterator_t *iterator, uint8_t matched_condition
 			iterator->next_item_no = 1;
 		}
 		pthread_mutex_unlock(&(tree->bucket_lock));
-		rw_unlock_write(&(tree->tree_lock));
+		pthread_rwlock_unlock(&(tree->tree_lock));
 		return INVALID_TUPLE;
 	}
 	while (tree->lock_buckets[cache.bucket_id] == 1) {
@@ -940,7 +939,7 @@ static tuple_id_t get_next(index_iterator_t *iterator, uint8_t matched_condition
 			iterator->next_item_no = 1;
 		}
 		pthread_mutex_unlock(&(tree->bucket_lock));
-		rw_unlock_write(&(tree->tree_lock));
+		pthread_rwlock_unlock(&(tree->tree_lock));
 		return INVALID_TUPLE;
 
 	}
@@ -1859,14 +1858,14 @@ start:
 	bucket_id = -1;
 	pair_t pair;
 	while (bucket_id < 0) {
-		rw_lock_read(&(tree->tree_lock));
+		pthread_rwlock_rdlock(&(tree->tree_lock));
 		path = tree_find(tree, key);
 		if (path == NULL) {
-			rw_unlock_read(&(tree->tree_lock));
+			pthread_rwlock_unlock(&(tree->tree_lock));
 			continue;
 		}
 		bucket_id = path[tree->levels].key;
-		rw_unlock_read(&(tree->tree_lock));
+		pthread_rwlock_unlock(&(tree->tree_lock));
 	}
 	pair.key = key;
 	pair.value = value;
@@ -1878,7 +1877,7 @@ start:
 	if (num_entries_bucket == BUCKET_SIZE) {
 		DB_LOG_D("DB: Bucket %d is full\n", bucket_id);
 retry:
-		if (rw_trylock_write(&(tree->tree_lock)) == 0) {
+		if (pthread_rwlock_trywrlock(&(tree->tree_lock)) != OK) {
 			pthread_mutex_lock(&(tree->bucket_lock));
 			tree->lock_buckets[bucket_id] = 0;
 			pthread_mutex_unlock(&(tree->bucket_lock));
@@ -1892,18 +1891,18 @@ retry:
 			if (tree->lock_buckets[bucket_id] == 0) {
 				DB_LOG_E("PANIC EDITED BUCKET WITHOUT LOCK\n");
 				pthread_mutex_unlock(&(tree->bucket_lock));
-				rw_unlock_write(&(tree->tree_lock));
+				pthread_rwlock_unlock(&(tree->tree_lock));
 				free(path);
 				return TREE_LOCK_ERROR;
 			} else {
 				tree->lock_buckets[bucket_id] = 0;
 				pthread_mutex_unlock(&(tree->bucket_lock));
-				rw_unlock_write(&(tree->tree_lock));
+				pthread_rwlock_unlock(&(tree->tree_lock));
 			}
 			free(path);
 			return TREE_INSERT_FAIL;
 		} else if (res == BSPLIT_RETRY) {
-			rw_unlock_write(&(tree->tree_lock));
+			pthread_rwlock_unlock(&(tree->tree_lock));
 			goto retry;
 		}
 
@@ -1911,13 +1910,13 @@ retry:
 		if (tree->lock_buckets[bucket_id] == 0) {
 			DB_LOG_E("PANIC EDITED BUCKET WITHOUT LOCK\n");
 			pthread_mutex_unlock(&(tree->bucket_lock));
-			rw_unlock_write(&(tree->tree_lock));
+			pthread_rwlock_unlock(&(tree->tree_lock));
 			free(path);
 			return TREE_LOCK_ERROR;
 		} else {
 			tree->lock_buckets[bucket_id] = 0;
 			pthread_mutex_unlock(&(tree->bucket_lock));
-			rw_unlock_write(&(tree->tree_lock));
+			pthread_rwlock_unlock(&(tree->tree_lock));
 		}
 	} else {
 		/* If the bucket has space for the entry, just append the new entry in the cache */
@@ -2579,16 +2578,16 @@ static db_result_t delete_item_btree(index_t *index, int value)
 		}
 	}
 
+	/* The tree lock is not taken here, only the bucket lock is released */
+
 	pthread_mutex_lock(&(tree->bucket_lock));
 	if (tree->lock_buckets[bucket_id] == 0) {
 		DB_LOG_E("PANIC EDITED BUCKET WITHOUT LOCK\n");
 		pthread_mutex_unlock(&(tree->bucket_lock));
-		rw_unlock_write(&(tree->tree_lock));
 		ret = DB_INDEX_ERROR;
 	} else {
 		tree->lock_buckets[bucket_id] = 0;
 		pthread_mutex_unlock(&(tree->bucket_lock));
-		rw_unlock_write(&(tree->tree_lock));
 	}
 
 	free(path);
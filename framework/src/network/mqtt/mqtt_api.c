@@ -40,6 +40,10 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+#ifndef CONFIG_NETUTILS_MQTT_MAX_INFLIGHT
+#define CONFIG_NETUTILS_MQTT_MAX_INFLIGHT 20
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -108,26 +112,18 @@ static void on_disconnect_callback(struct mosquitto *client, void *data, int res
 static void on_message_callback(struct mosquitto *client, void *data, const struct mosquitto_message *msg)
 {
 	mqtt_client_t *mqtt_client = (mqtt_client_t *)data;
-	mqtt_msg_t *received_msg;
+	mqtt_msg_t received_msg;
 
-	received_msg = (mqtt_msg_t *)mosquitto__malloc(sizeof(mqtt_msg_t));
-	if (!received_msg) {
-		ndbg("ERROR: received_msg is null.");
-		return;
-	}
-
-	received_msg->msg_id = msg->mid;
-	received_msg->topic = msg->topic;
-	received_msg->payload = msg->payload;
-	received_msg->payload_len = msg->payloadlen;
-	received_msg->qos = msg->qos;
-	received_msg->retain = msg->retain;
+	received_msg.msg_id = msg->mid;
+	received_msg.topic = msg->topic;
+	received_msg.payload = msg->payload;
+	received_msg.payload_len = msg->payloadlen;
+	received_msg.qos = msg->qos;
+	received_msg.retain = msg->retain;
 
 	if (mqtt_client && mqtt_client->config && mqtt_client->config->on_message) {
-		mqtt_client->config->on_message(mqtt_client, received_msg);
+		mqtt_client->config->on_message(mqtt_client, &received_msg);
 	}
-
-	mosquitto__free(received_msg);
 }
 
 static void on_publish_callback(struct mosquitto *client, void *data, int msg_id)
@@ -212,6 +208,7 @@ mqtt_client_t *mqtt_init_client(mqtt_client_config_t *config)
 	mqtt_client_t *mqtt_client = NULL;
 	int ret = 0;
 	int major, minor, revision;
+	int max_inflight;
 
 	if (config == NULL) {
 		ndbg("ERROR: mqtt config is null.\n");
@@ -272,6 +269,14 @@ mqtt_client_t *mqtt_init_client(mqtt_client_config_t *config)
 		ndbg("ERROR: fail to set mqtt protocol version.\n");
 		goto done;
 	}
+
+	/* set the number of messages sent ahead of their acknowledgement */
+	max_inflight = config->max_inflight > 0 ? config->max_inflight : CONFIG_NETUTILS_MQTT_MAX_INFLIGHT;
+	ret = mosquitto_int_option((struct mosquitto *)mqtt_client->mosq, MOSQ_OPT_SEND_MAXIMUM, max_inflight);
+	if (ret != MOSQ_ERR_SUCCESS) {
+		ndbg("ERROR: fail to set mqtt max inflight messages.\n");
+		goto done;
+	}
 #if defined(CONFIG_NETUTILS_MQTT_SECURITY)
 	if (config->tls) {
 		struct mosquitto *tmp = (struct mosquitto *)mqtt_client->mosq;
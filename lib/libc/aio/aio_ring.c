@@ -0,0 +1,160 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <aio.h>
+#include <errno.h>
+#include <string.h>
+#include <semaphore.h>
+
+#include <tinyara/semaphore.h>
+
+#ifdef CONFIG_FS_AIO_RING
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aio_ring_setup
+ *
+ * Description:
+ *   Prepare 'ring' to use the caller's arrays of 'entries' submission and
+ *   completion entries.  The ring and the arrays must stay valid until
+ *   aio_ring_teardown().
+ *
+ * Input Parameters:
+ *   ring    - The ring to set up
+ *   sq      - Array of 'entries' submission entries
+ *   cq      - Array of 'entries' completion entries
+ *   entries - Size of both queues, a power of two no larger than 32768
+ *
+ * Returned Value:
+ *   0 on success, or -1 with errno set to EINVAL.
+ *
+ ****************************************************************************/
+
+int aio_ring_setup(FAR struct aio_ring *ring, FAR struct aio_sqe *sq, FAR struct aio_cqe *cq, unsigned int entries)
+{
+	if (ring == NULL || sq == NULL || cq == NULL || entries == 0 || entries > 32768 || (entries & (entries - 1)) != 0) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	memset(ring, 0, sizeof(struct aio_ring));
+	ring->sq = sq;
+	ring->cq = cq;
+	ring->entries = entries;
+
+	/* waitsem is a signalling semaphore */
+
+	sem_init(&ring->waitsem, 0, 0);
+	sem_setprotocol(&ring->waitsem, SEM_PRIO_NONE);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: aio_ring_teardown
+ *
+ * Description:
+ *   Release a ring.  This fails with EBUSY while requests are in flight,
+ *   because their completions are still to be posted to the ring.
+ *
+ ****************************************************************************/
+
+int aio_ring_teardown(FAR struct aio_ring *ring)
+{
+	if (ring == NULL || ring->entries == 0) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	if (ring->inflight > 0) {
+		set_errno(EBUSY);
+		return ERROR;
+	}
+
+	sem_destroy(&ring->waitsem);
+	ring->entries = 0;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: aio_ring_get_sqe
+ *
+ * Description:
+ *   Return the next free submission entry and queue it, or NULL if the
+ *   submission queue is full.  The entry is consumed by the next
+ *   aio_ring_submit(), so it must be filled in before that call.
+ *
+ ****************************************************************************/
+
+FAR struct aio_sqe *aio_ring_get_sqe(FAR struct aio_ring *ring)
+{
+	FAR struct aio_sqe *sqe;
+
+	if ((uint16_t)(ring->sq_tail - ring->sq_head) >= ring->entries) {
+		return NULL;
+	}
+
+	sqe = &ring->sq[ring->sq_tail & (ring->entries - 1)];
+	memset(sqe, 0, sizeof(struct aio_sqe));
+	ring->sq_tail++;
+	return sqe;
+}
+
+/****************************************************************************
+ * Name: aio_ring_peek_cqe
+ *
+ * Description:
+ *   Return the oldest completion that has not been consumed, or NULL if
+ *   there is none.  This never blocks; aio_ring_cqe_seen() consumes it.
+ *
+ ****************************************************************************/
+
+FAR struct aio_cqe *aio_ring_peek_cqe(FAR struct aio_ring *ring)
+{
+	if (ring->cq_head == ring->cq_tail) {
+		return NULL;
+	}
+
+	return &ring->cq[ring->cq_head & (ring->entries - 1)];
+}
+
+/****************************************************************************
+ * Name: aio_ring_cqe_seen
+ *
+ * Description:
+ *   Consume the completion returned by aio_ring_peek_cqe(), freeing its
+ *   slot for another request.
+ *
+ ****************************************************************************/
+
+void aio_ring_cqe_seen(FAR struct aio_ring *ring)
+{
+	if (ring->cq_head != ring->cq_tail) {
+		ring->cq_head++;
+	}
+}
+
+#endif							/* CONFIG_FS_AIO_RING */
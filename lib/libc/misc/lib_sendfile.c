@@ -60,6 +60,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <errno.h>
 #include <limits.h>
 
@@ -92,11 +93,11 @@
  *
  * Description:
  *   sendfile() copies data between one file descriptor and another.
- *   sendfile() basically just wraps a sequence of reads() and writes()
- *   to perform a copy.  It serves a purpose in systems where there is
- *   a penalty for copies to between user and kernal space, but really
- *   nothing in TinyAra but provide some Linux compatible (and adding
- *   another 'almost standard' interface).
+ *   With CONFIG_FS_SPLICE, it is a sequence of splice() calls that move
+ *   the data inside the kernel, copying it once where one end is a pipe
+ *   or the input file can be mapped.  Otherwise sendfile() just wraps a
+ *   sequence of reads() and writes() through a user buffer to perform the
+ *   copy.
  *
  *   NOTE: This interface is *not* specified in POSIX.1-2001, or other
  *   standards.  The implementation here is very similar to the Linux
@@ -131,6 +132,45 @@
  *
  ************************************************************************/
 
+#ifdef CONFIG_FS_SPLICE
+ssize_t sendfile(int outfd, int infd, off_t *offset, size_t count)
+{
+	ssize_t ntransferred = 0;
+	ssize_t ret;
+
+	if (count > SSIZE_MAX) {
+		count = SSIZE_MAX;
+	}
+
+	/* splice() advances *offset (or the file position) by what it moved */
+
+	while (ntransferred < count) {
+		ret = splice(infd, offset, outfd, NULL, count - ntransferred, 0);
+		if (ret == 0) {
+			/* End of file */
+
+			break;
+		}
+
+		if (ret < 0) {
+			/* EINTR is not an error once some data has been transferred
+			 * (but will still stop the copy).
+			 */
+
+#ifndef CONFIG_DISABLE_SIGNALS
+			if (errno == EINTR && ntransferred > 0) {
+				break;
+			}
+#endif
+			return ERROR;
+		}
+
+		ntransferred += ret;
+	}
+
+	return ntransferred;
+}
+#else
 ssize_t sendfile(int outfd, int infd, off_t *offset, size_t count)
 {
 	FAR uint8_t *iobuffer;
@@ -177,9 +217,11 @@ ssize_t sendfile(int outfd, int infd, off_t *offset, size_t count)
 		/* Loop until the read side of the transfer comes to some conclusion */
 
 		do {
-			/* Read a buffer of data from the infd */
+			/* Read a buffer of data from the infd, but no more than is left
+			 * to transfer.
+			 */
 
-			nbytesread = read(infd, iobuffer, read_buf_size);
+			nbytesread = read(infd, iobuffer, count - ntransferred < read_buf_size ? count - ntransferred : read_buf_size);
 
 			/* Check for end of file */
 
@@ -310,5 +352,6 @@ ssize_t sendfile(int outfd, int infd, off_t *offset, size_t count)
 
 	return ntransferred;
 }
+#endif							/* CONFIG_FS_SPLICE */
 
 #endif							/* CONFIG_NSOCKET_DESCRIPTORS > 0 || CONFIG_NFILE_DESCRIPTORS > 0 */
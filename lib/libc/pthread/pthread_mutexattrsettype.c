@@ -104,6 +104,13 @@
 
 int pthread_mutexattr_settype(pthread_mutexattr_t *attr, int type)
 {
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+	if (attr && type == PTHREAD_MUTEX_ADAPTIVE_NP) {
+		attr->type = type;
+		return OK;
+	}
+#endif
+
 	if (attr && type >= PTHREAD_MUTEX_NORMAL && type <= PTHREAD_MUTEX_RECURSIVE) {
 #ifdef CONFIG_PTHREAD_MUTEX_TYPES
 		attr->type = type;
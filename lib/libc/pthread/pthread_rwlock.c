@@ -59,15 +59,34 @@
 #include <stdint.h>
 #include <sys/types.h>
 #include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
 #include <errno.h>
 #include <debug.h>
 
 #include <tinyara/semaphore.h>
 
+#include "pthread_rwlock.h"
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
 
+int rwlock_semwait(FAR sem_t *sem, FAR const struct timespec *abstime)
+{
+	int ret;
+
+	do {
+		if (abstime != NULL) {
+			ret = sem_timedwait(sem, abstime);
+		} else {
+			ret = sem_wait(sem);
+		}
+	} while (ret < 0 && get_errno() == EINTR);
+
+	return ret < 0 ? get_errno() : OK;
+}
+
 int pthread_rwlock_init(FAR pthread_rwlock_t *lock, FAR const pthread_rwlockattr_t *attr)
 {
 	int err;
@@ -80,59 +99,72 @@ int pthread_rwlock_init(FAR pthread_rwlock_t *lock, FAR const pthread_rwlockattr
 		return ENOSYS;
 	}
 
-	lock->num_readers = 0;
-	lock->num_writers = 0;
-	lock->write_in_progress = false;
+	lock->state = 0;
+	lock->writer = -1;
 
-	err = pthread_cond_init(&lock->cv, NULL);
-	if (err != 0) {
-		return err;
+	/* Writers hold 'wlock' for as long as they hold the lock, so that the
+	 * threads waiting on it boost the priority of the writer.
+	 */
+
+	if (sem_init(&lock->wlock, 0, 1) != OK) {
+		return get_errno();
 	}
 
-	err = pthread_mutex_init(&lock->lock, NULL);
-	if (err != 0) {
-		pthread_cond_destroy(&lock->cv);
+	if (sem_init(&lock->rdrain, 0, 0) != OK) {
+		err = get_errno();
+		sem_destroy(&lock->wlock);
 		return err;
 	}
 
-	return err;
+#ifdef CONFIG_PRIORITY_INHERITANCE
+	/* 'rdrain' is only used for signaling */
+
+	sem_setprotocol(&lock->rdrain, SEM_PRIO_NONE);
+#endif
+
+	return OK;
 }
 
 int pthread_rwlock_destroy(FAR pthread_rwlock_t *lock)
 {
-	int cond_err = pthread_cond_destroy(&lock->cv);
-	int mutex_err = pthread_mutex_destroy(&lock->lock);
+	if (rwlock_load(&lock->state) != 0) {
+		return EBUSY;
+	}
 
-	if (mutex_err) {
-		return mutex_err;
+	sem_destroy(&lock->rdrain);
+	if (sem_destroy(&lock->wlock) != OK) {
+		return get_errno();
 	}
 
-	return cond_err;
+	return OK;
 }
 
-int pthread_rwlock_unlock(FAR pthread_rwlock_t *rw_lock)
+int pthread_rwlock_unlock(FAR pthread_rwlock_t *lock)
 {
-	int err;
+	uint32_t state;
 
-	err = pthread_mutex_lock(&rw_lock->lock);
-	if (err != 0) {
-		return err;
-	}
+	if (lock->writer == getpid()) {
+		/* Wake one thread waiting for 'wlock': the next writer, or the
+		 * first of the blocked readers, which passes it on to the next.
+		 */
 
-	if (rw_lock->num_readers > 0) {
-		rw_lock->num_readers--;
+		lock->writer = -1;
+		rwlock_fetch_and(&lock->state, ~RWLOCK_WRITER);
+		return sem_post(&lock->wlock) == OK ? OK : get_errno();
+	}
 
-		if (rw_lock->num_readers == 0) {
-			err = pthread_cond_broadcast(&rw_lock->cv);
+	state = rwlock_load(&lock->state);
+	do {
+		if ((state & RWLOCK_READERS) == 0) {
+			return EPERM;
 		}
-	} else if (rw_lock->write_in_progress) {
-		rw_lock->write_in_progress = false;
+	} while (!rwlock_cas(&lock->state, &state, state - 1));
+
+	/* The last reader out lets the waiting writer in */
 
-		err = pthread_cond_broadcast(&rw_lock->cv);
-	} else {
-		err = EINVAL;
+	if (state == (RWLOCK_WRITER | 1)) {
+		return sem_post(&lock->rdrain) == OK ? OK : get_errno();
 	}
 
-	pthread_mutex_unlock(&rw_lock->lock);
-	return err;
+	return OK;
 }
@@ -0,0 +1,96 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __LIBC_PTHREAD_PTHREAD_RWLOCK_H
+#define __LIBC_PTHREAD_PTHREAD_RWLOCK_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The state word of a read/write lock holds the number of active readers
+ * and a bit set by the writer that holds 'wlock'.  While the bit is set no
+ * reader enters without first taking 'wlock' itself, and the reader that
+ * brings the count to zero posts 'rdrain' for the writer.
+ */
+
+#define RWLOCK_WRITER      0x80000000
+#define RWLOCK_READERS     0x7fffffff
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/* Reads of the state word are relaxed, the read-modify-write operations
+ * give the ordering of lock acquire and release.
+ */
+
+static inline uint32_t rwlock_load(FAR volatile uint32_t *state)
+{
+	return __atomic_load_n(state, __ATOMIC_RELAXED);
+}
+
+static inline bool rwlock_cas(FAR volatile uint32_t *state, FAR uint32_t *expected, uint32_t desired)
+{
+	return __atomic_compare_exchange_n(state, expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+static inline uint32_t rwlock_fetch_add(FAR volatile uint32_t *state, uint32_t value)
+{
+	return __atomic_fetch_add(state, value, __ATOMIC_ACQ_REL);
+}
+
+static inline uint32_t rwlock_fetch_or(FAR volatile uint32_t *state, uint32_t value)
+{
+	return __atomic_fetch_or(state, value, __ATOMIC_ACQ_REL);
+}
+
+static inline uint32_t rwlock_fetch_and(FAR volatile uint32_t *state, uint32_t value)
+{
+	return __atomic_fetch_and(state, value, __ATOMIC_ACQ_REL);
+}
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: rwlock_semwait
+ *
+ * Description:
+ *   Wait on one of the semaphores of a read/write lock, until 'abstime' if
+ *   it is not NULL.  Signals do not interrupt the wait.
+ *
+ * Return Value:
+ *   0 on success or an errno value on failure.
+ *
+ ****************************************************************************/
+
+int rwlock_semwait(FAR sem_t *sem, FAR const struct timespec *abstime);
+
+#endif							/* __LIBC_PTHREAD_PTHREAD_RWLOCK_H */
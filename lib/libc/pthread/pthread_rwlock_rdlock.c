@@ -59,38 +59,34 @@
 #include <stdint.h>
 #include <sys/types.h>
 #include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
 #include <errno.h>
 #include <debug.h>
 
 #include <tinyara/semaphore.h>
 
+#include "pthread_rwlock.h"
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
-#ifdef CONFIG_PTHREAD_CLEANUP
-static void rdlock_cleanup(FAR void *arg)
-{
-	FAR pthread_rwlock_t *rw_lock = (FAR pthread_rwlock_t *)arg;
-
-	(void)pthread_mutex_unlock(&rw_lock->lock);
-}
-#endif
-
 static int tryrdlock(FAR pthread_rwlock_t *rw_lock)
 {
-	int err;
+	uint32_t state = rwlock_load(&rw_lock->state);
 
-	if (rw_lock->num_writers > 0 || rw_lock->write_in_progress) {
-		err = EBUSY;
-	} else if (rw_lock->num_readers == UINT_MAX) {
-		err = EAGAIN;
-	} else {
-		rw_lock->num_readers++;
-		err = OK;
-	}
+	do {
+		if ((state & RWLOCK_WRITER) != 0) {
+			return EBUSY;
+		}
 
-	return err;
+		if (state == RWLOCK_READERS) {
+			return EAGAIN;
+		}
+	} while (!rwlock_cas(&rw_lock->state, &state, state + 1));
+
+	return OK;
 }
 
 /****************************************************************************
@@ -101,7 +97,10 @@ static int tryrdlock(FAR pthread_rwlock_t *rw_lock)
  * Name: pthread_rwlock_rdlock
  *
  * Description:
- *   Locks a read/write lock for reading
+ *   Locks a read/write lock for reading.  Without a writer this is a single
+ *   atomic update of the lock state, with no system call.  Otherwise the
+ *   reader sleeps on the semaphore held by the writer, boosting its
+ *   priority, and joins the other readers once the writer releases it.
  *
  * Parameters:
  *   None
@@ -115,44 +114,37 @@ static int tryrdlock(FAR pthread_rwlock_t *rw_lock)
 
 int pthread_rwlock_tryrdlock(FAR pthread_rwlock_t *rw_lock)
 {
-	int err = pthread_mutex_trylock(&rw_lock->lock);
-
-	if (err != 0) {
-		return err;
-	}
-
-	err = tryrdlock(rw_lock);
-
-	pthread_mutex_unlock(&rw_lock->lock);
-	return err;
+	return tryrdlock(rw_lock);
 }
 
 int pthread_rwlock_timedrdlock(FAR pthread_rwlock_t *rw_lock, FAR const struct timespec *ts)
 {
-	int err = pthread_mutex_lock(&rw_lock->lock);
+	uint32_t state;
+	int err;
 
-	if (err != 0) {
+	err = tryrdlock(rw_lock);
+	if (err != EBUSY) {
 		return err;
 	}
-#ifdef CONFIG_PTHREAD_CLEANUP
-	pthread_cleanup_push(&rdlock_cleanup, rw_lock);
-#endif
-	while ((err = tryrdlock(rw_lock)) == EBUSY) {
-		if (ts != NULL) {
-			err = pthread_cond_timedwait(&rw_lock->cv, &rw_lock->lock, ts);
-		} else {
-			err = pthread_cond_wait(&rw_lock->cv, &rw_lock->lock);
-		}
 
-		if (err != 0) {
-			break;
-		}
+	if (rw_lock->writer == getpid()) {
+		return EDEADLK;
+	}
+
+	err = rwlock_semwait(&rw_lock->wlock, ts);
+	if (err != OK) {
+		return err;
+	}
+
+	/* No writer holds the lock while 'wlock' is ours */
+
+	state = rwlock_fetch_add(&rw_lock->state, 1);
+	if (state == RWLOCK_READERS) {
+		rwlock_fetch_add(&rw_lock->state, (uint32_t)-1);
+		err = EAGAIN;
 	}
-#ifdef CONFIG_PTHREAD_CLEANUP
-	pthread_cleanup_pop(0);
-#endif
 
-	pthread_mutex_unlock(&rw_lock->lock);
+	sem_post(&rw_lock->wlock);
 	return err;
 }
 
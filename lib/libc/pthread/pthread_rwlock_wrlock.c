@@ -59,22 +59,31 @@
 #include <stdint.h>
 #include <sys/types.h>
 #include <pthread.h>
+#include <semaphore.h>
+#include <unistd.h>
 #include <errno.h>
 #include <debug.h>
 
 #include <tinyara/semaphore.h>
 
+#include "pthread_rwlock.h"
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+/* Give up a write lock that is still waiting for the readers to leave */
+
+static void wrlock_abort(FAR pthread_rwlock_t *rw_lock)
+{
+	rwlock_fetch_and(&rw_lock->state, ~RWLOCK_WRITER);
+	sem_post(&rw_lock->wlock);
+}
+
 #ifdef CONFIG_PTHREAD_CLEANUP
 static void wrlock_cleanup(FAR void *arg)
 {
-	FAR pthread_rwlock_t *rw_lock = (FAR pthread_rwlock_t *)arg;
-
-	rw_lock->num_writers--;
-	(void)pthread_mutex_unlock(&rw_lock->lock);
+	wrlock_abort((FAR pthread_rwlock_t *)arg);
 }
 #endif
 
@@ -86,7 +95,9 @@ static void wrlock_cleanup(FAR void *arg)
  * Name: pthread_rwlock_wrlock
  *
  * Description:
- *   Locks a read/write lock for writing
+ *   Locks a read/write lock for writing.  The writer takes the semaphore
+ *   that keeps out other writers and new readers, then waits for the
+ *   active readers to leave.
  *
  * Parameters:
  *   None
@@ -100,48 +111,46 @@ static void wrlock_cleanup(FAR void *arg)
 
 int pthread_rwlock_trywrlock(FAR pthread_rwlock_t *rw_lock)
 {
-	int err = pthread_mutex_trylock(&rw_lock->lock);
+	uint32_t state = 0;
 
-	if (err != 0) {
-		return err;
+	if (sem_trywait(&rw_lock->wlock) != OK) {
+		return EBUSY;
 	}
 
-	if (rw_lock->num_readers > 0 || rw_lock->write_in_progress) {
-		err = EBUSY;
-	} else {
-		rw_lock->write_in_progress = true;
+	if (!rwlock_cas(&rw_lock->state, &state, RWLOCK_WRITER)) {
+		sem_post(&rw_lock->wlock);
+		return EBUSY;
 	}
 
-	pthread_mutex_unlock(&rw_lock->lock);
-	return err;
+	rw_lock->writer = getpid();
+	return OK;
 }
 
 int pthread_rwlock_timedwrlock(FAR pthread_rwlock_t *rw_lock, FAR const struct timespec *ts)
 {
-	int err = pthread_mutex_lock(&rw_lock->lock);
+	int err;
 
-	if (err != 0) {
-		return err;
+	if (rw_lock->writer == getpid()) {
+		return EDEADLK;
 	}
 
-	if (rw_lock->num_writers == UINT_MAX) {
-		err = EAGAIN;
-		goto exit_with_mutex;
+	err = rwlock_semwait(&rw_lock->wlock, ts);
+	if (err != OK) {
+		return err;
 	}
 
-	rw_lock->num_writers++;
+	/* From here on new readers sleep on 'wlock'.  A post left on 'rdrain' by
+	 * an earlier writer that gave up only costs one more pass of the loop.
+	 */
+
+	rwlock_fetch_or(&rw_lock->state, RWLOCK_WRITER);
 
 #ifdef CONFIG_PTHREAD_CLEANUP
 	pthread_cleanup_push(&wrlock_cleanup, rw_lock);
 #endif
-	while (rw_lock->write_in_progress || rw_lock->num_readers > 0) {
-		if (ts != NULL) {
-			err = pthread_cond_timedwait(&rw_lock->cv, &rw_lock->lock, ts);
-		} else {
-			err = pthread_cond_wait(&rw_lock->cv, &rw_lock->lock);
-		}
-
-		if (err != 0) {
+	while ((rwlock_load(&rw_lock->state) & RWLOCK_READERS) != 0) {
+		err = rwlock_semwait(&rw_lock->rdrain, ts);
+		if (err != OK) {
 			break;
 		}
 	}
@@ -149,19 +158,13 @@ int pthread_rwlock_timedwrlock(FAR pthread_rwlock_t *rw_lock, FAR const struct t
 	pthread_cleanup_pop(0);
 #endif
 
-	if (err == 0) {
-		rw_lock->write_in_progress = true;
-	} else {
-		/* In case of error, notify any blocked readers. */
-
-		(void)pthread_cond_broadcast(&rw_lock->cv);
+	if (err != OK && (rwlock_load(&rw_lock->state) & RWLOCK_READERS) != 0) {
+		wrlock_abort(rw_lock);
+		return err;
 	}
 
-	rw_lock->num_writers--;
-
-exit_with_mutex:
-	pthread_mutex_unlock(&rw_lock->lock);
-	return err;
+	rw_lock->writer = getpid();
+	return OK;
 }
 
 int pthread_rwlock_wrlock(FAR pthread_rwlock_t *rw_lock)
@@ -123,11 +123,15 @@ int sem_init(FAR sem_t *sem, int pshared, unsigned int value)
 #endif
 
 #ifdef SAVE_SEM_HOLDER
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
-		sem->hhead = NULL;
-#else
+		/* The memory may be uninitialized, so nothing in it is followed.  A
+		 * semaphore that is initialized again while counts are held must be
+		 * destroyed first, sem_destroy() unlinks its holders.
+		 */
+
 		sem->holder.htcb = NULL;
 		sem->holder.counts = 0;
+#if CONFIG_SEM_PREALLOCHOLDERS > 0
+		sem->hhead = NULL;
 #endif
 		if (sem->semcount == 0) {
 			/* The semaphore with zero value is used for signaling */
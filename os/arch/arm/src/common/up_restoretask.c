@@ -37,6 +37,7 @@
 #include "mpu.h"
 #endif
 #include <tinyara/arch.h>
+#include <tinyara/sched_trace.h>
 
 #include "up_internal.h"
 #include "sched/sched.h"
@@ -72,6 +73,9 @@ void up_restoretask(struct tcb_s *tcb)
 		/* Save the task name which will be scheduled */
 		save_task_scheduling_status(tcb);
 #endif
+#ifdef CONFIG_SCHED_TRACE
+		sched_trace_switch(tcb);
+#endif
 
 		/* Restore the MPU registers in case we are switching to an application task */
 #ifdef CONFIG_APP_BINARY_SEPARATION
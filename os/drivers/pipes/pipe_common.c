@@ -153,6 +153,116 @@ static void pipecommon_pollnotify(FAR struct pipe_dev_s *dev, pollevent_t events
 #define pipecommon_pollnotify(dev, event)
 #endif
 
+#ifdef CONFIG_FS_SPLICE
+/****************************************************************************
+ * Name: pipecommon_wakeall
+ ****************************************************************************/
+
+static void pipecommon_wakeall(FAR sem_t *sem)
+{
+	int sval;
+
+	while (sem_getvalue(sem, &sval) == 0 && sval < 0) {
+		sem_post(sem);
+	}
+}
+
+/****************************************************************************
+ * Name: pipecommon_nbytes / pipecommon_nfree
+ *
+ * Description:
+ *   The number of bytes held in the ring and the number that can still be
+ *   written.  One slot is always left empty to tell a full ring from an
+ *   empty one.
+ *
+ ****************************************************************************/
+
+static size_t pipecommon_nbytes(FAR struct pipe_dev_s *dev)
+{
+	if (dev->d_wrndx >= dev->d_rdndx) {
+		return dev->d_wrndx - dev->d_rdndx;
+	}
+
+	return CONFIG_DEV_PIPE_SIZE - dev->d_rdndx + dev->d_wrndx;
+}
+
+static size_t pipecommon_nfree(FAR struct pipe_dev_s *dev)
+{
+	return CONFIG_DEV_PIPE_SIZE - 1 - pipecommon_nbytes(dev);
+}
+
+/****************************************************************************
+ * Name: pipecommon_waitdata
+ *
+ * Description:
+ *   Wait until the pipe holds data, with d_bfsem held on entry.  Returns 1
+ *   with d_bfsem still held when there is data.  Otherwise d_bfsem has been
+ *   released and 0 is returned at end of file or a negated errno value on
+ *   failure.
+ *
+ ****************************************************************************/
+
+static int pipecommon_waitdata(FAR struct pipe_dev_s *dev, bool nonblock)
+{
+	int ret;
+
+	while (dev->d_wrndx == dev->d_rdndx) {
+		if (dev->d_nwriters <= 0) {
+			sem_post(&dev->d_bfsem);
+			return 0;
+		}
+
+		if (nonblock) {
+			sem_post(&dev->d_bfsem);
+			return -EAGAIN;
+		}
+
+		sched_lock();
+		sem_post(&dev->d_bfsem);
+		ret = sem_wait(&dev->d_rdsem);
+		sched_unlock();
+
+		if (ret < 0 || sem_wait(&dev->d_bfsem) < 0) {
+			return -get_errno();
+		}
+	}
+
+	return 1;
+}
+
+/****************************************************************************
+ * Name: pipecommon_waitspace
+ *
+ * Description:
+ *   Wait until the pipe has room, with d_bfsem held on entry.  On failure
+ *   d_bfsem has been released and a negated errno value is returned.
+ *
+ ****************************************************************************/
+
+static int pipecommon_waitspace(FAR struct pipe_dev_s *dev, bool nonblock)
+{
+	int ret;
+
+	while (pipecommon_nfree(dev) == 0) {
+		if (nonblock) {
+			sem_post(&dev->d_bfsem);
+			return -EAGAIN;
+		}
+
+		sched_lock();
+		sem_post(&dev->d_bfsem);
+		ret = sem_wait(&dev->d_wrsem);
+		sched_unlock();
+
+		if (ret < 0 || sem_wait(&dev->d_bfsem) < 0) {
+			return -get_errno();
+		}
+	}
+
+	return OK;
+}
+#endif							/* CONFIG_FS_SPLICE */
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -731,4 +841,314 @@ int pipecommon_unlink(FAR struct inode *inode)
 	return OK;
 }
 
+#ifdef CONFIG_FS_SPLICE
+/****************************************************************************
+ * Name: pipecommon_ispipe
+ *
+ * Description:
+ *   Return true if 'filep' is an open pipe or FIFO.
+ *
+ ****************************************************************************/
+
+bool pipecommon_ispipe(FAR struct file *filep)
+{
+	FAR struct inode *inode = filep->f_inode;
+
+	return inode != NULL && inode->u.i_ops != NULL && inode->u.i_ops->read == pipecommon_read && inode->i_private != NULL;
+}
+
+/****************************************************************************
+ * Name: pipecommon_splice_read
+ *
+ * Description:
+ *   Hand the data in the pipe to 'sink' straight from the ring buffer, one
+ *   contiguous segment at a time, instead of copying it out first.  The
+ *   sink returns the number of bytes it consumed.  Only the consumed bytes
+ *   are removed from the pipe, and none of them when 'peek' is set.
+ *
+ *   The sink runs with the pipe locked, so it must not access this pipe.
+ *
+ * Returned Value:
+ *   The number of bytes consumed, 0 at end of file, or a negated errno
+ *   value.
+ *
+ ****************************************************************************/
+
+ssize_t pipecommon_splice_read(FAR struct file *filep, pipe_splice_t sink, FAR void *arg, size_t len, bool peek, bool nonblock)
+{
+	FAR struct pipe_dev_s *dev = filep->f_inode->i_private;
+	size_t rdndx;
+	size_t seg;
+	ssize_t nread = 0;
+	ssize_t ret;
+
+	DEBUGASSERT(dev && sink);
+
+	if (len == 0) {
+		return 0;
+	}
+
+	if (sem_wait(&dev->d_bfsem) < 0) {
+		return -get_errno();
+	}
+
+	ret = pipecommon_waitdata(dev, nonblock || (filep->f_oflags & O_NONBLOCK) != 0);
+	if (ret <= 0) {
+		return ret;
+	}
+
+	rdndx = dev->d_rdndx;
+	while (nread < len && rdndx != dev->d_wrndx) {
+		seg = rdndx < dev->d_wrndx ? dev->d_wrndx - rdndx : CONFIG_DEV_PIPE_SIZE - rdndx;
+		if (seg > len - nread) {
+			seg = len - nread;
+		}
+
+		ret = sink(arg, &dev->d_buffer[rdndx], seg);
+		if (ret <= 0) {
+			break;
+		}
+
+		nread += ret;
+		rdndx += ret;
+		if (rdndx >= CONFIG_DEV_PIPE_SIZE) {
+			rdndx = 0;
+		}
+
+		if (ret < seg) {
+			break;
+		}
+	}
+
+	if (nread > 0 && !peek) {
+		dev->d_rdndx = rdndx;
+
+		/* Notify all waiting writers and poll/select waiters */
+
+		pipecommon_wakeall(&dev->d_wrsem);
+		pipecommon_pollnotify(dev, POLLOUT);
+	}
+
+	sem_post(&dev->d_bfsem);
+	return nread > 0 ? nread : ret;
+}
+
+/****************************************************************************
+ * Name: pipecommon_splice_write
+ *
+ * Description:
+ *   Let 'source' fill the free space of the ring buffer directly, one
+ *   contiguous segment at a time.  The source returns the number of bytes
+ *   it produced, 0 at its end of file or a negated errno value.
+ *
+ *   The source runs with the pipe locked, so it must not access this pipe
+ *   and should not block for long: readers cannot drain the pipe meanwhile.
+ *
+ * Returned Value:
+ *   The number of bytes added to the pipe, 0 if the source had no data, or
+ *   a negated errno value.
+ *
+ ****************************************************************************/
+
+ssize_t pipecommon_splice_write(FAR struct file *filep, pipe_splice_t source, FAR void *arg, size_t len, bool nonblock)
+{
+	FAR struct pipe_dev_s *dev = filep->f_inode->i_private;
+	size_t seg;
+	ssize_t nwritten = 0;
+	ssize_t ret;
+
+	DEBUGASSERT(dev && source);
+
+	if (len == 0) {
+		return 0;
+	}
+
+	if (sem_wait(&dev->d_bfsem) < 0) {
+		return -get_errno();
+	}
+
+	ret = pipecommon_waitspace(dev, nonblock || (filep->f_oflags & O_NONBLOCK) != 0);
+	if (ret < 0) {
+		return ret;
+	}
+
+	while (nwritten < len) {
+		/* The free space up to the end of the buffer or the slot before the
+		 * read index, whichever comes first.
+		 */
+
+		if (dev->d_wrndx >= dev->d_rdndx) {
+			seg = (dev->d_rdndx == 0 ? CONFIG_DEV_PIPE_SIZE - 1 : CONFIG_DEV_PIPE_SIZE) - dev->d_wrndx;
+		} else {
+			seg = dev->d_rdndx - 1 - dev->d_wrndx;
+		}
+
+		if (seg == 0) {
+			break;
+		}
+
+		if (seg > len - nwritten) {
+			seg = len - nwritten;
+		}
+
+		ret = source(arg, &dev->d_buffer[dev->d_wrndx], seg);
+		if (ret <= 0) {
+			break;
+		}
+
+		nwritten += ret;
+		if (dev->d_wrndx + ret >= CONFIG_DEV_PIPE_SIZE) {
+			dev->d_wrndx = 0;
+		} else {
+			dev->d_wrndx += ret;
+		}
+
+		if (ret < seg) {
+			break;
+		}
+	}
+
+	if (nwritten > 0) {
+		/* Notify all waiting readers and poll/select waiters */
+
+		pipecommon_wakeall(&dev->d_rdsem);
+		pipecommon_pollnotify(dev, POLLIN);
+	}
+
+	sem_post(&dev->d_bfsem);
+	return nwritten > 0 ? nwritten : ret;
+}
+
+/****************************************************************************
+ * Name: pipecommon_splice
+ *
+ * Description:
+ *   Copy up to 'len' bytes from the ring of one pipe to the ring of
+ *   another, removing them from the input unless 'peek' is set (tee).  Both
+ *   pipes are locked in address order, so two tasks splicing in opposite
+ *   directions cannot deadlock.
+ *
+ * Returned Value:
+ *   The number of bytes copied, 0 if the input has no data and no writers,
+ *   or a negated errno value.
+ *
+ ****************************************************************************/
+
+ssize_t pipecommon_splice(FAR struct file *infilep, FAR struct file *outfilep, size_t len, bool peek, bool nonblock)
+{
+	FAR struct pipe_dev_s *indev = infilep->f_inode->i_private;
+	FAR struct pipe_dev_s *outdev = outfilep->f_inode->i_private;
+	FAR struct pipe_dev_s *first;
+	FAR struct pipe_dev_s *second;
+	FAR sem_t *waitsem;
+	size_t rdndx;
+	size_t nbytes;
+	size_t seg;
+	size_t ncopied;
+	int ret;
+
+	DEBUGASSERT(indev && outdev);
+
+	if (indev == outdev) {
+		return -EINVAL;
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	first = indev < outdev ? indev : outdev;
+	second = indev < outdev ? outdev : indev;
+
+	for (;;) {
+		if (sem_wait(&first->d_bfsem) < 0) {
+			return -get_errno();
+		}
+
+		if (sem_wait(&second->d_bfsem) < 0) {
+			ret = -get_errno();
+			sem_post(&first->d_bfsem);
+			return ret;
+		}
+
+		nbytes = pipecommon_nbytes(indev);
+		if (nbytes > 0 && pipecommon_nfree(outdev) > 0) {
+			break;
+		}
+
+		/* Give up or wait for whichever end is blocking the transfer */
+
+		if (nbytes == 0 && indev->d_nwriters <= 0) {
+			ret = 0;
+		} else if (nonblock || ((nbytes == 0 ? infilep : outfilep)->f_oflags & O_NONBLOCK) != 0) {
+			ret = -EAGAIN;
+		} else {
+			ret = 1;
+		}
+
+		waitsem = nbytes == 0 ? &indev->d_rdsem : &outdev->d_wrsem;
+
+		sched_lock();
+		sem_post(&second->d_bfsem);
+		sem_post(&first->d_bfsem);
+		if (ret <= 0) {
+			sched_unlock();
+			return ret;
+		}
+
+		ret = sem_wait(waitsem);
+		sched_unlock();
+		if (ret < 0) {
+			return -get_errno();
+		}
+	}
+
+	if (nbytes > pipecommon_nfree(outdev)) {
+		nbytes = pipecommon_nfree(outdev);
+	}
+
+	if (nbytes > len) {
+		nbytes = len;
+	}
+
+	rdndx = indev->d_rdndx;
+	for (ncopied = 0; ncopied < nbytes; ncopied += seg) {
+		seg = nbytes - ncopied;
+		if (seg > CONFIG_DEV_PIPE_SIZE - rdndx) {
+			seg = CONFIG_DEV_PIPE_SIZE - rdndx;
+		}
+
+		if (seg > CONFIG_DEV_PIPE_SIZE - outdev->d_wrndx) {
+			seg = CONFIG_DEV_PIPE_SIZE - outdev->d_wrndx;
+		}
+
+		memcpy(&outdev->d_buffer[outdev->d_wrndx], &indev->d_buffer[rdndx], seg);
+
+		rdndx += seg;
+		if (rdndx >= CONFIG_DEV_PIPE_SIZE) {
+			rdndx = 0;
+		}
+
+		if (outdev->d_wrndx + seg >= CONFIG_DEV_PIPE_SIZE) {
+			outdev->d_wrndx = 0;
+		} else {
+			outdev->d_wrndx += seg;
+		}
+	}
+
+	if (!peek) {
+		indev->d_rdndx = rdndx;
+		pipecommon_wakeall(&indev->d_wrsem);
+		pipecommon_pollnotify(indev, POLLOUT);
+	}
+
+	pipecommon_wakeall(&outdev->d_rdsem);
+	pipecommon_pollnotify(outdev, POLLIN);
+
+	sem_post(&second->d_bfsem);
+	sem_post(&first->d_bfsem);
+	return (ssize_t)ncopied;
+}
+#endif							/* CONFIG_FS_SPLICE */
+
 #endif							/* CONFIG_DEV_PIPE_SIZE > 0 */
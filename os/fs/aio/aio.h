@@ -90,6 +90,28 @@
 #error AIO needs file and/or socket descriptors
 #endif
 
+#ifdef CONFIG_FS_AIO_RING
+#ifndef CONFIG_FS_AIO_RING_NREQS
+#define CONFIG_FS_AIO_RING_NREQS 16
+#endif
+
+#ifndef CONFIG_FS_AIO_RING_NWORKERS
+#define CONFIG_FS_AIO_RING_NWORKERS 2
+#endif
+
+#ifndef CONFIG_FS_AIO_RING_MERGE_MAX
+#define CONFIG_FS_AIO_RING_MERGE_MAX 8
+#endif
+
+#ifndef CONFIG_FS_AIO_RING_PRIORITY
+#define CONFIG_FS_AIO_RING_PRIORITY 100
+#endif
+
+#ifndef CONFIG_FS_AIO_RING_STACKSIZE
+#define CONFIG_FS_AIO_RING_STACKSIZE 2048
+#endif
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -115,6 +137,24 @@ struct aio_container_s {
 #endif
 };
 
+#ifdef CONFIG_FS_AIO_RING
+/* One submission entry taken from an aio_ring and queued to the I/O worker
+ * of its device.  These are pre-allocated, the number controlled by
+ * CONFIG_FS_AIO_RING_NREQS.
+ */
+
+struct aioring_req_s {
+	dq_entry_t link;			/* Supports a doubly linked list */
+	FAR struct aio_ring *ring;	/* The ring to post the completion to */
+	FAR struct file *filep;		/* File structure to use with the I/O */
+	off_t offset;				/* File offset */
+	FAR uint8_t *buf;			/* Location of buffer */
+	size_t nbytes;				/* Length of transfer */
+	uintptr_t user_data;		/* Returned in the completion */
+	uint8_t opcode;				/* LIO_READ, LIO_WRITE, AIO_RING_FSYNC */
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -283,5 +323,60 @@ int aio_queue(FAR struct aio_container_s *aioc, worker_t worker);
 
 int aio_signal(pid_t pid, FAR struct aiocb *aiocbp);
 
+#ifdef CONFIG_FS_AIO_RING
+/****************************************************************************
+ * Name: aioring_initialize
+ *
+ * Description:
+ *   Perform one-time initialization of the submission ring requests.  The
+ *   I/O workers are started on the first submission.
+ *
+ * Input Parameters:
+ *   None
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void aioring_initialize(void);
+
+/****************************************************************************
+ * Name: aioring_complete
+ *
+ * Description:
+ *   Post the completion of a ring request to its ring, wake a thread
+ *   waiting in aio_ring_wait() and free the request.
+ *
+ * Input Parameters:
+ *   req    - The completed request
+ *   result - Bytes transferred or a negated errno value
+ *
+ * Returned Value:
+ *   None
+ *
+ ****************************************************************************/
+
+void aioring_complete(FAR struct aioring_req_s *req, ssize_t result);
+
+/****************************************************************************
+ * Name: aioring_dispatch
+ *
+ * Description:
+ *   Queue a ring request to the I/O worker that serves its device, starting
+ *   the workers on first use.
+ *
+ * Input Parameters:
+ *   req - The request to queue
+ *
+ * Returned Value:
+ *   Zero (OK) on success, or a negated errno value if the workers cannot
+ *   be started.
+ *
+ ****************************************************************************/
+
+int aioring_dispatch(FAR struct aioring_req_s *req);
+#endif
+
 #endif							/* CONFIG_FS_AIO */
 #endif							/* __FS_AIO_AIO_H */
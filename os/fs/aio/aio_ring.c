@@ -0,0 +1,370 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/aio/aio_ring.c
+ *
+ * The submission/completion rings.  aio_ring_submit() turns submission
+ * entries into pre-allocated requests and hands them to the I/O workers of
+ * aio_worker.c; the workers post completion entries straight into the ring
+ * and only wake the application when it waits in aio_ring_wait().
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <aio.h>
+#include <time.h>
+#include <semaphore.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+#include <queue.h>
+
+#include <tinyara/irq.h>
+#include <tinyara/cancelpt.h>
+#include <tinyara/fs/fs.h>
+
+#include "aio/aio.h"
+
+#ifdef CONFIG_FS_AIO_RING
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* This is an array of pre-allocated ring requests */
+
+static struct aioring_req_s g_aioring_alloc[CONFIG_FS_AIO_RING_NREQS];
+
+/* This is a list of free ring requests.  It is only accessed inside a
+ * critical section because requests are freed by the I/O workers.
+ */
+
+static dq_queue_t g_aioring_free;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aioring_check
+ *
+ * Description:
+ *   Check that a ring was set up by aio_ring_setup().
+ *
+ ****************************************************************************/
+
+static int aioring_check(FAR struct aio_ring *ring)
+{
+	if (ring == NULL || ring->sq == NULL || ring->cq == NULL) {
+		return -EINVAL;
+	}
+
+	if (ring->entries == 0 || (ring->entries & (ring->entries - 1)) != 0) {
+		return -EINVAL;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: aioring_reserve
+ *
+ * Description:
+ *   Take a free request and count it in flight on 'ring'.  A completion slot
+ *   is kept for every request in flight, so that a worker never overwrites a
+ *   completion the application has not consumed.
+ *
+ ****************************************************************************/
+
+static FAR struct aioring_req_s *aioring_reserve(FAR struct aio_ring *ring, FAR int *errcode)
+{
+	FAR struct aioring_req_s *req = NULL;
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	if (ring->inflight + (uint16_t)(ring->cq_tail - ring->cq_head) >= ring->entries) {
+		*errcode = EBUSY;
+	} else {
+		req = (FAR struct aioring_req_s *)dq_remfirst(&g_aioring_free);
+		if (req == NULL) {
+			*errcode = EAGAIN;
+		} else {
+			ring->inflight++;
+		}
+	}
+	leave_critical_section(flags);
+
+	return req;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aioring_initialize
+ *
+ * Description:
+ *   Put all of the pre-allocated ring requests on the free list.  Called
+ *   from aio_initialize().
+ *
+ ****************************************************************************/
+
+void aioring_initialize(void)
+{
+	int i;
+
+	dq_init(&g_aioring_free);
+	for (i = 0; i < CONFIG_FS_AIO_RING_NREQS; i++) {
+		dq_addlast(&g_aioring_alloc[i].link, &g_aioring_free);
+	}
+}
+
+/****************************************************************************
+ * Name: aioring_complete
+ *
+ * Description:
+ *   Post the completion of a ring request to its ring, wake a thread
+ *   waiting in aio_ring_wait() and free the request.
+ *
+ ****************************************************************************/
+
+void aioring_complete(FAR struct aioring_req_s *req, ssize_t result)
+{
+	FAR struct aio_ring *ring = req->ring;
+	FAR struct aio_cqe *cqe;
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+
+	cqe = &ring->cq[ring->cq_tail & (ring->entries - 1)];
+	cqe->user_data = req->user_data;
+	cqe->result = result;
+	ring->cq_tail++;
+	ring->inflight--;
+
+	if (ring->waiters > 0) {
+		ring->waiters = 0;
+		sem_post(&ring->waitsem);
+	}
+
+	dq_addlast(&req->link, &g_aioring_free);
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: aio_ring_submit
+ *
+ * Description:
+ *   Consume the submission entries from sq_head up to sq_tail and queue
+ *   each of them to the I/O worker of its device.  Entries that fail before
+ *   they are queued, such as a bad descriptor, complete at once with the
+ *   error in their completion entry.
+ *
+ *   Submission stops early when as many requests are in flight or waiting
+ *   to be consumed as the ring has completion slots, or when the
+ *   pre-allocated requests (CONFIG_FS_AIO_RING_NREQS) run out.  The entries
+ *   left in the submission queue are taken by the next call.
+ *
+ * Input Parameters:
+ *   ring - The ring set up by aio_ring_setup()
+ *
+ * Returned Value:
+ *   The number of entries consumed.  -1 is returned with errno set when
+ *   none could be consumed:
+ *
+ *   EINVAL - The ring was not set up.
+ *   EBUSY  - All completion slots are taken; consume completions first.
+ *   EAGAIN - No request is free; wait for completions.
+ *
+ ****************************************************************************/
+
+int aio_ring_submit(FAR struct aio_ring *ring)
+{
+	FAR struct aioring_req_s *req;
+	FAR struct aio_sqe *sqe;
+	FAR struct file *filep;
+	int nsubmit = 0;
+	int errcode = 0;
+	int ret;
+
+	ret = aioring_check(ring);
+	if (ret < 0) {
+		set_errno(-ret);
+		return ERROR;
+	}
+
+	while (ring->sq_head != ring->sq_tail) {
+		req = aioring_reserve(ring, &errcode);
+		if (req == NULL) {
+			break;
+		}
+
+		sqe = &ring->sq[ring->sq_head & (ring->entries - 1)];
+		req->ring = ring;
+		req->filep = NULL;
+		req->offset = sqe->offset;
+		req->buf = (FAR uint8_t *)sqe->buf;
+		req->nbytes = sqe->nbytes;
+		req->user_data = sqe->user_data;
+		req->opcode = sqe->opcode;
+
+		ring->sq_head++;
+		nsubmit++;
+
+		if (req->opcode == LIO_NOP) {
+			aioring_complete(req, 0);
+			continue;
+		}
+
+		if (req->opcode != LIO_READ && req->opcode != LIO_WRITE && req->opcode != AIO_RING_FSYNC) {
+			aioring_complete(req, -EINVAL);
+			continue;
+		}
+
+		/* The descriptor belongs to the caller's task group, so it is
+		 * resolved here rather than on the worker.
+		 */
+
+		ret = fs_getfilep(sqe->fildes, &filep);
+		if (ret < 0) {
+			aioring_complete(req, ret);
+			continue;
+		}
+
+		req->filep = filep;
+		ret = aioring_dispatch(req);
+		if (ret < 0) {
+			aioring_complete(req, ret);
+		}
+	}
+
+	if (nsubmit == 0 && errcode != 0) {
+		set_errno(errcode);
+		return ERROR;
+	}
+
+	return nsubmit;
+}
+
+/****************************************************************************
+ * Name: aio_ring_wait
+ *
+ * Description:
+ *   Wait until at least 'nr' completions are ready to be consumed.  Only
+ *   one thread at a time should wait on a ring.
+ *
+ * Input Parameters:
+ *   ring    - The ring set up by aio_ring_setup()
+ *   nr      - The number of completions to wait for, at most the number
+ *             of entries of the ring
+ *   timeout - The longest time to wait, or NULL to wait without limit
+ *
+ * Returned Value:
+ *   The number of completions ready.  -1 is returned with errno set on
+ *   failure:
+ *
+ *   EINVAL    - The ring was not set up or 'nr' is too large.
+ *   ETIMEDOUT - Fewer than 'nr' completions arrived within 'timeout'.
+ *   EINTR     - The wait was interrupted by a signal.
+ *
+ ****************************************************************************/
+
+int aio_ring_wait(FAR struct aio_ring *ring, unsigned int nr, FAR const struct timespec *timeout)
+{
+	struct timespec abstime;
+	irqstate_t flags;
+	int errcode = 0;
+	int ready;
+	int ret;
+
+	/* aio_ring_wait() is a cancellation point */
+
+	(void)enter_cancellation_point();
+
+	ret = aioring_check(ring);
+	if (ret < 0 || nr > ring->entries) {
+		set_errno(EINVAL);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	if (timeout != NULL) {
+		flags = enter_critical_section();
+		(void)clock_gettime(CLOCK_REALTIME, &abstime);
+		leave_critical_section(flags);
+
+		abstime.tv_sec += timeout->tv_sec;
+		abstime.tv_nsec += timeout->tv_nsec;
+		if (abstime.tv_nsec >= NSEC_PER_SEC) {
+			abstime.tv_sec++;
+			abstime.tv_nsec -= NSEC_PER_SEC;
+		}
+	}
+
+	/* The completion side posts waitsem only while 'waiters' is set, and
+	 * both sides look at the ring inside the critical section, so no
+	 * completion can slip in between the check and the wait.
+	 */
+
+	flags = enter_critical_section();
+	while ((uint16_t)(ring->cq_tail - ring->cq_head) < nr) {
+		ring->waiters = 1;
+		if (timeout != NULL) {
+			ret = sem_timedwait(&ring->waitsem, &abstime);
+		} else {
+			ret = sem_wait(&ring->waitsem);
+		}
+
+		if (ret < 0) {
+			errcode = get_errno();
+
+			/* A completion may have posted the semaphore after the wait
+			 * gave up.  Take that count back so that it does not satisfy
+			 * the next wait.
+			 */
+
+			if (ring->waiters > 0) {
+				ring->waiters = 0;
+			} else {
+				(void)sem_trywait(&ring->waitsem);
+			}
+			break;
+		}
+	}
+
+	ready = (uint16_t)(ring->cq_tail - ring->cq_head);
+	leave_critical_section(flags);
+
+	if (errcode != 0 && ready < nr) {
+		set_errno(errcode);
+		ready = ERROR;
+	}
+
+	leave_cancellation_point();
+	return ready;
+}
+
+#endif							/* CONFIG_FS_AIO_RING */
@@ -0,0 +1,401 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/aio/aio_worker.c
+ *
+ * The I/O workers of the submission rings.  Each device (the inode behind
+ * the file: a driver, or the mountpoint of a file system) is always served
+ * by the same worker, so the requests of one device run in submission
+ * order and never compete with each other or with the work queues.
+ *
+ * A worker merges the queued reads or writes of one file whose offsets
+ * follow each other into a single vectored transfer.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <aio.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+#include <queue.h>
+
+#include <tinyara/irq.h>
+#include <tinyara/kthread.h>
+#include <tinyara/semaphore.h>
+#include <tinyara/fs/fs.h>
+
+#include "aio/aio.h"
+
+#ifdef CONFIG_FS_AIO_RING
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define AIORING_MERGE_MAX  CONFIG_FS_AIO_RING_MERGE_MAX
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct aioring_worker_s {
+	dq_queue_t queue;			/* Requests waiting for this worker */
+	sem_t sem;					/* Posted once per queued request */
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct aioring_worker_s g_aioring_workers[CONFIG_FS_AIO_RING_NWORKERS];
+static int g_aioring_nworkers;	/* Workers running, 0 until the first use */
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aioring_mergeable
+ *
+ * Description:
+ *   Return true if 'req' reads or writes the same file as 'first' in the
+ *   same direction.
+ *
+ ****************************************************************************/
+
+static bool aioring_mergeable(FAR struct aioring_req_s *first, FAR struct aioring_req_s *req)
+{
+	return req->filep == first->filep && req->opcode == first->opcode && req->opcode != AIO_RING_FSYNC;
+}
+
+/****************************************************************************
+ * Name: aioring_take
+ *
+ * Description:
+ *   Remove the first queued request and the requests to the same file that
+ *   follow it in the queue and extend it at either end, up to
+ *   AIORING_MERGE_MAX.  The batch is returned in offset order.
+ *
+ ****************************************************************************/
+
+static int aioring_take(FAR struct aioring_worker_s *worker, FAR struct aioring_req_s **batch)
+{
+	FAR struct aioring_req_s *req;
+	FAR struct aioring_req_s *next;
+	irqstate_t flags;
+	off_t start;
+	off_t end;
+	int nreqs;
+	int i;
+
+	flags = enter_critical_section();
+
+	req = (FAR struct aioring_req_s *)dq_remfirst(&worker->queue);
+	if (req == NULL) {
+		leave_critical_section(flags);
+		return 0;
+	}
+
+	batch[0] = req;
+	nreqs = 1;
+	start = req->offset;
+	end = req->offset + req->nbytes;
+
+	/* Requests to other files are passed over.  The first one to the same
+	 * file that does not extend the batch ends the scan, so that no later
+	 * request to the file is done ahead of it.
+	 */
+
+	for (req = (FAR struct aioring_req_s *)dq_peek(&worker->queue); req != NULL && nreqs < AIORING_MERGE_MAX; req = next) {
+		next = (FAR struct aioring_req_s *)dq_next(&req->link);
+
+		if (req->filep != batch[0]->filep) {
+			continue;
+		}
+
+		if (!aioring_mergeable(batch[0], req)) {
+			break;
+		}
+
+		if (req->offset == end) {
+			batch[nreqs++] = req;
+			end += req->nbytes;
+		} else if (req->offset + req->nbytes == start) {
+			for (i = nreqs; i > 0; i--) {
+				batch[i] = batch[i - 1];
+			}
+			batch[0] = req;
+			nreqs++;
+			start = req->offset;
+		} else {
+			break;
+		}
+
+		dq_rem(&req->link, &worker->queue);
+	}
+
+	leave_critical_section(flags);
+	return nreqs;
+}
+
+/****************************************************************************
+ * Name: aioring_transfer
+ *
+ * Description:
+ *   Read or write the buffers of a batch at the offset of its first
+ *   request, leaving the file position as it was.
+ *
+ * Returned Value:
+ *   The number of bytes transferred, or a negated errno value.
+ *
+ ****************************************************************************/
+
+static ssize_t aioring_transfer(FAR struct aioring_req_s **batch, int nreqs)
+{
+	FAR struct file *filep = batch[0]->filep;
+	bool write = batch[0]->opcode == LIO_WRITE;
+	off_t savepos;
+	ssize_t ret;
+#ifdef CONFIG_FS_VECTORED_IO
+	struct iovec iov[AIORING_MERGE_MAX];
+#else
+	ssize_t nxfer;
+#endif
+	int i;
+
+	savepos = file_seek(filep, 0, SEEK_CUR);
+	if (savepos == (off_t)-1) {
+		return -get_errno();
+	}
+
+	if (file_seek(filep, batch[0]->offset, SEEK_SET) == (off_t)-1) {
+		return -get_errno();
+	}
+
+#ifdef CONFIG_FS_VECTORED_IO
+	for (i = 0; i < nreqs; i++) {
+		iov[i].iov_base = batch[i]->buf;
+		iov[i].iov_len = batch[i]->nbytes;
+	}
+
+	ret = write ? file_writev(filep, iov, nreqs) : file_readv(filep, iov, nreqs);
+#else
+	/* Without vectored I/O the merge still saves the seeks */
+
+	ret = 0;
+	for (i = 0; i < nreqs; i++) {
+		if (write) {
+			nxfer = file_write(filep, batch[i]->buf, batch[i]->nbytes);
+		} else {
+			nxfer = file_read(filep, batch[i]->buf, batch[i]->nbytes);
+		}
+
+		if (nxfer < 0) {
+			if (ret == 0) {
+				ret = nxfer;
+			}
+			break;
+		}
+
+		ret += nxfer;
+		if (nxfer < batch[i]->nbytes) {
+			break;
+		}
+	}
+#endif
+
+	(void)file_seek(filep, savepos, SEEK_SET);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: aioring_perform
+ *
+ * Description:
+ *   Perform a batch and post one completion per request.  The bytes of a
+ *   merged transfer are handed out in offset order, so a short transfer
+ *   ends in the request it stopped in and the rest complete with 0.
+ *
+ ****************************************************************************/
+
+static void aioring_perform(FAR struct aioring_req_s **batch, int nreqs)
+{
+	ssize_t total;
+	ssize_t result;
+	int i;
+
+	if (batch[0]->opcode == AIO_RING_FSYNC) {
+		DEBUGASSERT(nreqs == 1);
+#ifndef CONFIG_DISABLE_MOUNTPOINT
+		total = file_fsync(batch[0]->filep) < 0 ? -get_errno() : OK;
+#else
+		total = -ENOSYS;
+#endif
+		aioring_complete(batch[0], total);
+		return;
+	}
+
+	total = aioring_transfer(batch, nreqs);
+	if (total < 0) {
+		fdbg("ERROR: transfer of %d requests failed: %d\n", nreqs, (int)total);
+	}
+
+	for (i = 0; i < nreqs; i++) {
+		if (total < 0) {
+			result = total;
+		} else {
+			result = total < batch[i]->nbytes ? total : batch[i]->nbytes;
+			total -= result;
+		}
+
+		aioring_complete(batch[i], result);
+	}
+}
+
+/****************************************************************************
+ * Name: aioring_worker
+ *
+ * Description:
+ *   The I/O worker thread.  argv[1] is the index of its worker structure.
+ *
+ ****************************************************************************/
+
+static int aioring_worker(int argc, FAR char *argv[])
+{
+	FAR struct aioring_req_s *batch[AIORING_MERGE_MAX];
+	FAR struct aioring_worker_s *worker;
+	int nreqs;
+
+	DEBUGASSERT(argc > 1);
+	worker = &g_aioring_workers[atoi(argv[1])];
+
+	for (;;) {
+		while (sem_wait(&worker->sem) < 0) {
+			DEBUGASSERT(get_errno() == EINTR);
+		}
+
+		/* A merge takes several requests for one post, so the queue may
+		 * already be empty here.
+		 */
+
+		while ((nreqs = aioring_take(worker, batch)) > 0) {
+			aioring_perform(batch, nreqs);
+		}
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: aioring_start
+ *
+ * Description:
+ *   Start the I/O workers on the first submission.
+ *
+ ****************************************************************************/
+
+static int aioring_start(void)
+{
+	FAR char *argv[2];
+	char index[8];
+	int ret = OK;
+	int pid;
+	int i;
+
+	sched_lock();
+
+	if (g_aioring_nworkers == 0) {
+		for (i = 0; i < CONFIG_FS_AIO_RING_NWORKERS; i++) {
+			dq_init(&g_aioring_workers[i].queue);
+			sem_init(&g_aioring_workers[i].sem, 0, 0);
+			sem_setprotocol(&g_aioring_workers[i].sem, SEM_PRIO_NONE);
+		}
+
+		for (i = 0; i < CONFIG_FS_AIO_RING_NWORKERS; i++) {
+			snprintf(index, sizeof(index), "%d", i);
+			argv[0] = index;
+			argv[1] = NULL;
+
+			pid = kernel_thread("aio_ring", CONFIG_FS_AIO_RING_PRIORITY, CONFIG_FS_AIO_RING_STACKSIZE, aioring_worker, argv);
+			if (pid < 0) {
+				fdbg("ERROR: Failed to start I/O worker %d: %d\n", i, pid);
+				ret = pid;
+				break;
+			}
+		}
+
+		/* The workers that did start serve every device */
+
+		g_aioring_nworkers = i;
+	}
+
+	sched_unlock();
+	return g_aioring_nworkers > 0 ? OK : ret;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: aioring_dispatch
+ *
+ * Description:
+ *   Queue a ring request to the I/O worker that serves its device, starting
+ *   the workers on first use.
+ *
+ ****************************************************************************/
+
+int aioring_dispatch(FAR struct aioring_req_s *req)
+{
+	FAR struct aioring_worker_s *worker;
+	irqstate_t flags;
+	int ret;
+
+	ret = aioring_start();
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* Every file on one device goes to the same worker */
+
+	worker = &g_aioring_workers[((uintptr_t)req->filep->f_inode >> 4) % g_aioring_nworkers];
+
+	flags = enter_critical_section();
+	dq_addlast(&req->link, &worker->queue);
+	leave_critical_section(flags);
+
+	sem_post(&worker->sem);
+	return OK;
+}
+
+#endif							/* CONFIG_FS_AIO_RING */
@@ -78,6 +78,14 @@
  * Pre-processor Definitions
  ****************************************************************************/
 
+#ifndef CONFIG_MTD_PARTITION_BOUNCE_BLOCKS
+#define CONFIG_MTD_PARTITION_BOUNCE_BLOCKS 4
+#endif
+
+#if defined(CONFIG_MTD_DMA_ALIGNMENT) && CONFIG_MTD_DMA_ALIGNMENT > 1
+#define PART_BOUNCE_UNALIGNED 1
+#endif
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
@@ -213,6 +221,33 @@ static bool part_bytecheck(FAR struct mtd_partition_s *priv, off_t byoff)
 	return readend <= priv->neraseblocks;
 }
 
+/****************************************************************************
+ * Name: part_bounce_alloc
+ *
+ * Description:
+ *   Allocate a DMA-aligned buffer of up to CONFIG_MTD_PARTITION_BOUNCE_BLOCKS
+ *   blocks, but no more than 'nblocks'.  The number of blocks it holds is
+ *   returned in 'nbounce'.
+ *
+ ****************************************************************************/
+
+static FAR uint8_t *part_bounce_alloc(FAR struct mtd_partition_s *priv, size_t nblocks, FAR size_t *nbounce)
+{
+	FAR uint8_t *bounce;
+
+	*nbounce = nblocks < CONFIG_MTD_PARTITION_BOUNCE_BLOCKS ? nblocks : CONFIG_MTD_PARTITION_BOUNCE_BLOCKS;
+	if (*nbounce == 0) {
+		*nbounce = 1;
+	}
+
+	bounce = (FAR uint8_t *)mtd_dma_alloc(*nbounce * priv->blocksize);
+	if (bounce == NULL) {
+		fdbg("ERROR: Failed to allocate %d bounce blocks\n", *nbounce);
+	}
+
+	return bounce;
+}
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
@@ -308,6 +343,38 @@ static ssize_t part_bread(FAR struct mtd_dev_s *dev, off_t startblock, size_t nb
 		return -ENXIO;
 	}
 
+#ifdef PART_BOUNCE_UNALIGNED
+	/* The driver may DMA straight into the buffer, which it can only do
+	 * when the buffer is aligned.
+	 */
+
+	if (!MTD_DMA_ALIGNED(buf)) {
+		FAR uint8_t *bounce;
+		size_t nbounce;
+		size_t n;
+		ssize_t ret;
+		size_t i;
+
+		bounce = part_bounce_alloc(priv, nblocks, &nbounce);
+		if (bounce == NULL) {
+			return -ENOMEM;
+		}
+
+		for (i = 0; i < nblocks; i += n) {
+			n = nblocks - i < nbounce ? nblocks - i : nbounce;
+			ret = priv->parent->bread(priv->parent, startblock + priv->firstblock + i, n, bounce);
+			if (ret < 0) {
+				kmm_free(bounce);
+				return ret;
+			}
+			memcpy(buf + i * priv->blocksize, bounce, n * priv->blocksize);
+		}
+
+		kmm_free(bounce);
+		return nblocks;
+	}
+#endif
+
 	/* Just add the partition offset to the requested block and let the
 	 * underlying MTD driver perform the read.
 	 */
@@ -336,6 +403,34 @@ static ssize_t part_bwrite(FAR struct mtd_dev_s *dev, off_t startblock, size_t n
 		return -ENXIO;
 	}
 
+#ifdef PART_BOUNCE_UNALIGNED
+	if (!MTD_DMA_ALIGNED(buf)) {
+		FAR uint8_t *bounce;
+		size_t nbounce;
+		size_t n;
+		ssize_t ret;
+		size_t i;
+
+		bounce = part_bounce_alloc(priv, nblocks, &nbounce);
+		if (bounce == NULL) {
+			return -ENOMEM;
+		}
+
+		for (i = 0; i < nblocks; i += n) {
+			n = nblocks - i < nbounce ? nblocks - i : nbounce;
+			memcpy(bounce, buf + i * priv->blocksize, n * priv->blocksize);
+			ret = priv->parent->bwrite(priv->parent, startblock + priv->firstblock + i, n, bounce);
+			if (ret < 0) {
+				kmm_free(bounce);
+				return ret;
+			}
+		}
+
+		kmm_free(bounce);
+		return nblocks;
+	}
+#endif
+
 	/* Just add the partition offset to the requested block and let the
 	 * underlying MTD driver perform the write.
 	 */
@@ -343,6 +438,80 @@ static ssize_t part_bwrite(FAR struct mtd_dev_s *dev, off_t startblock, size_t n
 	return priv->parent->bwrite(priv->parent, startblock + priv->firstblock, nblocks, buf);
 }
 
+/****************************************************************************
+ * Name: part_read_blocks
+ *
+ * Description:
+ *   Read bytes from a device that only reads whole blocks.  The whole blocks
+ *   in the middle of the range go to the caller's buffer in one bread(); the
+ *   partial blocks at either end, and everything when the caller's buffer
+ *   cannot take DMA, go through a bounce buffer.
+ *
+ ****************************************************************************/
+
+static ssize_t part_read_blocks(FAR struct mtd_partition_s *priv, off_t offset, size_t nbytes, FAR uint8_t *buffer)
+{
+	FAR uint8_t *bounce = NULL;
+	size_t remaining = nbytes;
+	size_t nbounce = 0;
+	size_t nblocks;
+	size_t skip;
+	size_t n;
+	off_t block;
+	ssize_t ret;
+
+	block = offset / priv->blocksize + priv->firstblock;
+	skip = offset % priv->blocksize;
+
+	while (remaining > 0) {
+		if (skip == 0 && remaining >= priv->blocksize && MTD_DMA_ALIGNED(buffer)) {
+			nblocks = remaining / priv->blocksize;
+			ret = priv->parent->bread(priv->parent, block, nblocks, buffer);
+			n = nblocks * priv->blocksize;
+		} else {
+			if (bounce == NULL) {
+				bounce = part_bounce_alloc(priv, (skip + remaining + priv->blocksize - 1) / priv->blocksize, &nbounce);
+				if (bounce == NULL) {
+					return -ENOMEM;
+				}
+			}
+
+			nblocks = (skip + remaining + priv->blocksize - 1) / priv->blocksize;
+			if (nblocks > nbounce) {
+				nblocks = nbounce;
+			}
+
+			ret = priv->parent->bread(priv->parent, block, nblocks, bounce);
+			n = nblocks * priv->blocksize - skip;
+			if (n > remaining) {
+				n = remaining;
+			}
+
+			if (ret >= 0) {
+				memcpy(buffer, bounce + skip, n);
+			}
+		}
+
+		if (ret < 0) {
+			goto errout;
+		}
+
+		block += nblocks;
+		buffer += n;
+		remaining -= n;
+		skip = 0;
+	}
+
+	ret = nbytes;
+
+errout:
+	if (bounce != NULL) {
+		kmm_free(bounce);
+	}
+
+	return ret;
+}
+
 /****************************************************************************
  * Name: part_read
  *
@@ -376,9 +545,20 @@ static ssize_t part_read(FAR struct mtd_dev_s *dev, off_t offset, size_t nbytes,
 		return priv->parent->read(priv->parent, newoffset, nbytes, buffer);
 	}
 
-	/* The underlying MTD driver does not support the read() method */
+	/* The underlying MTD driver does not support the read() method, so the
+	 * bytes are read in blocks.
+	 */
 
-	return -ENOSYS;
+	if (priv->parent->bread == NULL) {
+		return -ENOSYS;
+	}
+
+	if (!part_bytecheck(priv, offset + nbytes - 1)) {
+		fdbg("ERROR: Read beyond the end of the partition\n");
+		return -ENXIO;
+	}
+
+	return part_read_blocks(priv, offset, nbytes, buffer);
 }
 
 /****************************************************************************
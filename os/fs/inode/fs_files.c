@@ -204,6 +204,9 @@ void files_releaselist(FAR struct filelist *list)
 	 */
 
 	for (i = 0; i < CONFIG_NFILE_DESCRIPTORS; i++) {
+		if (list->fl_files[i].f_inode) {
+			epoll_fdclose(list, i);
+		}
 		(void)_files_close(&list->fl_files[i]);
 	}
 
@@ -288,6 +288,27 @@ FAR struct inode *inode_search(FAR const char **path, FAR struct inode **peer, F
 	FAR struct inode *node = root_inode;
 	FAR struct inode *left = NULL;
 	FAR struct inode *above = NULL;
+#ifdef CONFIG_FS_INODE_CACHE
+	FAR const char *start = *path;
+	FAR struct inode *cached;
+	size_t reloff;
+
+	/* The cache only knows the node, callers that need its companion nodes
+	 * in order to modify the tree always walk it.
+	 */
+
+	if (!peer && !parent) {
+		cached = inode_cache_lookup(start, &reloff);
+		if (cached) {
+			if (relpath) {
+				*relpath = start + reloff;
+			}
+
+			*path = start + reloff;
+			return cached;
+		}
+	}
+#endif
 
 	while (node) {
 		int result = _inode_compare(name, node);
@@ -367,6 +388,12 @@ FAR struct inode *inode_search(FAR const char **path, FAR struct inode **peer, F
 		*parent = above;
 	}
 
+#ifdef CONFIG_FS_INODE_CACHE
+	if (node && !peer && !parent) {
+		inode_cache_add(start, node, name - start);
+	}
+#endif
+
 	*path = name;
 	return node;
 }
@@ -0,0 +1,212 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/inode/fs_inodecache.c
+ *
+ * A small direct-mapped cache of full path names to the inode that
+ * inode_search() resolved them to, together with the offset of the part of
+ * the path that is left for a mountpoint.  Only successful lookups are
+ * cached.
+ *
+ * Every change to the shape of the inode tree goes through inode_reserve()
+ * or inode_unlink(), both of which invalidate the whole cache by bumping a
+ * generation number, so an entry can never refer to an inode that has been
+ * unlinked, nor hide a node or mountpoint that has been added since.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <string.h>
+
+#include <tinyara/fs/fs.h>
+
+#include "inode/inode.h"
+
+#ifdef CONFIG_FS_INODE_CACHE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_FS_INODE_CACHE_ENTRIES
+#define CONFIG_FS_INODE_CACHE_ENTRIES 16
+#endif
+
+#ifndef CONFIG_FS_INODE_CACHE_PATHLEN
+#define CONFIG_FS_INODE_CACHE_PATHLEN 32
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct inode_cache_entry_s {
+	uint32_t hash;				/* Hash of the full path */
+	uint32_t gen;				/* Generation the entry was added in */
+	FAR struct inode *node;		/* The inode the path resolved to */
+	uint16_t reloff;			/* Offset of the mountpoint relative path */
+	char path[CONFIG_FS_INODE_CACHE_PATHLEN];
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct inode_cache_entry_s g_inode_cache[CONFIG_FS_INODE_CACHE_ENTRIES];
+
+/* Entries from an older generation are invalid, the generation starts at 1
+ * so that the zeroed table is empty.
+ */
+
+static uint32_t g_inode_cache_gen = 1;
+static struct inode_cache_stats_s g_inode_cache_stats;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* FNV-1a over the path, also returns its length */
+
+static uint32_t inode_cache_hash(FAR const char *path, FAR size_t *len)
+{
+	FAR const char *ptr;
+	uint32_t hash = 2166136261u;
+
+	for (ptr = path; *ptr != '\0'; ptr++) {
+		hash ^= (uint8_t)*ptr;
+		hash *= 16777619u;
+	}
+
+	*len = ptr - path;
+	return hash;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: inode_cache_lookup
+ *
+ * Description:
+ *   Return the inode that 'path' was last resolved to and the offset of
+ *   the relative path in 'path', or NULL if the path is not cached.
+ *
+ * Assumptions:
+ *   The caller holds the g_inode_sem semaphore
+ *
+ ****************************************************************************/
+
+FAR struct inode *inode_cache_lookup(FAR const char *path, FAR size_t *reloff)
+{
+	FAR struct inode_cache_entry_s *entry;
+	uint32_t hash;
+	size_t len;
+
+	hash = inode_cache_hash(path, &len);
+	if (len < CONFIG_FS_INODE_CACHE_PATHLEN) {
+		entry = &g_inode_cache[hash % CONFIG_FS_INODE_CACHE_ENTRIES];
+		if (entry->gen == g_inode_cache_gen && entry->hash == hash && strcmp(entry->path, path) == 0) {
+			g_inode_cache_stats.hits++;
+			*reloff = entry->reloff;
+			return entry->node;
+		}
+	}
+
+	g_inode_cache_stats.misses++;
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: inode_cache_add
+ *
+ * Description:
+ *   Remember that 'path' resolves to 'node', with the part of the path
+ *   starting at 'reloff' left for the node.  Paths that do not fit in an
+ *   entry are not cached.
+ *
+ * Assumptions:
+ *   The caller holds the g_inode_sem semaphore
+ *
+ ****************************************************************************/
+
+void inode_cache_add(FAR const char *path, FAR struct inode *node, size_t reloff)
+{
+	FAR struct inode_cache_entry_s *entry;
+	uint32_t hash;
+	size_t len;
+
+	hash = inode_cache_hash(path, &len);
+	if (len >= CONFIG_FS_INODE_CACHE_PATHLEN) {
+		return;
+	}
+
+	entry = &g_inode_cache[hash % CONFIG_FS_INODE_CACHE_ENTRIES];
+	entry->hash = hash;
+	entry->gen = g_inode_cache_gen;
+	entry->node = node;
+	entry->reloff = (uint16_t)reloff;
+	memcpy(entry->path, path, len + 1);
+}
+
+/****************************************************************************
+ * Name: inode_cache_invalidate
+ *
+ * Description:
+ *   Drop every cached path.  Called whenever an inode is added to or
+ *   removed from the tree.
+ *
+ * Assumptions:
+ *   The caller holds the g_inode_sem semaphore
+ *
+ ****************************************************************************/
+
+void inode_cache_invalidate(void)
+{
+	/* Clear the table instead of reusing a generation after a wrap */
+
+	if (++g_inode_cache_gen == 0) {
+		memset(g_inode_cache, 0, sizeof(g_inode_cache));
+		g_inode_cache_gen = 1;
+	}
+
+	g_inode_cache_stats.invalidations++;
+}
+
+/****************************************************************************
+ * Name: inode_cache_getstats
+ *
+ * Description:
+ *   Return a snapshot of the cache counters.
+ *
+ ****************************************************************************/
+
+void inode_cache_getstats(FAR struct inode_cache_stats_s *stats)
+{
+	inode_semtake();
+	*stats = g_inode_cache_stats;
+	inode_semgive();
+}
+
+#endif							/* CONFIG_FS_INODE_CACHE */
@@ -230,6 +230,10 @@ int inode_reserve(FAR const char *path, FAR struct inode **inode)
 		return -EEXIST;
 	}
 
+	/* The new nodes may become a mountpoint that absorbs cached paths */
+
+	inode_cache_invalidate();
+
 	/* Now we know the exact position to insert the subtree */
 
 	for (;;) {
@@ -123,6 +123,16 @@
 
 typedef int (*foreach_inode_t)(FAR struct inode *node, FAR char dirpath[PATH_MAX], FAR void *arg);
 
+#ifdef CONFIG_FS_INODE_CACHE
+/* Counters of the path lookup cache, see inode_cache_getstats() */
+
+struct inode_cache_stats_s {
+	uint32_t hits;				/* Lookups answered from the cache */
+	uint32_t misses;			/* Lookups that walked the inode tree */
+	uint32_t invalidations;		/* Times the cache was flushed */
+};
+#endif
+
 /****************************************************************************
  * Global Variables
  ****************************************************************************/
@@ -308,6 +318,64 @@ void inode_addref(FAR struct inode *inode);
 
 void inode_release(FAR struct inode *inode);
 
+/* fs_inodecache.c **********************************************************/
+
+#ifdef CONFIG_FS_INODE_CACHE
+/****************************************************************************
+ * Name: inode_cache_lookup
+ *
+ * Description:
+ *   Return the inode that 'path' was last resolved to by inode_search()
+ *   and the offset of its relative path in 'reloff', or NULL on a miss.
+ *
+ * Assumptions:
+ *   The caller holds the inode semaphore
+ *
+ ****************************************************************************/
+
+FAR struct inode *inode_cache_lookup(FAR const char *path, FAR size_t *reloff);
+
+/****************************************************************************
+ * Name: inode_cache_add
+ *
+ * Description:
+ *   Remember that 'path' resolves to 'node' with the relative path starting
+ *   at offset 'reloff'.
+ *
+ * Assumptions:
+ *   The caller holds the inode semaphore
+ *
+ ****************************************************************************/
+
+void inode_cache_add(FAR const char *path, FAR struct inode *node, size_t reloff);
+
+/****************************************************************************
+ * Name: inode_cache_invalidate
+ *
+ * Description:
+ *   Drop every cached path.  Must be called whenever an inode is added to
+ *   or removed from the tree.
+ *
+ * Assumptions:
+ *   The caller holds the inode semaphore
+ *
+ ****************************************************************************/
+
+void inode_cache_invalidate(void);
+
+/****************************************************************************
+ * Name: inode_cache_getstats
+ *
+ * Description:
+ *   Return a snapshot of the cache counters.
+ *
+ ****************************************************************************/
+
+void inode_cache_getstats(FAR struct inode_cache_stats_s *stats);
+#else
+#define inode_cache_invalidate()
+#endif
+
 /* fs_foreachinode.c ********************************************************/
 /****************************************************************************
  * Name: foreach_inode
@@ -373,6 +441,19 @@ int files_close(int fd);
 
 void files_release(int fd);
 
+#ifdef CONFIG_FS_VECTORED_IO
+/****************************************************************************
+ * Name: iov_check
+ *
+ * Description:
+ *   Check the count and the total length of an I/O vector before readv()
+ *   or writev() use it.  Returns OK or -EINVAL.
+ *
+ ****************************************************************************/
+
+int iov_check(FAR const struct iovec *iov, int iovcnt);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
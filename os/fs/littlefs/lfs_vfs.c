@@ -43,6 +43,8 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <queue.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include <tinyara/fs/dirent.h>
@@ -53,15 +55,76 @@
 
 #include <sys/stat.h>
 #include <sys/statfs.h>
+#include <sys/uio.h>
 
 #include "inode/inode.h"
 #include "littlefs/lfs.h"
 #include "littlefs/lfs_util.h"
 
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_FS_LITTLEFS_CACHE_SIZE
+#define CONFIG_FS_LITTLEFS_CACHE_SIZE 0
+#endif
+
+#ifndef CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE
+#define CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE 0
+#endif
+
+#ifndef CONFIG_FS_LITTLEFS_BLOCK_CACHE_ENTRIES
+#define CONFIG_FS_LITTLEFS_BLOCK_CACHE_ENTRIES 0
+#endif
+
+#define LITTLEFS_OPTIONS_MAX     128
+
+/* Tag of a block cache line that holds no data */
+
+#define LITTLEFS_BCACHE_INVALID  ((lfs_block_t)-1)
+
 /****************************************************************************
  * Private Types
  ****************************************************************************/
 
+/* Settings taken from the mount() data string, see littlefs_parse_options() */
+
+struct littlefs_options_s {
+	bool forceformat;
+	bool autoformat;
+	lfs_size_t read_size;
+	lfs_size_t prog_size;
+	lfs_size_t cache_size;
+	lfs_size_t lookahead_size;
+	int bcache_entries;
+};
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+/* One line of the block cache. A line holds cache_size bytes at a
+ * cache_size aligned offset of one littlefs block.
+ */
+
+struct littlefs_bcline_s {
+	dq_entry_t node;
+	lfs_block_t block;
+	lfs_off_t off;
+	FAR uint8_t *data;
+};
+
+/* The block cache sits between littlefs and the MTD driver and is shared
+ * by every file open on the mountpoint. littlefs only calls the block
+ * device callbacks with the mountpoint semaphore held, so the cache needs
+ * no lock of its own.
+ */
+
+struct littlefs_bcache_s {
+	dq_queue_t lru;				/* Most recently used line first */
+	lfs_size_t linesize;
+	int nlines;
+	FAR struct littlefs_bcline_s *lines;
+};
+#endif
+
 struct littlefs_file_s {
 	struct lfs_file file;
 	int refs;
@@ -78,6 +141,9 @@ struct littlefs_mountpt_s {
 	struct mtd_geometry_s geo;
 	struct lfs_config cfg;
 	struct lfs lfs;
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	struct littlefs_bcache_s bcache;
+#endif
 };
 
 /****************************************************************************
@@ -92,6 +158,10 @@ static int littlefs_close(FAR struct file *filep);
 static ssize_t littlefs_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
 static ssize_t littlefs_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
 static off_t littlefs_seek(FAR struct file *filep, off_t offset, int whence);
+#ifdef CONFIG_FS_VECTORED_IO
+static ssize_t littlefs_readv(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt);
+static ssize_t littlefs_writev(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt);
+#endif
 static int littlefs_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
 
 static int littlefs_sync(FAR struct file *filep);
@@ -149,7 +219,12 @@ const struct mountpt_operations littlefs_operations = {
 	littlefs_mkdir,				/* mkdir */
 	littlefs_rmdir,				/* rmdir */
 	littlefs_rename,			/* rename */
-	littlefs_stat				/* stat */
+	littlefs_stat,				/* stat */
+
+#ifdef CONFIG_FS_VECTORED_IO
+	littlefs_readv,				/* readv */
+	littlefs_writev				/* writev */
+#endif
 };
 
 /****************************************************************************
@@ -399,6 +474,92 @@ out:
 	return ret;
 }
 
+#ifdef CONFIG_FS_VECTORED_IO
+/****************************************************************************
+ * Name: littlefs_rwv
+ *
+ * Description: Transfer a whole vector under one hold of the mountpoint
+ *  semaphore and one seek, so LFS streams it as a single sequential access.
+ *
+ ****************************************************************************/
+
+static ssize_t littlefs_rwv(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt, bool write)
+{
+	FAR struct littlefs_mountpt_s *fs;
+	FAR struct littlefs_file_s *priv;
+	FAR struct inode *inode;
+	ssize_t ntotal = 0;
+	ssize_t ret = OK;
+	int i;
+
+	/* Recover our private data from the struct file instance */
+
+	priv = filep->f_priv;
+	inode = filep->f_inode;
+	fs = inode->i_private;
+
+	littlefs_semtake(fs);
+
+	if (filep->f_pos != priv->file.pos) {
+		ret = lfs_file_seek(&fs->lfs, &priv->file, filep->f_pos, LFS_SEEK_SET);
+		if (ret < 0) {
+			goto out;
+		}
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		if (iov[i].iov_len == 0) {
+			continue;
+		}
+
+		if (write) {
+			ret = lfs_file_write(&fs->lfs, &priv->file, iov[i].iov_base, iov[i].iov_len);
+		} else {
+			ret = lfs_file_read(&fs->lfs, &priv->file, iov[i].iov_base, iov[i].iov_len);
+		}
+
+		if (ret < 0) {
+			break;
+		}
+
+		ntotal += ret;
+		if (ret < iov[i].iov_len) {
+			break;
+		}
+	}
+
+	filep->f_pos += ntotal;
+
+	/* Report the bytes moved before an error */
+
+	if (ntotal > 0 || ret >= 0) {
+		ret = ntotal;
+	}
+
+out:
+	littlefs_semgive(fs);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: littlefs_readv
+ ****************************************************************************/
+
+static ssize_t littlefs_readv(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt)
+{
+	return littlefs_rwv(filep, iov, iovcnt, false);
+}
+
+/****************************************************************************
+ * Name: littlefs_writev
+ ****************************************************************************/
+
+static ssize_t littlefs_writev(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt)
+{
+	return littlefs_rwv(filep, iov, iovcnt, true);
+}
+#endif
+
 /****************************************************************************
  * Name: littlefs_seek
  ****************************************************************************/
@@ -730,25 +891,17 @@ static int littlefs_rewinddir(FAR struct inode *mountpt, FAR struct fs_dirent_s
 }
 
 /****************************************************************************
- * Name: littlefs_bind
- *
- * Description: This implements a portion of the mount operation. This
- *  function allocates and initializes the mountpoint private data and
- *  binds the driver inode to the filesystem private data. The final
- *  binding of the private data (containing the driver) to the
- *  mountpoint is performed by mount().
- *
+ * Name: littlefs_mtd_read
  ****************************************************************************/
 
-static int littlefs_read_block(FAR const struct lfs_config *c, lfs_block_t block, lfs_off_t off, FAR void *buffer, lfs_size_t size)
+static int littlefs_mtd_read(FAR struct littlefs_mountpt_s *fs, lfs_block_t block, lfs_off_t off, FAR void *buffer, lfs_size_t size)
 {
-	FAR struct littlefs_mountpt_s *fs = c->context;
 	FAR struct mtd_geometry_s *geo = &fs->geo;
 	FAR struct inode *drv = fs->drv;
 	FAR struct little_dev_s	*dev = (struct little_dev_s *)drv->i_private;
 	int ret;
 
-	block = (block * c->block_size + off) / geo->blocksize;
+	block = (block * fs->cfg.block_size + off) / geo->blocksize;
 	size = size / geo->blocksize;
 
 	DEBUGASSERT(drv && drv->i_private);
@@ -759,6 +912,184 @@ static int littlefs_read_block(FAR const struct lfs_config *c, lfs_block_t block
 	return ret;
 }
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+/****************************************************************************
+ * Name: littlefs_bcache_init
+ *
+ * Description: Allocate nlines cache lines of cache_size bytes each. With
+ *  nlines of zero the mountpoint reads the MTD device directly.
+ *
+ ****************************************************************************/
+
+static int littlefs_bcache_init(FAR struct littlefs_mountpt_s *fs, int nlines)
+{
+	FAR struct littlefs_bcache_s *bc = &fs->bcache;
+	FAR uint8_t *data;
+	size_t stride;
+	int i;
+
+	dq_init(&bc->lru);
+	bc->linesize = fs->cfg.cache_size;
+	bc->nlines = 0;
+	bc->lines = NULL;
+
+	if (nlines <= 0) {
+		return OK;
+	}
+
+	/* The line data is read straight from the MTD device, so it is kept
+	 * apart from the descriptors in a DMA-aligned allocation.
+	 */
+
+	bc->lines = kmm_malloc(nlines * sizeof(struct littlefs_bcline_s));
+	if (bc->lines == NULL) {
+		return -ENOMEM;
+	}
+
+	stride = MTD_DMA_ALIGNUP(bc->linesize);
+	data = mtd_dma_alloc(nlines * stride);
+	if (data == NULL) {
+		kmm_free(bc->lines);
+		bc->lines = NULL;
+		return -ENOMEM;
+	}
+
+	for (i = 0; i < nlines; i++) {
+		bc->lines[i].block = LITTLEFS_BCACHE_INVALID;
+		bc->lines[i].off = 0;
+		bc->lines[i].data = data + i * stride;
+		dq_addlast(&bc->lines[i].node, &bc->lru);
+	}
+
+	bc->nlines = nlines;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: littlefs_bcache_release
+ ****************************************************************************/
+
+static void littlefs_bcache_release(FAR struct littlefs_mountpt_s *fs)
+{
+	if (fs->bcache.lines != NULL) {
+		kmm_free(fs->bcache.lines[0].data);
+		kmm_free(fs->bcache.lines);
+		fs->bcache.lines = NULL;
+	}
+	fs->bcache.nlines = 0;
+}
+
+/****************************************************************************
+ * Name: littlefs_bcache_invalidate
+ *
+ * Description: Drop the lines of 'block' that overlap [off, off + size).
+ *  Dropped lines move to the tail of the LRU list to be reused first.
+ *
+ ****************************************************************************/
+
+static void littlefs_bcache_invalidate(FAR struct littlefs_mountpt_s *fs, lfs_block_t block, lfs_off_t off, lfs_size_t size)
+{
+	FAR struct littlefs_bcache_s *bc = &fs->bcache;
+	FAR struct littlefs_bcline_s *line;
+	FAR dq_entry_t *node;
+	FAR dq_entry_t *next;
+
+	for (node = dq_peek(&bc->lru); node != NULL; node = next) {
+		next = dq_next(node);
+		line = (FAR struct littlefs_bcline_s *)node;
+		if (line->block == block && line->off < off + size && off < line->off + bc->linesize) {
+			line->block = LITTLEFS_BCACHE_INVALID;
+			dq_rem(node, &bc->lru);
+			dq_addlast(node, &bc->lru);
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: littlefs_bcache_read
+ *
+ * Description: Serve a read from the block cache. littlefs fills its read
+ *  and file caches with reads of at most cache_size bytes, these go
+ *  through the cache a line at a time. Larger reads are bulk file data
+ *  that littlefs does not cache either, they go straight to the MTD
+ *  device so that they do not evict the metadata everybody else shares.
+ *
+ ****************************************************************************/
+
+static int littlefs_bcache_read(FAR struct littlefs_mountpt_s *fs, lfs_block_t block, lfs_off_t off, FAR uint8_t *buffer, lfs_size_t size)
+{
+	FAR struct littlefs_bcache_s *bc = &fs->bcache;
+	FAR struct littlefs_bcline_s *line;
+	FAR dq_entry_t *node;
+	lfs_off_t lineoff;
+	lfs_size_t skip;
+	lfs_size_t nbytes;
+	int ret;
+
+	if (size > bc->linesize) {
+		return littlefs_mtd_read(fs, block, off, buffer, size);
+	}
+
+	while (size > 0) {
+		lineoff = lfs_aligndown(off, bc->linesize);
+		skip = off - lineoff;
+		nbytes = lfs_min(bc->linesize - skip, size);
+
+		for (node = dq_peek(&bc->lru); node != NULL; node = dq_next(node)) {
+			line = (FAR struct littlefs_bcline_s *)node;
+			if (line->block == block && line->off == lineoff) {
+				break;
+			}
+		}
+
+		if (node == NULL) {
+			/* Miss, refill the least recently used line */
+
+			node = dq_tail(&bc->lru);
+			line = (FAR struct littlefs_bcline_s *)node;
+			line->block = LITTLEFS_BCACHE_INVALID;
+
+			ret = littlefs_mtd_read(fs, block, lineoff, line->data, bc->linesize);
+			if (ret < 0) {
+				return ret;
+			}
+
+			line->block = block;
+			line->off = lineoff;
+		}
+
+		if (node != dq_peek(&bc->lru)) {
+			dq_rem(node, &bc->lru);
+			dq_addfirst(node, &bc->lru);
+		}
+
+		memcpy(buffer, line->data + skip, nbytes);
+		buffer += nbytes;
+		off += nbytes;
+		size -= nbytes;
+	}
+
+	return OK;
+}
+#endif
+
+/****************************************************************************
+ * Name: littlefs_read_block
+ ****************************************************************************/
+
+static int littlefs_read_block(FAR const struct lfs_config *c, lfs_block_t block, lfs_off_t off, FAR void *buffer, lfs_size_t size)
+{
+	FAR struct littlefs_mountpt_s *fs = c->context;
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	if (fs->bcache.nlines > 0) {
+		return littlefs_bcache_read(fs, block, off, buffer, size);
+	}
+#endif
+
+	return littlefs_mtd_read(fs, block, off, buffer, size);
+}
+
 /****************************************************************************
  * Name: littlefs_write_block
  ****************************************************************************/
@@ -771,6 +1102,10 @@ static int littlefs_write_block(FAR const struct lfs_config *c, lfs_block_t bloc
 	FAR struct little_dev_s	*dev = (struct little_dev_s *)drv->i_private;
 	int ret;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	littlefs_bcache_invalidate(fs, block, off, size);
+#endif
+
 	block = (block * c->block_size + off) / geo->blocksize;
 	size = size / geo->blocksize;
 
@@ -793,6 +1128,10 @@ static int littlefs_erase_block(FAR const struct lfs_config *c, lfs_block_t bloc
 	FAR struct little_dev_s	*dev = (struct little_dev_s *)drv->i_private;
 	int ret = OK;
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	littlefs_bcache_invalidate(fs, block, 0, c->block_size);
+#endif
+
 	DEBUGASSERT(drv && drv->i_private);
 	FAR struct mtd_geometry_s *geo = &fs->geo;
 	size_t size = c->block_size / geo->erasesize;
@@ -824,6 +1163,136 @@ static int littlefs_sync_block(FAR const struct lfs_config *c)
 	return ret;
 }
 
+/****************************************************************************
+ * Name: littlefs_parse_options
+ *
+ * Description: Parse the comma separated mount() data string, e.g.
+ *  "autoformat,cache=4096,lookahead=64,bcache=16". Recognised options:
+ *
+ *   forceformat   Format the device before mounting it
+ *   autoformat    Format the device if it does not hold a littlefs
+ *   read=N        Minimum read unit in bytes
+ *   prog=N        Minimum program unit in bytes
+ *   cache=N       Size of each littlefs cache buffer in bytes
+ *   lookahead=N   Size of the block allocation bitmap in bytes
+ *   bcache=N      Number of lines in the shared block cache, 0 disables it
+ *
+ *  Sizes left out, or given as 0, take the Kconfig defaults.
+ *
+ ****************************************************************************/
+
+static int littlefs_parse_options(FAR const char *data, FAR struct littlefs_options_s *opts)
+{
+	char buf[LITTLEFS_OPTIONS_MAX];
+	FAR char *saveptr;
+	FAR char *token;
+	FAR char *value;
+	FAR char *end;
+	unsigned long num;
+
+	memset(opts, 0, sizeof(*opts));
+	opts->bcache_entries = CONFIG_FS_LITTLEFS_BLOCK_CACHE_ENTRIES;
+
+	if (data == NULL) {
+		return OK;
+	}
+
+	if (strlen(data) >= sizeof(buf)) {
+		return -EINVAL;
+	}
+	strncpy(buf, data, sizeof(buf));
+
+	for (token = strtok_r(buf, ",", &saveptr); token != NULL; token = strtok_r(NULL, ",", &saveptr)) {
+		if (strcmp(token, "forceformat") == 0) {
+			opts->forceformat = true;
+			continue;
+		}
+
+		if (strcmp(token, "autoformat") == 0) {
+			opts->autoformat = true;
+			continue;
+		}
+
+		value = strchr(token, '=');
+		if (value == NULL || value[1] == '\0') {
+			fdbg("ERROR: bad littlefs option: %s\n", token);
+			return -EINVAL;
+		}
+		*value++ = '\0';
+
+		num = strtoul(value, &end, 0);
+		if (*end != '\0') {
+			fdbg("ERROR: bad value for littlefs option %s: %s\n", token, value);
+			return -EINVAL;
+		}
+
+		if (strcmp(token, "read") == 0) {
+			opts->read_size = num;
+		} else if (strcmp(token, "prog") == 0) {
+			opts->prog_size = num;
+		} else if (strcmp(token, "cache") == 0) {
+			opts->cache_size = num;
+		} else if (strcmp(token, "lookahead") == 0) {
+			opts->lookahead_size = num;
+		} else if (strcmp(token, "bcache") == 0) {
+			opts->bcache_entries = num;
+		} else {
+			fdbg("ERROR: unknown littlefs option: %s\n", token);
+			return -EINVAL;
+		}
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: littlefs_set_sizes
+ *
+ * Description: Fill in the littlefs read, program, cache and lookahead
+ *  sizes. A cache larger than the MTD block lets littlefs read and program
+ *  several MTD blocks with one driver call. The lookahead bitmap covers the
+ *  whole device unless it is limited, so the allocator does not have to
+ *  rescan the filesystem every lookahead_size * 8 allocated blocks.
+ *
+ ****************************************************************************/
+
+static int littlefs_set_sizes(FAR struct littlefs_mountpt_s *fs, FAR const struct littlefs_options_s *opts)
+{
+	FAR struct lfs_config *cfg = &fs->cfg;
+	lfs_size_t lookahead_max;
+
+	cfg->read_size = opts->read_size ? opts->read_size : fs->geo.blocksize;
+	cfg->prog_size = opts->prog_size ? opts->prog_size : fs->geo.blocksize;
+
+	if (opts->cache_size) {
+		cfg->cache_size = opts->cache_size;
+	} else if (CONFIG_FS_LITTLEFS_CACHE_SIZE > 0) {
+		cfg->cache_size = CONFIG_FS_LITTLEFS_CACHE_SIZE;
+	} else {
+		cfg->cache_size = lfs_max(cfg->read_size, cfg->prog_size);
+	}
+
+	/* littlefs asserts on these, catch them here instead */
+
+	if (cfg->read_size % fs->geo.blocksize != 0 || cfg->prog_size % fs->geo.blocksize != 0 || cfg->cache_size % cfg->read_size != 0 || cfg->cache_size % cfg->prog_size != 0 || cfg->block_size % cfg->cache_size != 0) {
+		fdbg("ERROR: bad littlefs sizes read %u prog %u cache %u block %u\n", cfg->read_size, cfg->prog_size, cfg->cache_size, cfg->block_size);
+		return -EINVAL;
+	}
+
+	lookahead_max = lfs_alignup(cfg->block_count, 64) / 8;
+	if (opts->lookahead_size) {
+		cfg->lookahead_size = opts->lookahead_size;
+	} else if (CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE > 0) {
+		cfg->lookahead_size = CONFIG_FS_LITTLEFS_LOOKAHEAD_SIZE;
+	} else {
+		cfg->lookahead_size = lookahead_max;
+	}
+	cfg->lookahead_size = lfs_min(lfs_alignup(cfg->lookahead_size, 8), lookahead_max);
+
+	fvdbg("read %u prog %u cache %u lookahead %u\n", cfg->read_size, cfg->prog_size, cfg->cache_size, cfg->lookahead_size);
+	return OK;
+}
+
 /****************************************************************************
  * Name: littlefs_bind
  ****************************************************************************/
@@ -831,9 +1300,15 @@ static int littlefs_sync_block(FAR const struct lfs_config *c)
 static int littlefs_bind(FAR struct inode *driver, FAR const void *data, FAR void **handle)
 {
 	FAR struct littlefs_mountpt_s *fs;
+	struct littlefs_options_s opts;
 	int ret;
 	struct little_dev_s *dev;
 
+	ret = littlefs_parse_options(data, &opts);
+	if (ret < 0) {
+		return ret;
+	}
+
 	/* Open the block driver */
 
 	if (INODE_IS_BLOCK(driver) && driver->u.i_bops->open) {
@@ -877,13 +1352,21 @@ static int littlefs_bind(FAR struct inode *driver, FAR const void *data, FAR voi
 	fs->cfg.prog = littlefs_write_block;
 	fs->cfg.erase = littlefs_erase_block;
 	fs->cfg.sync = littlefs_sync_block;
-	fs->cfg.read_size = fs->geo.blocksize;
-	fs->cfg.prog_size = fs->geo.blocksize;
 	fs->cfg.block_size = fs->geo.erasesize;
 	fs->cfg.block_count = fs->geo.neraseblocks;
 	fs->cfg.block_cycles = 500;
-	fs->cfg.cache_size = fs->geo.blocksize;
-	fs->cfg.lookahead_size = lfs_min(lfs_alignup(fs->cfg.block_count, 64) / 8, fs->cfg.read_size);
+
+	ret = littlefs_set_sizes(fs, &opts);
+	if (ret < 0) {
+		goto errout_with_fs;
+	}
+
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	ret = littlefs_bcache_init(fs, opts.bcache_entries);
+	if (ret < 0) {
+		goto errout_with_fs;
+	}
+#endif
 
 	/* Then get information about the littlefs filesystem on the devices
 	 * managed by this driver.
@@ -891,7 +1374,7 @@ static int littlefs_bind(FAR struct inode *driver, FAR const void *data, FAR voi
 
 	/* Force format the device if -o forceformat */
 
-	if (data && strcmp(data, "forceformat") == 0) {
+	if (opts.forceformat) {
 		ret = lfs_format(&fs->lfs, &fs->cfg);
 		if (ret < 0) {
 			goto errout_with_fs;
@@ -906,7 +1389,7 @@ static int littlefs_bind(FAR struct inode *driver, FAR const void *data, FAR voi
 	if (ret < 0 && ret != LFS_ERR_CORRUPT) {
 		/* Auto format the device if -o autoformat */
 
-		if (!data || strcmp(data, "autoformat")) {
+		if (!opts.autoformat) {
 			goto errout_with_fs;
 		}
 
@@ -933,6 +1416,9 @@ static int littlefs_bind(FAR struct inode *driver, FAR const void *data, FAR voi
 	return ret;
 
 errout_with_fs:
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+	littlefs_bcache_release(fs);
+#endif
 	sem_destroy(&fs->sem);
 	kmm_free(fs);
 	return ret;
@@ -978,6 +1464,9 @@ static int littlefs_unbind(FAR void *handle, FAR struct inode **driver, unsigned
 
 		/* Release the mountpoint private data */
 
+#ifdef CONFIG_FS_LITTLEFS_BLOCK_CACHE
+		littlefs_bcache_release(fs);
+#endif
 		sem_destroy(&fs->sem);
 		kmm_free(fs);
 	}
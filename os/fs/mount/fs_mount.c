@@ -90,7 +90,7 @@
 #define BDFS_SUPPORT 1
 #endif
 
-#if defined(CONFIG_FS_PROCFS) || defined(CONFIG_FS_TMPFS)
+#if defined(CONFIG_FS_PROCFS) || defined(CONFIG_FS_TMPFS) || defined(CONFIG_FS_OVERLAY)
 #define NONBDFS_SUPPORT
 #endif
 
@@ -156,6 +156,9 @@ extern const struct mountpt_operations procfs_operations;
 #ifdef CONFIG_FS_TMPFS
 extern const struct mountpt_operations tmpfs_operations;
 #endif
+#ifdef CONFIG_FS_OVERLAY
+extern const struct mountpt_operations overlay_operations;
+#endif
 
 static const struct fsmap_t g_nonbdfsmap[] = {
 #ifdef CONFIG_FS_PROCFS
@@ -165,6 +168,10 @@ static const struct fsmap_t g_nonbdfsmap[] = {
 #ifdef CONFIG_FS_TMPFS
 	{TMPFS_FSTYPE, &tmpfs_operations},
 #endif
+
+#ifdef CONFIG_FS_OVERLAY
+	{OVERLAY_FSTYPE, &overlay_operations},
+#endif
 	{NULL, NULL},
 };
 #endif							/* NONBDFS_SUPPORT */
@@ -359,6 +366,12 @@ int mount(FAR const char *source, FAR const char *target, FAR const char *filesy
 	mountpt_inode->i_mode = mode;
 #endif
 	mountpt_inode->i_private = fshandle;
+
+	/* Lookups made by bind() may have cached the node before it became a
+	 * mountpoint.
+	 */
+
+	inode_cache_invalidate();
 	inode_semgive();
 
 	/* We can release our reference to the blkdrver_inode, if the filesystem
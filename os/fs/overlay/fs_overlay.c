@@ -0,0 +1,1471 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/statfs.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <semaphore.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/dirent.h>
+
+#include "inode/inode.h"
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_OVERLAY)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* An entry deleted from the lower layer is hidden by an empty ".wh.<name>"
+ * file next to where it would be in the upper layer.  A directory created
+ * over such an entry gets a ".wh..opq" marker so that the lower directory
+ * of the same name stays hidden.
+ */
+
+#define OVERLAY_WHITEOUT       ".wh."
+#define OVERLAY_WHITEOUT_LEN   4
+#define OVERLAY_OPAQUE         ".opq"
+
+#define OVERLAY_UPPER          0
+#define OVERLAY_LOWER          1
+#define OVERLAY_NLAYERS        2
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* One of the two mounted file systems and the directory used within it */
+
+struct overlay_layer_s {
+	FAR struct inode *ol_inode;	/* The mountpoint of the layer */
+	FAR char *ol_prefix;		/* The layer root relative to ol_inode */
+};
+
+struct overlay_mountpt_s {
+	struct overlay_layer_s om_layer[OVERLAY_NLAYERS];
+	sem_t om_sem;				/* Serializes lookups, copy-ups and whiteouts */
+	char om_path[PATH_MAX];		/* A path within one of the layers */
+	char om_path2[PATH_MAX];	/* The second path of a rename */
+	char om_scratch[PATH_MAX];	/* A relative path under construction */
+};
+
+/* A merged directory walks the upper layer, then the lower one */
+
+struct overlay_dir_s {
+	struct fs_dirent_s od_dir[OVERLAY_NLAYERS];
+	bool od_open[OVERLAY_NLAYERS];
+	uint8_t od_layer;			/* The layer being read */
+	FAR char *od_relpath;		/* For the lookups of the lower entries */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int overlay_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int overlay_close(FAR struct file *filep);
+static ssize_t overlay_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static ssize_t overlay_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
+static off_t overlay_seek(FAR struct file *filep, off_t offset, int whence);
+static int overlay_ioctl(FAR struct file *filep, int cmd, unsigned long arg);
+
+static int overlay_sync(FAR struct file *filep);
+static int overlay_dup(FAR const struct file *oldp, FAR struct file *newp);
+static int overlay_fstat(FAR const struct file *filep, FAR struct stat *buf);
+static int overlay_truncate(FAR struct file *filep, off_t length);
+
+static int overlay_opendir(FAR struct inode *mountpt, FAR const char *relpath, FAR struct fs_dirent_s *dir);
+static int overlay_closedir(FAR struct inode *mountpt, FAR struct fs_dirent_s *dir);
+static int overlay_readdir(FAR struct inode *mountpt, FAR struct fs_dirent_s *dir);
+static int overlay_rewinddir(FAR struct inode *mountpt, FAR struct fs_dirent_s *dir);
+
+static int overlay_bind(FAR struct inode *blkdriver, FAR const void *data, FAR void **handle);
+static int overlay_unbind(FAR void *handle, FAR struct inode **blkdriver);
+static int overlay_statfs(FAR struct inode *mountpt, FAR struct statfs *buf);
+
+static int overlay_unlink(FAR struct inode *mountpt, FAR const char *relpath);
+static int overlay_mkdir(FAR struct inode *mountpt, FAR const char *relpath, mode_t mode);
+static int overlay_rmdir(FAR struct inode *mountpt, FAR const char *relpath);
+static int overlay_rename(FAR struct inode *mountpt, FAR const char *oldrelpath, FAR const char *newrelpath);
+static int overlay_stat(FAR struct inode *mountpt, FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+const struct mountpt_operations overlay_operations = {
+	overlay_open,				/* open */
+	overlay_close,				/* close */
+	overlay_read,				/* read */
+	overlay_write,				/* write */
+	overlay_seek,				/* seek */
+	overlay_ioctl,				/* ioctl */
+
+	overlay_sync,				/* sync */
+	overlay_dup,				/* dup */
+	overlay_fstat,				/* fstat */
+	overlay_truncate,			/* truncate */
+
+	overlay_opendir,			/* opendir */
+	overlay_closedir,			/* closedir */
+	overlay_readdir,			/* readdir */
+	overlay_rewinddir,			/* rewinddir */
+
+	overlay_bind,				/* bind */
+	overlay_unbind,				/* unbind */
+	overlay_statfs,				/* statfs */
+
+	overlay_unlink,				/* unlink */
+	overlay_mkdir,				/* mkdir */
+	overlay_rmdir,				/* rmdir */
+	overlay_rename,				/* rename */
+	overlay_stat,				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void overlay_semtake(FAR struct overlay_mountpt_s *om)
+{
+	while (sem_wait(&om->om_sem) != 0) {
+		/* The only case that an error should occur here is if
+		 * the wait was awakened by a signal.
+		 */
+
+		ASSERT(*get_errno_ptr() == EINTR);
+	}
+}
+
+static inline void overlay_semgive(FAR struct overlay_mountpt_s *om)
+{
+	sem_post(&om->om_sem);
+}
+
+static inline FAR const struct mountpt_operations *overlay_mops(FAR struct overlay_layer_s *layer)
+{
+	return layer->ol_inode->u.i_mops;
+}
+
+static inline FAR struct file *overlay_inner(FAR const struct file *filep)
+{
+	return (FAR struct file *)filep->f_priv;
+}
+
+/****************************************************************************
+ * Name: overlay_basename
+ ****************************************************************************/
+
+static FAR const char *overlay_basename(FAR const char *relpath)
+{
+	FAR const char *base = strrchr(relpath, '/');
+
+	return base ? base + 1 : relpath;
+}
+
+/****************************************************************************
+ * Name: overlay_path
+ *
+ * Description:
+ *   Build in 'buf' the path of 'relpath' inside a layer, or the path of
+ *   its whiteout when 'whiteout' is set.
+ *
+ ****************************************************************************/
+
+static int overlay_path(FAR char *buf, FAR struct overlay_layer_s *layer, FAR const char *relpath, bool whiteout)
+{
+	FAR const char *prefix = layer->ol_prefix;
+	FAR const char *base;
+	int len;
+
+	if (!whiteout) {
+		len = snprintf(buf, PATH_MAX, "%s%s%s", prefix, *prefix && *relpath ? "/" : "", relpath);
+	} else {
+		base = overlay_basename(relpath);
+		len = snprintf(buf, PATH_MAX, "%s%s%.*s" OVERLAY_WHITEOUT "%s", prefix, *prefix ? "/" : "", (int)(base - relpath), relpath, base);
+	}
+
+	return len < PATH_MAX ? OK : -ENAMETOOLONG;
+}
+
+/****************************************************************************
+ * Name: overlay_join
+ *
+ * Description:
+ *   Build in 'buf' the relative path of the entry 'name' of directory
+ *   'relpath'.
+ *
+ ****************************************************************************/
+
+static int overlay_join(FAR char *buf, FAR const char *relpath, FAR const char *name)
+{
+	int len = snprintf(buf, PATH_MAX, "%s%s%s", relpath, *relpath ? "/" : "", name);
+
+	return len < PATH_MAX ? OK : -ENAMETOOLONG;
+}
+
+/****************************************************************************
+ * Name: overlay_statlayer
+ ****************************************************************************/
+
+static int overlay_statlayer(FAR struct overlay_mountpt_s *om, int index, FAR const char *relpath, bool whiteout, FAR struct stat *buf)
+{
+	FAR struct overlay_layer_s *layer = &om->om_layer[index];
+	struct stat st;
+	int ret;
+
+	if (overlay_mops(layer)->stat == NULL) {
+		return -ENOSYS;
+	}
+
+	ret = overlay_path(om->om_path, layer, relpath, whiteout);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return overlay_mops(layer)->stat(layer->ol_inode, om->om_path, buf ? buf : &st);
+}
+
+/****************************************************************************
+ * Name: overlay_opaque
+ *
+ * Description:
+ *   Is the upper directory 'relpath' marked to hide the lower one?
+ *
+ ****************************************************************************/
+
+static bool overlay_opaque(FAR struct overlay_mountpt_s *om, FAR const char *relpath)
+{
+	char *marker = om->om_scratch;
+
+	if (overlay_join(marker, relpath, OVERLAY_OPAQUE) < 0) {
+		return false;
+	}
+
+	return overlay_statlayer(om, OVERLAY_UPPER, marker, true, NULL) == OK;
+}
+
+/****************************************************************************
+ * Name: overlay_hidden
+ *
+ * Description:
+ *   Is the lower entry 'relpath' hidden, either by its own whiteout or by
+ *   the whiteout or opaque marker of one of its parents?
+ *
+ ****************************************************************************/
+
+static bool overlay_hidden(FAR struct overlay_mountpt_s *om, FAR const char *relpath)
+{
+	FAR const char *end = relpath;
+	char *scratch = om->om_scratch;
+	size_t len;
+
+	while (*end) {
+		end = strchr(end, '/');
+		len = end ? end - relpath : strlen(relpath);
+
+		memcpy(scratch, relpath, len);
+		scratch[len] = '\0';
+		if (overlay_statlayer(om, OVERLAY_UPPER, scratch, true, NULL) == OK) {
+			return true;
+		}
+
+		if (end == NULL) {
+			break;
+		}
+
+		/* A parent directory recreated over a whiteout hides the rest */
+
+		if (len + sizeof("/" OVERLAY_OPAQUE) <= PATH_MAX) {
+			strcpy(scratch + len, "/" OVERLAY_OPAQUE);
+			if (overlay_statlayer(om, OVERLAY_UPPER, scratch, true, NULL) == OK) {
+				return true;
+			}
+		}
+
+		end++;
+	}
+
+	return false;
+}
+
+/****************************************************************************
+ * Name: overlay_lookup
+ *
+ * Description:
+ *   Find the layer that provides 'relpath'.
+ *
+ * Returned Value:
+ *   OVERLAY_UPPER or OVERLAY_LOWER with 'buf' filled in, or -ENOENT.
+ *
+ ****************************************************************************/
+
+static int overlay_lookup(FAR struct overlay_mountpt_s *om, FAR const char *relpath, FAR struct stat *buf)
+{
+	if (overlay_statlayer(om, OVERLAY_UPPER, relpath, false, buf) == OK) {
+		return OVERLAY_UPPER;
+	}
+
+	if (!overlay_hidden(om, relpath) && overlay_statlayer(om, OVERLAY_LOWER, relpath, false, buf) == OK) {
+		return OVERLAY_LOWER;
+	}
+
+	return -ENOENT;
+}
+
+/****************************************************************************
+ * Name: overlay_openlayer
+ ****************************************************************************/
+
+static int overlay_openlayer(FAR struct overlay_mountpt_s *om, int index, FAR const char *relpath, bool whiteout, int oflags, mode_t mode, FAR struct file *filep)
+{
+	FAR struct overlay_layer_s *layer = &om->om_layer[index];
+	int ret;
+
+	ret = overlay_path(om->om_path, layer, relpath, whiteout);
+	if (ret < 0) {
+		return ret;
+	}
+
+	filep->f_oflags = oflags;
+	filep->f_pos = 0;
+	filep->f_inode = layer->ol_inode;
+	filep->f_priv = NULL;
+
+	return overlay_mops(layer)->open(filep, om->om_path, oflags, mode);
+}
+
+/****************************************************************************
+ * Name: overlay_mkparents
+ *
+ * Description:
+ *   Create in the upper layer the directories that lead to 'relpath' and
+ *   that so far only exist in the lower layer.
+ *
+ ****************************************************************************/
+
+static int overlay_mkparents(FAR struct overlay_mountpt_s *om, FAR const char *relpath)
+{
+	FAR struct overlay_layer_s *upper = &om->om_layer[OVERLAY_UPPER];
+	FAR const char *end = relpath;
+	char *scratch = om->om_scratch;
+	struct stat st;
+	size_t len;
+	int ret;
+
+	while ((end = strchr(end, '/')) != NULL) {
+		len = end - relpath;
+		memcpy(scratch, relpath, len);
+		scratch[len] = '\0';
+		end++;
+
+		ret = overlay_statlayer(om, OVERLAY_UPPER, scratch, false, &st);
+		if (ret == OK) {
+			if (!S_ISDIR(st.st_mode)) {
+				return -ENOTDIR;
+			}
+			continue;
+		}
+
+		ret = overlay_statlayer(om, OVERLAY_LOWER, scratch, false, &st);
+		if (ret < 0) {
+			return -ENOENT;
+		}
+
+		if (!S_ISDIR(st.st_mode)) {
+			return -ENOTDIR;
+		}
+
+		if (overlay_mops(upper)->mkdir == NULL) {
+			return -ENOSYS;
+		}
+
+		overlay_path(om->om_path, upper, scratch, false);
+		ret = overlay_mops(upper)->mkdir(upper->ol_inode, om->om_path, st.st_mode & 0777);
+		if (ret < 0 && ret != -EEXIST) {
+			return ret;
+		}
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: overlay_whiteout
+ *
+ * Description:
+ *   Hide the lower entry 'relpath' behind an empty upper file.
+ *
+ ****************************************************************************/
+
+static int overlay_whiteout(FAR struct overlay_mountpt_s *om, FAR const char *relpath)
+{
+	struct file wh;
+	int ret;
+
+	ret = overlay_mkparents(om, relpath);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = overlay_openlayer(om, OVERLAY_UPPER, relpath, true, O_WROK | O_CREAT | O_TRUNC, 0666, &wh);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return overlay_mops(&om->om_layer[OVERLAY_UPPER])->close(&wh);
+}
+
+/****************************************************************************
+ * Name: overlay_unwhiteout
+ ****************************************************************************/
+
+static bool overlay_unwhiteout(FAR struct overlay_mountpt_s *om, FAR const char *relpath)
+{
+	FAR struct overlay_layer_s *upper = &om->om_layer[OVERLAY_UPPER];
+
+	if (overlay_mops(upper)->unlink == NULL || overlay_path(om->om_path, upper, relpath, true) < 0) {
+		return false;
+	}
+
+	return overlay_mops(upper)->unlink(upper->ol_inode, om->om_path) == OK;
+}
+
+/****************************************************************************
+ * Name: overlay_copyup
+ *
+ * Description:
+ *   Give the lower file 'relpath' an upper copy that can be written.  The
+ *   contents are only copied when 'copydata' is set, an open with O_TRUNC
+ *   would discard them anyway.
+ *
+ ****************************************************************************/
+
+static int overlay_copyup(FAR struct overlay_mountpt_s *om, FAR const char *relpath, mode_t mode, bool copydata)
+{
+	FAR const struct mountpt_operations *lops = overlay_mops(&om->om_layer[OVERLAY_LOWER]);
+	FAR const struct mountpt_operations *uops = overlay_mops(&om->om_layer[OVERLAY_UPPER]);
+	FAR char *buffer;
+	struct file lower;
+	struct file upper;
+	ssize_t nread;
+	ssize_t nwritten;
+	ssize_t n;
+	int ret;
+
+	ret = overlay_mkparents(om, relpath);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = overlay_openlayer(om, OVERLAY_UPPER, relpath, false, O_WROK | O_CREAT | O_TRUNC, mode & 0777, &upper);
+	if (ret < 0 || !copydata) {
+		return ret < 0 ? ret : uops->close(&upper);
+	}
+
+	buffer = (FAR char *)kmm_malloc(CONFIG_FS_OVERLAY_COPYUP_BUFSIZE);
+	if (buffer == NULL) {
+		ret = -ENOMEM;
+		goto errout_with_upper;
+	}
+
+	ret = overlay_openlayer(om, OVERLAY_LOWER, relpath, false, O_RDOK, 0, &lower);
+	if (ret < 0) {
+		goto errout_with_buffer;
+	}
+
+	while ((nread = lops->read(&lower, buffer, CONFIG_FS_OVERLAY_COPYUP_BUFSIZE)) > 0) {
+		for (nwritten = 0; nwritten < nread; nwritten += n) {
+			n = uops->write(&upper, buffer + nwritten, nread - nwritten);
+			if (n <= 0) {
+				nread = n < 0 ? n : -ENOSPC;
+				break;
+			}
+		}
+
+		if (nread < 0) {
+			break;
+		}
+	}
+
+	ret = nread < 0 ? (int)nread : OK;
+	lops->close(&lower);
+
+errout_with_buffer:
+	kmm_free(buffer);
+
+errout_with_upper:
+	uops->close(&upper);
+	if (ret < 0 && uops->unlink != NULL) {
+		/* Do not leave a partial copy to shadow the lower file */
+
+		overlay_path(om->om_path, &om->om_layer[OVERLAY_UPPER], relpath, false);
+		uops->unlink(om->om_layer[OVERLAY_UPPER].ol_inode, om->om_path);
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_reserved
+ *
+ * Description:
+ *   Names that would be taken for whiteouts cannot be created.
+ *
+ ****************************************************************************/
+
+static inline bool overlay_reserved(FAR const char *relpath)
+{
+	return strncmp(overlay_basename(relpath), OVERLAY_WHITEOUT, OVERLAY_WHITEOUT_LEN) == 0;
+}
+
+/****************************************************************************
+ * Name: overlay_diropen
+ ****************************************************************************/
+
+static int overlay_diropen(FAR struct overlay_mountpt_s *om, FAR const char *relpath, FAR struct overlay_dir_s *od)
+{
+	FAR struct overlay_layer_s *layer;
+	struct stat st;
+	bool lower = true;
+	int index;
+	int ret;
+
+	ret = overlay_statlayer(om, OVERLAY_UPPER, relpath, false, &st);
+	if (ret == OK) {
+		if (!S_ISDIR(st.st_mode)) {
+			return -ENOTDIR;
+		}
+		lower = !overlay_opaque(om, relpath);
+	}
+
+	if (lower) {
+		lower = !overlay_hidden(om, relpath) && overlay_statlayer(om, OVERLAY_LOWER, relpath, false, &st) == OK && S_ISDIR(st.st_mode);
+	}
+
+	for (index = 0; index < OVERLAY_NLAYERS; index++) {
+		layer = &om->om_layer[index];
+		if ((index == OVERLAY_UPPER && ret < 0) || (index == OVERLAY_LOWER && !lower)) {
+			continue;
+		}
+
+		if (overlay_mops(layer)->opendir == NULL) {
+			continue;
+		}
+
+		od->od_dir[index].fd_root = layer->ol_inode;
+		overlay_path(om->om_path, layer, relpath, false);
+		if (overlay_mops(layer)->opendir(layer->ol_inode, om->om_path, &od->od_dir[index]) == OK) {
+			od->od_open[index] = true;
+		}
+	}
+
+	if (!od->od_open[OVERLAY_UPPER] && !od->od_open[OVERLAY_LOWER]) {
+		return -ENOENT;
+	}
+
+	od->od_relpath = (FAR char *)kmm_malloc(strlen(relpath) + 1);
+	if (od->od_relpath == NULL) {
+		return -ENOMEM;
+	}
+	strcpy(od->od_relpath, relpath);
+
+	od->od_layer = OVERLAY_UPPER;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: overlay_dirclose
+ ****************************************************************************/
+
+static void overlay_dirclose(FAR struct overlay_mountpt_s *om, FAR struct overlay_dir_s *od)
+{
+	FAR struct overlay_layer_s *layer;
+	int index;
+
+	for (index = 0; index < OVERLAY_NLAYERS; index++) {
+		layer = &om->om_layer[index];
+		if (od->od_open[index] && overlay_mops(layer)->closedir != NULL) {
+			overlay_mops(layer)->closedir(layer->ol_inode, &od->od_dir[index]);
+		}
+		od->od_open[index] = false;
+	}
+
+	if (od->od_relpath != NULL) {
+		kmm_free(od->od_relpath);
+		od->od_relpath = NULL;
+	}
+}
+
+/****************************************************************************
+ * Name: overlay_dirnext
+ *
+ * Description:
+ *   Return the next visible entry.  Whiteouts are skipped in the upper
+ *   layer, and so are the lower entries that are shadowed or whited out.
+ *
+ ****************************************************************************/
+
+static FAR struct dirent *overlay_dirnext(FAR struct overlay_mountpt_s *om, FAR struct overlay_dir_s *od, FAR int *result)
+{
+	FAR struct overlay_layer_s *layer;
+	FAR struct dirent *entry;
+	FAR char *child = om->om_path2;
+	int ret;
+
+	while (od->od_layer < OVERLAY_NLAYERS) {
+		layer = &om->om_layer[od->od_layer];
+		if (!od->od_open[od->od_layer]) {
+			od->od_layer++;
+			continue;
+		}
+
+		ret = overlay_mops(layer)->readdir(layer->ol_inode, &od->od_dir[od->od_layer]);
+		if (ret < 0) {
+			if (ret != -ENOENT) {
+				*result = ret;
+				return NULL;
+			}
+			od->od_layer++;
+			continue;
+		}
+
+		entry = &od->od_dir[od->od_layer].fd_dir;
+		if (od->od_layer == OVERLAY_UPPER) {
+			if (strncmp(entry->d_name, OVERLAY_WHITEOUT, OVERLAY_WHITEOUT_LEN) == 0) {
+				continue;
+			}
+		} else if (overlay_join(child, od->od_relpath, entry->d_name) == OK) {
+			if (overlay_statlayer(om, OVERLAY_UPPER, child, false, NULL) == OK || overlay_statlayer(om, OVERLAY_UPPER, child, true, NULL) == OK) {
+				continue;
+			}
+		}
+
+		*result = OK;
+		return entry;
+	}
+
+	*result = -ENOENT;
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: overlay_open
+ ****************************************************************************/
+
+static int overlay_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)filep->f_inode->i_private;
+	FAR struct file *inner;
+	struct stat st;
+	int index;
+	int ret;
+
+	inner = (FAR struct file *)kmm_zalloc(sizeof(struct file));
+	if (inner == NULL) {
+		return -ENOMEM;
+	}
+
+	overlay_semtake(om);
+	index = overlay_lookup(om, relpath, &st);
+	if (index < 0) {
+		/* A new file always goes to the upper layer */
+
+		if ((oflags & O_CREAT) == 0) {
+			ret = -ENOENT;
+			goto errout_with_semaphore;
+		}
+
+		if (overlay_reserved(relpath)) {
+			ret = -EINVAL;
+			goto errout_with_semaphore;
+		}
+
+		ret = overlay_mkparents(om, relpath);
+		if (ret < 0) {
+			goto errout_with_semaphore;
+		}
+
+		overlay_unwhiteout(om, relpath);
+		index = OVERLAY_UPPER;
+	} else if (index == OVERLAY_LOWER) {
+		if ((oflags & (O_CREAT | O_EXCL)) == (O_CREAT | O_EXCL)) {
+			ret = -EEXIST;
+			goto errout_with_semaphore;
+		}
+
+		/* Writing to a lower file copies it up first */
+
+		if ((oflags & (O_WROK | O_TRUNC)) != 0) {
+			if (S_ISDIR(st.st_mode)) {
+				ret = -EISDIR;
+				goto errout_with_semaphore;
+			}
+
+			ret = overlay_copyup(om, relpath, st.st_mode, (oflags & O_TRUNC) == 0);
+			if (ret < 0) {
+				goto errout_with_semaphore;
+			}
+			index = OVERLAY_UPPER;
+		}
+	}
+
+	ret = overlay_openlayer(om, index, relpath, false, oflags, mode, inner);
+	if (ret < 0) {
+		goto errout_with_semaphore;
+	}
+
+	overlay_semgive(om);
+	filep->f_priv = inner;
+	filep->f_pos = inner->f_pos;
+	return OK;
+
+errout_with_semaphore:
+	overlay_semgive(om);
+	kmm_free(inner);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_close
+ ****************************************************************************/
+
+static int overlay_close(FAR struct file *filep)
+{
+	FAR struct file *inner = overlay_inner(filep);
+	int ret;
+
+	ret = inner->f_inode->u.i_mops->close(inner);
+	kmm_free(inner);
+	filep->f_priv = NULL;
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_read
+ ****************************************************************************/
+
+static ssize_t overlay_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct file *inner = overlay_inner(filep);
+	ssize_t ret;
+
+	ret = inner->f_inode->u.i_mops->read(inner, buffer, buflen);
+	filep->f_pos = inner->f_pos;
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_write
+ ****************************************************************************/
+
+static ssize_t overlay_write(FAR struct file *filep, FAR const char *buffer, size_t buflen)
+{
+	FAR struct file *inner = overlay_inner(filep);
+	ssize_t ret;
+
+	if (inner->f_inode->u.i_mops->write == NULL) {
+		return -EACCES;
+	}
+
+	ret = inner->f_inode->u.i_mops->write(inner, buffer, buflen);
+	filep->f_pos = inner->f_pos;
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_seek
+ ****************************************************************************/
+
+static off_t overlay_seek(FAR struct file *filep, off_t offset, int whence)
+{
+	FAR struct file *inner = overlay_inner(filep);
+	off_t ret;
+
+	if (inner->f_inode->u.i_mops->seek == NULL) {
+		return -ESPIPE;
+	}
+
+	ret = inner->f_inode->u.i_mops->seek(inner, offset, whence);
+	filep->f_pos = inner->f_pos;
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_ioctl
+ ****************************************************************************/
+
+static int overlay_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
+{
+	FAR struct file *inner = overlay_inner(filep);
+
+	if (inner->f_inode->u.i_mops->ioctl == NULL) {
+		return -ENOTTY;
+	}
+
+	return inner->f_inode->u.i_mops->ioctl(inner, cmd, arg);
+}
+
+/****************************************************************************
+ * Name: overlay_sync
+ ****************************************************************************/
+
+static int overlay_sync(FAR struct file *filep)
+{
+	FAR struct file *inner = overlay_inner(filep);
+
+	if (inner->f_inode->u.i_mops->sync == NULL) {
+		return OK;
+	}
+
+	return inner->f_inode->u.i_mops->sync(inner);
+}
+
+/****************************************************************************
+ * Name: overlay_dup
+ ****************************************************************************/
+
+static int overlay_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct file *oldinner = overlay_inner(oldp);
+	FAR struct file *newinner;
+	int ret;
+
+	if (oldinner->f_inode->u.i_mops->dup == NULL) {
+		return -ENOSYS;
+	}
+
+	newinner = (FAR struct file *)kmm_zalloc(sizeof(struct file));
+	if (newinner == NULL) {
+		return -ENOMEM;
+	}
+
+	newinner->f_oflags = oldinner->f_oflags;
+	newinner->f_pos = oldinner->f_pos;
+	newinner->f_inode = oldinner->f_inode;
+
+	ret = oldinner->f_inode->u.i_mops->dup(oldinner, newinner);
+	if (ret < 0) {
+		kmm_free(newinner);
+		return ret;
+	}
+
+	newp->f_priv = newinner;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: overlay_fstat
+ ****************************************************************************/
+
+static int overlay_fstat(FAR const struct file *filep, FAR struct stat *buf)
+{
+	FAR struct file *inner = overlay_inner(filep);
+
+	if (inner->f_inode->u.i_mops->fstat == NULL) {
+		return -ENOSYS;
+	}
+
+	return inner->f_inode->u.i_mops->fstat(inner, buf);
+}
+
+/****************************************************************************
+ * Name: overlay_truncate
+ ****************************************************************************/
+
+static int overlay_truncate(FAR struct file *filep, off_t length)
+{
+	FAR struct file *inner = overlay_inner(filep);
+
+	if (inner->f_inode->u.i_mops->truncate == NULL) {
+		return -ENOSYS;
+	}
+
+	return inner->f_inode->u.i_mops->truncate(inner, length);
+}
+
+/****************************************************************************
+ * Name: overlay_opendir
+ ****************************************************************************/
+
+static int overlay_opendir(FAR struct inode *mountpt, FAR const char *relpath, FAR struct fs_dirent_s *dir)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	FAR struct overlay_dir_s *od;
+	int ret;
+
+	od = (FAR struct overlay_dir_s *)kmm_zalloc(sizeof(struct overlay_dir_s));
+	if (od == NULL) {
+		return -ENOMEM;
+	}
+
+	overlay_semtake(om);
+	ret = overlay_diropen(om, relpath, od);
+	if (ret < 0) {
+		overlay_dirclose(om, od);
+		kmm_free(od);
+	} else {
+		dir->u.overlay = od;
+	}
+
+	overlay_semgive(om);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_closedir
+ ****************************************************************************/
+
+static int overlay_closedir(FAR struct inode *mountpt, FAR struct fs_dirent_s *dir)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	FAR struct overlay_dir_s *od = (FAR struct overlay_dir_s *)dir->u.overlay;
+
+	overlay_semtake(om);
+	overlay_dirclose(om, od);
+	overlay_semgive(om);
+
+	kmm_free(od);
+	dir->u.overlay = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: overlay_readdir
+ ****************************************************************************/
+
+static int overlay_readdir(FAR struct inode *mountpt, FAR struct fs_dirent_s *dir)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	FAR struct overlay_dir_s *od = (FAR struct overlay_dir_s *)dir->u.overlay;
+	FAR struct dirent *entry;
+	int ret;
+
+	overlay_semtake(om);
+	entry = overlay_dirnext(om, od, &ret);
+	if (entry != NULL) {
+		memcpy(&dir->fd_dir, entry, sizeof(struct dirent));
+	}
+
+	overlay_semgive(om);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_rewinddir
+ ****************************************************************************/
+
+static int overlay_rewinddir(FAR struct inode *mountpt, FAR struct fs_dirent_s *dir)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	FAR struct overlay_dir_s *od = (FAR struct overlay_dir_s *)dir->u.overlay;
+	FAR struct overlay_layer_s *layer;
+	int index;
+
+	overlay_semtake(om);
+	for (index = 0; index < OVERLAY_NLAYERS; index++) {
+		layer = &om->om_layer[index];
+		if (od->od_open[index] && overlay_mops(layer)->rewinddir != NULL) {
+			overlay_mops(layer)->rewinddir(layer->ol_inode, &od->od_dir[index]);
+		}
+	}
+
+	od->od_layer = OVERLAY_UPPER;
+	overlay_semgive(om);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: overlay_bindlayer
+ *
+ * Description:
+ *   Hold the mountpoint that contains the absolute 'path'.
+ *
+ ****************************************************************************/
+
+static int overlay_bindlayer(FAR struct overlay_layer_s *layer, FAR const char *path)
+{
+	FAR const char *relpath = NULL;
+	FAR struct inode *inode;
+	size_t len;
+
+	inode = inode_find(path, &relpath);
+	if (inode == NULL) {
+		return -ENOENT;
+	}
+
+	if (!INODE_IS_MOUNTPT(inode) || inode->u.i_mops == NULL || inode->u.i_mops->open == NULL) {
+		inode_release(inode);
+		return -EINVAL;
+	}
+
+	relpath = relpath ? relpath : "";
+	len = strlen(relpath);
+	while (len > 0 && relpath[len - 1] == '/') {
+		len--;
+	}
+
+	layer->ol_prefix = (FAR char *)kmm_malloc(len + 1);
+	if (layer->ol_prefix == NULL) {
+		inode_release(inode);
+		return -ENOMEM;
+	}
+
+	memcpy(layer->ol_prefix, relpath, len);
+	layer->ol_prefix[len] = '\0';
+	layer->ol_inode = inode;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: overlay_release
+ ****************************************************************************/
+
+static void overlay_release(FAR struct overlay_mountpt_s *om)
+{
+	FAR struct overlay_layer_s *layer;
+	int index;
+
+	for (index = 0; index < OVERLAY_NLAYERS; index++) {
+		layer = &om->om_layer[index];
+		if (layer->ol_inode != NULL) {
+			inode_release(layer->ol_inode);
+			kmm_free(layer->ol_prefix);
+		}
+	}
+
+	sem_destroy(&om->om_sem);
+	kmm_free(om);
+}
+
+/****************************************************************************
+ * Name: overlay_bind
+ *
+ * Description:
+ *   The mount data names the layers, "lower=<path>,upper=<path>".  Both
+ *   must be inside mounted file systems and the upper one must be
+ *   writable.
+ *
+ ****************************************************************************/
+
+static int overlay_bind(FAR struct inode *blkdriver, FAR const void *data, FAR void **handle)
+{
+	FAR struct overlay_mountpt_s *om;
+	FAR char *options;
+	FAR char *option;
+	FAR char *saveptr;
+	int index;
+	int ret = OK;
+
+	if (data == NULL) {
+		return -EINVAL;
+	}
+
+	options = (FAR char *)kmm_malloc(strlen((FAR const char *)data) + 1);
+	om = (FAR struct overlay_mountpt_s *)kmm_zalloc(sizeof(struct overlay_mountpt_s));
+	if (options == NULL || om == NULL) {
+		kmm_free(options);
+		kmm_free(om);
+		return -ENOMEM;
+	}
+
+	strcpy(options, (FAR const char *)data);
+	sem_init(&om->om_sem, 0, 1);
+
+	for (option = strtok_r(options, ",", &saveptr); option != NULL && ret == OK; option = strtok_r(NULL, ",", &saveptr)) {
+		if (strncmp(option, "lower=", 6) == 0) {
+			index = OVERLAY_LOWER;
+		} else if (strncmp(option, "upper=", 6) == 0) {
+			index = OVERLAY_UPPER;
+		} else {
+			fdbg("ERROR: unknown option %s\n", option);
+			ret = -EINVAL;
+			break;
+		}
+
+		if (om->om_layer[index].ol_inode != NULL) {
+			ret = -EINVAL;
+			break;
+		}
+
+		ret = overlay_bindlayer(&om->om_layer[index], option + 6);
+	}
+
+	kmm_free(options);
+
+	if (ret == OK && (om->om_layer[OVERLAY_LOWER].ol_inode == NULL || om->om_layer[OVERLAY_UPPER].ol_inode == NULL)) {
+		ret = -EINVAL;
+	}
+
+	if (ret == OK && overlay_mops(&om->om_layer[OVERLAY_UPPER])->write == NULL) {
+		ret = -EROFS;
+	}
+
+	if (ret < 0) {
+		fdbg("ERROR: overlay bind failed: %d\n", ret);
+		overlay_release(om);
+		return ret;
+	}
+
+	*handle = (FAR void *)om;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: overlay_unbind
+ ****************************************************************************/
+
+static int overlay_unbind(FAR void *handle, FAR struct inode **blkdriver)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)handle;
+
+	if (om == NULL) {
+		return -EINVAL;
+	}
+
+	if (blkdriver) {
+		*blkdriver = NULL;
+	}
+
+	overlay_release(om);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: overlay_statfs
+ *
+ * Description:
+ *   The free space is that of the upper layer, where all writes go.
+ *
+ ****************************************************************************/
+
+static int overlay_statfs(FAR struct inode *mountpt, FAR struct statfs *buf)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	FAR struct overlay_layer_s *upper = &om->om_layer[OVERLAY_UPPER];
+
+	if (overlay_mops(upper)->statfs == NULL) {
+		return -ENOSYS;
+	}
+
+	return overlay_mops(upper)->statfs(upper->ol_inode, buf);
+}
+
+/****************************************************************************
+ * Name: overlay_unlink
+ ****************************************************************************/
+
+static int overlay_unlink(FAR struct inode *mountpt, FAR const char *relpath)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	FAR struct overlay_layer_s *upper = &om->om_layer[OVERLAY_UPPER];
+	struct stat st;
+	int index;
+	int ret = OK;
+
+	overlay_semtake(om);
+	index = overlay_lookup(om, relpath, &st);
+	if (index < 0) {
+		ret = index;
+		goto errout_with_semaphore;
+	}
+
+	if (S_ISDIR(st.st_mode)) {
+		ret = -EISDIR;
+		goto errout_with_semaphore;
+	}
+
+	if (index == OVERLAY_UPPER) {
+		if (overlay_mops(upper)->unlink == NULL) {
+			ret = -ENOSYS;
+			goto errout_with_semaphore;
+		}
+
+		overlay_path(om->om_path, upper, relpath, false);
+		ret = overlay_mops(upper)->unlink(upper->ol_inode, om->om_path);
+		if (ret < 0) {
+			goto errout_with_semaphore;
+		}
+	}
+
+	/* A lower file of the same name would show through */
+
+	if (!overlay_hidden(om, relpath) && overlay_statlayer(om, OVERLAY_LOWER, relpath, false, NULL) == OK) {
+		ret = overlay_whiteout(om, relpath);
+	}
+
+errout_with_semaphore:
+	overlay_semgive(om);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_mkdir
+ ****************************************************************************/
+
+static int overlay_mkdir(FAR struct inode *mountpt, FAR const char *relpath, mode_t mode)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	FAR struct overlay_layer_s *upper = &om->om_layer[OVERLAY_UPPER];
+	FAR char *marker;
+	struct file opq;
+	bool opaque;
+	int ret;
+
+	if (overlay_mops(upper)->mkdir == NULL) {
+		return -ENOSYS;
+	}
+
+	if (overlay_reserved(relpath)) {
+		return -EINVAL;
+	}
+
+	overlay_semtake(om);
+	if (overlay_lookup(om, relpath, NULL) >= 0) {
+		ret = -EEXIST;
+		goto errout_with_semaphore;
+	}
+
+	ret = overlay_mkparents(om, relpath);
+	if (ret < 0) {
+		goto errout_with_semaphore;
+	}
+
+	opaque = overlay_unwhiteout(om, relpath);
+
+	overlay_path(om->om_path, upper, relpath, false);
+	ret = overlay_mops(upper)->mkdir(upper->ol_inode, om->om_path, mode);
+	if (ret < 0 || !opaque) {
+		goto errout_with_semaphore;
+	}
+
+	/* The directory replaces a deleted lower one, keep the old entries hidden */
+
+	marker = om->om_path2;
+	ret = overlay_join(marker, relpath, OVERLAY_OPAQUE);
+	if (ret == OK) {
+		ret = overlay_openlayer(om, OVERLAY_UPPER, marker, true, O_WROK | O_CREAT | O_TRUNC, 0666, &opq);
+	}
+
+	if (ret == OK) {
+		ret = overlay_mops(upper)->close(&opq);
+	}
+
+errout_with_semaphore:
+	overlay_semgive(om);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_rmdir
+ ****************************************************************************/
+
+static int overlay_rmdir(FAR struct inode *mountpt, FAR const char *relpath)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	FAR struct overlay_layer_s *upper = &om->om_layer[OVERLAY_UPPER];
+	FAR struct overlay_dir_s *od;
+	FAR struct dirent *entry;
+	struct stat st;
+	bool found;
+	int index;
+	int ret;
+
+	if (overlay_mops(upper)->rmdir == NULL || overlay_mops(upper)->unlink == NULL) {
+		return -ENOSYS;
+	}
+
+	od = (FAR struct overlay_dir_s *)kmm_zalloc(sizeof(struct overlay_dir_s));
+	if (od == NULL) {
+		return -ENOMEM;
+	}
+
+	overlay_semtake(om);
+	index = overlay_lookup(om, relpath, &st);
+	if (index < 0) {
+		ret = index;
+		goto errout_with_semaphore;
+	}
+
+	if (!S_ISDIR(st.st_mode)) {
+		ret = -ENOTDIR;
+		goto errout_with_semaphore;
+	}
+
+	/* The directory must look empty once both layers are merged */
+
+	ret = overlay_diropen(om, relpath, od);
+	if (ret == OK) {
+		entry = overlay_dirnext(om, od, &ret);
+		ret = entry != NULL ? -ENOTEMPTY : (ret == -ENOENT ? OK : ret);
+	}
+
+	overlay_dirclose(om, od);
+	if (ret < 0) {
+		goto errout_with_semaphore;
+	}
+
+	if (index == OVERLAY_UPPER) {
+		/* Only whiteouts are left, remove them one at a time */
+
+		do {
+			found = false;
+			memset(od, 0, sizeof(struct overlay_dir_s));
+			od->od_dir[OVERLAY_UPPER].fd_root = upper->ol_inode;
+			overlay_path(om->om_path, upper, relpath, false);
+			if (overlay_mops(upper)->opendir(upper->ol_inode, om->om_path, &od->od_dir[OVERLAY_UPPER]) < 0) {
+				break;
+			}
+
+			while (overlay_mops(upper)->readdir(upper->ol_inode, &od->od_dir[OVERLAY_UPPER]) == OK) {
+				entry = &od->od_dir[OVERLAY_UPPER].fd_dir;
+				if (strncmp(entry->d_name, OVERLAY_WHITEOUT, OVERLAY_WHITEOUT_LEN) == 0) {
+					found = overlay_join(om->om_scratch, relpath, entry->d_name) == OK;
+					break;
+				}
+			}
+
+			if (overlay_mops(upper)->closedir != NULL) {
+				overlay_mops(upper)->closedir(upper->ol_inode, &od->od_dir[OVERLAY_UPPER]);
+			}
+
+			if (found) {
+				overlay_path(om->om_path, upper, om->om_scratch, false);
+				found = overlay_mops(upper)->unlink(upper->ol_inode, om->om_path) == OK;
+			}
+		} while (found);
+
+		overlay_path(om->om_path, upper, relpath, false);
+		ret = overlay_mops(upper)->rmdir(upper->ol_inode, om->om_path);
+		if (ret < 0) {
+			goto errout_with_semaphore;
+		}
+	}
+
+	if (!overlay_hidden(om, relpath) && overlay_statlayer(om, OVERLAY_LOWER, relpath, false, NULL) == OK) {
+		ret = overlay_whiteout(om, relpath);
+	}
+
+errout_with_semaphore:
+	overlay_semgive(om);
+	kmm_free(od);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_rename
+ *
+ * Description:
+ *   Files are copied up before they are renamed in the upper layer.  Lower
+ *   directories are not moved, which is reported as -EXDEV so that callers
+ *   fall back to copying like across file systems.
+ *
+ ****************************************************************************/
+
+static int overlay_rename(FAR struct inode *mountpt, FAR const char *oldrelpath, FAR const char *newrelpath)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	FAR struct overlay_layer_s *upper = &om->om_layer[OVERLAY_UPPER];
+	struct stat st;
+	int index;
+	int ret;
+
+	if (overlay_mops(upper)->rename == NULL) {
+		return -ENOSYS;
+	}
+
+	if (overlay_reserved(newrelpath)) {
+		return -EINVAL;
+	}
+
+	overlay_semtake(om);
+	index = overlay_lookup(om, oldrelpath, &st);
+	if (index < 0) {
+		ret = index;
+		goto errout_with_semaphore;
+	}
+
+	if (S_ISDIR(st.st_mode)) {
+		/* Only a directory that has nothing in the lower layer can move */
+
+		if (index == OVERLAY_LOWER || (!overlay_hidden(om, oldrelpath) && overlay_statlayer(om, OVERLAY_LOWER, oldrelpath, false, NULL) == OK)) {
+			ret = -EXDEV;
+			goto errout_with_semaphore;
+		}
+	} else if (index == OVERLAY_LOWER) {
+		ret = overlay_copyup(om, oldrelpath, st.st_mode, true);
+		if (ret < 0) {
+			goto errout_with_semaphore;
+		}
+	}
+
+	ret = overlay_mkparents(om, newrelpath);
+	if (ret < 0) {
+		goto errout_with_semaphore;
+	}
+
+	overlay_unwhiteout(om, newrelpath);
+
+	overlay_path(om->om_path, upper, oldrelpath, false);
+	ret = overlay_path(om->om_path2, upper, newrelpath, false);
+	if (ret == OK) {
+		ret = overlay_mops(upper)->rename(upper->ol_inode, om->om_path, om->om_path2);
+	}
+
+	if (ret == OK && !overlay_hidden(om, oldrelpath) && overlay_statlayer(om, OVERLAY_LOWER, oldrelpath, false, NULL) == OK) {
+		ret = overlay_whiteout(om, oldrelpath);
+	}
+
+errout_with_semaphore:
+	overlay_semgive(om);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: overlay_stat
+ ****************************************************************************/
+
+static int overlay_stat(FAR struct inode *mountpt, FAR const char *relpath, FAR struct stat *buf)
+{
+	FAR struct overlay_mountpt_s *om = (FAR struct overlay_mountpt_s *)mountpt->i_private;
+	int ret;
+
+	overlay_semtake(om);
+	ret = overlay_lookup(om, relpath, buf);
+	overlay_semgive(om);
+
+	return ret < 0 ? ret : OK;
+}
+
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_OVERLAY */
@@ -94,6 +94,9 @@
 
 extern const struct procfs_operations proc_operations;
 extern const struct procfs_operations cpuload_operations;
+extern const struct procfs_operations schedtrace_operations;
+extern const struct procfs_operations wqueue_operations;
+extern const struct procfs_operations inodecache_operations;
 extern const struct procfs_operations uptime_operations;
 extern const struct procfs_operations version_operations;
 #if defined(CONFIG_LOG_DUMP)
@@ -111,6 +114,7 @@ extern const struct procfs_operations power_procfsoperations;
 extern const struct procfs_operations cm_operations;
 extern const struct procfs_operations irqs_operations;
 extern const struct procfs_operations ereport_operations;
+extern const struct procfs_operations dnscache_operations;
 
 /* And even worse, this one is specific to the STM32.  The solution to
  * this nasty couple would be to replace this hard-coded, ROM-able
@@ -132,6 +136,18 @@ static const struct procfs_entry_s g_procfsentries[] = {
 	{"cpuload", &cpuload_operations},
 #endif
 
+#if defined(CONFIG_SCHED_TRACE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SCHEDTRACE)
+	{"schedtrace", &schedtrace_operations},
+#endif
+
+#if defined(CONFIG_SCHED_WORKQUEUE_STATS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_WQUEUE)
+	{"wqueue", &wqueue_operations},
+#endif
+
+#if defined(CONFIG_FS_INODE_CACHE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_INODECACHE)
+	{"inodecache", &inodecache_operations},
+#endif
+
 #if defined(CONFIG_LOG_DUMP)
 	{"logsave", &logsave_operations},
 #endif
@@ -165,6 +181,10 @@ static const struct procfs_entry_s g_procfsentries[] = {
 	{"version", &version_operations},
 #endif
 
+#if defined(CONFIG_NET_DNS_CACHE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_DNSCACHE)
+	{"dnscache", &dnscache_operations},
+#endif
+
 #if defined(CONFIG_CM) && !defined(CONFIG_FS_PROCFS_EXCLUDE_CONNECTIVITY)
 	{"connectivity**", &cm_operations},
 #endif
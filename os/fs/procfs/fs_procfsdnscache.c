@@ -0,0 +1,266 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+
+#include "lwip/opt.h"
+#include "lwip/ip_addr.h"
+#include "lwip/dns_cache.h"
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_NET_DNS_CACHE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_DNSCACHE)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Counters plus one line per entry: name, address, seconds left and flags */
+
+#define DNSCACHE_STATS_LEN  256
+#define DNSCACHE_LINE_LEN   (DNS_CACHE_NAME_LEN + IPADDR_STRLEN_MAX + 24)
+#define DNSCACHE_BUFSIZE    (DNSCACHE_STATS_LEN + DNS_CACHE_SIZE * DNSCACHE_LINE_LEN)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The cache is sampled and formatted when the file is read at offset 0 */
+
+struct dnscache_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	unsigned int linesize;		/* Number of valid characters in line[] */
+	char line[DNSCACHE_BUFSIZE];
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int dnscache_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int dnscache_close(FAR struct file *filep);
+static ssize_t dnscache_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static int dnscache_dup(FAR const struct file *oldp, FAR struct file *newp);
+static int dnscache_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+const struct procfs_operations dnscache_operations = {
+	dnscache_open,				/* open */
+	dnscache_close,				/* close */
+	dnscache_read,				/* read */
+	NULL,						/* write */
+
+	dnscache_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	dnscache_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: dnscache_entry
+ ****************************************************************************/
+
+static void dnscache_entry(FAR const struct dns_cache_info *info, FAR void *arg)
+{
+	FAR struct dnscache_file_s *attr = (FAR struct dnscache_file_s *)arg;
+	char addr[IPADDR_STRLEN_MAX];
+
+	if (attr->linesize >= DNSCACHE_BUFSIZE) {
+		return;
+	}
+
+	if (info->ipaddr == NULL) {
+		strncpy(addr, "-", sizeof(addr));
+	} else {
+		ipaddr_ntoa_r(info->ipaddr, addr, sizeof(addr));
+	}
+
+	attr->linesize += snprintf(attr->line + attr->linesize, DNSCACHE_BUFSIZE - attr->linesize, "%-24s %-16s %7u%s%s\n", info->name, addr, (unsigned int)info->ttl, info->ipaddr == NULL ? " N" : "", info->prefetching ? " P" : "");
+}
+
+/****************************************************************************
+ * Name: dnscache_format
+ ****************************************************************************/
+
+static void dnscache_format(FAR struct dnscache_file_s *attr)
+{
+	struct dns_cache_stats stats;
+
+	dns_cache_get_stats(&stats);
+
+	attr->linesize = snprintf(attr->line, DNSCACHE_BUFSIZE, "lookups %u\nhits %u\nnegative_hits %u\nmisses %u\nexpired %u\ninserts %u\nevictions %u\nprefetches %u\n", (unsigned int)stats.lookups, (unsigned int)stats.hits, (unsigned int)stats.negative_hits, (unsigned int)stats.misses, (unsigned int)stats.expired, (unsigned int)stats.inserts, (unsigned int)stats.evictions, (unsigned int)stats.prefetches);
+
+	dns_cache_foreach(dnscache_entry, attr);
+
+	if (attr->linesize >= DNSCACHE_BUFSIZE) {
+		attr->linesize = DNSCACHE_BUFSIZE - 1;
+	}
+}
+
+/****************************************************************************
+ * Name: dnscache_open
+ ****************************************************************************/
+
+static int dnscache_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct dnscache_file_s *attr;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* PROCFS is read-only */
+
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0) {
+		fdbg("ERROR: Only O_RDONLY supported\n");
+		return -EACCES;
+	}
+
+	if (strcmp(relpath, "dnscache") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	attr = (FAR struct dnscache_file_s *)kmm_zalloc(sizeof(struct dnscache_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: dnscache_close
+ ****************************************************************************/
+
+static int dnscache_close(FAR struct file *filep)
+{
+	FAR struct dnscache_file_s *attr;
+
+	attr = (FAR struct dnscache_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: dnscache_read
+ ****************************************************************************/
+
+static ssize_t dnscache_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct dnscache_file_s *attr;
+	off_t offset;
+	ssize_t ret;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	attr = (FAR struct dnscache_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	/* Keep the snapshot stable while the reader continues at f_pos > 0 */
+
+	if (filep->f_pos == 0) {
+		dnscache_format(attr);
+	}
+
+	offset = filep->f_pos;
+	ret = procfs_memcpy(attr->line, attr->linesize, buffer, buflen, &offset);
+	if (ret > 0) {
+		filep->f_pos += ret;
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: dnscache_dup
+ ****************************************************************************/
+
+static int dnscache_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct dnscache_file_s *oldattr;
+	FAR struct dnscache_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	oldattr = (FAR struct dnscache_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	newattr = (FAR struct dnscache_file_s *)kmm_malloc(sizeof(struct dnscache_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	memcpy(newattr, oldattr, sizeof(struct dnscache_file_s));
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: dnscache_stat
+ ****************************************************************************/
+
+static int dnscache_stat(FAR const char *relpath, FAR struct stat *buf)
+{
+	if (strcmp(relpath, "dnscache") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	memset(buf, 0, sizeof(struct stat));
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	return OK;
+}
+
+#endif							/* CONFIG_NET_DNS_CACHE && !CONFIG_FS_PROCFS_EXCLUDE_DNSCACHE */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
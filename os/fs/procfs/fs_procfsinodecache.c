@@ -0,0 +1,224 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+
+#include "inode/inode.h"
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_FS_INODE_CACHE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_INODECACHE)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define INODECACHE_LINELEN 96
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* The counters are sampled and formatted when the file is opened */
+
+struct inodecache_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	unsigned int linesize;		/* Number of valid characters in line[] */
+	char line[INODECACHE_LINELEN];
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int inodecache_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int inodecache_close(FAR struct file *filep);
+static ssize_t inodecache_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static int inodecache_dup(FAR const struct file *oldp, FAR struct file *newp);
+static int inodecache_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+const struct procfs_operations inodecache_operations = {
+	inodecache_open,			/* open */
+	inodecache_close,			/* close */
+	inodecache_read,			/* read */
+	NULL,						/* write */
+
+	inodecache_dup,				/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	inodecache_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: inodecache_open
+ ****************************************************************************/
+
+static int inodecache_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct inodecache_file_s *attr;
+	struct inode_cache_stats_s stats;
+	uint32_t lookups;
+	uint32_t permille;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* PROCFS is read-only */
+
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0) {
+		fdbg("ERROR: Only O_RDONLY supported\n");
+		return -EACCES;
+	}
+
+	if (strcmp(relpath, "inodecache") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	attr = (FAR struct inodecache_file_s *)kmm_zalloc(sizeof(struct inodecache_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	inode_cache_getstats(&stats);
+	lookups = stats.hits + stats.misses;
+	permille = lookups > 0 ? (uint32_t)((uint64_t)stats.hits * 1000 / lookups) : 0;
+
+	attr->linesize = snprintf(attr->line, INODECACHE_LINELEN, "hits %u misses %u hitrate %u.%u%% invalidations %u\n", (unsigned int)stats.hits, (unsigned int)stats.misses, (unsigned int)(permille / 10), (unsigned int)(permille % 10), (unsigned int)stats.invalidations);
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: inodecache_close
+ ****************************************************************************/
+
+static int inodecache_close(FAR struct file *filep)
+{
+	FAR struct inodecache_file_s *attr;
+
+	attr = (FAR struct inodecache_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: inodecache_read
+ ****************************************************************************/
+
+static ssize_t inodecache_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct inodecache_file_s *attr;
+	off_t offset;
+	ssize_t ret;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	attr = (FAR struct inodecache_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	offset = filep->f_pos;
+	ret = procfs_memcpy(attr->line, attr->linesize, buffer, buflen, &offset);
+	if (ret > 0) {
+		filep->f_pos += ret;
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: inodecache_dup
+ ****************************************************************************/
+
+static int inodecache_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct inodecache_file_s *oldattr;
+	FAR struct inodecache_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	oldattr = (FAR struct inodecache_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	newattr = (FAR struct inodecache_file_s *)kmm_malloc(sizeof(struct inodecache_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	memcpy(newattr, oldattr, sizeof(struct inodecache_file_s));
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: inodecache_stat
+ ****************************************************************************/
+
+static int inodecache_stat(const char *relpath, struct stat *buf)
+{
+	if (strcmp(relpath, "inodecache") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_FS_INODE_CACHE && !CONFIG_FS_PROCFS_EXCLUDE_INODECACHE */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
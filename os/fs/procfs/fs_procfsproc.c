@@ -367,7 +367,7 @@ static ssize_t proc_entry_stat(FAR struct proc_file_s *procfile, FAR struct tcb_
 	pid_t ppid;
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 	struct mm_heap_s *heap;
-	pid_t hash_pid;
+	heapinfo_tcb_info_t tcbinfo;
 #endif
 #ifdef CONFIG_SCHED_CPULOAD
 	int cpuload_idx;
@@ -402,10 +402,9 @@ static ssize_t proc_entry_stat(FAR struct proc_file_s *procfile, FAR struct tcb_
 		return -1;
 	}
 
-	hash_pid = PIDHASH(tcb->pid);
-	if (heap->alloc_list[hash_pid].pid == tcb->pid) {
-		curr_heap = heap->alloc_list[hash_pid].curr_alloc_size;
-		peak_heap = heap->alloc_list[hash_pid].peak_alloc_size;
+	if (heapinfo_get_tcbinfo(heap, tcb->pid, &tcbinfo) == OK) {
+		curr_heap = tcbinfo.curr_alloc_size;
+		peak_heap = tcbinfo.peak_alloc_size;
 	}
 #endif
 
@@ -0,0 +1,322 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/sched.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+#include <tinyara/sched_trace.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_SCHED_TRACE) && !defined(CONFIG_FS_PROCFS_EXCLUDE_SCHEDTRACE)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define SCHEDTRACE_LINELEN 64
+
+#if CONFIG_TASK_NAME_SIZE > 0
+#define SCHEDTRACE_NAMELEN CONFIG_TASK_NAME_SIZE
+#else
+#define SCHEDTRACE_NAMELEN 1
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct schedtrace_task_s {
+	pid_t pid;
+	uint8_t priority;
+	char name[SCHEDTRACE_NAMELEN + 1];
+};
+
+/* The trace is copied when the file is opened and formatted one line at a
+ * time as it is read: a header line per CPU, a line per task so that the
+ * converter can name the tasks, then a line per event.
+ */
+
+struct schedtrace_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	int ntasks;					/* Number of valid entries in tasks[] */
+	int nevents[SCHED_TRACE_NCPUS];	/* Number of events copied per CPU */
+	uint32_t total[SCHED_TRACE_NCPUS];	/* Events recorded per CPU since boot */
+	int item;					/* Next line to format */
+	unsigned int linesize;		/* Number of valid characters in line[] */
+	unsigned int linepos;		/* Number of characters of line[] already read */
+	char line[SCHEDTRACE_LINELEN];
+	FAR struct schedtrace_task_s *tasks;
+	FAR struct sched_trace_event_s *events;
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int schedtrace_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int schedtrace_close(FAR struct file *filep);
+static ssize_t schedtrace_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static ssize_t schedtrace_write(FAR struct file *filep, FAR const char *buffer, size_t buflen);
+static int schedtrace_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+const struct procfs_operations schedtrace_operations = {
+	schedtrace_open,			/* open */
+	schedtrace_close,			/* close */
+	schedtrace_read,			/* read */
+	schedtrace_write,			/* write */
+
+	NULL,						/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	schedtrace_stat				/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void schedtrace_gettask(FAR struct tcb_s *tcb, FAR void *arg)
+{
+	FAR struct schedtrace_file_s *attr = (FAR struct schedtrace_file_s *)arg;
+	FAR struct schedtrace_task_s *task;
+
+	if (attr->ntasks >= CONFIG_MAX_TASKS) {
+		return;
+	}
+
+	task = &attr->tasks[attr->ntasks++];
+	task->pid = tcb->pid;
+	task->priority = tcb->sched_priority;
+#if CONFIG_TASK_NAME_SIZE > 0
+	strncpy(task->name, tcb->name, SCHEDTRACE_NAMELEN);
+	task->name[SCHEDTRACE_NAMELEN] = '\0';
+#else
+	task->name[0] = '\0';
+#endif
+}
+
+/* Format line number 'item', returns false past the last line */
+
+static bool schedtrace_format(FAR struct schedtrace_file_s *attr, int item)
+{
+	FAR struct sched_trace_event_s *event;
+	int cpu;
+
+	if (item < SCHED_TRACE_NCPUS) {
+		cpu = item;
+		attr->linesize = snprintf(attr->line, SCHEDTRACE_LINELEN, "C %d %u %u %u\n", cpu, (unsigned int)SCHED_TRACE_TIMESTAMP_FREQ,
+								  (unsigned int)attr->total[cpu], (unsigned int)(attr->total[cpu] - attr->nevents[cpu]));
+		return true;
+	}
+	item -= SCHED_TRACE_NCPUS;
+
+	if (item < attr->ntasks) {
+		attr->linesize = snprintf(attr->line, SCHEDTRACE_LINELEN, "T %d %u %s\n", attr->tasks[item].pid,
+								  attr->tasks[item].priority, attr->tasks[item].name[0] ? attr->tasks[item].name : "-");
+		return true;
+	}
+	item -= attr->ntasks;
+
+	for (cpu = 0; cpu < SCHED_TRACE_NCPUS; cpu++) {
+		if (item < attr->nevents[cpu]) {
+			event = &attr->events[cpu * CONFIG_SCHED_TRACE_NEVENTS + item];
+			attr->linesize = snprintf(attr->line, SCHEDTRACE_LINELEN, "E %u %u %u %d %x\n", event->cpu, (unsigned int)event->time,
+									  event->type, event->pid, (unsigned int)event->arg);
+			return true;
+		}
+		item -= attr->nevents[cpu];
+	}
+
+	return false;
+}
+
+/****************************************************************************
+ * Name: schedtrace_open
+ ****************************************************************************/
+
+static int schedtrace_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct schedtrace_file_s *attr;
+	int cpu;
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* Writing "0" or "1" stops or restarts the recording */
+
+	if ((oflags & O_RDWR) == O_RDWR) {
+		fdbg("ERROR: Only O_RDONLY or O_WRONLY supported\n");
+		return -EACCES;
+	}
+
+	if (strcmp(relpath, "schedtrace") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	attr = (FAR struct schedtrace_file_s *)kmm_zalloc(sizeof(struct schedtrace_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	if ((oflags & O_WRONLY) == 0) {
+		attr->events = (FAR struct sched_trace_event_s *)kmm_malloc(SCHED_TRACE_NCPUS * CONFIG_SCHED_TRACE_NEVENTS * sizeof(struct sched_trace_event_s));
+		attr->tasks = (FAR struct schedtrace_task_s *)kmm_malloc(CONFIG_MAX_TASKS * sizeof(struct schedtrace_task_s));
+		if (!attr->events || !attr->tasks) {
+			fdbg("ERROR: Failed to allocate the trace copy\n");
+			kmm_free(attr->events);
+			kmm_free(attr->tasks);
+			kmm_free(attr);
+			return -ENOMEM;
+		}
+
+		for (cpu = 0; cpu < SCHED_TRACE_NCPUS; cpu++) {
+			attr->nevents[cpu] = sched_trace_snapshot(cpu, &attr->events[cpu * CONFIG_SCHED_TRACE_NEVENTS], &attr->total[cpu]);
+		}
+		sched_foreach(schedtrace_gettask, attr);
+	}
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: schedtrace_close
+ ****************************************************************************/
+
+static int schedtrace_close(FAR struct file *filep)
+{
+	FAR struct schedtrace_file_s *attr;
+
+	attr = (FAR struct schedtrace_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	kmm_free(attr->events);
+	kmm_free(attr->tasks);
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: schedtrace_read
+ ****************************************************************************/
+
+static ssize_t schedtrace_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct schedtrace_file_s *attr;
+	size_t copysize;
+	size_t total = 0;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	attr = (FAR struct schedtrace_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	while (total < buflen) {
+		if (attr->linepos >= attr->linesize) {
+			if (!schedtrace_format(attr, attr->item)) {
+				break;
+			}
+			attr->item++;
+			attr->linepos = 0;
+		}
+
+		copysize = attr->linesize - attr->linepos;
+		if (copysize > buflen - total) {
+			copysize = buflen - total;
+		}
+		memcpy(buffer + total, attr->line + attr->linepos, copysize);
+		attr->linepos += copysize;
+		total += copysize;
+	}
+
+	filep->f_pos += total;
+	return total;
+}
+
+/****************************************************************************
+ * Name: schedtrace_write
+ ****************************************************************************/
+
+static ssize_t schedtrace_write(FAR struct file *filep, FAR const char *buffer, size_t buflen)
+{
+	if (buflen == 0) {
+		return 0;
+	}
+
+	if (buffer[0] == '0') {
+		sched_trace_enable(false);
+	} else if (buffer[0] == '1') {
+		sched_trace_enable(true);
+	} else {
+		return -EINVAL;
+	}
+
+	return buflen;
+}
+
+/****************************************************************************
+ * Name: schedtrace_stat
+ ****************************************************************************/
+
+static int schedtrace_stat(const char *relpath, struct stat *buf)
+{
+	if (strcmp(relpath, "schedtrace") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR | S_IWUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_SCHED_TRACE && !CONFIG_FS_PROCFS_EXCLUDE_SCHEDTRACE */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
@@ -0,0 +1,307 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/clock.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/wqueue.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/procfs.h>
+
+#if !defined(CONFIG_DISABLE_MOUNTPOINT) && defined(CONFIG_FS_PROCFS)
+#if defined(CONFIG_SCHED_WORKQUEUE_STATS) && !defined(CONFIG_FS_PROCFS_EXCLUDE_WQUEUE)
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define WQUEUE_LINELEN 96
+
+/* One line for the high priority queue and one for the low priority queue,
+ * which has a line per CPU more when it steals work.
+ */
+
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+#define WQUEUE_NROWS   (2 + CONFIG_SMP_NCPUS)
+#else
+#define WQUEUE_NROWS   2
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct wqueue_row_s {
+	FAR const char *name;
+	int cpu;					/* WORK_CPU_ANY for the whole queue */
+	struct work_stats_s stats;
+};
+
+/* The statistics are copied when the file is opened and formatted one line
+ * at a time as they are read.
+ */
+
+struct wqueue_file_s {
+	struct procfs_file_s base;	/* Base open file structure */
+	int nrows;					/* Number of valid entries in rows[] */
+	int item;					/* Next line to format */
+	unsigned int linesize;		/* Number of valid characters in line[] */
+	unsigned int linepos;		/* Number of characters of line[] already read */
+	char line[WQUEUE_LINELEN];
+	struct wqueue_row_s rows[WQUEUE_NROWS];
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+/* File system methods */
+
+static int wqueue_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode);
+static int wqueue_close(FAR struct file *filep);
+static ssize_t wqueue_read(FAR struct file *filep, FAR char *buffer, size_t buflen);
+static int wqueue_dup(FAR const struct file *oldp, FAR struct file *newp);
+static int wqueue_stat(FAR const char *relpath, FAR struct stat *buf);
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+const struct procfs_operations wqueue_operations = {
+	wqueue_open,				/* open */
+	wqueue_close,				/* close */
+	wqueue_read,				/* read */
+	NULL,						/* write */
+
+	wqueue_dup,					/* dup */
+
+	NULL,						/* opendir */
+	NULL,						/* closedir */
+	NULL,						/* readdir */
+	NULL,						/* rewinddir */
+
+	wqueue_stat					/* stat */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void wqueue_addrow(FAR struct wqueue_file_s *attr, int qid, FAR const char *name, int cpu)
+{
+	FAR struct wqueue_row_s *row = &attr->rows[attr->nrows];
+
+	if (work_getstats(qid, cpu, &row->stats) == OK) {
+		row->name = name;
+		row->cpu = cpu;
+		attr->nrows++;
+	}
+}
+
+/* Format line number 'item', returns false past the last line */
+
+static bool wqueue_format(FAR struct wqueue_file_s *attr, int item)
+{
+	FAR struct wqueue_row_s *row;
+	char cpu[8];
+	uint32_t avg;
+
+	if (item == 0) {
+		attr->linesize = snprintf(attr->line, WQUEUE_LINELEN, "%-7s %3s %10s %10s %8s %5s %8s %10s %10s\n", "QUEUE", "CPU", "QUEUED", "EXECUTED", "STOLEN", "DEPTH", "MAXDEPTH", "AVGLAT(us)", "MAXLAT(us)");
+		return true;
+	}
+	item--;
+
+	if (item >= attr->nrows) {
+		return false;
+	}
+
+	row = &attr->rows[item];
+	if (row->cpu == WORK_CPU_ANY) {
+		strncpy(cpu, "-", sizeof(cpu));
+	} else {
+		snprintf(cpu, sizeof(cpu), "%d", row->cpu);
+	}
+
+	avg = row->stats.executed > 0 ? row->stats.latency / row->stats.executed : 0;
+	attr->linesize = snprintf(attr->line, WQUEUE_LINELEN, "%-7s %3s %10u %10u %8u %5u %8u %10u %10u\n", row->name, cpu, (unsigned int)row->stats.queued, (unsigned int)row->stats.executed, (unsigned int)row->stats.stolen, row->stats.depth, row->stats.maxdepth, (unsigned int)TICK2USEC(avg), (unsigned int)TICK2USEC(row->stats.maxlatency));
+	return true;
+}
+
+/****************************************************************************
+ * Name: wqueue_open
+ ****************************************************************************/
+
+static int wqueue_open(FAR struct file *filep, FAR const char *relpath, int oflags, mode_t mode)
+{
+	FAR struct wqueue_file_s *attr;
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+	int cpu;
+#endif
+
+	fvdbg("Open '%s'\n", relpath);
+
+	/* PROCFS is read-only */
+
+	if ((oflags & O_WRONLY) != 0 || (oflags & O_RDONLY) == 0) {
+		fdbg("ERROR: Only O_RDONLY supported\n");
+		return -EACCES;
+	}
+
+	if (strcmp(relpath, "wqueue") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	attr = (FAR struct wqueue_file_s *)kmm_zalloc(sizeof(struct wqueue_file_s));
+	if (!attr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+#ifdef CONFIG_SCHED_HPWORK
+	wqueue_addrow(attr, HPWORK, HPWORKNAME, WORK_CPU_ANY);
+#endif
+#ifdef CONFIG_SCHED_LPWORK
+	wqueue_addrow(attr, LPWORK, LPWORKNAME, WORK_CPU_ANY);
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		wqueue_addrow(attr, LPWORK, LPWORKNAME, cpu);
+	}
+#endif
+#endif
+
+	filep->f_priv = (FAR void *)attr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: wqueue_close
+ ****************************************************************************/
+
+static int wqueue_close(FAR struct file *filep)
+{
+	FAR struct wqueue_file_s *attr;
+
+	attr = (FAR struct wqueue_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	kmm_free(attr);
+	filep->f_priv = NULL;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: wqueue_read
+ ****************************************************************************/
+
+static ssize_t wqueue_read(FAR struct file *filep, FAR char *buffer, size_t buflen)
+{
+	FAR struct wqueue_file_s *attr;
+	size_t copysize;
+	size_t total = 0;
+
+	fvdbg("buffer=%p buflen=%d\n", buffer, (int)buflen);
+
+	attr = (FAR struct wqueue_file_s *)filep->f_priv;
+	DEBUGASSERT(attr);
+
+	while (total < buflen) {
+		if (attr->linepos >= attr->linesize) {
+			if (!wqueue_format(attr, attr->item)) {
+				break;
+			}
+			attr->item++;
+			attr->linepos = 0;
+		}
+
+		copysize = attr->linesize - attr->linepos;
+		if (copysize > buflen - total) {
+			copysize = buflen - total;
+		}
+		memcpy(buffer + total, attr->line + attr->linepos, copysize);
+		attr->linepos += copysize;
+		total += copysize;
+	}
+
+	filep->f_pos += total;
+	return total;
+}
+
+/****************************************************************************
+ * Name: wqueue_dup
+ ****************************************************************************/
+
+static int wqueue_dup(FAR const struct file *oldp, FAR struct file *newp)
+{
+	FAR struct wqueue_file_s *oldattr;
+	FAR struct wqueue_file_s *newattr;
+
+	fvdbg("Dup %p->%p\n", oldp, newp);
+
+	oldattr = (FAR struct wqueue_file_s *)oldp->f_priv;
+	DEBUGASSERT(oldattr);
+
+	newattr = (FAR struct wqueue_file_s *)kmm_malloc(sizeof(struct wqueue_file_s));
+	if (!newattr) {
+		fdbg("ERROR: Failed to allocate file attributes\n");
+		return -ENOMEM;
+	}
+
+	memcpy(newattr, oldattr, sizeof(struct wqueue_file_s));
+	newp->f_priv = (FAR void *)newattr;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: wqueue_stat
+ ****************************************************************************/
+
+static int wqueue_stat(const char *relpath, struct stat *buf)
+{
+	if (strcmp(relpath, "wqueue") != 0) {
+		fdbg("ERROR: relpath is '%s'\n", relpath);
+		return -ENOENT;
+	}
+
+	buf->st_mode = S_IFREG | S_IROTH | S_IRGRP | S_IRUSR;
+	buf->st_size = 0;
+	buf->st_blksize = 0;
+	buf->st_blocks = 0;
+	return OK;
+}
+
+#endif							/* CONFIG_SCHED_WORKQUEUE_STATS && !CONFIG_FS_PROCFS_EXCLUDE_WQUEUE */
+#endif							/* !CONFIG_DISABLE_MOUNTPOINT && CONFIG_FS_PROCFS */
@@ -87,6 +87,12 @@
 #  warning CONFIG_FS_TMPFS_FILE_FREEGUARD needs to be > ALLOCGUARD
 #endif
 
+/* Smallest number of entries allocated for a directory */
+
+#define TMPFS_DIRECTORY_MINENTRIES \
+	((CONFIG_FS_TMPFS_DIRECTORY_ALLOCGUARD + sizeof(struct tmpfs_dirent_s) - 1) / \
+	sizeof(struct tmpfs_dirent_s))
+
 #define tmpfs_lock_file(tfo) \
 	(tmpfs_lock_object((FAR struct tmpfs_object_s *)tfo))
 #define tmpfs_lock_directory(tdo) \
@@ -102,18 +108,25 @@
 /* TMPFS helpers */
 
 static void tmpfs_lock_reentrant(FAR struct tmpfs_sem_s *sem);
-static void tmpfs_lock(FAR struct tmpfs_s *fs);
+static void tmpfs_rdlock(FAR struct tmpfs_s *fs);
+static void tmpfs_wrlock(FAR struct tmpfs_s *fs);
 static void tmpfs_unlock_reentrant(FAR struct tmpfs_sem_s *sem);
 static void tmpfs_unlock(FAR struct tmpfs_s *fs);
 static void tmpfs_lock_object(FAR struct tmpfs_object_s *to);
 static void tmpfs_unlock_object(FAR struct tmpfs_object_s *to);
-static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s **tdo, unsigned int nentries);
-static int tmpfs_realloc_file(FAR struct tmpfs_file_s **tfo, size_t newsize);
+static uint32_t tmpfs_hash_name(FAR const char *name);
+static void tmpfs_hash_link(FAR struct tmpfs_directory_s *tdo, unsigned int index);
+static void tmpfs_hash_unlink(FAR struct tmpfs_directory_s *tdo, unsigned int index);
+static int tmpfs_resize_directory(FAR struct tmpfs_directory_s *tdo, unsigned int maxentries);
+static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s *tdo, unsigned int nentries);
+static int tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo, size_t newsize);
+static void tmpfs_free_object(FAR struct tmpfs_object_s *to);
 static void tmpfs_release_lockedobject(FAR struct tmpfs_object_s *to);
 static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo);
 static int tmpfs_find_dirent(FAR struct tmpfs_directory_s *tdo, FAR const char *name);
+static void tmpfs_delete_dirent(FAR struct tmpfs_directory_s *tdo, unsigned int index);
 static int tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo, FAR const char *name);
-static int tmpfs_add_dirent(FAR struct tmpfs_directory_s **tdo, FAR struct tmpfs_object_s *to, FAR const char *name);
+static int tmpfs_add_dirent(FAR struct tmpfs_directory_s *tdo, FAR struct tmpfs_object_s *to, FAR const char *name);
 static FAR struct tmpfs_file_s *tmpfs_alloc_file(void);
 static int tmpfs_create_file(FAR struct tmpfs_s *fs,	FAR const char *relpath, FAR struct tmpfs_file_s **tfo);
 static FAR struct tmpfs_directory_s *tmpfs_alloc_directory(void);
@@ -150,6 +163,14 @@ static int tmpfs_rename(FAR struct inode *mountpt, FAR const char *oldrelpath, F
 static void tmpfs_stat_common(FAR struct tmpfs_object_s *to, FAR struct stat *buf);
 static int tmpfs_stat(FAR struct inode *mountpt, FAR const char *relpath, FAR struct stat *buf);
 
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* What FIOC_MMAP maps for a file that has no data yet */
+
+static uint8_t g_tmpfs_empty[1];
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -223,12 +244,29 @@ static void tmpfs_lock_reentrant(FAR struct tmpfs_sem_s *sem)
 }
 
 /****************************************************************************
- * Name: tmpfs_lock
+ * Name: tmpfs_rdlock
  ****************************************************************************/
 
-static void tmpfs_lock(FAR struct tmpfs_s *fs)
+static void tmpfs_rdlock(FAR struct tmpfs_s *fs)
 {
-	tmpfs_lock_reentrant(&fs->tfs_exclsem);
+	int ret;
+
+	ret = pthread_rwlock_rdlock(&fs->tfs_rwlock);
+	DEBUGASSERT(ret == OK);
+	UNUSED(ret);
+}
+
+/****************************************************************************
+ * Name: tmpfs_wrlock
+ ****************************************************************************/
+
+static void tmpfs_wrlock(FAR struct tmpfs_s *fs)
+{
+	int ret;
+
+	ret = pthread_rwlock_wrlock(&fs->tfs_rwlock);
+	DEBUGASSERT(ret == OK);
+	UNUSED(ret);
 }
 
 /****************************************************************************
@@ -271,7 +309,7 @@ static void tmpfs_unlock_reentrant(FAR struct tmpfs_sem_s *sem)
 
 static void tmpfs_unlock(FAR struct tmpfs_s *fs)
 {
-	tmpfs_unlock_reentrant(&fs->tfs_exclsem);
+	pthread_rwlock_unlock(&fs->tfs_rwlock);
 }
 
 /****************************************************************************
@@ -284,56 +322,145 @@ static void tmpfs_unlock_object(FAR struct tmpfs_object_s *to)
 }
 
 /****************************************************************************
- * Name: tmpfs_realloc_directory
+ * Name: tmpfs_hash_name
  ****************************************************************************/
 
-static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s **tdo,
-		unsigned int nentries)
+static uint32_t tmpfs_hash_name(FAR const char *name)
 {
-	FAR struct tmpfs_directory_s *oldtdo = *tdo;
-	FAR struct tmpfs_directory_s *newtdo;
-	size_t objsize;
-	int ret = oldtdo->tdo_nentries;
+	uint32_t hash = 2166136261u;
 
-	/* Get the new object size */
+	/* 32-bit FNV-1a */
 
-	objsize = SIZEOF_TMPFS_DIRECTORY(nentries);
-	if (objsize <= oldtdo->tdo_alloc) {
-		/* Already big enough.
-		 * REVISIT: Missing logic to shrink directory objects.
-		 */
+	while (*name != '\0') {
+		hash ^= (uint8_t)*name++;
+		hash *= 16777619u;
+	}
 
-		oldtdo->tdo_nentries = nentries;
-		return ret;
+	return hash;
+}
+
+/****************************************************************************
+ * Name: tmpfs_hash_link
+ ****************************************************************************/
+
+static void tmpfs_hash_link(FAR struct tmpfs_directory_s *tdo,
+		unsigned int index)
+{
+	FAR struct tmpfs_dirent_s *tde = &tdo->tdo_entry[index];
+	FAR uint16_t *bucket;
+
+	bucket = &tdo->tdo_bucket[tde->tde_hash & (tdo->tdo_nbuckets - 1)];
+	tde->tde_next = *bucket;
+	*bucket = index;
+}
+
+/****************************************************************************
+ * Name: tmpfs_hash_unlink
+ ****************************************************************************/
+
+static void tmpfs_hash_unlink(FAR struct tmpfs_directory_s *tdo,
+		unsigned int index)
+{
+	FAR struct tmpfs_dirent_s *tde = &tdo->tdo_entry[index];
+	FAR uint16_t *link;
+
+	link = &tdo->tdo_bucket[tde->tde_hash & (tdo->tdo_nbuckets - 1)];
+	while (*link != index) {
+		DEBUGASSERT(*link != TMPFS_NO_ENTRY);
+		link = &tdo->tdo_entry[*link].tde_next;
 	}
 
-	/* Added some additional amount to the new size to account frequent
-	 * reallocations.
-	 */
+	*link = tde->tde_next;
+}
 
-	objsize += CONFIG_FS_TMPFS_DIRECTORY_ALLOCGUARD;
+/****************************************************************************
+ * Name: tmpfs_resize_directory
+ *
+ * Description:
+ *   Reallocate the entries of a directory to hold 'maxentries' entries
+ *   with one hash bucket per entry.  The entries may move, so the hash
+ *   chains and the back links from the objects to their entries are
+ *   rebuilt.
+ *
+ ****************************************************************************/
 
-	/* Realloc the directory object */
+static int tmpfs_resize_directory(FAR struct tmpfs_directory_s *tdo,
+		unsigned int maxentries)
+{
+	FAR struct tmpfs_dirent_s *entry;
+	unsigned int nbuckets;
+	unsigned int i;
 
-	newtdo = (FAR struct tmpfs_directory_s *)kmm_realloc(oldtdo, objsize);
-	if (newtdo == NULL) {
+	DEBUGASSERT(maxentries >= tdo->tdo_nentries && maxentries < TMPFS_NO_ENTRY);
+
+	for (nbuckets = 1; nbuckets < maxentries; nbuckets <<= 1);
+
+	entry = (FAR struct tmpfs_dirent_s *)kmm_realloc(tdo->tdo_entry,
+			maxentries * sizeof(struct tmpfs_dirent_s) +
+			nbuckets * sizeof(uint16_t));
+	if (entry == NULL) {
 		return -ENOMEM;
 	}
-	/* Adjust the reference in the parent directory entry */
 
-	DEBUGASSERT(newtdo->tdo_dirent);
-	newtdo->tdo_dirent->tde_object = (FAR struct tmpfs_object_s *)newtdo;
+	tdo->tdo_entry      = entry;
+	tdo->tdo_bucket     = (FAR uint16_t *)&entry[maxentries];
+	tdo->tdo_maxentries = maxentries;
+	tdo->tdo_nbuckets   = nbuckets;
+	tdo->tdo_alloc      = SIZEOF_TMPFS_DIRECTORY(maxentries) +
+		nbuckets * sizeof(uint16_t);
+
+	for (i = 0; i < nbuckets; i++) {
+		tdo->tdo_bucket[i] = TMPFS_NO_ENTRY;
+	}
+
+	for (i = 0; i < tdo->tdo_nentries; i++) {
+		entry[i].tde_object->to_dirent = &entry[i];
+		tmpfs_hash_link(tdo, i);
+	}
+
+	return OK;
+}
 
-	/* Return the new address of the reallocated directory object */
+/****************************************************************************
+ * Name: tmpfs_realloc_directory
+ ****************************************************************************/
+
+static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s *tdo,
+		unsigned int nentries)
+{
+	unsigned int maxentries;
+	int ret = tdo->tdo_nentries;
+
+	if (nentries > tdo->tdo_maxentries) {
+		/* Double the allocation so that adding entries one at a time only
+		 * copies the directory a logarithmic number of times.
+		 */
+
+		if (nentries >= TMPFS_NO_ENTRY) {
+			return -ENOSPC;
+		}
+
+		maxentries = 2 * tdo->tdo_maxentries;
+		if (maxentries < TMPFS_DIRECTORY_MINENTRIES) {
+			maxentries = TMPFS_DIRECTORY_MINENTRIES;
+		}
+
+		if (maxentries < nentries) {
+			maxentries = nentries;
+		}
 
-	newtdo->tdo_alloc    = objsize;
-	newtdo->tdo_nentries = nentries;
-	*tdo                 = newtdo;
+		if (maxentries >= TMPFS_NO_ENTRY) {
+			maxentries = TMPFS_NO_ENTRY - 1;
+		}
 
-	/* Adjust the reference in the parent directory entry */
+		ret = tmpfs_resize_directory(tdo, maxentries);
+		if (ret < 0) {
+			return ret;
+		}
+		ret = tdo->tdo_nentries;
+	}
 
-	DEBUGASSERT(newtdo->tdo_dirent);
-	newtdo->tdo_dirent->tde_object = (FAR struct tmpfs_object_s *)newtdo;
+	tdo->tdo_nentries = nentries;
 
 	/* Return the index to the first, newly allocated directory entry */
 
@@ -344,62 +471,98 @@ static int tmpfs_realloc_directory(FAR struct tmpfs_directory_s **tdo,
  * Name: tmpfs_realloc_file
  ****************************************************************************/
 
-static int tmpfs_realloc_file(FAR struct tmpfs_file_s **tfo,
+static int tmpfs_realloc_file(FAR struct tmpfs_file_s *tfo,
 		size_t newsize)
 {
-	FAR struct tmpfs_file_s *oldtfo = *tfo;
-	FAR struct tmpfs_file_s *newtfo;
-	size_t objsize;
+	FAR uint8_t *newdata;
+	size_t datasize;
 	size_t allocsize;
 
 	/* Check if the current allocation is sufficent */
 
-	objsize = SIZEOF_TMPFS_FILE(newsize);
+	datasize = tfo->tfo_alloc - SIZEOF_TMPFS_FILE(0);
 
 	/* Are we growing or shrinking the object? */
 
-	if (objsize <= oldtfo->tfo_alloc) {
-		/* Shrinking ... Shrink unconditionally if the size is shrinking to
+	if (newsize <= datasize) {
+		/* Release the data unconditionally if the size is shrinking to
 		 * zero.
 		 */
 
-		if (newsize > 0) {
-			/* Otherwise, don't realloc unless the object has shrunk by a
-			 * lot.
-			 */
+		if (newsize == 0) {
+			if (tfo->tfo_data != NULL) {
+				kmm_free(tfo->tfo_data);
+				tfo->tfo_data = NULL;
+			}
+
+			tfo->tfo_alloc = SIZEOF_TMPFS_FILE(0);
+			tfo->tfo_size  = 0;
+			return OK;
+		}
 
-			if (oldtfo->tfo_alloc - objsize <= CONFIG_FS_TMPFS_FILE_FREEGUARD) {
-				/* Hasn't shrunk enough.. Return doing nothing for now */
+		/* Otherwise, don't realloc unless the object has shrunk by a
+		 * lot.
+		 */
 
-				oldtfo->tfo_size = newsize;
-				return OK;
-			}
+		if (newsize >= tfo->tfo_size ||
+				datasize - newsize <= CONFIG_FS_TMPFS_FILE_FREEGUARD) {
+			tfo->tfo_size = newsize;
+			return OK;
 		}
-	}
 
-	/* Added some additional amount to the new size to account frequent
-	 * reallocations.
-	 */
+		allocsize = newsize + CONFIG_FS_TMPFS_FILE_ALLOCGUARD;
+	} else {
+		/* Grow by at least half of the current allocation so that a file
+		 * written in small pieces is only copied a logarithmic number of
+		 * times.
+		 */
 
-	allocsize = objsize + CONFIG_FS_TMPFS_FILE_ALLOCGUARD;
+		allocsize = newsize + CONFIG_FS_TMPFS_FILE_ALLOCGUARD;
+		if (allocsize < datasize + datasize / 2) {
+			allocsize = datasize + datasize / 2;
+		}
+	}
 
-	/* Realloc the file object */
+	/* Realloc the file data, the file object itself stays in place */
 
-	newtfo = (FAR struct tmpfs_file_s *)kmm_realloc(oldtfo, allocsize);
-	if (newtfo == NULL) {
+	newdata = (FAR uint8_t *)kmm_realloc(tfo->tfo_data, allocsize);
+	if (newdata == NULL) {
 		return -ENOMEM;
 	}
-	/* Adjust the reference in the parent directory entry */
 
-	DEBUGASSERT(newtfo->tfo_dirent);
-	newtfo->tfo_dirent->tde_object = (FAR struct tmpfs_object_s *)newtfo;
+	tfo->tfo_data  = newdata;
+	tfo->tfo_alloc = SIZEOF_TMPFS_FILE(allocsize);
+	tfo->tfo_size  = newsize;
+	return OK;
+}
+
+/****************************************************************************
+ * Name: tmpfs_free_object
+ *
+ * Description:
+ *   Free an object that has no directory entry any more, together with
+ *   its file data or directory entries.
+ *
+ ****************************************************************************/
+
+static void tmpfs_free_object(FAR struct tmpfs_object_s *to)
+{
+	if (to->to_type == TMPFS_REGULAR) {
+		FAR struct tmpfs_file_s *tfo = (FAR struct tmpfs_file_s *)to;
 
-	/* Return the new address of the reallocated file object */
+		if (tfo->tfo_data != NULL) {
+			kmm_free(tfo->tfo_data);
+		}
+	} else {
+		FAR struct tmpfs_directory_s *tdo = (FAR struct tmpfs_directory_s *)to;
 
-	newtfo->tfo_alloc = allocsize;
-	newtfo->tfo_size  = newsize;
-	*tfo              = newtfo;
-	return OK;
+		if (tdo->tdo_entry != NULL) {
+			kmm_free(tdo->tdo_entry);
+		}
+	}
+
+	sem_destroy(&to->to_exclsem.ts_sem);
+	kmm_free(to);
 }
 
 /****************************************************************************
@@ -433,8 +596,7 @@ static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo)
 	 */
 
 	if (tfo->tfo_refs == 1 && (tfo->tfo_flags & TFO_FLAG_UNLINKED) != 0) {
-		sem_destroy(&tfo->tfo_exclsem.ts_sem);
-		kmm_free(tfo);
+		tmpfs_free_object((FAR struct tmpfs_object_s *)tfo);
 	}
 
 	/* Otherwise, just decrement the reference count on the file object */
@@ -452,66 +614,89 @@ static void tmpfs_release_lockedfile(FAR struct tmpfs_file_s *tfo)
 static int tmpfs_find_dirent(FAR struct tmpfs_directory_s *tdo,
 		FAR const char *name)
 {
-	int i;
+	FAR struct tmpfs_dirent_s *tde;
+	uint32_t hash;
+	unsigned int i;
 
-	/* Search the list of directory entries for a match */
+	if (tdo->tdo_nbuckets == 0) {
+		return -ENOENT;
+	}
 
-	for (i = 0;
-			i < tdo->tdo_nentries &&
-			strcmp(tdo->tdo_entry[i].tde_name, name) != 0;
-			i++);
+	/* Search the hash chain of the name for a match */
 
-	/* Return what we found, if anything */
+	hash = tmpfs_hash_name(name);
+	for (i = tdo->tdo_bucket[hash & (tdo->tdo_nbuckets - 1)];
+			i != TMPFS_NO_ENTRY; i = tde->tde_next) {
+		tde = &tdo->tdo_entry[i];
+		if (tde->tde_hash == hash && strcmp(tde->tde_name, name) == 0) {
+			return i;
+		}
+	}
 
-	return i < tdo->tdo_nentries ? i : -ENOENT;
+	return -ENOENT;
 }
 
 /****************************************************************************
- * Name: tmpfs_remove_dirent
+ * Name: tmpfs_delete_dirent
  ****************************************************************************/
 
-static int tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo,
-		FAR const char *name)
+static void tmpfs_delete_dirent(FAR struct tmpfs_directory_s *tdo,
+		unsigned int index)
 {
-	int index;
-	int last;
-
-	/* Search the list of directory entries for a match */
+	FAR struct tmpfs_dirent_s *tde = &tdo->tdo_entry[index];
+	unsigned int last = tdo->tdo_nentries - 1;
 
-	index = tmpfs_find_dirent(tdo, name);
-	if (index < 0) {
-		return index;
-	}
 	/* Free the object name */
 
-	if (tdo->tdo_entry[index].tde_name != NULL) {
-		kmm_free(tdo->tdo_entry[index].tde_name);
+	if (tde->tde_name != NULL) {
+		kmm_free(tde->tde_name);
 	}
+	tmpfs_hash_unlink(tdo, index);
+
 	/* Remove by replacing this entry with the final directory entry */
 
-	last = tdo->tdo_nentries - 1;
 	if (index != last) {
-		FAR struct tmpfs_dirent_s *newtde;
-		FAR struct tmpfs_dirent_s *oldtde;
-		FAR struct tmpfs_object_s *to;
-
-		/* Move the directory entry */
-
-		newtde             = &tdo->tdo_entry[index];
-		oldtde             = &tdo->tdo_entry[last];
-		to                 = oldtde->tde_object;
-
-		newtde->tde_object = to;
-		newtde->tde_name   = oldtde->tde_name;
+		tmpfs_hash_unlink(tdo, last);
+		*tde = tdo->tdo_entry[last];
+		tmpfs_hash_link(tdo, index);
 
 		/* Reset the backward link to the directory entry */
 
-		to->to_dirent      = newtde;
+		tde->tde_object->to_dirent = tde;
 	}
 
 	/* And decrement the count of directory entries */
 
 	tdo->tdo_nentries = last;
+
+	/* Give memory back once the directory is down to a quarter of its
+	 * allocation.  A failure to shrink leaves it as it is.
+	 */
+
+	if (tdo->tdo_nentries <= tdo->tdo_maxentries / 4 &&
+			(tdo->tdo_maxentries - tdo->tdo_maxentries / 2) *
+			sizeof(struct tmpfs_dirent_s) > CONFIG_FS_TMPFS_DIRECTORY_FREEGUARD) {
+		(void)tmpfs_resize_directory(tdo, tdo->tdo_maxentries / 2);
+	}
+}
+
+/****************************************************************************
+ * Name: tmpfs_remove_dirent
+ ****************************************************************************/
+
+static int tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo,
+		FAR const char *name)
+{
+	int index;
+
+	/* Search the list of directory entries for a match */
+
+	index = tmpfs_find_dirent(tdo, name);
+	if (index < 0) {
+		return index;
+	}
+
+	tmpfs_delete_dirent(tdo, index);
 	return OK;
 }
 
@@ -519,15 +704,12 @@ static int tmpfs_remove_dirent(FAR struct tmpfs_directory_s *tdo,
  * Name: tmpfs_add_dirent
  ****************************************************************************/
 
-static int tmpfs_add_dirent(FAR struct tmpfs_directory_s **tdo,
+static int tmpfs_add_dirent(FAR struct tmpfs_directory_s *tdo,
 		FAR struct tmpfs_object_s *to,
 		FAR const char *name)
 {
-	FAR struct tmpfs_directory_s *oldtdo;
-	FAR struct tmpfs_directory_s *newtdo;
 	FAR struct tmpfs_dirent_s *tde;
 	FAR char *newname;
-	unsigned int nentries;
 	int index;
 
 	/* Copy the name string so that it will persist as long as the
@@ -538,14 +720,10 @@ static int tmpfs_add_dirent(FAR struct tmpfs_directory_s **tdo,
 	if (newname == NULL) {
 		return -ENOMEM;
 	}
-	/* Get the new number of entries */
 
-	oldtdo = *tdo;
-	nentries = oldtdo->tdo_nentries + 1;
+	/* Reallocate the directory entries (if necessary) */
 
-	/* Reallocate the directory object (if necessary) */
-
-	index = tmpfs_realloc_directory(tdo, nentries);
+	index = tmpfs_realloc_directory(tdo, tdo->tdo_nentries + 1);
 	if (index < 0) {
 		kmm_free(newname);
 		return index;
@@ -553,10 +731,11 @@ static int tmpfs_add_dirent(FAR struct tmpfs_directory_s **tdo,
 
 	/* Save the new object info in the new directory entry */
 
-	newtdo          = *tdo;
-	tde             = &newtdo->tdo_entry[index];
+	tde             = &tdo->tdo_entry[index];
 	tde->tde_object = to;
 	tde->tde_name   = newname;
+	tde->tde_hash   = tmpfs_hash_name(newname);
+	tmpfs_hash_link(tdo, index);
 
 	/* Add backward link to the directory entry to the object */
 
@@ -573,9 +752,11 @@ static FAR struct tmpfs_file_s *tmpfs_alloc_file(void)
 	FAR struct tmpfs_file_s *tfo;
 	size_t allocsize;
 
-	/* Create a new zero length file object */
+	/* Create a new zero length file object.  The data is allocated by the
+	 * first write.
+	 */
 
-	allocsize = SIZEOF_TMPFS_FILE(CONFIG_FS_TMPFS_FILE_ALLOCGUARD);
+	allocsize = SIZEOF_TMPFS_FILE(0);
 	tfo = (FAR struct tmpfs_file_s *)kmm_malloc(allocsize);
 	if (tfo == NULL) {
 		return NULL;
@@ -589,6 +770,7 @@ static FAR struct tmpfs_file_s *tmpfs_alloc_file(void)
 	tfo->tfo_refs  = 1;
 	tfo->tfo_flags = 0;
 	tfo->tfo_size  = 0;
+	tfo->tfo_data  = NULL;
 
 	tfo->tfo_exclsem.ts_holder = getpid();
 	tfo->tfo_exclsem.ts_count  = 1;
@@ -675,7 +857,7 @@ static int tmpfs_create_file(FAR struct tmpfs_s *fs,
 
 	/* Then add the new, empty file to the directory */
 
-	ret = tmpfs_add_dirent(&parent, (FAR struct tmpfs_object_s *)newtfo, name);
+	ret = tmpfs_add_dirent(parent, (FAR struct tmpfs_object_s *)newtfo, name);
 	if (ret < 0) {
 		goto errout_with_file;
 	}
@@ -693,8 +875,7 @@ static int tmpfs_create_file(FAR struct tmpfs_s *fs,
 	/* Error exits */
 
 errout_with_file:
-	sem_destroy(&newtfo->tfo_exclsem.ts_sem);
-	kmm_free(newtfo);
+	tmpfs_free_object((FAR struct tmpfs_object_s *)newtfo);
 
 errout_with_parent:
 	parent->tdo_refs--;
@@ -713,27 +894,26 @@ static FAR struct tmpfs_directory_s *tmpfs_alloc_directory(void)
 {
 	FAR struct tmpfs_directory_s *tdo;
 	size_t allocsize;
-	unsigned int nentries;
-
-	/* Convert the pre-allocated memory to a number of directory entries */
 
-	nentries = (CONFIG_FS_TMPFS_DIRECTORY_ALLOCGUARD +
-			sizeof(struct tmpfs_dirent_s) - 1) /
-		sizeof(struct tmpfs_dirent_s);
-
-	/* Create a new zero length directory object */
+	/* Create a new zero length directory object.  The entries are
+	 * allocated when the first one is added.
+	 */
 
-	allocsize = SIZEOF_TMPFS_DIRECTORY(nentries);
+	allocsize = SIZEOF_TMPFS_DIRECTORY(0);
 	tdo = (FAR struct tmpfs_directory_s *)kmm_malloc(allocsize);
 	if (tdo == NULL) {
 		return NULL;
 	}
 	/* Initialize the new directory object */
 
-	tdo->tdo_alloc    = allocsize;
-	tdo->tdo_type     = TMPFS_DIRECTORY;
-	tdo->tdo_refs     = 0;
-	tdo->tdo_nentries = 0;
+	tdo->tdo_alloc      = allocsize;
+	tdo->tdo_type       = TMPFS_DIRECTORY;
+	tdo->tdo_refs       = 0;
+	tdo->tdo_nentries   = 0;
+	tdo->tdo_maxentries = 0;
+	tdo->tdo_nbuckets   = 0;
+	tdo->tdo_bucket     = NULL;
+	tdo->tdo_entry      = NULL;
 
 	tdo->tdo_exclsem.ts_holder = TMPFS_NO_HOLDER;
 	tdo->tdo_exclsem.ts_count  = 0;
@@ -817,7 +997,7 @@ static int tmpfs_create_directory(FAR struct tmpfs_s *fs,
 
 	/* Then add the new, empty file to the directory */
 
-	ret = tmpfs_add_dirent(&parent, (FAR struct tmpfs_object_s *)newtdo, name);
+	ret = tmpfs_add_dirent(parent, (FAR struct tmpfs_object_s *)newtdo, name);
 	if (ret < 0) {
 		goto errout_with_directory;
 	}
@@ -839,8 +1019,7 @@ static int tmpfs_create_directory(FAR struct tmpfs_s *fs,
 	/* Error exits */
 
 errout_with_directory:
-	sem_destroy(&newtdo->tdo_exclsem.ts_sem);
-	kmm_free(newtdo);
+	tmpfs_free_object((FAR struct tmpfs_object_s *)newtdo);
 
 errout_with_parent:
 	parent->tdo_refs--;
@@ -1121,42 +1300,13 @@ static int tmpfs_statfs_callout(FAR struct tmpfs_directory_s *tdo,
 static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
 		unsigned int index, FAR void *arg)
 {
-	FAR struct tmpfs_dirent_s *tde;
 	FAR struct tmpfs_object_s *to;
 	FAR struct tmpfs_file_s *tfo;
-	unsigned int last;
-
-	/* Free the object name */
-
-	if (tdo->tdo_entry[index].tde_name != NULL) {
-		kmm_free(tdo->tdo_entry[index].tde_name);
-	}
-	/* Remove by replacing this entry with the final directory entry */
 
-	tde  = &tdo->tdo_entry[index];
-	to   = tde->tde_object;
-	last = tdo->tdo_nentries - 1;
+	/* Remove the directory entry */
 
-	if (index != last) {
-		FAR struct tmpfs_dirent_s *oldtde;
-		FAR struct tmpfs_object_s *oldto;
-
-		/* Move the directory entry */
-
-		oldtde           = &tdo->tdo_entry[last];
-		oldto            = oldtde->tde_object;
-
-		tde->tde_object  = oldto;
-		tde->tde_name    = oldtde->tde_name;
-
-		/* Reset the backward link to the directory entry */
-
-		oldto->to_dirent = tde;
-	}
-
-	/* And decrement the count of directory entries */
-
-	tdo->tdo_nentries = last;
+	to = tdo->tdo_entry[index].tde_object;
+	tmpfs_delete_dirent(tdo, index);
 
 	/* Is this directory entry a file object? */
 
@@ -1175,8 +1325,7 @@ static int tmpfs_free_callout(FAR struct tmpfs_directory_s *tdo,
 
 	/* Free the object now */
 
-	sem_destroy(&to->to_exclsem.ts_sem);
-	kmm_free(to);
+	tmpfs_free_object(to);
 	return TMPFS_DELETED;
 }
 
@@ -1271,9 +1420,13 @@ static int tmpfs_open(FAR struct file *filep, FAR const char *relpath,
 
 	DEBUGASSERT(fs != NULL && fs->tfs_root.tde_object != NULL);
 
-	/* Get exclusive access to the file system */
+	/* Creating or truncating the file changes a directory entry */
 
-	tmpfs_lock(fs);
+	if ((oflags & (O_CREAT | O_TRUNC)) != 0) {
+		tmpfs_wrlock(fs);
+	} else {
+		tmpfs_rdlock(fs);
+	}
 
 	/* Skip over any leading directory separators (shouldn't be any) */
 
@@ -1316,7 +1469,7 @@ static int tmpfs_open(FAR struct file *filep, FAR const char *relpath,
 			 */
 
 			if (tfo->tfo_size > 0) {
-				ret = tmpfs_realloc_file(&tfo, 0);
+				ret = tmpfs_realloc_file(tfo, 0);
 				if (ret < 0)
 					goto errout_with_filelock;
 			}
@@ -1420,7 +1573,7 @@ static int tmpfs_close(FAR struct file *filep)
 		 * have any other references.
 		 */
 
-		kmm_free(tfo);
+		tmpfs_free_object((FAR struct tmpfs_object_s *)tfo);
 		return OK;
 	}
 
@@ -1510,11 +1663,10 @@ static ssize_t tmpfs_write(FAR struct file *filep, FAR const char *buffer,
 	if (endpos > tfo->tfo_size) {
 		/* Reallocate the file to handle the write past the end of the file. */
 
-		ret = tmpfs_realloc_file(&tfo, (size_t)endpos);
+		ret = tmpfs_realloc_file(tfo, (size_t)endpos);
 		if (ret < 0) {
 			goto errout_with_lock;
 		}
-		filep->f_priv = tfo;
 	}
 
 	/* Copy data from the memory object to the user buffer */
@@ -1612,10 +1764,13 @@ static int tmpfs_ioctl(FAR struct file *filep, int cmd, unsigned long arg)
 
 	if (cmd == FIOC_MMAP && ppv != NULL) {
 		/* Return the address on the media corresponding to the start of
-		 * the file.
+		 * the file.  A file gets its data on the first write, until then
+		 * it maps to a valid zero-length region.
 		 */
 
-		*ppv = (FAR void *)tfo->tfo_data;
+		tmpfs_lock_file(tfo);
+		*ppv = tfo->tfo_data != NULL ? (FAR void *)tfo->tfo_data : (FAR void *)g_tmpfs_empty;
+		tmpfs_unlock_file(tfo);
 		return OK;
 	}
 
@@ -1718,13 +1873,11 @@ static int tmpfs_truncate(FAR struct file *filep, off_t length)
 	oldsize = tfo->tfo_size;
 	if (oldsize != length) {
 		/* The size is changing.. up or down.  Reallocate the file memory. */
-		ret = tmpfs_realloc_file(&tfo, (size_t)length);
+		ret = tmpfs_realloc_file(tfo, (size_t)length);
 		if (ret < 0) {
 			goto errout_with_lock;
 		}
 
-		filep->f_priv = tfo;
-
 		/* If the size has increased, then we need to zero the newly added
 		 * memory.
 		 */
@@ -1760,9 +1913,9 @@ static int tmpfs_opendir(FAR struct inode *mountpt, FAR const char *relpath,
 	fs = mountpt->i_private;
 	DEBUGASSERT(fs != NULL && fs->tfs_root.tde_object != NULL);
 
-	/* Get exclusive access to the file system */
+	/* Get shared access to the file system */
 
-	tmpfs_lock(fs);
+	tmpfs_rdlock(fs);
 
 	/* Skip over any leading directory separators (shouldn't be any) */
 
@@ -1935,9 +2088,7 @@ static int tmpfs_bind(FAR struct inode *blkdriver, FAR const void *data,
 
 	/* Initialize the file system state */
 
-	fs->tfs_exclsem.ts_holder = TMPFS_NO_HOLDER;
-	fs->tfs_exclsem.ts_count  = 0;
-	sem_init(&fs->tfs_exclsem.ts_sem, 0, 1);
+	pthread_rwlock_init(&fs->tfs_rwlock, NULL);
 
 	/* Return the new file system handle */
 
@@ -1959,7 +2110,7 @@ static int tmpfs_unbind(FAR void *handle, FAR struct inode **blkdriver)
 
 	/* Lock the file system */
 
-	tmpfs_lock(fs);
+	tmpfs_wrlock(fs);
 
 	/* Traverse all directory entries (recursively), freeing all resources. */
 
@@ -1968,10 +2119,10 @@ static int tmpfs_unbind(FAR void *handle, FAR struct inode **blkdriver)
 
 	/* Now we can destroy the root file system and the file system itself. */
 
-	sem_destroy(&tdo->tdo_exclsem.ts_sem);
-	kmm_free(tdo);
+	tmpfs_free_object((FAR struct tmpfs_object_s *)tdo);
 
-	sem_destroy(&fs->tfs_exclsem.ts_sem);
+	tmpfs_unlock(fs);
+	pthread_rwlock_destroy(&fs->tfs_rwlock);
 	kmm_free(fs);
 	return ret;
 }
@@ -1999,9 +2150,9 @@ static int tmpfs_statfs(FAR struct inode *mountpt, FAR struct statfs *buf)
 	fs = mountpt->i_private;
 	DEBUGASSERT(fs != NULL && fs->tfs_root.tde_object != NULL);
 
-	/* Get exclusive access to the file system */
+	/* Get shared access to the file system */
 
-	tmpfs_lock(fs);
+	tmpfs_rdlock(fs);
 
 	/* Set up the memory use for the file system and root directory object */
 
@@ -2065,7 +2216,7 @@ static int tmpfs_unlink(FAR struct inode *mountpt, FAR const char *relpath)
 
 	/* Get exclusive access to the file system */
 
-	tmpfs_lock(fs);
+	tmpfs_wrlock(fs);
 
 	/* Find the file object and parent directory associated with this relative
 	 * path.  If successful, tmpfs_find_file will lock both the file object
@@ -2116,8 +2267,7 @@ static int tmpfs_unlink(FAR struct inode *mountpt, FAR const char *relpath)
 	/* Otherwise we can free the object now */
 
 	else {
-		sem_destroy(&tfo->tfo_exclsem.ts_sem);
-		kmm_free(tfo);
+		tmpfs_free_object((FAR struct tmpfs_object_s *)tfo);
 	}
 
 	/* Release the reference and lock on the parent directory */
@@ -2159,7 +2309,7 @@ static int tmpfs_mkdir(FAR struct inode *mountpt, FAR const char *relpath,
 
 	/* Get exclusive access to the file system */
 
-	tmpfs_lock(fs);
+	tmpfs_wrlock(fs);
 
 	/* Create the directory. */
 
@@ -2190,7 +2340,7 @@ static int tmpfs_rmdir(FAR struct inode *mountpt, FAR const char *relpath)
 
 	/* Get exclusive access to the file system */
 
-	tmpfs_lock(fs);
+	tmpfs_wrlock(fs);
 
 	/* Find the directory object and parent directory associated with this
 	 * relative path.  If successful, tmpfs_find_file will lock both the
@@ -2234,8 +2384,7 @@ static int tmpfs_rmdir(FAR struct inode *mountpt, FAR const char *relpath)
 	}
 	/* Free the directory object */
 
-	sem_destroy(&tdo->tdo_exclsem.ts_sem);
-	kmm_free(tdo);
+	tmpfs_free_object((FAR struct tmpfs_object_s *)tdo);
 
 	/* Release the reference and lock on the parent directory */
 
@@ -2290,7 +2439,7 @@ static int tmpfs_rename(FAR struct inode *mountpt, FAR const char *oldrelpath,
 	}
 	/* Get exclusive access to the file system */
 
-	tmpfs_lock(fs);
+	tmpfs_wrlock(fs);
 
 	/* Separate the new path into the new file name and the path to the new
 	 * parent directory.
@@ -2367,7 +2516,7 @@ static int tmpfs_rename(FAR struct inode *mountpt, FAR const char *oldrelpath,
 	}
 	/* Add an entry to the new parent directory. */
 
-	ret = tmpfs_add_dirent(&newparent, to, newname);
+	ret = tmpfs_add_dirent(newparent, to, newname);
 
 errout_with_oldparent:
 	oldparent->tdo_refs--;
@@ -2449,9 +2598,9 @@ static int tmpfs_stat(FAR struct inode *mountpt, FAR const char *relpath,
 	fs = mountpt->i_private;
 	DEBUGASSERT(fs != NULL && fs->tfs_root.tde_object != NULL);
 
-	/* Get exclusive access to the file system */
+	/* Get shared access to the file system */
 
-	tmpfs_lock(fs);
+	tmpfs_rdlock(fs);
 
 	/* Find the tmpfs object at the relpath.  If successful,
 	 * tmpfs_find_object() will lock the object and increment the
@@ -61,6 +61,7 @@
 
 #include <stdint.h>
 #include <semaphore.h>
+#include <pthread.h>
 
 #include <tinyara/fs/fs.h>
 
@@ -75,6 +76,10 @@
 
 #define TFO_FLAG_UNLINKED (1 << 0)  /* Bit 0: File is unlinked */
 
+/* Ends a hash chain of directory entries */
+
+#define TMPFS_NO_ENTRY    0xffff
+
 /* Redefine memory alloc function when using multi heap */
 
 #if CONFIG_KMM_NHEAPS > 1 && CONFIG_KMM_REGIONS > 1
@@ -119,9 +124,16 @@ struct tmpfs_sem_s {
 struct tmpfs_dirent_s {
 	FAR struct tmpfs_object_s *tde_object;
 	FAR char *tde_name;
+	uint32_t tde_hash;     /* Hash of tde_name */
+	uint16_t tde_next;     /* Next entry in the same hash bucket */
 };
 
-/* The generic form of a TMPFS memory object */
+/* The generic form of a TMPFS memory object
+ *
+ * Object headers are never reallocated, so that the lock and the address
+ * of an object stay valid for as long as it exists.  The directory entries
+ * and the file data that grow and shrink are kept in separate allocations.
+ */
 
 struct tmpfs_object_s {
 	FAR struct tmpfs_dirent_s *to_dirent;
@@ -146,11 +158,14 @@ struct tmpfs_directory_s {
 	/* Remaining fields are unique to a directory object */
 
 	uint16_t tdo_nentries; /* Number of directory entries */
-	struct tmpfs_dirent_s tdo_entry[1];
+	uint16_t tdo_maxentries; /* Number of entries allocated */
+	uint16_t tdo_nbuckets; /* Number of hash buckets, a power of two */
+	FAR uint16_t *tdo_bucket; /* First entry of each hash bucket */
+	FAR struct tmpfs_dirent_s *tdo_entry; /* Entries, then the hash buckets */
 };
 
 #define SIZEOF_TMPFS_DIRECTORY(n) \
-	(sizeof(struct tmpfs_directory_s) + ((n) - 1) * sizeof(struct tmpfs_dirent_s))
+	(sizeof(struct tmpfs_directory_s) + (n) * sizeof(struct tmpfs_dirent_s))
 
 /* The form of a regular file memory object
  *
@@ -174,10 +189,10 @@ struct tmpfs_file_s {
 
 	uint8_t  tfo_flags;    /* See TFO_FLAG_* definitions */
 	size_t   tfo_size;     /* Valid file size */
-	uint8_t  tfo_data[1];  /* File data starts here */
+	FAR uint8_t *tfo_data; /* File data, NULL until something is written */
 };
 
-#define SIZEOF_TMPFS_FILE(n) (sizeof(struct tmpfs_file_s) + (n) - 1)
+#define SIZEOF_TMPFS_FILE(n) (sizeof(struct tmpfs_file_s) + (n))
 
 /* This structure represents one instance of a TMPFS file system */
 
@@ -185,7 +200,12 @@ struct tmpfs_s {
 	/* The root directory */
 
 	FAR struct tmpfs_dirent_s tfs_root;
-	struct tmpfs_sem_s tfs_exclsem;
+
+	/* Operations that change the directory tree hold this for writing,
+	 * lookups only for reading.
+	 */
+
+	pthread_rwlock_t tfs_rwlock;
 };
 
 /* This is the type used the tmpfs_statfs_callout to accumulate memory usage */
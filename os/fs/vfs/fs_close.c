@@ -104,6 +104,12 @@ int close(int fd)
 	/* close() is a cancellation point */
 	(void)enter_cancellation_point();
 
+	/* Drop the descriptor from any epoll interest list while the driver can
+	 * still tear its poll down.
+	 */
+
+	epoll_fdclose(sched_getfiles(), fd);
+
 #if CONFIG_NFILE_DESCRIPTORS > 0
 	/* Did we get a valid file descriptor? */
 
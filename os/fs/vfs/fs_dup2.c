@@ -60,6 +60,8 @@
 #include <sched.h>
 #include <errno.h>
 
+#include <tinyara/fs/fs.h>
+
 #include "inode/inode.h"
 
 /* This logic in this applies only when both socket and file descriptors are
@@ -100,7 +102,13 @@ int dup2(int fd1, int fd2)
 		/* Not a valid file descriptor.  Did we get a valid socket descriptor? */
 
 		if ((unsigned int)fd1 < (CONFIG_NFILE_DESCRIPTORS + CONFIG_NSOCKET_DESCRIPTORS)) {
-			/* Yes.. dup the socket descriptor */
+			/* Yes.. dup the socket descriptor.  Like close(), drop the
+			 * descriptor it replaces from any epoll interest list first.
+			 */
+
+			if (fd1 != fd2) {
+				epoll_fdclose(sched_getfiles(), fd2);
+			}
 
 			return net_dupsd2(fd1, fd2);
 		} else {
@@ -60,6 +60,8 @@
 #include <sched.h>
 #include <errno.h>
 
+#include <tinyara/fs/fs.h>
+
 #include "inode/inode.h"
 
 #if CONFIG_NFILE_DESCRIPTORS > 0
@@ -125,6 +127,12 @@ int dup2(int fd1, int fd2)
 		return fd1;
 	}
 
+	/* fd2 is closed by the dup2, drop it from any epoll interest list while
+	 * its driver can still tear the poll down, as close() does.
+	 */
+
+	epoll_fdclose(sched_getfiles(), fd2);
+
 	/* Perform the dup2 operation */
 
 	ret = file_dup2(filep1, filep2);
@@ -0,0 +1,646 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/vfs/fs_epoll.c
+ *
+ * Every registered descriptor owns a struct pollfd that is set up in its
+ * driver or socket by epoll_ctl() and stays there.  Drivers post the
+ * semaphore of the epoll instance and set revents as they do for poll(),
+ * so epoll_wait() only has to look for entries with revents set.  Those
+ * are torn down and set up again, which both gives the current state of a
+ * level-triggered descriptor and re-arms it for the next wait.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/epoll.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <queue.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sched.h>
+#include <errno.h>
+#include <assert.h>
+#include <debug.h>
+
+#include <tinyara/clock.h>
+#include <tinyara/cancelpt.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/semaphore.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/net/net.h>
+#include <arch/irq.h>
+
+#include "inode/inode.h"
+
+#ifdef CONFIG_FS_EPOLL
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Errors and hang-ups are always reported */
+
+#define EPOLL_ALWAYS  (POLLERR | POLLHUP)
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct epoll_reg_s {
+	dq_entry_t node;			/* In the interest list of the instance */
+	int fd;						/* The registered descriptor */
+	FAR struct file *filep;		/* Its file, NULL for a socket */
+	uint32_t events;			/* As given to epoll_ctl() */
+	epoll_data_t data;
+	bool armed;					/* pfd is set up in the driver */
+	struct pollfd pfd;
+};
+
+struct epoll_head_s {
+	dq_entry_t node;			/* In g_epoll_heads */
+	FAR struct filelist *list;	/* Files of the group that created it */
+	sem_t exclsem;				/* Protects the interest list */
+	sem_t waitsem;				/* Posted by the drivers */
+	dq_queue_t regs;			/* Interest list */
+};
+
+/****************************************************************************
+ * Private Function Prototypes
+ ****************************************************************************/
+
+static int epoll_open(FAR struct file *filep);
+static int epoll_close(FAR struct file *filep);
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static const struct file_operations g_epoll_ops = {
+	epoll_open,					/* open */
+	epoll_close,				/* close */
+	NULL,						/* read */
+	NULL,						/* write */
+	NULL,						/* seek */
+	NULL,						/* ioctl */
+#ifndef CONFIG_DISABLE_POLL
+	NULL,						/* poll */
+#endif
+};
+
+/* All epoll instances, so that closing a descriptor can remove it from the
+ * interest lists that it is in.
+ */
+
+static dq_queue_t g_epoll_heads;
+static sem_t g_epoll_sem = SEM_INITIALIZER(1);
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void epoll_semtake(FAR sem_t *sem)
+{
+	while (sem_wait(sem) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+#define epoll_semgive(sem) sem_post(sem)
+
+/****************************************************************************
+ * Name: epoll_gethead
+ *
+ * Description:
+ *   Return the epoll instance behind the descriptor 'epfd'.
+ *
+ ****************************************************************************/
+
+static FAR struct epoll_head_s *epoll_gethead(int epfd)
+{
+	FAR struct file *filep;
+
+	if ((unsigned int)epfd >= CONFIG_NFILE_DESCRIPTORS || fs_getfilep(epfd, &filep) < 0) {
+		set_errno(EBADF);
+		return NULL;
+	}
+
+	if (filep->f_inode == NULL || filep->f_inode->u.i_ops != &g_epoll_ops) {
+		set_errno(EINVAL);
+		return NULL;
+	}
+
+	return (FAR struct epoll_head_s *)filep->f_inode->i_private;
+}
+
+/****************************************************************************
+ * Name: epoll_setup
+ *
+ * Description:
+ *   Set up (arm) or tear down (disarm) the poll of one registration.
+ *
+ ****************************************************************************/
+
+static int epoll_setup(FAR struct epoll_head_s *eph, FAR struct epoll_reg_s *reg, bool setup)
+{
+	int ret;
+
+	if (setup) {
+		reg->pfd.fd = reg->fd;
+		reg->pfd.sem = &eph->waitsem;
+		reg->pfd.events = (pollevent_t)(reg->events | EPOLL_ALWAYS);
+		reg->pfd.revents = 0;
+		reg->pfd.priv = NULL;
+		reg->pfd.filep = NULL;
+	} else if (!reg->armed) {
+		return OK;
+	}
+
+#if defined(CONFIG_NET) && CONFIG_NSOCKET_DESCRIPTORS > 0
+	if (reg->filep == NULL) {
+		ret = net_poll(reg->fd, &reg->pfd, setup);
+	} else
+#endif
+	{
+		ret = file_poll(reg->filep, &reg->pfd, setup);
+	}
+
+	reg->armed = setup && ret == OK;
+	return ret;
+}
+
+/****************************************************************************
+ * Name: epoll_find
+ ****************************************************************************/
+
+static FAR struct epoll_reg_s *epoll_find(FAR struct epoll_head_s *eph, int fd)
+{
+	FAR struct epoll_reg_s *reg;
+
+	for (reg = (FAR struct epoll_reg_s *)dq_peek(&eph->regs); reg != NULL; reg = (FAR struct epoll_reg_s *)dq_next(&reg->node)) {
+		if (reg->fd == fd) {
+			return reg;
+		}
+	}
+
+	return NULL;
+}
+
+/****************************************************************************
+ * Name: epoll_collect
+ *
+ * Description:
+ *   Return up to 'maxevents' registrations that are ready now.  Reported
+ *   registrations move to the end of the list so that a busy descriptor
+ *   can not hide the others when there are more than 'maxevents'.
+ *
+ * Assumptions:
+ *   The caller holds exclsem
+ *
+ ****************************************************************************/
+
+static int epoll_collect(FAR struct epoll_head_s *eph, FAR struct epoll_event *evs, int maxevents)
+{
+	FAR struct epoll_reg_s *reg;
+	FAR struct epoll_reg_s *next;
+	FAR struct epoll_reg_s *last;
+	pollevent_t revents;
+	int nevents = 0;
+
+	last = (FAR struct epoll_reg_s *)dq_tail(&eph->regs);
+	for (reg = (FAR struct epoll_reg_s *)dq_peek(&eph->regs); reg != NULL && nevents < maxevents; reg = next) {
+		next = (reg == last) ? NULL : (FAR struct epoll_reg_s *)dq_next(&reg->node);
+
+		if (!reg->armed || reg->pfd.revents == 0) {
+			continue;
+		}
+
+		/* The event may be stale, ask the driver again */
+
+		(void)epoll_setup(eph, reg, false);
+		if (epoll_setup(eph, reg, true) < 0) {
+			revents = POLLERR;
+		} else {
+			revents = reg->pfd.revents & (reg->events | EPOLL_ALWAYS);
+		}
+
+		if (revents == 0) {
+			continue;
+		}
+
+		if ((reg->events & EPOLLONESHOT) != 0) {
+			(void)epoll_setup(eph, reg, false);
+		}
+
+		evs[nevents].events = revents;
+		evs[nevents].data = reg->data;
+		nevents++;
+
+		dq_rem(&reg->node, &eph->regs);
+		dq_addlast(&reg->node, &eph->regs);
+	}
+
+	return nevents;
+}
+
+/****************************************************************************
+ * Name: epoll_wait_event
+ *
+ * Description:
+ *   Wait until a driver posts the instance, 'abstime' is NULL to wait
+ *   forever.
+ *
+ ****************************************************************************/
+
+static int epoll_wait_event(FAR struct epoll_head_s *eph, FAR const struct timespec *abstime)
+{
+	int ret;
+
+	if (abstime == NULL) {
+		ret = sem_wait(&eph->waitsem);
+	} else {
+		ret = sem_timedwait(&eph->waitsem, abstime);
+	}
+
+	return ret < 0 ? -get_errno() : OK;
+}
+
+/****************************************************************************
+ * Name: epoll_destroy
+ ****************************************************************************/
+
+static void epoll_destroy(FAR struct epoll_head_s *eph)
+{
+	FAR struct epoll_reg_s *reg;
+
+	epoll_semtake(&g_epoll_sem);
+	dq_rem(&eph->node, &g_epoll_heads);
+	epoll_semgive(&g_epoll_sem);
+
+	while ((reg = (FAR struct epoll_reg_s *)dq_remfirst(&eph->regs)) != NULL) {
+		(void)epoll_setup(eph, reg, false);
+		kmm_free(reg);
+	}
+
+	sem_destroy(&eph->waitsem);
+	sem_destroy(&eph->exclsem);
+	kmm_free(eph);
+}
+
+/****************************************************************************
+ * Name: epoll_open
+ *
+ * Description:
+ *   Only reached through dup(), the instance is shared.
+ *
+ ****************************************************************************/
+
+static int epoll_open(FAR struct file *filep)
+{
+	return OK;
+}
+
+/****************************************************************************
+ * Name: epoll_close
+ ****************************************************************************/
+
+static int epoll_close(FAR struct file *filep)
+{
+	FAR struct inode *inode = filep->f_inode;
+
+	/* The inode is freed by inode_release() after the last close, the
+	 * instance goes with it.
+	 */
+
+	if (inode->i_crefs <= 1) {
+		epoll_destroy((FAR struct epoll_head_s *)inode->i_private);
+		inode->i_private = NULL;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: epoll_create1
+ *
+ * Description:
+ *   Create an epoll instance.  It is an anonymous driver inode that is not
+ *   in the inode tree and is freed when its last descriptor is closed.
+ *
+ ****************************************************************************/
+
+int epoll_create1(int flags)
+{
+	FAR struct epoll_head_s *eph;
+	FAR struct inode *inode;
+	int fd;
+
+	if ((flags & ~EPOLL_CLOEXEC) != 0) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	eph = (FAR struct epoll_head_s *)kmm_zalloc(sizeof(struct epoll_head_s));
+	inode = (FAR struct inode *)kmm_zalloc(sizeof(struct inode));
+	if (eph == NULL || inode == NULL) {
+		kmm_free(eph);
+		kmm_free(inode);
+		set_errno(ENOMEM);
+		return ERROR;
+	}
+
+	sem_init(&eph->exclsem, 0, 1);
+	sem_init(&eph->waitsem, 0, 0);
+	sem_setprotocol(&eph->waitsem, SEM_PRIO_NONE);
+	dq_init(&eph->regs);
+	eph->list = sched_getfiles();
+
+	inode->i_crefs = 1;
+	inode->i_flags = FSNODEFLAG_TYPE_DRIVER | FSNODEFLAG_DELETED;
+	inode->u.i_ops = &g_epoll_ops;
+	inode->i_private = eph;
+
+	fd = files_allocate(inode, O_RDWR, 0, 0);
+	if (fd < 0) {
+		sem_destroy(&eph->waitsem);
+		sem_destroy(&eph->exclsem);
+		kmm_free(eph);
+		kmm_free(inode);
+		set_errno(EMFILE);
+		return ERROR;
+	}
+
+	epoll_semtake(&g_epoll_sem);
+	dq_addlast(&eph->node, &g_epoll_heads);
+	epoll_semgive(&g_epoll_sem);
+
+	return fd;
+}
+
+/****************************************************************************
+ * Name: epoll_create
+ ****************************************************************************/
+
+int epoll_create(int size)
+{
+	if (size <= 0) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	return epoll_create1(0);
+}
+
+/****************************************************************************
+ * Name: epoll_ctl
+ *
+ * Description:
+ *   Add, modify or remove a descriptor of the interest list.  Added and
+ *   modified descriptors are armed in their driver or socket right away.
+ *
+ ****************************************************************************/
+
+int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev)
+{
+	FAR struct epoll_head_s *eph;
+	FAR struct epoll_reg_s *reg;
+	FAR struct file *filep = NULL;
+	int ret = OK;
+
+	eph = epoll_gethead(epfd);
+	if (eph == NULL) {
+		return ERROR;
+	}
+
+	if (fd == epfd || (op != EPOLL_CTL_DEL && ev == NULL)) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	if ((unsigned int)fd < CONFIG_NFILE_DESCRIPTORS) {
+		ret = fs_getfilep(fd, &filep);
+	}
+#if defined(CONFIG_NET) && CONFIG_NSOCKET_DESCRIPTORS > 0
+	else if ((unsigned int)fd >= CONFIG_NFILE_DESCRIPTORS + CONFIG_NSOCKET_DESCRIPTORS) {
+		ret = -EBADF;
+	}
+#else
+	else {
+		ret = -EBADF;
+	}
+#endif
+
+	if (ret < 0) {
+		set_errno(-ret);
+		return ERROR;
+	}
+
+	epoll_semtake(&eph->exclsem);
+	reg = epoll_find(eph, fd);
+
+	switch (op) {
+	case EPOLL_CTL_ADD:
+		if (reg != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		reg = (FAR struct epoll_reg_s *)kmm_zalloc(sizeof(struct epoll_reg_s));
+		if (reg == NULL) {
+			ret = -ENOMEM;
+			break;
+		}
+
+		reg->fd = fd;
+		reg->filep = filep;
+		reg->events = ev->events;
+		reg->data = ev->data;
+
+		ret = epoll_setup(eph, reg, true);
+		if (ret < 0) {
+			kmm_free(reg);
+			break;
+		}
+
+		dq_addlast(&reg->node, &eph->regs);
+		break;
+
+	case EPOLL_CTL_MOD:
+		if (reg == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		(void)epoll_setup(eph, reg, false);
+		reg->events = ev->events;
+		reg->data = ev->data;
+		ret = epoll_setup(eph, reg, true);
+		break;
+
+	case EPOLL_CTL_DEL:
+		if (reg == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		(void)epoll_setup(eph, reg, false);
+		dq_rem(&reg->node, &eph->regs);
+		kmm_free(reg);
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	epoll_semgive(&eph->exclsem);
+
+	if (ret < 0) {
+		/* A driver without poll() can not be waited for */
+
+		set_errno(ret == -ENOSYS ? EPERM : -ret);
+		return ERROR;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: epoll_wait
+ *
+ * Description:
+ *   Wait for at least one descriptor of the interest list to be ready and
+ *   return the ready ones.  Unlike poll(), nothing is set up or torn down
+ *   for the descriptors that are not ready.
+ *
+ ****************************************************************************/
+
+int epoll_wait(int epfd, FAR struct epoll_event *evs, int maxevents, int timeout)
+{
+	FAR struct epoll_head_s *eph;
+	struct timespec abstime;
+	irqstate_t flags;
+	int nevents;
+	int ret;
+
+	/* epoll_wait() is a cancellation point */
+
+	(void)enter_cancellation_point();
+
+	eph = epoll_gethead(epfd);
+	if (eph == NULL) {
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	if (evs == NULL || maxevents <= 0) {
+		set_errno(EINVAL);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	if (timeout > 0) {
+		flags = enter_critical_section();
+		(void)clock_gettime(CLOCK_REALTIME, &abstime);
+		leave_critical_section(flags);
+
+		abstime.tv_sec += timeout / MSEC_PER_SEC;
+		abstime.tv_nsec += (timeout % MSEC_PER_SEC) * NSEC_PER_MSEC;
+		if (abstime.tv_nsec >= NSEC_PER_SEC) {
+			abstime.tv_sec++;
+			abstime.tv_nsec -= NSEC_PER_SEC;
+		}
+	}
+
+	/* Every post of waitsem is one event of one descriptor, possibly one
+	 * that was already reported.  Look again until something is ready.
+	 */
+
+	for (;;) {
+		epoll_semtake(&eph->exclsem);
+		nevents = epoll_collect(eph, evs, maxevents);
+		epoll_semgive(&eph->exclsem);
+
+		if (nevents > 0 || timeout == 0) {
+			break;
+		}
+
+		ret = epoll_wait_event(eph, timeout > 0 ? &abstime : NULL);
+		if (ret == -ETIMEDOUT) {
+			nevents = 0;
+			break;
+		} else if (ret < 0) {
+			set_errno(-ret);
+			nevents = ERROR;
+			break;
+		}
+	}
+
+	leave_cancellation_point();
+	return nevents;
+}
+
+/****************************************************************************
+ * Name: epoll_fdclose
+ *
+ * Description:
+ *   Remove the descriptor 'fd' of the file list 'list' from every interest
+ *   list before it is closed, so that no driver keeps a reference to a
+ *   registration after the descriptor is gone.
+ *
+ ****************************************************************************/
+
+void epoll_fdclose(FAR struct filelist *list, int fd)
+{
+	FAR struct epoll_head_s *eph;
+	FAR struct epoll_reg_s *reg;
+
+	if (dq_peek(&g_epoll_heads) == NULL) {
+		return;
+	}
+
+	epoll_semtake(&g_epoll_sem);
+	for (eph = (FAR struct epoll_head_s *)dq_peek(&g_epoll_heads); eph != NULL; eph = (FAR struct epoll_head_s *)dq_next(&eph->node)) {
+		if (eph->list != list) {
+			continue;
+		}
+
+		epoll_semtake(&eph->exclsem);
+		reg = epoll_find(eph, fd);
+		if (reg != NULL) {
+			(void)epoll_setup(eph, reg, false);
+			dq_rem(&reg->node, &eph->regs);
+			kmm_free(reg);
+		}
+		epoll_semgive(&eph->exclsem);
+	}
+	epoll_semgive(&g_epoll_sem);
+}
+
+#endif							/* CONFIG_FS_EPOLL */
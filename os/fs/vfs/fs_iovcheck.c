@@ -0,0 +1,69 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <limits.h>
+#include <errno.h>
+
+#include "inode/inode.h"
+
+#ifdef CONFIG_FS_VECTORED_IO
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: iov_check
+ *
+ * Description:
+ *   Reject a vector whose count is out of range or whose total length
+ *   overflows an ssize_t.  Shared by readv() and writev().
+ *
+ * Returned Value:
+ *   OK if the vector is usable, otherwise -EINVAL.
+ *
+ ****************************************************************************/
+
+int iov_check(FAR const struct iovec *iov, int iovcnt)
+{
+	size_t total = 0;
+	int i;
+
+	if (iovcnt < 0 || iovcnt > IOV_MAX || (iov == NULL && iovcnt > 0)) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		if (iov[i].iov_len > SSIZE_MAX - total) {
+			return -EINVAL;
+		}
+		total += iov[i].iov_len;
+	}
+
+	return OK;
+}
+
+#endif							/* CONFIG_FS_VECTORED_IO */
@@ -0,0 +1,179 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <assert.h>
+
+#include <tinyara/cancelpt.h>
+#include <tinyara/fs/fs.h>
+
+#include "inode/inode.h"
+
+#ifdef CONFIG_FS_VECTORED_IO
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#if CONFIG_NFILE_DESCRIPTORS > 0
+/****************************************************************************
+ * Name: file_readv
+ *
+ * Description:
+ *   Read into the buffers of 'iov' in order.  The readv method of the
+ *   driver or file system does the whole transfer when there is one,
+ *   otherwise each buffer is read in turn until a short read.
+ *
+ * Returned Value:
+ *   The number of bytes read, or a negated errno value.
+ *
+ ****************************************************************************/
+
+ssize_t file_readv(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt)
+{
+	FAR struct inode *inode;
+	ssize_t ntotal = 0;
+	ssize_t nread;
+	int ret;
+	int i;
+
+	DEBUGASSERT(filep);
+	inode = filep->f_inode;
+
+	if (inode == NULL) {
+		return -EBADF;
+	}
+
+	if ((filep->f_oflags & O_RDOK) == 0) {
+		return -EBADF;
+	}
+
+	ret = iov_check(iov, iovcnt);
+	if (ret < 0) {
+		return ret;
+	}
+
+#ifndef CONFIG_DISABLE_MOUNTPOINT
+	if (INODE_IS_MOUNTPT(inode)) {
+		if (inode->u.i_mops && inode->u.i_mops->readv) {
+			return inode->u.i_mops->readv(filep, iov, iovcnt);
+		}
+	} else
+#endif
+	if (inode->u.i_ops && inode->u.i_ops->readv) {
+		return inode->u.i_ops->readv(filep, iov, iovcnt);
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		if (iov[i].iov_len == 0) {
+			continue;
+		}
+
+		nread = file_read(filep, iov[i].iov_base, iov[i].iov_len);
+		if (nread < 0) {
+			return ntotal > 0 ? ntotal : nread;
+		}
+
+		ntotal += nread;
+		if (nread < iov[i].iov_len) {
+			break;
+		}
+	}
+
+	return ntotal;
+}
+#endif
+
+/****************************************************************************
+ * Name: readv
+ *
+ * Description:
+ *   Read into the 'iovcnt' buffers of 'iov' with a single system call.
+ *   See sys/uio.h.
+ *
+ ****************************************************************************/
+
+ssize_t readv(int fd, FAR const struct iovec *iov, int iovcnt)
+{
+	ssize_t ret;
+
+	/* readv() is a cancellation point */
+
+	(void)enter_cancellation_point();
+
+#if CONFIG_NFILE_DESCRIPTORS > 0
+	if ((unsigned int)fd < CONFIG_NFILE_DESCRIPTORS) {
+		FAR struct file *filep;
+
+		ret = (ssize_t)fs_getfilep(fd, &filep);
+		if (ret >= 0) {
+			ret = file_readv(filep, iov, iovcnt);
+		}
+	} else
+#endif
+	{
+#if defined(CONFIG_NET) && CONFIG_NSOCKET_DESCRIPTORS > 0
+		ssize_t nread;
+		int i;
+
+		/* Sockets receive into one buffer after the other */
+
+		ret = iov_check(iov, iovcnt);
+		for (i = 0; ret >= 0 && i < iovcnt; i++) {
+			if (iov[i].iov_len == 0) {
+				continue;
+			}
+
+			nread = recv(fd, iov[i].iov_base, iov[i].iov_len, 0);
+			if (nread < 0) {
+				ret = ret > 0 ? ret : -get_errno();
+				break;
+			}
+
+			ret += nread;
+			if (nread < iov[i].iov_len) {
+				break;
+			}
+		}
+#else
+		ret = -EBADF;
+#endif
+	}
+
+	if (ret < 0) {
+		set_errno(-ret);
+		ret = ERROR;
+	}
+
+	leave_cancellation_point();
+	return ret;
+}
+
+#endif							/* CONFIG_FS_VECTORED_IO */
@@ -0,0 +1,496 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/****************************************************************************
+ * fs/vfs/fs_splice.c
+ *
+ * splice() moves data between two descriptors without passing it through
+ * a user buffer.  Pipes have no pages to hand over, so the data is copied
+ * once, directly between the ring buffer of the pipe and the other end:
+ *
+ *   pipe -> pipe    ring to ring, both pipes locked (pipecommon_splice)
+ *   pipe -> any     the other end writes out of the ring
+ *   file -> pipe    the file is read into the ring
+ *   XIP file -> any the other end writes out of the FIOC_MMAP mapping
+ *
+ * Everything else goes through a kernel bounce buffer, which still saves
+ * the copies to and from user space and the extra system calls.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/cancelpt.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/fs/ioctl.h>
+
+#include "inode/inode.h"
+
+#ifdef CONFIG_FS_SPLICE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#ifndef CONFIG_FS_SPLICE_BUFSIZE
+#define CONFIG_FS_SPLICE_BUFSIZE 512
+#endif
+
+#if defined(CONFIG_NET_LWIP) && CONFIG_NSOCKET_DESCRIPTORS > 0
+#define SPLICE_SOCKETS
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+struct splice_end_s {
+	int fd;						/* The descriptor */
+	FAR struct file *filep;		/* Its file, NULL for a socket */
+	bool ispipe;				/* The file is a pipe or FIFO */
+	FAR off_t *offset;			/* The caller's offset, or NULL */
+	off_t savepos;				/* File position to restore with 'offset' */
+};
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: splice_open
+ *
+ * Description:
+ *   Look up one end of the transfer and check that it is open for 'access'
+ *   (O_RDOK or O_WROK).  Offsets are only accepted for seekable files.
+ *
+ ****************************************************************************/
+
+static int splice_open(FAR struct splice_end_s *end, int fd, FAR off_t *offset, int access)
+{
+	int ret;
+
+	end->fd = fd;
+	end->filep = NULL;
+	end->ispipe = false;
+	end->offset = offset;
+
+	if ((unsigned int)fd >= CONFIG_NFILE_DESCRIPTORS) {
+#ifdef SPLICE_SOCKETS
+		return offset != NULL ? -ESPIPE : OK;
+#else
+		return -EBADF;
+#endif
+	}
+
+	ret = fs_getfilep(fd, &end->filep);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (end->filep->f_inode == NULL || (end->filep->f_oflags & access) == 0) {
+		return -EBADF;
+	}
+
+#ifdef CONFIG_PIPES
+	end->ispipe = pipecommon_ispipe(end->filep);
+#endif
+	if (end->ispipe && offset != NULL) {
+		return -ESPIPE;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: splice_seek / splice_restore
+ *
+ * Description:
+ *   With an explicit offset, the transfer runs at that offset and the file
+ *   position of the descriptor is left as it was.
+ *
+ ****************************************************************************/
+
+static int splice_seek(FAR struct splice_end_s *end)
+{
+	if (end->offset == NULL) {
+		return OK;
+	}
+
+	end->savepos = file_seek(end->filep, 0, SEEK_CUR);
+	if (end->savepos < 0 || file_seek(end->filep, *end->offset, SEEK_SET) < 0) {
+		return -get_errno();
+	}
+
+	return OK;
+}
+
+static void splice_restore(FAR struct splice_end_s *end)
+{
+	off_t pos;
+
+	if (end->offset != NULL) {
+		pos = file_seek(end->filep, 0, SEEK_CUR);
+		if (pos >= 0) {
+			*end->offset = pos;
+		}
+
+		file_seek(end->filep, end->savepos, SEEK_SET);
+	}
+}
+
+/****************************************************************************
+ * Name: splice_read / splice_write
+ *
+ * Description:
+ *   Read or write one end, returning a negated errno value on failure.
+ *
+ ****************************************************************************/
+
+static ssize_t splice_read(FAR struct splice_end_s *end, FAR void *buf, size_t len)
+{
+#ifdef SPLICE_SOCKETS
+	ssize_t ret;
+
+	if (end->filep == NULL) {
+		ret = recv(end->fd, buf, len, 0);
+		return ret < 0 ? -get_errno() : ret;
+	}
+#endif
+
+	return file_read(end->filep, buf, len);
+}
+
+static ssize_t splice_write(FAR struct splice_end_s *end, FAR const void *buf, size_t len)
+{
+#ifdef SPLICE_SOCKETS
+	ssize_t ret;
+
+	if (end->filep == NULL) {
+		ret = send(end->fd, buf, len, 0);
+		return ret < 0 ? -get_errno() : ret;
+	}
+#endif
+
+	return file_write(end->filep, buf, len);
+}
+
+#ifdef CONFIG_PIPES
+/****************************************************************************
+ * Name: splice_sink / splice_source
+ *
+ * Description:
+ *   Write the other end straight out of, or read it straight into, the
+ *   ring buffer of a pipe.
+ *
+ ****************************************************************************/
+
+static ssize_t splice_sink(FAR void *arg, FAR uint8_t *buf, size_t len)
+{
+	return splice_write((FAR struct splice_end_s *)arg, buf, len);
+}
+
+static ssize_t splice_source(FAR void *arg, FAR uint8_t *buf, size_t len)
+{
+	return splice_read((FAR struct splice_end_s *)arg, buf, len);
+}
+#endif
+
+/****************************************************************************
+ * Name: splice_mapped
+ *
+ * Description:
+ *   Write the output straight from the memory mapping of the input file,
+ *   if its file system can map it (romfs on XIP flash, tmpfs).  Returns
+ *   -ENOTTY if the input cannot be mapped.
+ *
+ ****************************************************************************/
+
+static ssize_t splice_mapped(FAR struct splice_end_s *in, FAR struct splice_end_s *out, size_t len)
+{
+	FAR uint8_t *base = NULL;
+	off_t pos;
+	off_t size;
+	ssize_t ret;
+
+	if (in->filep == NULL || !INODE_IS_MOUNTPT(in->filep->f_inode)) {
+		return -ENOTTY;
+	}
+
+	if (file_ioctl(in->filep, FIOC_MMAP, (unsigned long)((uintptr_t)&base)) < 0 || base == NULL) {
+		return -ENOTTY;
+	}
+
+	/* The mapping has no length, take it from the end of the file */
+
+	pos = file_seek(in->filep, 0, SEEK_CUR);
+	if (pos < 0) {
+		return -get_errno();
+	}
+
+	size = file_seek(in->filep, 0, SEEK_END);
+	if (size < 0 || file_seek(in->filep, pos, SEEK_SET) < 0) {
+		return -get_errno();
+	}
+
+	if (pos >= size) {
+		return 0;
+	}
+
+	if (len > size - pos) {
+		len = size - pos;
+	}
+
+	ret = splice_write(out, base + pos, len);
+	if (ret > 0 && file_seek(in->filep, pos + ret, SEEK_SET) < 0) {
+		return -get_errno();
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: splice_copy
+ *
+ * Description:
+ *   Move the data through a kernel buffer.  Stops at the first short read
+ *   so that a socket or device input is not waited on twice.
+ *
+ ****************************************************************************/
+
+static ssize_t splice_copy(FAR struct splice_end_s *in, FAR struct splice_end_s *out, size_t len)
+{
+	FAR uint8_t *buffer;
+	size_t ntotal = 0;
+	size_t chunk;
+	ssize_t nread;
+	ssize_t nwritten;
+	ssize_t ret = 0;
+
+	buffer = (FAR uint8_t *)kmm_malloc(CONFIG_FS_SPLICE_BUFSIZE);
+	if (buffer == NULL) {
+		return -ENOMEM;
+	}
+
+	while (ntotal < len) {
+		chunk = len - ntotal;
+		if (chunk > CONFIG_FS_SPLICE_BUFSIZE) {
+			chunk = CONFIG_FS_SPLICE_BUFSIZE;
+		}
+
+		nread = splice_read(in, buffer, chunk);
+		if (nread <= 0) {
+			ret = nread;
+			break;
+		}
+
+		/* The data has left the input, so write all of it */
+
+		for (nwritten = 0; nwritten < nread; nwritten += ret) {
+			ret = splice_write(out, buffer + nwritten, nread - nwritten);
+			if (ret <= 0) {
+				break;
+			}
+		}
+
+		ntotal += nwritten;
+		if (nwritten < nread) {
+			fdbg("ERROR: %d bytes lost after a write error\n", (int)(nread - nwritten));
+			break;
+		}
+
+		if (nread < chunk) {
+			break;
+		}
+	}
+
+	kmm_free(buffer);
+	return ntotal > 0 ? (ssize_t)ntotal : ret;
+}
+
+/****************************************************************************
+ * Name: splice_transfer
+ ****************************************************************************/
+
+static ssize_t splice_transfer(FAR struct splice_end_s *in, FAR struct splice_end_s *out, size_t len, bool nonblock)
+{
+	ssize_t ret;
+
+#ifdef CONFIG_PIPES
+	if (in->ispipe && out->ispipe) {
+		return pipecommon_splice(in->filep, out->filep, len, false, nonblock);
+	}
+
+	if (in->ispipe) {
+		return pipecommon_splice_read(in->filep, splice_sink, out, len, false, nonblock);
+	}
+
+	/* Only regular files are read with the output pipe locked, a socket or
+	 * a device could keep the readers of the pipe waiting indefinitely.
+	 */
+
+	if (out->ispipe && in->filep != NULL && INODE_IS_MOUNTPT(in->filep->f_inode)) {
+		return pipecommon_splice_write(out->filep, splice_source, in, len, nonblock);
+	}
+#endif
+
+	ret = splice_mapped(in, out, len);
+	if (ret != -ENOTTY) {
+		return ret;
+	}
+
+	return splice_copy(in, out, len);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: splice
+ *
+ * Description:
+ *   Move up to 'len' bytes from 'fd_in' to 'fd_out' inside the kernel.
+ *   Unlike linux, neither descriptor has to be a pipe.
+ *
+ * Input Parameters:
+ *   fd_in   - The descriptor to read from
+ *   off_in  - Offset to read at, or NULL to use the file position
+ *   fd_out  - The descriptor to write to
+ *   off_out - Offset to write at, or NULL to use the file position
+ *   len     - The maximum number of bytes to move
+ *   flags   - SPLICE_F_NONBLOCK makes pipe I/O non-blocking, the other
+ *             flags are hints
+ *
+ * Returned Value:
+ *   The number of bytes moved, 0 at end of input, or -1 with errno set.
+ *
+ ****************************************************************************/
+
+ssize_t splice(int fd_in, FAR off_t *off_in, int fd_out, FAR off_t *off_out, size_t len, unsigned int flags)
+{
+	struct splice_end_s in;
+	struct splice_end_s out;
+	ssize_t ret;
+
+	/* splice() is a cancellation point */
+
+	(void)enter_cancellation_point();
+
+	ret = splice_open(&in, fd_in, off_in, O_RDOK);
+	if (ret == OK) {
+		ret = splice_open(&out, fd_out, off_out, O_WROK);
+	}
+
+	if (ret < 0) {
+		goto errout;
+	}
+
+	if (len > SSIZE_MAX) {
+		len = SSIZE_MAX;
+	}
+
+	ret = splice_seek(&in);
+	if (ret < 0) {
+		goto errout;
+	}
+
+	ret = splice_seek(&out);
+	if (ret == OK) {
+		ret = splice_transfer(&in, &out, len, (flags & SPLICE_F_NONBLOCK) != 0);
+		splice_restore(&out);
+	}
+
+	splice_restore(&in);
+	if (ret < 0) {
+		goto errout;
+	}
+
+	leave_cancellation_point();
+	return ret;
+
+errout:
+	set_errno(-ret);
+	leave_cancellation_point();
+	return ERROR;
+}
+
+/****************************************************************************
+ * Name: tee
+ *
+ * Description:
+ *   Copy up to 'len' bytes from the pipe 'fd_in' to the pipe 'fd_out'
+ *   without consuming them.
+ *
+ * Returned Value:
+ *   The number of bytes copied, 0 if 'fd_in' is empty and has no writers,
+ *   or -1 with errno set.
+ *
+ ****************************************************************************/
+
+ssize_t tee(int fd_in, int fd_out, size_t len, unsigned int flags)
+{
+	struct splice_end_s in;
+	struct splice_end_s out;
+	ssize_t ret;
+
+	(void)enter_cancellation_point();
+
+	ret = splice_open(&in, fd_in, NULL, O_RDOK);
+	if (ret == OK) {
+		ret = splice_open(&out, fd_out, NULL, O_WROK);
+	}
+
+	if (ret == OK) {
+#ifdef CONFIG_PIPES
+		if (in.ispipe && out.ispipe) {
+			if (len > SSIZE_MAX) {
+				len = SSIZE_MAX;
+			}
+
+			ret = pipecommon_splice(in.filep, out.filep, len, true, (flags & SPLICE_F_NONBLOCK) != 0);
+		} else
+#endif
+		{
+			ret = -EINVAL;
+		}
+	}
+
+	if (ret < 0) {
+		set_errno(-ret);
+		ret = ERROR;
+	}
+
+	leave_cancellation_point();
+	return ret;
+}
+
+#endif							/* CONFIG_FS_SPLICE */
@@ -65,6 +65,11 @@
 
 #include <tinyara/wqueue.h>
 
+#ifdef CONFIG_FS_AIO_RING
+#include <stdint.h>
+#include <semaphore.h>
+#endif
+
 /****************************************************************************
  * Pre-processor Definitions
  ****************************************************************************/
@@ -73,6 +78,7 @@
 
 #if (defined(CONFIG_BUILD_PROTECTED) || defined(CONFIG_BUILD_KERNEL)) && defined(__KERNEL__)
 #undef CONFIG_FS_AIO
+#undef CONFIG_FS_AIO_RING
 #endif
 
 /* Work queue support is required.  The low-priority work queue is required
@@ -130,6 +136,18 @@
 #define LIO_NOWAIT      0
 #define LIO_WAIT        1
 
+#ifdef CONFIG_FS_AIO_RING
+/* Submission ring operations, in addition to LIO_NOP, LIO_READ and
+ * LIO_WRITE.
+ *
+ * AIO_RING_FSYNC  - Requests that the file be synchronized with the media
+ *                   after the requests submitted before it on the same
+ *                   device.
+ */
+
+#define AIO_RING_FSYNC  3
+#endif
+
 /****************************************************************************
  * Type Definitions
  ****************************************************************************/
@@ -157,6 +175,48 @@ struct aiocb {
 	FAR void *aio_priv;			/* Used by signal handlers */
 };
 
+#ifdef CONFIG_FS_AIO_RING
+/* A submission and a completion queue shared between the application and
+ * the I/O workers.  The application fills submission entries and advances
+ * sq_tail, aio_ring_submit() consumes them up to sq_tail.  The workers post
+ * completion entries at cq_tail and the application consumes them from
+ * cq_head, by polling or with aio_ring_wait(); no signal is sent.
+ *
+ * Both queues hold 'entries' slots, a power of two.  The indices run freely
+ * and are masked on access.
+ */
+
+struct aio_sqe {
+	uint8_t opcode;				/* LIO_NOP, LIO_READ, LIO_WRITE, AIO_RING_FSYNC */
+	int fildes;					/* File descriptor */
+	off_t offset;				/* File offset */
+	FAR volatile void *buf;		/* Location of buffer */
+	size_t nbytes;				/* Length of transfer */
+	uintptr_t user_data;		/* Returned unchanged in the completion */
+};
+
+struct aio_cqe {
+	uintptr_t user_data;		/* From the submission entry */
+	ssize_t result;				/* Bytes transferred or a negated errno */
+};
+
+struct aio_ring {
+	FAR struct aio_sqe *sq;		/* Submission entries */
+	FAR struct aio_cqe *cq;		/* Completion entries */
+	uint16_t entries;			/* Number of slots in each queue */
+	volatile uint16_t sq_head;	/* Next entry aio_ring_submit() consumes */
+	volatile uint16_t sq_tail;	/* Next entry the application fills */
+	volatile uint16_t cq_head;	/* Next completion the application reads */
+	volatile uint16_t cq_tail;	/* Next completion a worker posts */
+
+	/* Non-standard, implementation-dependent data */
+
+	volatile uint16_t inflight;	/* Submitted, not yet completed */
+	volatile uint8_t waiters;	/* Threads in aio_ring_wait() */
+	sem_t waitsem;				/* Posted on completion when waited for */
+};
+#endif
+
 /****************************************************************************
  * Public Data
  ****************************************************************************/
@@ -181,6 +241,16 @@ int aio_suspend(FAR const struct aiocb *const list[], int nent, FAR const struct
 int aio_write(FAR struct aiocb *aiocbp);
 int lio_listio(int mode, FAR struct aiocb *const list[], int nent, FAR struct sigevent *sig);
 
+#ifdef CONFIG_FS_AIO_RING
+int aio_ring_setup(FAR struct aio_ring *ring, FAR struct aio_sqe *sq, FAR struct aio_cqe *cq, unsigned int entries);
+int aio_ring_teardown(FAR struct aio_ring *ring);
+FAR struct aio_sqe *aio_ring_get_sqe(FAR struct aio_ring *ring);
+int aio_ring_submit(FAR struct aio_ring *ring);
+FAR struct aio_cqe *aio_ring_peek_cqe(FAR struct aio_ring *ring);
+void aio_ring_cqe_seen(FAR struct aio_ring *ring);
+int aio_ring_wait(FAR struct aio_ring *ring, unsigned int nr, FAR const struct timespec *timeout);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -155,6 +155,15 @@
 #define DN_RENAME   4			/* A file was renamed */
 #define DN_ATTRIB   5			/* Attributes of a file were changed */
 
+/* splice() and tee() flags (linux).  SPLICE_F_MOVE, SPLICE_F_MORE and
+ * SPLICE_F_GIFT are accepted as hints.
+ */
+
+#define SPLICE_F_MOVE      (1 << 0)	/* Move pages instead of copying */
+#define SPLICE_F_NONBLOCK  (1 << 1)	/* Do not block on pipe I/O */
+#define SPLICE_F_MORE      (1 << 2)	/* More data will follow */
+#define SPLICE_F_GIFT      (1 << 3)	/* Pages are given to the kernel */
+
 /* int creat(const char *path, mode_t mode);
  *
  * is equivalent to open with O_WRONLY|O_CREAT|O_TRUNC.
@@ -212,6 +221,46 @@ int open(const char *path, int oflag, ...);
  */
 int fcntl(int fd, int cmd, ...);
 
+#ifdef CONFIG_FS_SPLICE
+/**
+ * @ingroup FCNTL_KERNEL
+ * @brief move data between two descriptors without a user buffer
+ * @details @b #include <fcntl.h> \n
+ * SYSTEM CALL API \n
+ * Unlike linux, neither descriptor has to be a pipe.  Data is copied once
+ * inside the kernel when one end is a pipe or the input file can be mapped,
+ * and through a kernel buffer otherwise.
+ * @param[in] fd_in the descriptor to read from
+ * @param[in,out] off_in the offset to read from, or NULL to use and advance
+ *                the file position.  Must be NULL for a pipe or a socket.
+ * @param[in] fd_out the descriptor to write to
+ * @param[in,out] off_out the offset to write to, or NULL to use and advance
+ *                the file position.  Must be NULL for a pipe or a socket.
+ * @param[in] len the maximum number of bytes to move
+ * @param[in] flags SPLICE_F_* flags
+ * @return the number of bytes moved, 0 at end of input, -1 with errno set
+ *         on failure
+ * @since TizenRT v4.1
+ */
+ssize_t splice(int fd_in, FAR off_t *off_in, int fd_out, FAR off_t *off_out, size_t len, unsigned int flags);
+/**
+ * @ingroup FCNTL_KERNEL
+ * @brief duplicate pipe data without consuming it
+ * @details @b #include <fcntl.h> \n
+ * SYSTEM CALL API \n
+ * Copies up to len bytes from the pipe fd_in to the pipe fd_out, leaving
+ * them in fd_in.
+ * @param[in] fd_in the pipe to copy from
+ * @param[in] fd_out the pipe to copy to
+ * @param[in] len the maximum number of bytes to copy
+ * @param[in] flags SPLICE_F_* flags
+ * @return the number of bytes copied, 0 if fd_in has no writers left, -1
+ *         with errno set on failure
+ * @since TizenRT v4.1
+ */
+ssize_t tee(int fd_in, int fd_out, size_t len, unsigned int flags);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -189,6 +189,48 @@ int mq_setattr(mqd_t mqdes, FAR const struct mq_attr *mq_stat, FAR struct mq_att
  */
 int mq_getattr(mqd_t mqdes, FAR struct mq_attr *mq_stat);
 
+#ifdef CONFIG_MQ_ZEROCOPY
+/**
+ * @brief allocate a buffer for a message sent by reference
+ * @details @b #include <mqueue.h> \n
+ * SYSTEM CALL API \n
+ * The calling task owns the buffer until it is sent with mq_send_buf()
+ * or freed with mq_buf_free().
+ * @param[in] size the size needed, at most CONFIG_MQ_ZEROCOPY_BUFSIZE
+ * @return the buffer on success, NULL with errno set on failure
+ * @since TizenRT v4.1
+ */
+FAR void *mq_buf_alloc(size_t size);
+/**
+ * @brief return a message buffer to the pool
+ * @details @b #include <mqueue.h> \n
+ * SYSTEM CALL API
+ * @param[in] buf a buffer owned by the calling task
+ * @return 0 on success, -1 with errno set on failure
+ * @since TizenRT v4.1
+ */
+int mq_buf_free(FAR void *buf);
+/**
+ * @brief send a message by reference
+ * @details @b #include <mqueue.h> \n
+ * SYSTEM CALL API \n
+ * The queue takes the buffer without copying it and the receiver becomes
+ * its owner. The caller still owns the buffer if the call fails.
+ * @since TizenRT v4.1
+ */
+int mq_send_buf(mqd_t mqdes, FAR void *buf, size_t msglen, int prio);
+/**
+ * @brief receive a message by reference
+ * @details @b #include <mqueue.h> \n
+ * SYSTEM CALL API \n
+ * On success *buf is a buffer owned by the caller, to be freed with
+ * mq_buf_free() or passed on with mq_send_buf().
+ * @return the message length on success, -1 with errno set on failure
+ * @since TizenRT v4.1
+ */
+ssize_t mq_receive_buf(mqd_t mqdes, FAR void **buf, FAR int *prio);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -119,12 +119,19 @@
  *   mutex will return with an error.
  * PTHREAD_MUTEX_DEFAULT
  *  An implementation is allowed to map this mutex to one of the other mutex types.
+ * PTHREAD_MUTEX_ADAPTIVE_NP
+ *   Non-standard.  A non-robust mutex without priority inheritance that spins
+ *   while its holder runs on another CPU before it blocks.  Relocking it or
+ *   unlocking it from another thread returns an error.
  */
 
 #define PTHREAD_MUTEX_NORMAL        0
 #define PTHREAD_MUTEX_ERRORCHECK    1
 #define PTHREAD_MUTEX_RECURSIVE     2
 #define PTHREAD_MUTEX_DEFAULT       PTHREAD_MUTEX_NORMAL
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+#define PTHREAD_MUTEX_ADAPTIVE_NP   3
+#endif
 
 /* Valid ranges for the pthread stacksize attribute */
 
@@ -293,9 +300,10 @@ typedef pthread_startroutine_t pthread_func_t;
 typedef CODE void (*pthread_cleanup_t)(FAR void *arg);
 #endif
 
-#define PTHREAD_RWLOCK_INITIALIZER {PTHREAD_MUTEX_INITIALIZER, \
-				    PTHREAD_COND_INITIALIZER, \
-				    0, 0, false}
+/* 'rdrain' is only used for signaling, as set up by pthread_rwlock_init() */
+
+#define PTHREAD_RWLOCK_INITIALIZER {0, -1, SEM_INITIALIZER(1), \
+				    NOPI_SEM_INITIALIZER(0)}
 
 /* Forware references */
 
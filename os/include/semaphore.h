@@ -90,7 +90,11 @@
  * Public Type Declarations
  ****************************************************************************/
 
-/* This structure contains information about the holder of a semaphore */
+/* This structure contains information about the holder of a semaphore.
+ * A holder is also linked into the list of semaphores held by its thread,
+ * so a semaphore on which counts are held must be destroyed with
+ * sem_destroy() before its memory is freed or reused.
+ */
 
 #ifdef SAVE_SEM_HOLDER
 struct tcb_s;					/* Forward reference */
@@ -100,16 +104,18 @@ struct tcb_s;					/* Forward reference */
  */
 struct semholder_s {
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-	struct semholder_s *flink;	/* Implements singly linked list */
+	struct semholder_s *flink;	/* Next holder of the same semaphore */
 #endif
+	FAR struct semholder_s *tlink;	/* Next semaphore held by the same thread */
+	FAR struct sem_s *sem;		/* Semaphore the counts are held on */
 	FAR struct tcb_s *htcb;		/* Holder TCB */
 	int16_t counts;				/* Number of counts owned by this holder */
 };
 
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-#define SEMHOLDER_INITIALIZER {NULL, NULL, 0}
+#define SEMHOLDER_INITIALIZER {NULL, NULL, NULL, NULL, 0}
 #else
-#define SEMHOLDER_INITIALIZER {NULL, 0}
+#define SEMHOLDER_INITIALIZER {NULL, NULL, NULL, 0}
 #endif
 #endif							/* SAVE_SEM_HOLDER */
 
@@ -129,10 +135,9 @@ struct sem_s {
 
 	uint8_t flags;			/* See definitions for the struct sem_s flags */
 #ifdef SAVE_SEM_HOLDER
+	struct semholder_s holder;	/* First holder, needs no allocation */
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-	FAR struct semholder_s *hhead;	/* List of holders of semaphore counts */
-#else
-	struct semholder_s holder;	/* Single holder */
+	FAR struct semholder_s *hhead;	/* List of the other holders */
 #endif
 #endif
 };
@@ -148,28 +153,36 @@ typedef struct sem_s sem_t;
 /**
  * @ingroup SEMAPHORE_KERNEL
  * @brief Sem initializer
+ *
+ * NOPI_SEM_INITIALIZER is for semaphores used only for signaling, with
+ * priority inheritance disabled as by sem_setprotocol(SEM_PRIO_NONE).
  */
 #ifdef SAVE_SEM_HOLDER
 #ifdef CONFIG_BINARY_MANAGER
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-#define SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED, NULL} /* flink, semcount, flags, hhead */
-#define MUTEX_SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED | FLAGS_SEM_MUTEX, NULL} /* flink, semcount, flags, hhead */
+#define SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED, SEMHOLDER_INITIALIZER, NULL} /* flink, semcount, flags, holder, hhead */
+#define MUTEX_SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED | FLAGS_SEM_MUTEX, SEMHOLDER_INITIALIZER, NULL} /* flink, semcount, flags, holder, hhead */
+#define NOPI_SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED | PRIOINHERIT_FLAGS_DISABLE, SEMHOLDER_INITIALIZER, NULL} /* flink, semcount, flags, holder, hhead */
 #else
 #define SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED, SEMHOLDER_INITIALIZER} /* flink, semcount, flags, holder */
 #define MUTEX_SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED | FLAGS_SEM_MUTEX, SEMHOLDER_INITIALIZER} /* flink, semcount, flags, holder */
+#define NOPI_SEM_INITIALIZER(c) {NULL, (c), FLAGS_INITIALIZED | PRIOINHERIT_FLAGS_DISABLE, SEMHOLDER_INITIALIZER} /* flink, semcount, flags, holder */
 #endif
 #else // CONFIG_BINARY_MANAGER
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-#define SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED, NULL} /* semcount, flags, hhead */
-#define MUTEX_SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED | FLAGS_SEM_MUTEX, NULL} /* semcount, flags, hhead */
+#define SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED, SEMHOLDER_INITIALIZER, NULL} /* semcount, flags, holder, hhead */
+#define MUTEX_SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED | FLAGS_SEM_MUTEX, SEMHOLDER_INITIALIZER, NULL} /* semcount, flags, holder, hhead */
+#define NOPI_SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED | PRIOINHERIT_FLAGS_DISABLE, SEMHOLDER_INITIALIZER, NULL} /* semcount, flags, holder, hhead */
 #else
 #define SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED, SEMHOLDER_INITIALIZER} /* semcount, flags, holder */
 #define MUTEX_SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED | FLAGS_SEM_MUTEX, SEMHOLDER_INITIALIZER} /* semcount, flags, holder */
+#define NOPI_SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED | PRIOINHERIT_FLAGS_DISABLE, SEMHOLDER_INITIALIZER} /* semcount, flags, holder */
 #endif
 #endif
 #else
 #define SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED}	/* semcount, flags */
 #define MUTEX_SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED | FLAGS_SEM_MUTEX} /* semcount, flags */
+#define NOPI_SEM_INITIALIZER(c) {(c), FLAGS_INITIALIZED | PRIOINHERIT_FLAGS_DISABLE} /* semcount, flags */
 #endif
 
 /****************************************************************************
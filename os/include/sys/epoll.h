@@ -0,0 +1,170 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/**
+ * @defgroup EPOLL_KERNEL EPOLL
+ * @brief Provides APIs for scalable I/O event notification
+ * @ingroup KERNEL
+ *
+ * @{
+ */
+
+/// @file sys/epoll.h
+/// @brief I/O event notification APIs
+
+#ifndef __INCLUDE_SYS_EPOLL_H
+#define __INCLUDE_SYS_EPOLL_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <poll.h>
+
+#ifdef CONFIG_FS_EPOLL
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/* epoll_ctl() operations */
+
+#define EPOLL_CTL_ADD  1		/* Add a descriptor to the interest list */
+#define EPOLL_CTL_DEL  2		/* Remove a descriptor from the interest list */
+#define EPOLL_CTL_MOD  3		/* Change the events of a registered descriptor */
+
+/* Event bits are the poll() bits.  EPOLLET is accepted, but events are
+ * always level-triggered, which also serves a reader that drains the
+ * descriptor until EAGAIN.
+ */
+
+#define EPOLLIN        POLLIN
+#define EPOLLPRI       POLLPRI
+#define EPOLLOUT       POLLOUT
+#define EPOLLRDNORM    POLLRDNORM
+#define EPOLLRDBAND    POLLRDBAND
+#define EPOLLWRNORM    POLLWRNORM
+#define EPOLLWRBAND    POLLWRBAND
+#define EPOLLERR       POLLERR
+#define EPOLLHUP       POLLHUP
+
+#define EPOLLONESHOT   (1u << 30)	/* Disarm after one event until EPOLL_CTL_MOD */
+#define EPOLLET        (1u << 31)	/* Accepted, see above */
+
+/* epoll_create1() flags */
+
+#define EPOLL_CLOEXEC  0x01
+
+/****************************************************************************
+ * Public Type Definitions
+ ****************************************************************************/
+
+typedef union epoll_data {
+	FAR void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} epoll_data_t;
+
+struct epoll_event {
+	uint32_t events;			/* EPOLLIN, EPOLLOUT, ... */
+	epoll_data_t data;			/* Returned unchanged by epoll_wait() */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#undef EXTERN
+#if defined(__cplusplus)
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+/**
+ * @ingroup EPOLL_KERNEL
+ * @brief open an epoll instance
+ * @details @b #include <sys/epoll.h> \n
+ * SYSTEM CALL API \n
+ * The returned descriptor is released with close(), which also drops every
+ * registration.
+ * @param[in] size ignored, must be greater than zero
+ * @return the epoll descriptor on success, -1 with errno set on failure
+ * @since TizenRT v4.1
+ */
+EXTERN int epoll_create(int size);
+
+/**
+ * @ingroup EPOLL_KERNEL
+ * @brief open an epoll instance
+ * @details @b #include <sys/epoll.h> \n
+ * SYSTEM CALL API
+ * @param[in] flags 0 or EPOLL_CLOEXEC
+ * @return the epoll descriptor on success, -1 with errno set on failure
+ * @since TizenRT v4.1
+ */
+EXTERN int epoll_create1(int flags);
+
+/**
+ * @ingroup EPOLL_KERNEL
+ * @brief add, change or remove a descriptor in the interest list
+ * @details @b #include <sys/epoll.h> \n
+ * SYSTEM CALL API \n
+ * A registered descriptor stays armed in its driver or socket between
+ * calls to epoll_wait().  Closing a registered descriptor removes it from
+ * every epoll instance of the task group.
+ * @param[in] epfd the epoll descriptor
+ * @param[in] op EPOLL_CTL_ADD, EPOLL_CTL_MOD or EPOLL_CTL_DEL
+ * @param[in] fd the file or socket descriptor
+ * @param[in] ev the events of interest and the user data, unused for
+ *            EPOLL_CTL_DEL
+ * @return 0 on success, -1 with errno set on failure
+ * @since TizenRT v4.1
+ */
+EXTERN int epoll_ctl(int epfd, int op, int fd, FAR struct epoll_event *ev);
+
+/**
+ * @ingroup EPOLL_KERNEL
+ * @brief wait for events on the interest list
+ * @details @b #include <sys/epoll.h> \n
+ * SYSTEM CALL API \n
+ * Only the descriptors that are ready are returned.
+ * @param[in] epfd the epoll descriptor
+ * @param[out] evs the ready descriptors
+ * @param[in] maxevents the size of evs
+ * @param[in] timeout milliseconds to wait, -1 waits forever
+ * @return the number of ready descriptors, 0 on timeout, -1 with errno set
+ *         on failure
+ * @since TizenRT v4.1
+ */
+EXTERN int epoll_wait(int epfd, FAR struct epoll_event *evs, int maxevents, int timeout);
+
+#undef EXTERN
+#if defined(__cplusplus)
+}
+#endif
+
+#endif							/* CONFIG_FS_EPOLL */
+
+#endif							/* __INCLUDE_SYS_EPOLL_H */
+/**
+ * @} */
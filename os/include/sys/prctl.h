@@ -104,6 +104,18 @@
  *
  *      int ppid;
  *      prctl(PR_GET_TGTASK, &ppid);
+ *
+ *  PR_SET_TIMERSLACK
+ *    Set the timer slack of the calling task (or thread) to arg1 (int)
+ *    microseconds, rounded down to whole ticks.  Its timed waits, sleeps
+ *    and timers may then expire that much later, to share a wakeup with
+ *    other timers.  Zero restores the default slack.  Requires
+ *    CONFIG_WDOG_TIMER_SLACK.  As an example:
+ *
+ *      prctl(PR_SET_TIMERSLACK, 5000);
+ *
+ *  PR_GET_TIMERSLACK
+ *    Return the timer slack of the calling task (or thread) in microseconds.
  */
 
 /**
@@ -134,7 +146,9 @@ enum prctl_type_e {
 	PR_REBOOT_REASON_CLEAR,
 	PR_SET_SECURITY_LEVEL,
 	PR_GET_SECURITY_LEVEL,
-	PR_GET_TGTASK
+	PR_GET_TGTASK,
+	PR_SET_TIMERSLACK,
+	PR_GET_TIMERSLACK
 };
 
 /****************************************************************************
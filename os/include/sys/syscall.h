@@ -288,14 +288,28 @@
 #define SYS_aio_write                  (__SYS_descriptors + 7)
 #define SYS_aio_fsync                  (__SYS_descriptors + 8)
 #define SYS_aio_cancel                 (__SYS_descriptors + 9)
+#ifdef CONFIG_FS_AIO_RING
+#define SYS_aio_ring_submit            (__SYS_descriptors + 10)
+#define SYS_aio_ring_wait              (__SYS_descriptors + 11)
+#define __SYS_poll                     (__SYS_descriptors + 12)
+#else
 #define __SYS_poll                     (__SYS_descriptors + 10)
+#endif
 #else
 #define __SYS_poll                     (__SYS_descriptors + 6)
 #endif
 #ifndef CONFIG_DISABLE_POLL
 #define SYS_poll                       __SYS_poll
 #define SYS_select                     (__SYS_poll + 1)
+#ifdef CONFIG_FS_EPOLL
+#define SYS_epoll_create               (__SYS_poll + 2)
+#define SYS_epoll_create1              (__SYS_poll + 3)
+#define SYS_epoll_ctl                  (__SYS_poll + 4)
+#define SYS_epoll_wait                 (__SYS_poll + 5)
+#define __SYS_boardctl                 (__SYS_poll + 6)
+#else
 #define __SYS_boardctl                 (__SYS_poll + 2)
+#endif
 #else
 #define __SYS_boardctl                 __SYS_poll
 #endif
@@ -342,12 +356,28 @@
 #define SYS_stat                       (__SYS_readdir + 3)
 #define SYS_statfs                     (__SYS_readdir + 4)
 
+#if defined(CONFIG_FS_SPLICE)
+#define SYS_splice                     (__SYS_readdir + 5)
+#define SYS_tee                        (__SYS_readdir + 6)
+#define __SYS_vectored                 (__SYS_readdir + 7)
+#else
+#define __SYS_vectored                 (__SYS_readdir + 5)
+#endif
+
+#if defined(CONFIG_FS_VECTORED_IO)
+#define SYS_readv                      (__SYS_vectored + 0)
+#define SYS_writev                     (__SYS_vectored + 1)
+#define __SYS_streams                  (__SYS_vectored + 2)
+#else
+#define __SYS_streams                  __SYS_vectored
+#endif
+
 #if CONFIG_NFILE_STREAMS > 0
-#define SYS_fs_fdopen                  (__SYS_readdir + 5)
-#define SYS_sched_getstreams           (__SYS_readdir + 6)
-#define __SYS_mountpoint               (__SYS_readdir + 7)
+#define SYS_fs_fdopen                  (__SYS_streams + 0)
+#define SYS_sched_getstreams           (__SYS_streams + 1)
+#define __SYS_mountpoint               (__SYS_streams + 2)
 #else
-#define __SYS_mountpoint               (__SYS_readdir + 5)
+#define __SYS_mountpoint               __SYS_streams
 #endif
 
 #if !defined(CONFIG_DISABLE_MOUNTPOINT)
@@ -442,7 +472,15 @@
 #define SYS_mq_timedreceive            (__SYS_mqueue + 7)
 #define SYS_mq_timedsend               (__SYS_mqueue + 8)
 #define SYS_mq_unlink                  (__SYS_mqueue + 9)
+#ifdef CONFIG_MQ_ZEROCOPY
+#define SYS_mq_buf_alloc               (__SYS_mqueue + 10)
+#define SYS_mq_buf_free                (__SYS_mqueue + 11)
+#define SYS_mq_receive_buf             (__SYS_mqueue + 12)
+#define SYS_mq_send_buf                (__SYS_mqueue + 13)
+#define __SYS_environ                  (__SYS_mqueue + 14)
+#else
 #define __SYS_environ                  (__SYS_mqueue + 10)
+#endif
 #else
 #define __SYS_environ                  __SYS_mqueue
 #endif
@@ -64,6 +64,9 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <semaphore.h>
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+#include <arch/spinlock.h>
+#endif
 #endif
 
 /****************************************************************************
@@ -407,6 +410,10 @@ struct pthread_mutex_s {
 	uint8_t type;                   /* Type of the mutex.  See PTHREAD_MUTEX_* definitions */
 	int nlocks;                     /* The number of recursive locks held */
 #endif
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+	volatile spinlock_t lockword;   /* Lock state of an adaptive mutex */
+	volatile uint16_t waiters;      /* Threads sleeping on sem for an adaptive mutex */
+#endif
 };
 typedef struct pthread_mutex_s pthread_mutex_t;
 
@@ -435,11 +442,10 @@ typedef bool pthread_once_t;
  * @brief Structure of pthread rwlock
  */
 struct pthread_rwlock_s {
-	pthread_mutex_t lock;
-	pthread_cond_t cv;
-	unsigned int num_readers;
-	unsigned int num_writers;
-	bool write_in_progress;
+	volatile uint32_t state;	/* Number of active readers and writer bit */
+	volatile pid_t writer;		/* Thread holding the write lock or -1 */
+	sem_t wlock;				/* Held by the writer, waiters are queued here */
+	sem_t rdrain;				/* Posted when the last reader leaves a writer */
 };
 typedef struct pthread_rwlock_s pthread_rwlock_t;
 
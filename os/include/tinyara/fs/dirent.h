@@ -174,6 +174,9 @@ struct fs_dirent_s {
 #ifdef CONFIG_FS_LITTLEFS
 		FAR void *littlefs;
 #endif
+#ifdef CONFIG_FS_OVERLAY
+		FAR void *overlay;
+#endif
 #endif							/* !CONFIG_DISABLE_MOUNTPOINT */
 	} u;
 
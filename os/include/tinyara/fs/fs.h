@@ -103,6 +103,10 @@
 #define TMPFS_MOUNT_POINT "/tmp"
 #endif
 #endif
+
+#ifdef CONFIG_FS_OVERLAY
+#define OVERLAY_FSTYPE "overlayfs"
+#endif
 #ifdef NXFUSE_HOST_BUILD
 #define  O_WROK    1
 #define  O_RDOK    2
@@ -119,6 +123,7 @@
 struct file;					/* Forward reference */
 struct pollfd;					/* Forward reference */
 struct inode;					/* Forward reference */
+struct iovec;					/* Forward reference */
 
 struct file_operations {
 	/* The device driver open method differs from the mountpoint open method */
@@ -142,6 +147,15 @@ struct file_operations {
 	int (*poll)(FAR struct file *filep, struct pollfd *fds, bool setup);
 #endif
 	int (*unlink)(FAR struct inode *inode);
+
+	/* Optional scatter/gather transfers, file_readv() and file_writev()
+	 * fall back to one read or write per buffer without them.
+	 */
+
+#ifdef CONFIG_FS_VECTORED_IO
+	ssize_t (*readv)(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt);
+	ssize_t (*writev)(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt);
+#endif
 };
 
 /* This structure provides information about the state of a block driver */
@@ -236,6 +250,13 @@ struct mountpt_operations {
 	int (*rename)(FAR struct inode *mountpt, FAR const char *oldrelpath, FAR const char *newrelpath);
 	int (*stat)(FAR struct inode *mountpt, FAR const char *relpath, FAR struct stat *buf);
 
+	/* Optional scatter/gather transfers on an open file */
+
+#ifdef CONFIG_FS_VECTORED_IO
+	ssize_t (*readv)(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt);
+	ssize_t (*writev)(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt);
+#endif
+
 	/* NOTE:  More operations will be needed here to support:  disk usage
 	 * stats file stat(), file attributes, file truncation, etc.
 	 */
@@ -921,6 +942,23 @@ ssize_t file_pread(FAR struct file *filep, FAR void *buf, size_t nbytes, off_t o
 ssize_t file_pwrite(FAR struct file *filep, FAR const void *buf, size_t nbytes, off_t offset);
 #endif
 
+/* fs/fs_readv.c, fs/fs_writev.c ********************************************/
+/****************************************************************************
+ * Name: file_readv / file_writev
+ *
+ * Description:
+ *   Equivalent to the standard readv() and writev() functions except that
+ *   they accept a struct file instance instead of a file descriptor and
+ *   return a negated errno value on failure.  The transfer is handed to the
+ *   readv or writev method of the driver or file system when it has one.
+ *
+ ****************************************************************************/
+
+#if CONFIG_NFILE_DESCRIPTORS > 0 && defined(CONFIG_FS_VECTORED_IO)
+ssize_t file_readv(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt);
+ssize_t file_writev(FAR struct file *filep, FAR const struct iovec *iov, int iovcnt);
+#endif
+
 /* fs/fs_lseek.c ************************************************************/
 /****************************************************************************
  * Name: file_seek
@@ -1027,6 +1065,22 @@ int file_poll(FAR struct file *filep, FAR struct pollfd *fds, bool setup);
 
 int fdesc_poll(int fd, FAR struct pollfd *fds, bool setup);
 
+/* fs/vfs/fs_epoll.c ********************************************************/
+/****************************************************************************
+ * Name: epoll_fdclose
+ *
+ * Description:
+ *   Called before the descriptor 'fd' of the file list 'list' is closed to
+ *   remove it from the interest lists of all epoll instances.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_FS_EPOLL
+void epoll_fdclose(FAR struct filelist *list, int fd);
+#else
+#define epoll_fdclose(list, fd)
+#endif
+
 /* fs/driver/block/fs_blockproxy.c ******************************************/
 /****************************************************************************
  * Name: unique_chardev_initialize
@@ -1171,6 +1225,52 @@ ssize_t bchlib_write(FAR void *handle, FAR const char *buffer, size_t offset, si
 
 void pipe_initialize(void);
 
+#if defined(CONFIG_PIPES) && defined(CONFIG_FS_SPLICE)
+/* drivers/pipes/pipe_common.c **********************************************/
+
+/* A splice sink consumes, or a splice source produces, up to 'len' bytes
+ * directly in the ring buffer of a pipe and returns how many it handled, 0
+ * at its end of file, or a negated errno value.
+ */
+
+typedef ssize_t (*pipe_splice_t)(FAR void *arg, FAR uint8_t *buf, size_t len);
+
+/****************************************************************************
+ * Name: pipecommon_ispipe
+ *
+ * Description:
+ *   Return true if 'filep' is an open pipe or FIFO.
+ *
+ ****************************************************************************/
+
+bool pipecommon_ispipe(FAR struct file *filep);
+
+/****************************************************************************
+ * Name: pipecommon_splice_read / pipecommon_splice_write
+ *
+ * Description:
+ *   Move data between the ring buffer of a pipe and a sink or source
+ *   without an intermediate buffer.  'peek' leaves the data in the pipe.
+ *   Return the number of bytes moved, 0 at end of file, or a negated errno
+ *   value.
+ *
+ ****************************************************************************/
+
+ssize_t pipecommon_splice_read(FAR struct file *filep, pipe_splice_t sink, FAR void *arg, size_t len, bool peek, bool nonblock);
+ssize_t pipecommon_splice_write(FAR struct file *filep, pipe_splice_t source, FAR void *arg, size_t len, bool nonblock);
+
+/****************************************************************************
+ * Name: pipecommon_splice
+ *
+ * Description:
+ *   Copy data from one pipe to another, ring to ring.  'peek' leaves the
+ *   data in the input pipe.
+ *
+ ****************************************************************************/
+
+ssize_t pipecommon_splice(FAR struct file *infilep, FAR struct file *outfilep, size_t len, bool peek, bool nonblock);
+#endif
+
 #undef EXTERN
 #if defined(__cplusplus)
 }
@@ -88,6 +88,21 @@
 #define CONFIG_MTD_REGISTRATION   1
 #endif
 
+/* Buffers handed to bread()/bwrite() by the MTD layers are allocated with
+ * mtd_dma_alloc() so that a DMA-capable flash driver can use them in place.
+ * The caller includes tinyara/kmalloc.h.
+ */
+
+#if defined(CONFIG_MTD_DMA_ALIGNMENT) && CONFIG_MTD_DMA_ALIGNMENT > 1
+#define MTD_DMA_ALIGNUP(n)     (((n) + CONFIG_MTD_DMA_ALIGNMENT - 1) & ~(CONFIG_MTD_DMA_ALIGNMENT - 1))
+#define MTD_DMA_ALIGNED(p)     (((uintptr_t)(p) & (CONFIG_MTD_DMA_ALIGNMENT - 1)) == 0)
+#define mtd_dma_alloc(n)       kmm_memalign(CONFIG_MTD_DMA_ALIGNMENT, MTD_DMA_ALIGNUP(n))
+#else
+#define MTD_DMA_ALIGNUP(n)     (n)
+#define MTD_DMA_ALIGNED(p)     (true)
+#define mtd_dma_alloc(n)       kmm_malloc(n)
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
@@ -34,6 +34,22 @@
 #define LOGDUMP_SAVE_START	"1"
 #define LOGDUMP_SAVE_STOP	"2"
 #define LOGDUMP_GET_SIZE    	"3"
+#define LOGDUMP_STORE_QUERY	"4"
+
+/* Severities found in the logs of a stored block */
+
+#define LOGDUMP_SEV_INFO	0x01	/* Any log */
+#define LOGDUMP_SEV_WARN	0x02	/* "warn" */
+#define LOGDUMP_SEV_ERROR	0x04	/* "error" or "fail" */
+#define LOGDUMP_SEV_CRASH	0x08	/* "assert" or "panic" */
+
+/* Query of the flash store, with the boots back (0 for this boot), the
+ * seconds before the newest log of that boot (0 for all) and the
+ * LOGDUMP_SEV_* to match (0 for all).  The reads after the query return
+ * the matching compressed blocks, until a read returns 0.
+ */
+
+#define LOGDUMP_STORE_QUERY_FMT	LOGDUMP_STORE_QUERY " %d %u %u"
 
 /********************************************************************************
  * Public Types
@@ -46,5 +62,6 @@
 #define START_LOGDUMP_SAVE(fd)		write(fd, LOGDUMP_SAVE_START, strlen(LOGDUMP_SAVE_START) + 1)
 #define STOP_LOGDUMP_SAVE(fd)		write(fd, LOGDUMP_SAVE_STOP, strlen(LOGDUMP_SAVE_STOP) + 1)
 #define GET_LOGDUMP_SIZE(fd)        	write(fd, LOGDUMP_GET_SIZE, strlen(LOGDUMP_GET_SIZE) + 1)
+#define QUERY_LOGDUMP_STORE(fd, query)	write(fd, query, strlen(query) + 1)
 #define READ_LOGDUMP(fd, buf, bufsize)	read(fd, buf, bufsize)
 #define CLOSE_LOGDUMP(fd)		close(fd)
@@ -22,6 +22,16 @@
 /****************************************************************************
  * Included Files
  ****************************************************************************/
+
+#include <tinyara/config.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+/* Digits of the size in front of each compressed block read */
+
+#define LOGDUMP_STORE_PREFIXSZ	4
+
 /****************************************************************************
  * Description:
  *   This is used to save each character to log buffer
@@ -64,4 +74,18 @@ int log_dump_get_size(void);
  ****************************************************************************/
 int log_dump(int argc, char *argv[]);
 
+#ifdef CONFIG_LOG_DUMP_STORE
+/****************************************************************************
+ * Description:
+ *   Flash store of the compressed blocks, see log_dump_store.c
+ *
+ ****************************************************************************/
+int log_dump_store_init(void);
+int log_dump_store_append(FAR const uint8_t *data, size_t size, uint32_t first_ms, uint32_t last_ms, uint8_t sevmask);
+int log_dump_store_sync(void);
+int log_dump_store_query(int bootback, uint32_t seconds, uint8_t sevmask);
+bool log_dump_store_active(void);
+size_t log_dump_store_read(FAR char *buffer, size_t buflen);
+#endif
+
 #endif							/* __LOG_DUMP_INTERNAL_H */
@@ -348,6 +348,20 @@ struct heapinfo_tcb_info_s {
 	int num_alloc_free;
 };
 typedef struct heapinfo_tcb_info_s heapinfo_tcb_info_t;
+
+/* Usage of one heap taken from the running counters, without a heap walk */
+
+struct heapinfo_usage_s {
+	size_t heap_size;
+	size_t curr_alloc_size;
+	size_t peak_alloc_size;
+	size_t free_size;
+	size_t largest_free_size;
+	size_t stack_size;		/* Stacks of the threads */
+	size_t alive_size;		/* Heap of the alive threads, without stacks */
+	size_t dead_size;		/* Allocated by dead threads or in interrupt context */
+	int alloc_count;		/* Number of alive allocations */
+};
 #ifdef CONFIG_HEAPINFO_USER_GROUP
 struct heapinfo_group_info_s {
 	int pid;
@@ -357,6 +371,7 @@ struct heapinfo_group_info_s {
 
 struct heapinfo_group_s {
 	int curr_size;
+	int curr_stack_size;		/* Sum of the stacks of the alive threads in group */
 	int peak_size;
 	int stack_size;
 	int heap_size;
@@ -396,6 +411,8 @@ struct mm_heap_s {
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 	size_t peak_alloc_size;
 	size_t total_alloc_size;
+	size_t stack_alloc_size;	/* Part of total_alloc_size used for stacks */
+	int total_alloc_count;		/* Number of alive allocations */
 #ifdef CONFIG_HEAPINFO_USER_GROUP
 	int max_group;
 	struct heapinfo_group_s group[HEAPINFO_USER_GROUP_NUM];
@@ -738,10 +755,13 @@ void heapinfo_exclude_stacksize(void *stack_ptr);
 void heapinfo_peak_init(struct mm_heap_s *heap);
 void heapinfo_dealloc_tcbinfo(void *address, pid_t pid);
 void heapinfo_dump_heap(struct mm_heap_s *heap);
+int heapinfo_get_tcbinfo(struct mm_heap_s *heap, pid_t pid, heapinfo_tcb_info_t *info);
+void heapinfo_get_usage(struct mm_heap_s *heap, struct heapinfo_usage_s *usage);
 #ifdef CONFIG_HEAPINFO_USER_GROUP
 void heapinfo_update_group(mmsize_t size, pid_t pid);
 void heapinfo_update_group_info(pid_t pid, int group, int type);
 void heapinfo_check_group_list(pid_t pid, char *name);
+int heapinfo_find_group(pid_t pid);
 #endif
 #endif
 void mm_is_sem_available(void *address);
@@ -752,6 +772,7 @@ struct mm_heap_s *mm_get_heap_with_index(int index);
 
 int mm_get_index_of_heap(void *mem);
 size_t mm_get_largest_freenode_size(void);
+size_t mm_get_largest_freesize_from_specific_heap(struct mm_heap_s *heap);
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
 size_t mm_get_heap_free_size(void);
 #endif
@@ -591,6 +591,9 @@ struct tcb_s {
 	int timeslice;				/* RR timeslice interval remaining     */
 #endif
 	FAR struct wdog_s *waitdog;	/* All timed waits used this wdog      */
+#ifdef CONFIG_WDOG_TIMER_SLACK
+	uint16_t timer_slack;		/* Tolerated watchdog delay in ticks   */
+#endif
 
 	/* Stack-Related Fields ****************************************************** */
 
@@ -617,6 +620,9 @@ struct tcb_s {
 	/* POSIX Semaphore Control Fields ******************************************** */
 
 	sem_t *waitsem;				/* Semaphore ID waiting on             */
+#ifdef SAVE_SEM_HOLDER
+	FAR struct semholder_s *holdsem;	/* Semaphore counts held by thread */
+#endif
 
 	/* POSIX Signal Control Fields *********************************************** */
 
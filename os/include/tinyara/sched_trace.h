@@ -0,0 +1,198 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __INCLUDE_TINYARA_SCHED_TRACE_H
+#define __INCLUDE_TINYARA_SCHED_TRACE_H
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Event types.  The arg field of each event is described next to it. */
+
+#define SCHED_TRACE_SWITCH       1	/* pid starts running, arg: previous pid | priority << 16 */
+#define SCHED_TRACE_IRQ_ENTER    2	/* arg: irq number */
+#define SCHED_TRACE_IRQ_LEAVE    3	/* arg: irq number */
+#define SCHED_TRACE_SEM_WAIT     4	/* pid blocks on a semaphore, arg: semaphore address */
+#define SCHED_TRACE_SEM_WAKE     5	/* pid is given a semaphore, arg: semaphore address */
+#define SCHED_TRACE_MQ_WAITRECV  6	/* pid blocks on an empty queue, arg: queue address */
+#define SCHED_TRACE_MQ_WAITSEND  7	/* pid blocks on a full queue, arg: queue address */
+#define SCHED_TRACE_MQ_WAKE      8	/* pid is woken up by a queue, arg: queue address */
+
+#ifdef CONFIG_SMP
+#define SCHED_TRACE_NCPUS        CONFIG_SMP_NCPUS
+#else
+#define SCHED_TRACE_NCPUS        1
+#endif
+
+#ifndef CONFIG_SCHED_TRACE_NEVENTS
+#define CONFIG_SCHED_TRACE_NEVENTS 512
+#endif
+
+/* Timestamps count up_trace_timestamp() ticks if the architecture has a
+ * free running counter, system timer ticks otherwise.
+ */
+
+#ifdef CONFIG_ARCH_HAVE_TRACE_TIMESTAMP
+#define SCHED_TRACE_TIMESTAMP_FREQ CONFIG_ARCH_TRACE_TIMESTAMP_FREQ
+#else
+#define SCHED_TRACE_TIMESTAMP_FREQ CLOCKS_PER_SEC
+#endif
+
+/****************************************************************************
+ * Public Types
+ ****************************************************************************/
+
+/* One trace record, kept small so that a few hundred of them per CPU fit
+ * in a couple of KB.
+ */
+
+struct sched_trace_event_s {
+	uint32_t time;				/* Timestamp, see SCHED_TRACE_TIMESTAMP_FREQ */
+	uint32_t arg;				/* Event specific argument */
+	int16_t pid;				/* Task the event is about */
+	uint8_t type;				/* One of SCHED_TRACE_* */
+	uint8_t cpu;				/* CPU that recorded the event */
+};
+
+/****************************************************************************
+ * Public Function Prototypes
+ ****************************************************************************/
+
+#ifdef __cplusplus
+#define EXTERN extern "C"
+extern "C" {
+#else
+#define EXTERN extern
+#endif
+
+#ifdef CONFIG_SCHED_TRACE
+
+struct tcb_s;
+
+/****************************************************************************
+ * Name: sched_trace_add
+ *
+ * Description:
+ *   Append an event to the trace buffer of the calling CPU, overwriting the
+ *   oldest event when the buffer is full.  May be called from interrupt
+ *   handlers.  Normally used through the sched_trace_* hooks below, which
+ *   compile to nothing when the event class is not configured.
+ *
+ ****************************************************************************/
+
+void sched_trace_add(uint8_t type, pid_t pid, uint32_t arg);
+
+/****************************************************************************
+ * Name: sched_trace_switch
+ *
+ * Description:
+ *   Record that tcb is about to run on the calling CPU.  Calls for the task
+ *   that is already running are ignored, so the architecture may report a
+ *   switch from more than one place.
+ *
+ ****************************************************************************/
+
+void sched_trace_switch(FAR struct tcb_s *tcb);
+
+/****************************************************************************
+ * Name: sched_trace_enable
+ *
+ * Description:
+ *   Start or stop recording.  Recording starts at boot.
+ *
+ ****************************************************************************/
+
+void sched_trace_enable(bool enable);
+
+/****************************************************************************
+ * Name: sched_trace_snapshot
+ *
+ * Description:
+ *   Copy the events recorded by one CPU, oldest first.  Events that are
+ *   overwritten while they are copied are left out.
+ *
+ * Input Parameters:
+ *   cpu     - The CPU whose buffer is copied
+ *   events  - Destination for up to CONFIG_SCHED_TRACE_NEVENTS events
+ *   total   - Returns the number of events recorded since boot, so that the
+ *             caller can tell how many were lost
+ *
+ * Returned Value:
+ *   The number of events copied.
+ *
+ ****************************************************************************/
+
+int sched_trace_snapshot(int cpu, FAR struct sched_trace_event_s *events, FAR uint32_t *total);
+
+#ifdef CONFIG_ARCH_HAVE_TRACE_TIMESTAMP
+/* Provided by the architecture: a free running counter that counts at
+ * CONFIG_ARCH_TRACE_TIMESTAMP_FREQ.
+ */
+
+uint32_t up_trace_timestamp(void);
+#endif
+
+#else
+#define sched_trace_add(type, pid, arg)
+#define sched_trace_switch(tcb)
+#endif							/* CONFIG_SCHED_TRACE */
+
+#ifdef CONFIG_SCHED_TRACE_IRQ
+#define sched_trace_irq_enter(irq)      sched_trace_add(SCHED_TRACE_IRQ_ENTER, 0, irq)
+#define sched_trace_irq_leave(irq)      sched_trace_add(SCHED_TRACE_IRQ_LEAVE, 0, irq)
+#else
+#define sched_trace_irq_enter(irq)
+#define sched_trace_irq_leave(irq)
+#endif
+
+#ifdef CONFIG_SCHED_TRACE_SEMAPHORE
+#define sched_trace_sem_wait(tcb, sem)  sched_trace_add(SCHED_TRACE_SEM_WAIT, (tcb)->pid, (uint32_t)(uintptr_t)(sem))
+#define sched_trace_sem_wake(tcb, sem)  sched_trace_add(SCHED_TRACE_SEM_WAKE, (tcb)->pid, (uint32_t)(uintptr_t)(sem))
+#else
+#define sched_trace_sem_wait(tcb, sem)
+#define sched_trace_sem_wake(tcb, sem)
+#endif
+
+#ifdef CONFIG_SCHED_TRACE_MQUEUE
+#define sched_trace_mq_waitrecv(tcb, mq) sched_trace_add(SCHED_TRACE_MQ_WAITRECV, (tcb)->pid, (uint32_t)(uintptr_t)(mq))
+#define sched_trace_mq_waitsend(tcb, mq) sched_trace_add(SCHED_TRACE_MQ_WAITSEND, (tcb)->pid, (uint32_t)(uintptr_t)(mq))
+#define sched_trace_mq_wake(tcb, mq)     sched_trace_add(SCHED_TRACE_MQ_WAKE, (tcb)->pid, (uint32_t)(uintptr_t)(mq))
+#else
+#define sched_trace_mq_waitrecv(tcb, mq)
+#define sched_trace_mq_waitsend(tcb, mq)
+#define sched_trace_mq_wake(tcb, mq)
+#endif
+
+#undef EXTERN
+#ifdef __cplusplus
+}
+#endif
+
+#endif							/* __INCLUDE_TINYARA_SCHED_TRACE_H */
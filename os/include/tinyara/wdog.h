@@ -91,6 +91,7 @@
 #define WDOGF_ALLOCED      (1 << 1)	/* Bit 1: 0=Pre-allocated, 1=Allocated */
 #define WDOGF_STATIC       (1 << 2)	/* Bit 2: 0=[Pre-]allocated, 1=Static */
 #define WDOGF_WAKEUP       (1 << 3)	/* Bit 3: 1=Watchdog is registered as a power management wakeup source */
+#define WDOGF_SLACK        (1 << 4)	/* Bit 4: 1=Watchdog has its own timer slack */
 
 #define WDOG_SETACTIVE(w)  do { (w)->flags |= WDOGF_ACTIVE; } while (0)
 #define WDOG_SETALLOCED(w) do { (w)->flags |= WDOGF_ALLOCED; } while (0)
@@ -149,6 +150,9 @@ typedef CODE void (*wdentry_t)(int argc, uint32_t arg1, ...);
 
 struct wdog_s {
 	FAR struct wdog_s *next;	/* Support for singly linked lists. */
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	FAR struct wdog_s *prev;	/* Timing wheel slots are doubly linked */
+#endif
 	wdentry_t func;				/* Function to execute when delay expires */
 #ifdef CONFIG_PIC
 	FAR void *picbase;			/* PIC base address */
@@ -156,10 +160,26 @@ struct wdog_s {
 #ifdef CONFIG_DEBUG
 	int pid;					/* The pid of process which creates wdog timer */
 #endif
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	uint32_t expire;			/* Tick at which the watchdog expires */
+	uint16_t slot;				/* Timing wheel slot holding the watchdog */
+#else
 	int lag;					/* Timer associated with the delay */
+#endif
 	uint8_t flags;				/* See WDOGF_* definitions above */
 	uint8_t argc;				/* The number of parameters to pass */
 	uint32_t parm[CONFIG_MAX_WDOGPARMS];
+#ifdef CONFIG_WDOG_TIMER_SLACK
+	uint16_t slack;				/* Own timer slack in ticks, see WDOGF_SLACK */
+#endif
+};
+
+/* Counters of watchdog expirations, see wd_getstats() */
+
+struct wdog_stats_s {
+	uint32_t wakeups;			/* Timer events that expired watchdogs */
+	uint32_t expired;			/* Watchdogs expired */
+	uint32_t coalesced;			/* Watchdogs moved to share an expiry */
 };
 
 /* Watchdog 'handle' */
@@ -190,6 +210,10 @@ int wd_gettime(WDOG_ID wdog);
 int wd_setwakeupsource(WDOG_ID wdog);
 clock_t wd_getwakeupdelay(void);
 #endif
+#ifdef CONFIG_WDOG_TIMER_SLACK
+int wd_setslack(WDOG_ID wdog, int slack);
+#endif
+void wd_getstats(FAR struct wdog_stats_s *stats);
 
 #undef EXTERN
 #ifdef __cplusplus
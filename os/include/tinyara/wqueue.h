@@ -287,7 +287,27 @@ struct work_s {
 	FAR void *arg;				/* Callback argument */
 	clock_t qtime;			/* Time work queued */
 	clock_t delay;			/* Delay until work performed */
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+	int8_t cpu;					/* CPU whose deque gets the work when it is ready */
+#endif
+};
+
+/* Statistics of one kernel work queue, or of the deque of one CPU when the
+ * low priority queue steals work.  Latencies are in clock ticks from the
+ * time the work is ready to the time its worker starts it.
+ */
+
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+struct work_stats_s {
+	uint32_t queued;			/* Work items that became pending */
+	uint32_t executed;			/* Work items that were run */
+	uint32_t stolen;			/* Work items run by a worker of another CPU */
+	uint16_t depth;				/* Work items pending now */
+	uint16_t maxdepth;			/* Most work items ever pending */
+	uint32_t latency;			/* Sum of the latencies of the work run */
+	uint32_t maxlatency;		/* Largest latency */
 };
+#endif
 
 /****************************************************************************
  * Public Data
@@ -392,6 +412,29 @@ int work_lpstart(void);
 
 int work_queue(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay);
 
+/****************************************************************************
+ * Name: work_queue_cpu
+ *
+ * Description:
+ *   Queue work like work_queue(), with a hint on the CPU that should run
+ *   it.  With CONFIG_SCHED_LPWORK_STEALING, low priority work goes to the
+ *   deque of that CPU, where an idle worker of another CPU may still steal
+ *   it; work_queue() uses the CPU of the caller.  The hint is ignored
+ *   otherwise.
+ *
+ * Input parameters:
+ *   qid, work, worker, arg, delay - As for work_queue()
+ *   cpu    - The preferred CPU, or WORK_CPU_ANY
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+#define WORK_CPU_ANY (-1)
+
+int work_queue_cpu(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay, int cpu);
+
 /****************************************************************************
  * Name: work_cancel
  *
@@ -491,6 +534,27 @@ void lpwork_boostpriority(uint8_t reqprio);
 void lpwork_restorepriority(uint8_t reqprio);
 #endif
 
+/****************************************************************************
+ * Name: work_getstats
+ *
+ * Description:
+ *   Get the statistics of a kernel work queue.
+ *
+ * Parameters:
+ *   qid   - HPWORK or LPWORK
+ *   cpu   - The CPU whose deque is reported when the low priority queue
+ *           steals work, ignored otherwise
+ *   stats - Receives the statistics
+ *
+ * Return Value:
+ *   Zero on success, -EINVAL for an unknown queue or CPU
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+int work_getstats(int qid, int cpu, FAR struct work_stats_s *stats);
+#endif
+
 /****************************************************************************
  * Name: work_get_current
  *
@@ -699,8 +699,10 @@ void binary_manager_release_binary_sem(int bin_idx)
 		bmdbg("g_sem_list is empty.\n");
 	} else {
 		do {
+			/* The built-in holder first, then the allocated ones */
+
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-			for (holder = sem->hhead; holder; holder = holder->flink)
+			for (holder = &sem->holder; holder; holder = (holder == &sem->holder) ? sem->hhead : holder->flink)
 #else
 			holder = &sem->holder;
 #endif
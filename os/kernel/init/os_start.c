@@ -520,6 +520,12 @@ void os_start(void)
 		                          TCB_FLAG_NONCANCELABLE);
 #endif
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+		/* The IDLE task passes the default timer slack on to all tasks */
+
+		g_idletcb[i].cmn.timer_slack = WDOG_USEC2SLACK(CONFIG_WDOG_TIMER_SLACK_DEFAULT);
+#endif
+
 #if CONFIG_TASK_NAME_SIZE > 0
 		/* Set the IDLE task name */
 
@@ -551,7 +557,11 @@ void os_start(void)
 #else
 		tasklist = TLIST_HEAD(TSTATE_TASK_RUNNING);
 #endif
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+		sched_addprioritized(&g_idletcb[i].cmn, tasklist);
+#else
 		dq_addfirst((FAR dq_entry_t *)&g_idletcb[i], tasklist);
+#endif
 
 		/* Mark the idle task as the running task */
 
@@ -59,6 +59,7 @@
 #include <debug.h>
 #include <tinyara/arch.h>
 #include <tinyara/irq.h>
+#include <tinyara/sched_trace.h>
 
 #include "irq/irq.h"
 
@@ -128,5 +129,7 @@ void irq_dispatch(int irq, FAR void *context)
 
 	/* Then dispatch to the interrupt handler */
 
+	sched_trace_irq_enter(irq);
 	vector(irq, context, arg);
+	sched_trace_irq_leave(irq);
 }
@@ -80,6 +80,24 @@ struct log_dump_msg_s {
       bool comp;
 };
 
+#ifdef CONFIG_LOG_DUMP_STORE
+/* Time range and severities of the logs in an uncompressed buffer */
+
+struct log_dump_bufinfo_s {
+	uint32_t first_ms;
+	uint32_t last_ms;
+	uint8_t sevmask;
+};
+
+/* Word that marks a severity, and how far the logs match it now */
+
+struct log_dump_sevword_s {
+	FAR const char *word;
+	uint8_t sevmask;
+	uint8_t matched;
+};
+#endif
+
 /* log_dump_chunk_s is the compressed data node */
 struct log_dump_chunk_s {
 	struct log_dump_chunk_s *flink;
@@ -119,10 +137,50 @@ static size_t last_comp_block_size;
 static int last_comp_block_ptr;
 static bool compress_last_block;
 
+#ifdef CONFIG_LOG_DUMP_STORE
+static struct log_dump_bufinfo_s uncomp_info[CONFIG_LOG_DUMP_NUMBUFS];
+static struct log_dump_sevword_s sev_words[] = {
+	{"warn", LOGDUMP_SEV_WARN, 0},
+	{"error", LOGDUMP_SEV_ERROR, 0},
+	{"fail", LOGDUMP_SEV_ERROR, 0},
+	{"assert", LOGDUMP_SEV_CRASH, 0},
+	{"panic", LOGDUMP_SEV_CRASH, 0},
+};
+#endif
+
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
 
+#ifdef CONFIG_LOG_DUMP_STORE
+/* Track the time and the severity words of the logs saved in a buffer */
+
+static void log_dump_track(struct log_dump_bufinfo_s *info, char ch)
+{
+	struct log_dump_sevword_s *sev;
+
+	if (uncomp_curbytes == 0) {
+		info->first_ms = TICK2MSEC(clock_systimer());
+		info->sevmask = LOGDUMP_SEV_INFO;
+	}
+
+	if (ch >= 'A' && ch <= 'Z') {
+		ch += 'a' - 'A';
+	}
+
+	for (sev = sev_words; sev < &sev_words[sizeof(sev_words) / sizeof(sev_words[0])]; sev++) {
+		if (ch == sev->word[sev->matched]) {
+			if (sev->word[++sev->matched] == '\0') {
+				info->sevmask |= sev->sevmask;
+				sev->matched = 0;
+			}
+		} else {
+			sev->matched = (ch == sev->word[0]);
+		}
+	}
+}
+#endif
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -289,8 +347,22 @@ int log_dump_set(FAR const char *buffer, size_t buflen)
 			/* Should we return error from here?? because partially filled uncompressed buffer
 			 * might not be compressed but log_dump save has stopped now, so operation is success */
 		}
+#ifdef CONFIG_LOG_DUMP_STORE
+		(void)log_dump_store_sync();
+#endif
 	} else if (strncmp(buffer, LOGDUMP_GET_SIZE, strlen(LOGDUMP_GET_SIZE) + 1) == 0) {
 		return log_dump_get_size();
+#ifdef CONFIG_LOG_DUMP_STORE
+	} else if (strncmp(buffer, LOGDUMP_STORE_QUERY, strlen(LOGDUMP_STORE_QUERY)) == 0 && (buffer[strlen(LOGDUMP_STORE_QUERY)] == ' ' || buffer[strlen(LOGDUMP_STORE_QUERY)] == '\0')) {
+		FAR char *arg = (FAR char *)&buffer[strlen(LOGDUMP_STORE_QUERY)];
+		int bootback = (int)strtol(arg, &arg, 10);
+		uint32_t seconds = (uint32_t)strtoul(arg, &arg, 10);
+		uint8_t sevmask = (uint8_t)strtoul(arg, &arg, 10);
+
+		if (bootback < 0 || log_dump_store_query(bootback, seconds, sevmask) != OK) {
+			return LOG_DUMP_OPT_FAIL;
+		}
+#endif
 	} else {
 		return LOG_DUMP_OPT_FAIL;
 	}
@@ -491,9 +563,15 @@ int log_dump_save(char ch)
 	 * accept any more data into the uncompress buffer.
 	 */
 	if (!uncomp_buf_full[uncomp_idx]) {
+#ifdef CONFIG_LOG_DUMP_STORE
+		log_dump_track(&uncomp_info[uncomp_idx], ch);
+#endif
 		uncomp_buf[uncomp_idx][uncomp_curbytes] = ch;
 		uncomp_curbytes++;
 		if (uncomp_curbytes == CONFIG_LOG_DUMP_CHUNK_SIZE) {
+#ifdef CONFIG_LOG_DUMP_STORE
+			uncomp_info[uncomp_idx].last_ms = TICK2MSEC(clock_systimer());
+#endif
 			uncomp_curbytes = 0;	/* reset */
 			uncomp_buf_full[uncomp_idx] = true;
 			int temp = uncomp_idx++;
@@ -535,6 +613,14 @@ size_t log_dump_read(FAR char *buffer, size_t buflen)
 {
 	size_t ret = 0;
 
+#ifdef CONFIG_LOG_DUMP_STORE
+	/* After a query the reads return its blocks from flash */
+
+	if (log_dump_store_active()) {
+		return log_dump_store_read(buffer, buflen);
+	}
+#endif
+
 	sched_lock();	/* to ensure that the read is not disturbed by add_char */
 
 	while (ret < buflen) {
@@ -590,6 +676,15 @@ int log_dump(int argc, char *argv[])
 		return 0;
 	}
 
+#ifdef CONFIG_LOG_DUMP_STORE
+	/* Without the flash store the logs are still kept in RAM */
+
+	if (log_dump_store_init() != OK) {
+		ldpdbg("Fail to init log dump store\n");
+	}
+
+	struct log_dump_bufinfo_s info;
+#endif
 	int msg_compress;
 	int nbytes;
 
@@ -609,7 +704,19 @@ int log_dump(int argc, char *argv[])
 			if (compress_ret != LOG_DUMP_OK) {
 				ldpdbg("Fail to compress compress_ret = %d\n", compress_ret);
 			}
+#ifdef CONFIG_LOG_DUMP_STORE
+			/* The buffer is reused once the waiting logger is released */
+
+			info = uncomp_info[comp_idx];
+#endif
 			compress_full_block = false;
+#ifdef CONFIG_LOG_DUMP_STORE
+			/* out_buf stays as it is until the next request */
+
+			if (compress_ret == LOG_DUMP_OK) {
+				(void)log_dump_store_append(out_buf, writesize, info.first_ms, info.last_ms, info.sevmask);
+			}
+#endif
 		}
 	}
 }
@@ -0,0 +1,568 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <debug.h>
+#include <assert.h>
+#include <semaphore.h>
+
+#include <tinyara/kmalloc.h>
+#include <tinyara/fs/fs.h>
+#include <tinyara/log_dump/log_dump.h>
+#include <tinyara/log_dump/log_dump_internal.h>
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* The store is a ring of segments on flash.  A segment is written as a
+ * whole, always to the slot after the previous one, so every erase block
+ * of the partition is erased once per turn of the ring.  A segment holds
+ * the compressed blocks in records, each with the time range and severity
+ * of its logs, and its header sums them up for the whole segment.
+ *
+ * A segment that is synced before it is full is never rewritten in place:
+ * each copy goes to the other one of two adjacent slots, with a higher
+ * generation, and the older copy is dropped only after the new one is
+ * written.  A power loss during a sync so leaves the previous copy intact.
+ */
+
+#ifndef MIN
+#define MIN(a, b)		(((a) < (b)) ? (a) : (b))
+#endif
+
+#define STORE_SEGSIZE		CONFIG_LOG_DUMP_STORE_SEGMENT_SIZE
+#define STORE_NSEGS		(CONFIG_LOG_DUMP_STORE_SIZE / STORE_SEGSIZE)
+
+#define STORE_SEG_MAGIC		0x4d53444c	/* "LDSM" */
+#define STORE_REC_MAGIC		0x524c		/* "LR" */
+
+#define STORE_ALIGN(n)		(((n) + 3) & ~3)
+
+#if STORE_SEGSIZE < CONFIG_LOG_DUMP_CHUNK_SIZE + 64
+#error "CONFIG_LOG_DUMP_STORE_SEGMENT_SIZE cannot hold a compressed chunk"
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Segment header on flash, also kept in RAM for every segment as its index */
+
+struct log_dump_seghdr_s {
+	uint32_t magic;
+	uint32_t seq;				/* Increases with every new segment */
+	uint32_t first_ms;			/* Uptime of the oldest log in the segment */
+	uint32_t last_ms;			/* Uptime of the newest log in the segment */
+	uint16_t boot;				/* Boot the segment was written in */
+	uint8_t sevmask;			/* LOGDUMP_SEV_* of all records */
+	uint8_t gen;				/* Copy of the segment, the higher one is valid */
+	uint32_t used;				/* Bytes of records after the header */
+};
+
+/* Record header, followed by the compressed block padded to a word */
+
+struct log_dump_rechdr_s {
+	uint16_t magic;
+	uint16_t size;				/* Size of the compressed block */
+	uint8_t sevmask;
+	uint8_t reserved[3];
+	uint32_t first_ms;
+	uint32_t last_ms;
+};
+
+/* Position of a query in the store */
+
+struct log_dump_cursor_s {
+	bool active;
+	int nvisited;				/* Segments visited, the query ends at STORE_NSEGS */
+	int seg;					/* Segment read now */
+	uint32_t seq;				/* Its sequence number, to notice if it is rewritten */
+	uint32_t off;				/* Offset of the next record in the segment, 0 before the segment */
+	uint32_t rec_pos;			/* Flash offset of the rest of the current record */
+	uint32_t rec_left;			/* Bytes of the current record still to read */
+	char prefix[LOGDUMP_STORE_PREFIXSZ + 1];	/* Size prefix of the current record */
+	int prefix_pos;
+
+	/* Filter */
+
+	uint16_t boot;
+	uint32_t min_ms;
+	uint8_t sevmask;
+};
+
+struct log_dump_store_s {
+	bool ready;
+	sem_t lock;
+	struct file file;
+	FAR struct log_dump_seghdr_s *index;	/* Header of every segment */
+	FAR uint8_t *segbuf;		/* Segment filled now */
+	int wrseg;					/* Slot the segment filled now is written to next */
+	int cpseg;					/* Slot of its newest copy on flash, -1 if none */
+	uint32_t seq;
+	uint16_t boot;
+	bool dirty;					/* segbuf has records that are not on flash */
+	struct log_dump_cursor_s cursor;
+};
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+static struct log_dump_store_s g_store;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void store_lock(void)
+{
+	while (sem_wait(&g_store.lock) != OK) {
+		ASSERT(get_errno() == EINTR);
+	}
+}
+
+static void store_unlock(void)
+{
+	sem_post(&g_store.lock);
+}
+
+/* Start a new segment in the slot after the newest copy of the current one */
+
+static void store_newsegment(void)
+{
+	FAR struct log_dump_seghdr_s *hdr = (FAR struct log_dump_seghdr_s *)g_store.segbuf;
+
+	if (g_store.cpseg >= 0) {
+		g_store.wrseg = (g_store.cpseg + 1) % STORE_NSEGS;
+		g_store.cpseg = -1;
+	}
+
+	memset(g_store.segbuf, 0xff, STORE_SEGSIZE);
+	hdr->magic = STORE_SEG_MAGIC;
+	hdr->seq = g_store.seq++;
+	hdr->boot = g_store.boot;
+	hdr->sevmask = 0;
+	hdr->gen = 0;
+	hdr->used = 0;
+	g_store.dirty = false;
+}
+
+/****************************************************************************
+ * Name: store_writesegment
+ *
+ * Description:
+ *   Write the segment filled now to the slot wrseg, which never holds its
+ *   newest copy.  Once the write is complete the new copy replaces the old
+ *   one, whose slot takes the next copy.
+ *
+ ****************************************************************************/
+
+static int store_writesegment(void)
+{
+	FAR struct log_dump_seghdr_s *hdr = (FAR struct log_dump_seghdr_s *)g_store.segbuf;
+	ssize_t ret;
+	int next;
+
+	/* The old segment of the slot is lost from here on */
+
+	g_store.index[g_store.wrseg].magic = 0;
+
+	ret = file_pwrite(&g_store.file, g_store.segbuf, STORE_SEGSIZE, (off_t)g_store.wrseg * STORE_SEGSIZE);
+	if (ret != STORE_SEGSIZE) {
+		ldpdbg("Fail to write segment %d, ret %d\n", g_store.wrseg, ret);
+		return ret < 0 ? ret : -EIO;
+	}
+
+	g_store.index[g_store.wrseg] = *hdr;
+	if (g_store.cpseg >= 0) {
+		g_store.index[g_store.cpseg].magic = 0;
+		next = g_store.cpseg;
+	} else {
+		next = (g_store.wrseg + 1) % STORE_NSEGS;
+	}
+
+	g_store.cpseg = g_store.wrseg;
+	g_store.wrseg = next;
+	hdr->gen++;
+	g_store.dirty = false;
+	return OK;
+}
+
+static bool store_segmatch(FAR const struct log_dump_seghdr_s *hdr, FAR const struct log_dump_cursor_s *cur)
+{
+	return hdr->magic == STORE_SEG_MAGIC && hdr->boot == cur->boot && hdr->last_ms >= cur->min_ms && (cur->sevmask == 0 || (hdr->sevmask & cur->sevmask) != 0);
+}
+
+static void store_nextsegment(FAR struct log_dump_cursor_s *cur)
+{
+	cur->seg = (cur->seg + 1) % STORE_NSEGS;
+	cur->nvisited++;
+	cur->off = 0;
+}
+
+/****************************************************************************
+ * Name: store_nextrecord
+ *
+ * Description:
+ *   Move the cursor to the next record that passes the filter, reading only
+ *   the headers of the segments that may hold one.
+ *
+ ****************************************************************************/
+
+static bool store_nextrecord(FAR struct log_dump_cursor_s *cur)
+{
+	FAR struct log_dump_seghdr_s *hdr;
+	struct log_dump_rechdr_s rec;
+	off_t base;
+
+	while (cur->nvisited < STORE_NSEGS) {
+		hdr = &g_store.index[cur->seg];
+		if (cur->off == 0) {
+			if (!store_segmatch(hdr, cur)) {
+				store_nextsegment(cur);
+				continue;
+			}
+			cur->seq = hdr->seq;
+			cur->off = sizeof(struct log_dump_seghdr_s);
+		} else if (hdr->magic != STORE_SEG_MAGIC || hdr->seq != cur->seq) {
+			/* Rewritten since the query read its first records */
+
+			store_nextsegment(cur);
+			continue;
+		}
+
+		if (cur->off + sizeof(rec) > sizeof(struct log_dump_seghdr_s) + hdr->used) {
+			store_nextsegment(cur);
+			continue;
+		}
+
+		base = (off_t)cur->seg * STORE_SEGSIZE;
+		if (file_pread(&g_store.file, &rec, sizeof(rec), base + cur->off) != sizeof(rec) || rec.magic != STORE_REC_MAGIC) {
+			store_nextsegment(cur);
+			continue;
+		}
+
+		cur->rec_pos = base + cur->off + sizeof(rec);
+		cur->off += sizeof(rec) + STORE_ALIGN(rec.size);
+
+		if (rec.last_ms >= cur->min_ms && (cur->sevmask == 0 || (rec.sevmask & cur->sevmask) != 0)) {
+			cur->rec_left = rec.size;
+			snprintf(cur->prefix, sizeof(cur->prefix), "%04d", rec.size);
+			cur->prefix_pos = 0;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: log_dump_store_init
+ *
+ * Description:
+ *   Open the flash partition of the store and build the index from the
+ *   segment headers.  New segments go after the newest one found.
+ *
+ ****************************************************************************/
+
+int log_dump_store_init(void)
+{
+	FAR struct log_dump_seghdr_s *hdr;
+	FAR struct log_dump_seghdr_s *next;
+	uint32_t maxseq = 0;
+	uint16_t maxboot = 0;
+	bool found = false;
+	int newest = -1;
+	int ret;
+	int i;
+
+	ret = file_open(&g_store.file, CONFIG_LOG_DUMP_STORE_DEVPATH, O_RDWR);
+	if (ret < 0) {
+		ldpdbg("Fail to open %s, errno %d\n", CONFIG_LOG_DUMP_STORE_DEVPATH, get_errno());
+		return ERROR;
+	}
+
+	g_store.index = (FAR struct log_dump_seghdr_s *)kmm_zalloc(STORE_NSEGS * sizeof(struct log_dump_seghdr_s));
+	g_store.segbuf = (FAR uint8_t *)kmm_malloc(STORE_SEGSIZE);
+	if (g_store.index == NULL || g_store.segbuf == NULL) {
+		ldpdbg("memory allocation failure\n");
+		goto errout;
+	}
+
+	for (i = 0; i < STORE_NSEGS; i++) {
+		hdr = &g_store.index[i];
+		if (file_pread(&g_store.file, hdr, sizeof(*hdr), (off_t)i * STORE_SEGSIZE) != sizeof(*hdr) || hdr->magic != STORE_SEG_MAGIC || hdr->used > STORE_SEGSIZE - sizeof(*hdr)) {
+			hdr->magic = 0;
+		}
+	}
+
+	/* Two copies of a synced segment lie in adjacent slots, keep the newer */
+
+	for (i = 0; i < STORE_NSEGS && STORE_NSEGS > 1; i++) {
+		hdr = &g_store.index[i];
+		next = &g_store.index[(i + 1) % STORE_NSEGS];
+		if (hdr->magic == STORE_SEG_MAGIC && next->magic == STORE_SEG_MAGIC && hdr->seq == next->seq) {
+			if ((int8_t)(next->gen - hdr->gen) > 0) {
+				hdr->magic = 0;
+			} else {
+				next->magic = 0;
+			}
+		}
+	}
+
+	for (i = 0; i < STORE_NSEGS; i++) {
+		hdr = &g_store.index[i];
+		if (hdr->magic != STORE_SEG_MAGIC) {
+			continue;
+		}
+
+		if (!found || (int32_t)(hdr->seq - maxseq) > 0) {
+			maxseq = hdr->seq;
+			newest = i;
+		}
+		if (!found || (int16_t)(hdr->boot - maxboot) > 0) {
+			maxboot = hdr->boot;
+		}
+		found = true;
+	}
+
+	g_store.seq = found ? maxseq + 1 : 1;
+	g_store.boot = found ? maxboot + 1 : 1;
+	g_store.wrseg = (newest + 1) % STORE_NSEGS;
+	g_store.cpseg = -1;
+	g_store.cursor.active = false;
+	sem_init(&g_store.lock, 0, 1);
+	store_newsegment();
+	g_store.ready = true;
+
+	return OK;
+
+errout:
+	kmm_free(g_store.index);
+	kmm_free(g_store.segbuf);
+	file_close(&g_store.file);
+	return ERROR;
+}
+
+/****************************************************************************
+ * Name: log_dump_store_append
+ *
+ * Description:
+ *   Add a compressed block to the segment filled now, writing the segment to
+ *   flash first if the block does not fit anymore.
+ *
+ ****************************************************************************/
+
+int log_dump_store_append(FAR const uint8_t *data, size_t size, uint32_t first_ms, uint32_t last_ms, uint8_t sevmask)
+{
+	FAR struct log_dump_seghdr_s *hdr = (FAR struct log_dump_seghdr_s *)g_store.segbuf;
+	FAR struct log_dump_rechdr_s *rec;
+	size_t recsize = sizeof(struct log_dump_rechdr_s) + STORE_ALIGN(size);
+	int ret = OK;
+
+	if (!g_store.ready) {
+		return -ENODEV;
+	}
+
+	store_lock();
+
+	if (sizeof(*hdr) + hdr->used + recsize > STORE_SEGSIZE) {
+		ret = store_writesegment();
+		if (ret != OK && g_store.cpseg < 0) {
+			/* Skip the slot that failed like before */
+
+			g_store.wrseg = (g_store.wrseg + 1) % STORE_NSEGS;
+		}
+		store_newsegment();
+	}
+
+	rec = (FAR struct log_dump_rechdr_s *)(g_store.segbuf + sizeof(*hdr) + hdr->used);
+	rec->magic = STORE_REC_MAGIC;
+	rec->size = size;
+	rec->sevmask = sevmask;
+	memset(rec->reserved, 0, sizeof(rec->reserved));
+	rec->first_ms = first_ms;
+	rec->last_ms = last_ms;
+	memcpy(rec + 1, data, size);
+
+	if (hdr->used == 0) {
+		hdr->first_ms = first_ms;
+	}
+	hdr->last_ms = last_ms;
+	hdr->sevmask |= sevmask;
+	hdr->used += recsize;
+	g_store.dirty = true;
+
+	store_unlock();
+	return ret;
+}
+
+/****************************************************************************
+ * Name: log_dump_store_sync
+ *
+ * Description:
+ *   Write the segment filled now to flash, it stays the one filled.  The
+ *   copy goes to another slot than the previous copy of the segment, which
+ *   stays valid until the write is complete.
+ *
+ ****************************************************************************/
+
+int log_dump_store_sync(void)
+{
+	int ret = OK;
+
+	if (!g_store.ready) {
+		return -ENODEV;
+	}
+
+	store_lock();
+	if (g_store.dirty) {
+		ret = store_writesegment();
+	}
+	store_unlock();
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: log_dump_store_query
+ *
+ * Description:
+ *   Select the stored blocks that log_dump_store_read() returns: those of
+ *   the boot 'bootback' boots ago, within 'seconds' of its newest log if
+ *   'seconds' is not zero, and with a severity in 'sevmask' if it is not
+ *   zero.
+ *
+ ****************************************************************************/
+
+int log_dump_store_query(int bootback, uint32_t seconds, uint8_t sevmask)
+{
+	FAR struct log_dump_cursor_s *cur = &g_store.cursor;
+	uint32_t max_ms = 0;
+	int i;
+
+	if (!g_store.ready) {
+		return -ENODEV;
+	}
+
+	(void)log_dump_store_sync();
+
+	store_lock();
+
+	cur->boot = g_store.boot - bootback;
+	for (i = 0; i < STORE_NSEGS; i++) {
+		if (g_store.index[i].magic == STORE_SEG_MAGIC && g_store.index[i].boot == cur->boot && g_store.index[i].last_ms > max_ms) {
+			max_ms = g_store.index[i].last_ms;
+		}
+	}
+
+	cur->min_ms = (seconds > 0 && max_ms > seconds * 1000) ? max_ms - seconds * 1000 : 0;
+	cur->sevmask = sevmask;
+
+	/* Oldest segment first, the one after the slots of the segment filled
+	 * now.  Its newest copy may lie after the slot it is written to next.
+	 */
+
+	if (g_store.cpseg == (g_store.wrseg + 1) % STORE_NSEGS) {
+		cur->seg = (g_store.cpseg + 1) % STORE_NSEGS;
+	} else {
+		cur->seg = (g_store.wrseg + 1) % STORE_NSEGS;
+	}
+	cur->nvisited = 0;
+	cur->off = 0;
+	cur->rec_left = 0;
+	cur->prefix_pos = LOGDUMP_STORE_PREFIXSZ;
+	cur->active = true;
+
+	store_unlock();
+	return OK;
+}
+
+/****************************************************************************
+ * Name: log_dump_store_active
+ *
+ * Description:
+ *   Check if a query is being read.
+ *
+ ****************************************************************************/
+
+bool log_dump_store_active(void)
+{
+	return g_store.cursor.active;
+}
+
+/****************************************************************************
+ * Name: log_dump_store_read
+ *
+ * Description:
+ *   Read the blocks of the query, in the framing of log_dump_read(): the
+ *   size of each compressed block in four digits, then the block.  The
+ *   query ends when this returns 0.
+ *
+ ****************************************************************************/
+
+size_t log_dump_store_read(FAR char *buffer, size_t buflen)
+{
+	FAR struct log_dump_cursor_s *cur = &g_store.cursor;
+	size_t ret = 0;
+	ssize_t nread;
+	size_t n;
+
+	store_lock();
+
+	while (ret < buflen) {
+		if (cur->prefix_pos < LOGDUMP_STORE_PREFIXSZ) {
+			buffer[ret++] = cur->prefix[cur->prefix_pos++];
+		} else if (cur->rec_left > 0) {
+			n = MIN(buflen - ret, cur->rec_left);
+			nread = file_pread(&g_store.file, &buffer[ret], n, cur->rec_pos);
+			if (nread <= 0) {
+				cur->rec_left = 0;
+				break;
+			}
+			ret += nread;
+			cur->rec_pos += nread;
+			cur->rec_left -= nread;
+		} else if (!store_nextrecord(cur)) {
+			break;
+		}
+	}
+
+	if (ret == 0) {
+		cur->active = false;
+	}
+
+	store_unlock();
+	return ret;
+}
@@ -0,0 +1,328 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <mqueue.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/kmalloc.h>
+#include <tinyara/sched.h>
+
+#include "sched/sched.h"
+#include "mqueue/mqueue.h"
+
+#ifdef CONFIG_MQ_ZEROCOPY
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#if CONFIG_MQ_ZEROCOPY_BUFSIZE < CONFIG_MQ_MAXMSGSIZE
+#error "CONFIG_MQ_ZEROCOPY_BUFSIZE must not be smaller than CONFIG_MQ_MAXMSGSIZE"
+#endif
+
+#define MQ_BUF_ALIGN(n)    (((n) + 7) & ~7)
+#define MQ_BUF_HDRSIZE     MQ_BUF_ALIGN(sizeof(struct mq_buf_s))
+#define MQ_BUF_STRIDE      (MQ_BUF_HDRSIZE + MQ_BUF_ALIGN(CONFIG_MQ_ZEROCOPY_BUFSIZE))
+
+#define MQ_BUF_HEADER(buf) ((FAR struct mq_buf_s *)((FAR uint8_t *)(buf) - MQ_BUF_HDRSIZE))
+#define MQ_BUF_DATA(hdr)   ((FAR void *)((FAR uint8_t *)(hdr) + MQ_BUF_HDRSIZE))
+
+/****************************************************************************
+ * Private Type Declarations
+ ****************************************************************************/
+
+/* Each buffer of the pool is preceded by this header.  A buffer belongs to
+ * exactly one task at a time, or to no task while it is free or queued.
+ */
+
+struct mq_buf_s {
+	FAR struct mq_buf_s *flink;	/* Link in the free list */
+	pid_t owner;				/* Task that may use the buffer */
+};
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+/* The buffers are carved from one block of user accessible memory, so that
+ * a pointer passed in from user space is checked by its address alone.
+ */
+
+static FAR uint8_t *g_mqbufpool;
+static sq_queue_t g_mqbuffree;
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mq_bufinitialize
+ *
+ * Description:
+ *   Allocate the buffer pool the first time it is needed.  Must not be
+ *   called within a critical section.
+ *
+ ****************************************************************************/
+
+int mq_bufinitialize(void)
+{
+	FAR uint8_t *pool;
+	irqstate_t flags;
+	int i;
+
+	if (g_mqbufpool != NULL) {
+		return OK;
+	}
+
+	pool = (FAR uint8_t *)kumm_malloc(CONFIG_MQ_ZEROCOPY_NBUFFERS * MQ_BUF_STRIDE);
+	if (pool == NULL) {
+		return -ENOMEM;
+	}
+
+	flags = enter_critical_section();
+	if (g_mqbufpool != NULL) {
+		/* Another task got here first */
+
+		leave_critical_section(flags);
+		kumm_free(pool);
+		return OK;
+	}
+
+	sq_init(&g_mqbuffree);
+	for (i = 0; i < CONFIG_MQ_ZEROCOPY_NBUFFERS; i++) {
+		FAR struct mq_buf_s *hdr = (FAR struct mq_buf_s *)(pool + i * MQ_BUF_STRIDE);
+
+		hdr->owner = INVALID_PROCESS_ID;
+		sq_addlast((FAR sq_entry_t *)hdr, &g_mqbuffree);
+	}
+
+	g_mqbufpool = pool;
+	leave_critical_section(flags);
+	return OK;
+}
+
+/****************************************************************************
+ * Name: mq_bufverify
+ *
+ * Description:
+ *   Check that 'buf' is a buffer of the pool that belongs to 'owner'.
+ *
+ * Return Value:
+ *   OK, -EINVAL if 'buf' is not the start of a pool buffer or -EPERM if it
+ *   belongs to another task.
+ *
+ ****************************************************************************/
+
+int mq_bufverify(FAR void *buf, pid_t owner)
+{
+	uintptr_t offset;
+
+	if (g_mqbufpool == NULL || (FAR uint8_t *)buf < g_mqbufpool + MQ_BUF_HDRSIZE) {
+		return -EINVAL;
+	}
+
+	offset = (FAR uint8_t *)buf - g_mqbufpool - MQ_BUF_HDRSIZE;
+	if (offset >= CONFIG_MQ_ZEROCOPY_NBUFFERS * MQ_BUF_STRIDE || (offset % MQ_BUF_STRIDE) != 0) {
+		return -EINVAL;
+	}
+
+	if (MQ_BUF_HEADER(buf)->owner != owner) {
+		return -EPERM;
+	}
+
+	return OK;
+}
+
+/****************************************************************************
+ * Name: mq_bufget
+ *
+ * Description:
+ *   Take a buffer from the pool on behalf of 'owner'.  Returns NULL if the
+ *   pool is exhausted or not allocated yet.
+ *
+ ****************************************************************************/
+
+FAR void *mq_bufget(pid_t owner)
+{
+	FAR struct mq_buf_s *hdr;
+	irqstate_t flags;
+
+	if (g_mqbufpool == NULL) {
+		return NULL;
+	}
+
+	flags = enter_critical_section();
+	hdr = (FAR struct mq_buf_s *)sq_remfirst(&g_mqbuffree);
+	if (hdr) {
+		hdr->owner = owner;
+	}
+	leave_critical_section(flags);
+
+	return hdr ? MQ_BUF_DATA(hdr) : NULL;
+}
+
+/****************************************************************************
+ * Name: mq_bufrelease
+ *
+ * Description:
+ *   Return a buffer to the pool, whoever owns it.
+ *
+ ****************************************************************************/
+
+void mq_bufrelease(FAR void *buf)
+{
+	FAR struct mq_buf_s *hdr = MQ_BUF_HEADER(buf);
+	irqstate_t flags;
+
+	flags = enter_critical_section();
+	hdr->owner = INVALID_PROCESS_ID;
+	sq_addlast((FAR sq_entry_t *)hdr, &g_mqbuffree);
+	leave_critical_section(flags);
+}
+
+/****************************************************************************
+ * Name: mq_bufsetowner
+ *
+ * Description:
+ *   Transfer a buffer to another owner, INVALID_PROCESS_ID while it waits
+ *   in a message queue.
+ *
+ ****************************************************************************/
+
+void mq_bufsetowner(FAR void *buf, pid_t owner)
+{
+	MQ_BUF_HEADER(buf)->owner = owner;
+}
+
+/****************************************************************************
+ * Name: mq_bufrecover
+ *
+ * Description:
+ *   Called from mq_recover() when a task exits, returns the buffers still
+ *   owned by the task to the pool.
+ *
+ ****************************************************************************/
+
+void mq_bufrecover(FAR struct tcb_s *tcb)
+{
+	FAR struct mq_buf_s *hdr;
+	int i;
+
+	if (g_mqbufpool == NULL) {
+		return;
+	}
+
+	for (i = 0; i < CONFIG_MQ_ZEROCOPY_NBUFFERS; i++) {
+		hdr = (FAR struct mq_buf_s *)(g_mqbufpool + i * MQ_BUF_STRIDE);
+		if (hdr->owner == tcb->pid) {
+			mq_bufrelease(MQ_BUF_DATA(hdr));
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: mq_buf_alloc
+ *
+ * Description:
+ *   Allocate a buffer for a message to be sent with mq_send_buf().  The
+ *   calling task owns the buffer until it sends it or frees it with
+ *   mq_buf_free().
+ *
+ * Parameters:
+ *   size - The size needed, at most CONFIG_MQ_ZEROCOPY_BUFSIZE
+ *
+ * Return Value:
+ *   The buffer, or NULL with errno set:
+ *
+ *   EMSGSIZE 'size' is larger than the buffers of the pool.
+ *   ENOMEM   The pool could not be allocated.
+ *   ENOBUFS  All buffers are in use.
+ *
+ ****************************************************************************/
+
+FAR void *mq_buf_alloc(size_t size)
+{
+	FAR void *buf;
+
+	DEBUGASSERT(up_interrupt_context() == false);
+
+	if (size > CONFIG_MQ_ZEROCOPY_BUFSIZE) {
+		set_errno(EMSGSIZE);
+		return NULL;
+	}
+
+	if (mq_bufinitialize() != OK) {
+		set_errno(ENOMEM);
+		return NULL;
+	}
+
+	buf = mq_bufget(this_task()->pid);
+	if (buf == NULL) {
+		set_errno(ENOBUFS);
+	}
+
+	return buf;
+}
+
+/****************************************************************************
+ * Name: mq_buf_free
+ *
+ * Description:
+ *   Return a buffer obtained from mq_buf_alloc() or mq_receive_buf() to
+ *   the pool.
+ *
+ * Parameters:
+ *   buf - The buffer, which must belong to the calling task
+ *
+ * Return Value:
+ *   0 (OK), or -1 (ERROR) with errno set:
+ *
+ *   EINVAL   'buf' is not a message buffer.
+ *   EPERM    'buf' does not belong to the calling task.
+ *
+ ****************************************************************************/
+
+int mq_buf_free(FAR void *buf)
+{
+	int ret;
+
+	DEBUGASSERT(up_interrupt_context() == false);
+
+	ret = mq_bufverify(buf, this_task()->pid);
+	if (ret < 0) {
+		set_errno(-ret);
+		return ERROR;
+	}
+
+	mq_bufrelease(buf);
+	return OK;
+}
+
+#endif							/* CONFIG_MQ_ZEROCOPY */
@@ -117,8 +117,8 @@ FAR struct mqueue_inode_s *mq_msgqalloc(mode_t mode, FAR struct mq_attr *attr)
 	 * larger than the configured maximum message size.
 	 */
 
-	DEBUGASSERT(!attr || attr->mq_msgsize <= MQ_MAX_BYTES);
-	if (attr && attr->mq_msgsize > MQ_MAX_BYTES) {
+	DEBUGASSERT(!attr || attr->mq_msgsize <= MQ_MAX_QUEUE_BYTES);
+	if (attr && attr->mq_msgsize > MQ_MAX_QUEUE_BYTES) {
 		return NULL;
 	}
 
@@ -114,6 +114,11 @@ void mq_msgqfree(FAR struct mqueue_inode_s *msgq)
 		/* Deallocate the message structure. */
 
 		next = curr->next;
+#ifdef CONFIG_MQ_ZEROCOPY
+		if (curr->buf) {
+			mq_bufrelease(curr->buf);
+		}
+#endif
 		mq_msgfree(curr);
 		curr = next;
 	}
@@ -67,6 +67,7 @@
 
 #include <tinyara/arch.h>
 #include <tinyara/cancelpt.h>
+#include <tinyara/sched_trace.h>
 
 #include "sched/sched.h"
 #include "mqueue/mqueue.h"
@@ -207,6 +208,7 @@ FAR struct mqueue_msg_s *mq_waitreceive(mqd_t mqdes)
 			msgq->nwaitnotempty++;
 
 			set_errno(OK);
+			sched_trace_mq_waitrecv(rtcb, msgq);
 			up_block_task(rtcb, TSTATE_WAIT_MQNOTEMPTY);
 
 			/* When we resume at this point, either (1) the message queue
@@ -279,9 +281,22 @@ ssize_t mq_doreceive(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR char *ubuf
 
 	rcvmsglen = mqmsg->msglen;
 
-	/* Copy the message into the caller's buffer */
+	/* Copy the message into the caller's buffer.  A zero-copy buffer goes
+	 * back to the pool once copied, mq_receive_buf() passes no buffer and
+	 * has already taken it.
+	 */
 
-	memcpy(ubuffer, (const void *)mqmsg->mail, rcvmsglen);
+#ifdef CONFIG_MQ_ZEROCOPY
+	if (mqmsg->buf != NULL) {
+		if (ubuffer != NULL) {
+			memcpy(ubuffer, mqmsg->buf, rcvmsglen);
+			mq_bufrelease(mqmsg->buf);
+		}
+	} else
+#endif
+	{
+		memcpy(ubuffer, (const void *)mqmsg->mail, rcvmsglen);
+	}
 
 	/* Copy the message priority as well (if a buffer is provided) */
 
@@ -315,6 +330,7 @@ ssize_t mq_doreceive(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR char *ubuf
 
 		btcb->msgwaitq = NULL;
 		msgq->nwaitnotfull--;
+		sched_trace_mq_wake(btcb, msgq);
 		up_unblock_task(btcb);
 
 		leave_critical_section(saved_state);
@@ -0,0 +1,163 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <fcntl.h>
+#include <string.h>
+#include <mqueue.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/cancelpt.h>
+
+#include "sched/sched.h"
+#include "mqueue/mqueue.h"
+
+#ifdef CONFIG_MQ_ZEROCOPY
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/* Put a message back at the head of its priority in the queue */
+
+static void mq_requeue(FAR struct mqueue_inode_s *msgq, FAR struct mqueue_msg_s *mqmsg)
+{
+	FAR struct mqueue_msg_s *prev;
+	FAR struct mqueue_msg_s *next;
+
+	for (prev = NULL, next = (FAR struct mqueue_msg_s *)msgq->msglist.head; next && mqmsg->priority < next->priority; prev = next, next = next->next) ;
+
+	if (prev) {
+		sq_addafter((FAR sq_entry_t *)prev, (FAR sq_entry_t *)mqmsg, &msgq->msglist);
+	} else {
+		sq_addfirst((FAR sq_entry_t *)mqmsg, &msgq->msglist);
+	}
+
+	msgq->nmsgs++;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mq_receive_buf
+ *
+ * Description:
+ *   Receive the highest priority message by reference.  The calling task
+ *   becomes the owner of the buffer holding the message and must return it
+ *   with mq_buf_free() or pass it on with mq_send_buf().  A message that
+ *   was sent with mq_send() is copied into a buffer from the pool.
+ *
+ * Parameters:
+ *   mqdes - Message Queue Descriptor
+ *   buf - Returns the buffer holding the message
+ *   prio - If not NULL, the location to store message priority.
+ *
+ * Return Value:
+ *   On success, the length of the message in bytes is returned.  On
+ *   failure, -1 (ERROR) is returned and errno is set as for mq_receive(),
+ *   or to ENOBUFS if a copied message cannot get a buffer.  The message
+ *   then stays in the queue.
+ *
+ ****************************************************************************/
+
+ssize_t mq_receive_buf(mqd_t mqdes, FAR void **buf, FAR int *prio)
+{
+	FAR struct mqueue_msg_s *mqmsg;
+	FAR void *data;
+	irqstate_t saved_state;
+	pid_t pid;
+	ssize_t ret = ERROR;
+
+	DEBUGASSERT(up_interrupt_context() == false);
+
+	/* mq_receive_buf() is a cancellation point */
+
+	(void)enter_cancellation_point();
+
+	if (!buf || !mqdes) {
+		set_errno(EINVAL);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	if ((mqdes->oflags & O_RDOK) == 0) {
+		set_errno(EPERM);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	/* Messages sent with mq_send() are given a buffer from the pool, which
+	 * cannot be allocated in the critical section below.
+	 */
+
+	if (mq_bufinitialize() != OK) {
+		set_errno(ENOMEM);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	pid = this_task()->pid;
+
+	sched_lock();
+	saved_state = enter_critical_section();
+
+	mqmsg = mq_waitreceive(mqdes);
+	if (mqmsg && mqmsg->buf == NULL) {
+		/* The message was copied in by mq_send(), so it needs a buffer.
+		 * This is decided within the same critical section, so nobody sees
+		 * the message missing if it has to go back to the queue.
+		 */
+
+		data = mq_bufget(pid);
+		if (data) {
+			memcpy(data, (FAR const void *)mqmsg->mail, mqmsg->msglen);
+			mqmsg->buf = data;
+		} else {
+			mq_requeue(mqdes->msgq, mqmsg);
+			mqmsg = NULL;
+			set_errno(ENOBUFS);
+		}
+	} else if (mqmsg) {
+		mq_bufsetowner(mqmsg->buf, pid);
+	}
+
+	leave_critical_section(saved_state);
+	sched_unlock();
+
+	if (mqmsg) {
+		*buf = mqmsg->buf;
+		ret = mq_doreceive(mqdes, mqmsg, NULL, prio);
+	}
+
+	leave_cancellation_point();
+	return ret;
+}
+
+#endif							/* CONFIG_MQ_ZEROCOPY */
@@ -130,4 +130,10 @@ void mq_recover(FAR struct tcb_s *tcb)
 		DEBUGASSERT(tcb->msgwaitq && tcb->msgwaitq->nwaitnotfull > 0);
 		tcb->msgwaitq->nwaitnotfull--;
 	}
+
+#ifdef CONFIG_MQ_ZEROCOPY
+	/* Return the zero-copy buffers that the task still owns */
+
+	mq_bufrecover(tcb);
+#endif
 }
@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <fcntl.h>
+#include <mqueue.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/cancelpt.h>
+
+#include "sched/sched.h"
+#include "mqueue/mqueue.h"
+
+#ifdef CONFIG_MQ_ZEROCOPY
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: mq_send_buf
+ *
+ * Description:
+ *   Send a message by reference.  Instead of copying the data, the queue
+ *   takes the buffer, which the receiver then owns.  The caller must not
+ *   touch the buffer once the call succeeds; if it fails, the caller still
+ *   owns the buffer.
+ *
+ * Parameters:
+ *   mqdes - Message queue descriptor
+ *   buf - A buffer from mq_buf_alloc() or mq_receive_buf() owned by the
+ *         calling task
+ *   msglen - The length of the message in bytes
+ *   prio - The priority of the message
+ *
+ * Return Value:
+ *   On success, mq_send_buf() returns 0 (OK); on error, -1 (ERROR) is
+ *   returned, with errno set to indicate the error, as for mq_send() and:
+ *
+ *   EINVAL   'buf' is not a message buffer.
+ *   EPERM    'buf' does not belong to the calling task.
+ *
+ ****************************************************************************/
+
+int mq_send_buf(mqd_t mqdes, FAR void *buf, size_t msglen, int prio)
+{
+	FAR struct mqueue_inode_s *msgq;
+	FAR struct mqueue_msg_s *mqmsg = NULL;
+	irqstate_t saved_state;
+	int ret = ERROR;
+
+	DEBUGASSERT(up_interrupt_context() == false);
+
+	/* mq_send_buf() is a cancellation point */
+
+	(void)enter_cancellation_point();
+
+	if (!mqdes || prio < 0 || prio > MQ_PRIO_MAX) {
+		set_errno(EINVAL);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	if ((mqdes->oflags & O_WROK) == 0) {
+		set_errno(EPERM);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	if (msglen > mqdes->msgq->maxmsgsize || msglen > CONFIG_MQ_ZEROCOPY_BUFSIZE) {
+		set_errno(EMSGSIZE);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	ret = mq_bufverify(buf, this_task()->pid);
+	if (ret < 0) {
+		set_errno(-ret);
+		leave_cancellation_point();
+		return ERROR;
+	}
+
+	/* Wait for room in the queue as mq_send() does */
+
+	msgq = mqdes->msgq;
+	saved_state = enter_critical_section();
+	if (msgq->nmsgs < msgq->maxmsgs || mq_waitsend(mqdes) == OK) {
+		leave_critical_section(saved_state);
+		mqmsg = mq_msgalloc();
+	} else {
+		leave_critical_section(saved_state);
+	}
+
+	sched_lock();
+
+	ret = ERROR;
+	if (mqmsg) {
+		/* The buffer belongs to no task while it is queued */
+
+		mq_bufsetowner(buf, INVALID_PROCESS_ID);
+		mqmsg->buf = buf;
+		ret = mq_dosend(mqdes, mqmsg, buf, msglen, prio);
+	}
+
+	sched_unlock();
+	leave_cancellation_point();
+	return ret;
+}
+
+#endif							/* CONFIG_MQ_ZEROCOPY */
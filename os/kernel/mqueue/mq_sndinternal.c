@@ -69,6 +69,7 @@
 #include <tinyara/arch.h>
 #include <tinyara/sched.h>
 #include <tinyara/cancelpt.h>
+#include <tinyara/sched_trace.h>
 #include "sched/sched.h"
 #ifndef CONFIG_DISABLE_SIGNALS
 #include "signal/signal.h"
@@ -145,6 +146,15 @@ int mq_verifysend(mqd_t mqdes, FAR const char *msg, size_t msglen, int prio)
 		return ERROR;
 	}
 
+#ifdef CONFIG_MQ_ZEROCOPY
+	/* Messages larger than MQ_MAX_BYTES can only be sent by reference */
+
+	if (msglen > MQ_MAX_BYTES) {
+		set_errno(EMSGSIZE);
+		return ERROR;
+	}
+#endif
+
 	return OK;
 }
 
@@ -226,6 +236,14 @@ FAR struct mqueue_msg_s *mq_msgalloc(void)
 		}
 	}
 
+#ifdef CONFIG_MQ_ZEROCOPY
+	/* mq_send_buf() sets the buffer after allocating the message */
+
+	if (mqmsg) {
+		mqmsg->buf = NULL;
+	}
+#endif
+
 	return mqmsg;
 }
 
@@ -310,6 +328,7 @@ int mq_waitsend(mqd_t mqdes)
 				msgq->nwaitnotfull++;
 
 				set_errno(OK);
+				sched_trace_mq_waitsend(rtcb, msgq);
 				up_block_task(rtcb, TSTATE_WAIT_MQNOTFULL);
 
 				/* When we resume at this point, either (1) the message queue
@@ -370,9 +389,16 @@ int mq_dosend(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR const char *msg,
 	mqmsg->priority = prio;
 	mqmsg->msglen = msglen;
 
-	/* Copy the message data into the message */
+	/* Copy the message data into the message, unless the message refers to
+	 * a zero-copy buffer.
+	 */
 
-	memcpy((void *)mqmsg->mail, (FAR const void *)msg, msglen);
+#ifdef CONFIG_MQ_ZEROCOPY
+	if (mqmsg->buf == NULL)
+#endif
+	{
+		memcpy((void *)mqmsg->mail, (FAR const void *)msg, msglen);
+	}
 
 	/* Insert the new message in the message queue */
 
@@ -448,6 +474,7 @@ int mq_dosend(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR const char *msg,
 
 		btcb->msgwaitq = NULL;
 		msgq->nwaitnotempty--;
+		sched_trace_mq_wake(btcb, msgq);
 		up_unblock_task(btcb);
 	}
 
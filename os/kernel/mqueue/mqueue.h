@@ -78,6 +78,16 @@
 
 #define MQ_MAX_BYTES   CONFIG_MQ_MAXMSGSIZE
 #define MQ_MAX_MSGS    16
+
+/* The largest message size a queue may be created with.  With zero-copy
+ * buffers, messages longer than MQ_MAX_BYTES can be sent by reference.
+ */
+
+#ifdef CONFIG_MQ_ZEROCOPY
+#define MQ_MAX_QUEUE_BYTES CONFIG_MQ_ZEROCOPY_BUFSIZE
+#else
+#define MQ_MAX_QUEUE_BYTES MQ_MAX_BYTES
+#endif
 #define MQ_PRIO_MAX    _POSIX_MQ_PRIO_MAX
 
 /* This defines the number of messages descriptors to allocate at each
@@ -109,6 +119,9 @@ struct mqueue_msg_s {
 	uint8_t type;					/* (Used to manage allocations) */
 	uint8_t priority;				/* priority of message */
 	size_t msglen;					/* Message data length */
+#ifdef CONFIG_MQ_ZEROCOPY
+	FAR void *buf;					/* Zero-copy buffer holding the data, or NULL */
+#endif
 	char mail[MQ_MAX_BYTES];		/* Message data */
 };
 
@@ -174,6 +187,17 @@ FAR struct mqueue_msg_s *mq_msgalloc(void);
 int mq_waitsend(mqd_t mqdes);
 int mq_dosend(mqd_t mqdes, FAR struct mqueue_msg_s *mqmsg, FAR const char *msg, size_t msglen, int prio);
 
+#ifdef CONFIG_MQ_ZEROCOPY
+/* mq_bufpool.c ************************************************************/
+
+int mq_bufinitialize(void);
+int mq_bufverify(FAR void *buf, pid_t owner);
+FAR void *mq_bufget(pid_t owner);
+void mq_bufrelease(FAR void *buf);
+void mq_bufsetowner(FAR void *buf, pid_t owner);
+void mq_bufrecover(FAR struct tcb_s *tcb);
+#endif
+
 /* mq_release.c ************************************************************/
 
 void mq_release(FAR struct task_group_s *group);
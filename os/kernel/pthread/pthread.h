@@ -128,11 +128,26 @@ int pthread_sem_trytake(sem_t *sem);
 #endif
 int pthread_sem_give(sem_t *sem);
 
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+#define pthread_mutex_isadaptive(m) ((m)->type == PTHREAD_MUTEX_ADAPTIVE_NP)
+
+int pthread_mutex_adaptive_take(FAR struct pthread_mutex_s *mutex);
+int pthread_mutex_adaptive_trytake(FAR struct pthread_mutex_s *mutex);
+int pthread_mutex_adaptive_give(FAR struct pthread_mutex_s *mutex);
+int pthread_mutex_adaptive_lock(FAR struct pthread_mutex_s *mutex);
+int pthread_mutex_adaptive_trylock(FAR struct pthread_mutex_s *mutex);
+int pthread_mutex_adaptive_unlock(FAR struct pthread_mutex_s *mutex);
+#endif
+
 #ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
 int pthread_mutex_take(FAR struct pthread_mutex_s *mutex);
 int pthread_mutex_trytake(FAR struct pthread_mutex_s *mutex);
 int pthread_mutex_give(FAR struct pthread_mutex_s *mutex);
 void pthread_mutex_inconsistent(FAR struct pthread_tcb_s *tcb);
+#elif defined(CONFIG_PTHREAD_MUTEX_ADAPTIVE)
+#define pthread_mutex_take(m) (pthread_mutex_isadaptive(m) ? pthread_mutex_adaptive_take(m) : pthread_sem_take(&(m)->sem))
+#define pthread_mutex_trytake(m) (pthread_mutex_isadaptive(m) ? pthread_mutex_adaptive_trytake(m) : pthread_sem_trytake(&(m)->sem))
+#define pthread_mutex_give(m)   (pthread_mutex_isadaptive(m) ? pthread_mutex_adaptive_give(m) : pthread_sem_give(&(m)->sem))
 #else
 #define pthread_mutex_take(m) pthread_sem_take(&(m)->sem)
 #define pthread_mutex_trytake(m) pthread_sem_trytake(&(m)->sem)
@@ -57,6 +57,7 @@
 #include <tinyara/config.h>
 
 #include <stdbool.h>
+#include <pthread.h>
 #include <sched.h>
 #include <assert.h>
 #include <errno.h>
@@ -126,6 +127,17 @@ int pthread_mutex_take(FAR struct pthread_mutex_s *mutex)
 	/* Verify input parameters */
 
 	DEBUGASSERT(mutex != NULL);
+
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+	/* Adaptive mutexes are not robust, they are not kept in the list of
+	 * mutexes held by the thread.
+	 */
+
+	if (mutex != NULL && pthread_mutex_isadaptive(mutex)) {
+		return pthread_mutex_adaptive_take(mutex);
+	}
+#endif
+
 	if (mutex != NULL) {
 		/* Make sure that no unexpected context switches occur */
 
@@ -187,6 +199,17 @@ int pthread_mutex_trytake(FAR struct pthread_mutex_s *mutex)
 	/* Verify input parameters */
 
 	DEBUGASSERT(mutex != NULL);
+
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+	/* Adaptive mutexes are not robust, they are not kept in the list of
+	 * mutexes held by the thread.
+	 */
+
+	if (mutex != NULL && pthread_mutex_isadaptive(mutex)) {
+		return pthread_mutex_adaptive_trytake(mutex);
+	}
+#endif
+
 	if (mutex != NULL) {
 		/* Make sure that no unexpected context switches occur */
 
@@ -239,6 +262,17 @@ int pthread_mutex_give(FAR struct pthread_mutex_s *mutex)
 	/* Verify input parameters */
 
 	DEBUGASSERT(mutex != NULL);
+
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+	/* Adaptive mutexes are not robust, they are not kept in the list of
+	 * mutexes held by the thread.
+	 */
+
+	if (mutex != NULL && pthread_mutex_isadaptive(mutex)) {
+		return pthread_mutex_adaptive_give(mutex);
+	}
+#endif
+
 	if (mutex != NULL) {
 		FAR struct pthread_tcb_s *rtcb = (FAR struct pthread_tcb_s *)this_task();
 		irqstate_t flags;
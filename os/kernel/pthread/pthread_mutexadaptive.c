@@ -0,0 +1,272 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <assert.h>
+#include <errno.h>
+#include <debug.h>
+
+#include <tinyara/irq.h>
+#include <tinyara/sched.h>
+#include <tinyara/spinlock.h>
+
+#include "sched/sched.h"
+#include "pthread/pthread.h"
+
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pthread_mutex_spin
+ *
+ * Description:
+ *   Poll a held adaptive mutex while its holder is running on another CPU.
+ *   The lock word is only read until it looks free, so the spinning CPUs
+ *   do not keep stealing the cache line from the holder.
+ *
+ * Return Value:
+ *   True if the mutex was taken, false if the caller should sleep.
+ *
+ ****************************************************************************/
+
+static bool pthread_mutex_spin(FAR struct pthread_mutex_s *mutex)
+{
+	FAR struct tcb_s *htcb = NULL;
+	int holder = -1;
+	int spins;
+
+	for (spins = 0; spins < CONFIG_PTHREAD_MUTEX_ADAPTIVE_SPINS; spins++) {
+		if (!spin_islocked(&mutex->lockword) && spin_trylock_wo_note(&mutex->lockword) == SP_UNLOCKED) {
+			return true;
+		}
+
+		/* The holder sets mutex->pid just after it takes the lock word, a
+		 * negative pid means that it is about to.
+		 */
+
+		if (mutex->pid != holder) {
+			holder = mutex->pid;
+			htcb = holder > 0 ? sched_gettcb(holder) : NULL;
+		}
+
+		if (holder > 0 && (htcb == NULL || htcb->task_state != TSTATE_TASK_RUNNING)) {
+			/* The holder is preempted or asleep, it will not release soon */
+
+			return false;
+		}
+	}
+
+	return false;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: pthread_mutex_adaptive_take
+ *
+ * Description:
+ *   Take an adaptive mutex: with one test-and-set if it is free, spinning
+ *   while the holder runs, or else sleeping on the semaphore of the mutex,
+ *   which starts with a count of zero and is posted once per sleeper.
+ *
+ * Return Value:
+ *   0 on success or an errno value on failure.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_adaptive_take(FAR struct pthread_mutex_s *mutex)
+{
+	irqstate_t flags;
+	int ret;
+
+	DEBUGASSERT(mutex != NULL);
+
+	if (spin_trylock_wo_note(&mutex->lockword) == SP_UNLOCKED) {
+		return OK;
+	}
+
+	if (pthread_mutex_spin(mutex)) {
+		return OK;
+	}
+
+	for (;;) {
+		/* Announce the sleeper before the last try.  The releasing thread
+		 * clears the lock word before it reads the sleeper count, so either
+		 * the try succeeds or the semaphore gets posted.
+		 */
+
+		flags = enter_critical_section();
+		mutex->waiters++;
+		SP_DSB();
+
+		if (spin_trylock_wo_note(&mutex->lockword) == SP_UNLOCKED) {
+			mutex->waiters--;
+			leave_critical_section(flags);
+			return OK;
+		}
+
+		/* A failed wait leaves the count raised, which only costs a
+		 * spurious wake-up later.
+		 */
+
+		ret = pthread_sem_take(&mutex->sem);
+		leave_critical_section(flags);
+		if (ret != OK) {
+			return ret;
+		}
+
+		/* Woken by a release, compete for the lock word again */
+	}
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_adaptive_trytake
+ *
+ * Description:
+ *   Take an adaptive mutex if it is free.
+ *
+ * Return Value:
+ *   0 on success or EBUSY.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_adaptive_trytake(FAR struct pthread_mutex_s *mutex)
+{
+	DEBUGASSERT(mutex != NULL);
+
+	return spin_trylock_wo_note(&mutex->lockword) == SP_UNLOCKED ? OK : EBUSY;
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_adaptive_give
+ *
+ * Description:
+ *   Release an adaptive mutex and wake one sleeper, if any.
+ *
+ * Return Value:
+ *   0 on success or an errno value on failure.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_adaptive_give(FAR struct pthread_mutex_s *mutex)
+{
+	irqstate_t flags;
+	int ret = OK;
+
+	DEBUGASSERT(mutex != NULL);
+
+	/* spin_unlock_wo_note() ends with a barrier, the sleeper count is read
+	 * after the lock word is visible as free.
+	 */
+
+	spin_unlock_wo_note(&mutex->lockword);
+	if (mutex->waiters == 0) {
+		return OK;
+	}
+
+	flags = enter_critical_section();
+	if (mutex->waiters > 0) {
+		mutex->waiters--;
+		ret = pthread_sem_give(&mutex->sem);
+	}
+
+	leave_critical_section(flags);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_adaptive_lock
+ *
+ * Description:
+ *   pthread_mutex_lock() for an adaptive mutex.  The uncontended case does
+ *   not lock the scheduler and does not enter the critical section.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_adaptive_lock(FAR struct pthread_mutex_s *mutex)
+{
+	int mypid = (int)getpid();
+	int ret;
+
+	if (mutex->pid == mypid) {
+		sdbg("Returning EDEADLK\n");
+		return EDEADLK;
+	}
+
+	ret = pthread_mutex_adaptive_take(mutex);
+	if (ret == OK) {
+		mutex->pid = mypid;
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_adaptive_trylock
+ *
+ * Description:
+ *   pthread_mutex_trylock() for an adaptive mutex.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_adaptive_trylock(FAR struct pthread_mutex_s *mutex)
+{
+	int ret;
+
+	ret = pthread_mutex_adaptive_trytake(mutex);
+	if (ret == OK) {
+		mutex->pid = (int)getpid();
+	}
+
+	return ret;
+}
+
+/****************************************************************************
+ * Name: pthread_mutex_adaptive_unlock
+ *
+ * Description:
+ *   pthread_mutex_unlock() for an adaptive mutex.
+ *
+ ****************************************************************************/
+
+int pthread_mutex_adaptive_unlock(FAR struct pthread_mutex_s *mutex)
+{
+	if (!spin_islocked(&mutex->lockword) || mutex->pid != (int)getpid()) {
+		sdbg("Holder=%d returning EPERM\n", mutex->pid);
+		return EPERM;
+	}
+
+	mutex->pid = -1;
+	return pthread_mutex_adaptive_give(mutex);
+}
+
+#endif							/* CONFIG_PTHREAD_MUTEX_ADAPTIVE */
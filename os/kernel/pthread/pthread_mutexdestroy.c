@@ -66,6 +66,7 @@
 #include <stdbool.h>
 
 #include <tinyara/semaphore.h>
+#include <tinyara/spinlock.h>
 
 #include "pthread/pthread.h"
 
@@ -119,6 +120,19 @@ int pthread_mutex_destroy(FAR pthread_mutex_t *mutex)
 	svdbg("mutex=0x%p\n", mutex);
 	DEBUGASSERT(mutex != NULL);
 
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+	/* The semaphore of an adaptive mutex only holds its sleepers */
+
+	if (mutex != NULL && pthread_mutex_isadaptive(mutex)) {
+		if (spin_islocked(&mutex->lockword) || mutex->waiters > 0) {
+			return EBUSY;
+		}
+
+		status = sem_destroy((FAR sem_t *)&mutex->sem);
+		return (status != OK) ? get_errno() : OK;
+	}
+#endif
+
 	if (mutex != NULL) {
 
 		/* Make sure the semaphore is stable while we make the following checks */
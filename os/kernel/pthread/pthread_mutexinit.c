@@ -63,6 +63,7 @@
 #include <debug.h>
 
 #include <tinyara/semaphore.h>
+#include <tinyara/spinlock.h>
 
 #include "pthread/pthread.h"
 
@@ -150,6 +151,34 @@ int pthread_mutex_init(FAR pthread_mutex_t *mutex,
 
 		mutex->pid = -1;
 
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+		if (type == PTHREAD_MUTEX_ADAPTIVE_NP) {
+			/* The lock word holds the lock state, the semaphore only
+			 * holds the threads sleeping on the mutex.
+			 */
+
+			mutex->lockword = SP_UNLOCKED;
+			mutex->waiters = 0;
+			mutex->type = type;
+			mutex->nlocks = 0;
+#ifndef CONFIG_PTHREAD_MUTEX_UNSAFE
+			mutex->flink = NULL;
+			mutex->flags = 0;
+#endif
+
+			status = sem_init((sem_t *)&mutex->sem, pshared, 0);
+#ifdef CONFIG_PRIORITY_INHERITANCE
+			if (status == OK) {
+				status = sem_setprotocol((FAR sem_t *)&mutex->sem, SEM_PRIO_NONE);
+			}
+#endif
+
+			ret = (status != OK) ? get_errno() : OK;
+			svdbg("Returning %d\n", ret);
+			return ret;
+		}
+#endif
+
 		/* Initialize the mutex like a semaphore with initial count = 1 */
 
 		status = sem_init((sem_t *)&mutex->sem, pshared, 1);
@@ -150,6 +150,14 @@ int pthread_mutex_lock(FAR pthread_mutex_t *mutex)
 	svdbg("mutex=0x%p\n", mutex);
 	DEBUGASSERT(mutex != NULL);
 
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+	/* Adaptive mutexes take the fast path, without locking the scheduler */
+
+	if (mutex != NULL && pthread_mutex_isadaptive(mutex)) {
+		return pthread_mutex_adaptive_lock(mutex);
+	}
+#endif
+
 	if (mutex != NULL) {
 		/* Make sure the semaphore is stable while we make the following
 		 * checks.  This all needs to be one atomic action.
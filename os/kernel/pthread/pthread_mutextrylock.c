@@ -128,6 +128,12 @@ int pthread_mutex_trylock(FAR pthread_mutex_t *mutex)
 	svdbg("mutex=0x%p\n", mutex);
 	DEBUGASSERT(mutex != NULL);
 
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+	if (mutex != NULL && pthread_mutex_isadaptive(mutex)) {
+		return pthread_mutex_adaptive_trylock(mutex);
+	}
+#endif
+
 	if (mutex != NULL) {
 		int mypid = (int)getpid();
 
@@ -155,6 +155,12 @@ int pthread_mutex_unlock(FAR pthread_mutex_t *mutex)
 		return EINVAL;
 	}
 
+#ifdef CONFIG_PTHREAD_MUTEX_ADAPTIVE
+	if (pthread_mutex_isadaptive(mutex)) {
+		return pthread_mutex_adaptive_unlock(mutex);
+	}
+#endif
+
 	/* Make sure the semaphore is stable while we make the following checks.
 	 * This all needs to be one atomic action.
 	 */
@@ -173,6 +173,15 @@ struct tasklist_s {
 
 extern volatile dq_queue_t g_readytorun;
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+/* Per-priority index of g_readytorun, see sched_readytorunmap.c */
+
+#define READYTORUN_MAP_WORDS ((SCHED_PRIORITY_MAX + 32) / 32)
+
+extern FAR struct tcb_s *g_readytorun_tail[SCHED_PRIORITY_MAX + 1];
+extern uint32_t g_readytorun_map[READYTORUN_MAP_WORDS];
+#endif
+
 #ifdef CONFIG_SMP
 /* In order to support SMP, the function of the g_readytorun list changes,
  * The g_readytorun is still used but in the SMP case it will contain only:
@@ -357,6 +366,30 @@ bool sched_addreadytorun(FAR struct tcb_s *rtrtcb);
 bool sched_removereadytorun(FAR struct tcb_s *rtrtcb);
 bool sched_addprioritized(FAR struct tcb_s *newTcb, DSEG dq_queue_t *list);
 bool sched_mergepending(void);
+
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+bool sched_rtrmap_add(FAR struct tcb_s *tcb);
+void sched_rtrmap_rem(FAR struct tcb_s *tcb);
+void sched_rtrmap_setpriority(FAR struct tcb_s *tcb, uint8_t priority);
+
+/* Remove a TCB from a task list, keeping the ready-to-run index in step */
+
+#define sched_tasklist_rem(tcb, list) \
+	do { \
+		if ((FAR dq_queue_t *)(list) == (FAR dq_queue_t *)&g_readytorun) { \
+			sched_rtrmap_rem(tcb); \
+		} else { \
+			dq_rem((FAR dq_entry_t *)(tcb), (FAR dq_queue_t *)(list)); \
+		} \
+	} while (0)
+#define sched_running_setpriority(tcb, priority) \
+	sched_rtrmap_setpriority(tcb, (uint8_t)(priority))
+#else
+#define sched_tasklist_rem(tcb, list) \
+	dq_rem((FAR dq_entry_t *)(tcb), (FAR dq_queue_t *)(list))
+#define sched_running_setpriority(tcb, priority) \
+	((tcb)->sched_priority = (uint8_t)(priority))
+#endif
 void sched_addblocked(FAR struct tcb_s *btcb, tstate_t task_state);
 void sched_removeblocked(FAR struct tcb_s *btcb);
 int sched_setpriority(FAR struct tcb_s *tcb, int sched_priority);
@@ -123,6 +123,14 @@ bool sched_addprioritized(FAR struct tcb_s *tcb, DSEG dq_queue_t *list)
 
 	ASSERT(sched_priority >= SCHED_PRIORITY_MIN);
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+	/* The ready-to-run list has an index which finds the spot directly */
+
+	if (list == (FAR dq_queue_t *)&g_readytorun) {
+		return sched_rtrmap_add(tcb);
+	}
+#endif
+
 	/* Search the list to find the location to insert the new Tcb.
 	 * Each is list is maintained in ascending sched_priority order.
 	 */
@@ -120,19 +120,34 @@ bool sched_mergepending(void)
 {
 	FAR struct tcb_s *pndtcb;
 	FAR struct tcb_s *pndnext;
+#ifndef CONFIG_SCHED_READYTORUN_BITMAP
 	FAR struct tcb_s *rtrtcb;
 	FAR struct tcb_s *rtrprev;
+#endif
 	bool ret = false;
 
+#ifndef CONFIG_SCHED_READYTORUN_BITMAP
 	/* Initialize the inner search loop */
 
 	rtrtcb = this_task();
+#endif
 
 	/* Process every TCB in the g_pendingtasks list */
 
 	for (pndtcb = (FAR struct tcb_s *)g_pendingtasks.head; pndtcb; pndtcb = pndnext) {
 		pndnext = pndtcb->flink;
 
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+		/* The index finds the spot without walking g_readytorun */
+
+		if (sched_rtrmap_add(pndtcb)) {
+			pndtcb->flink->task_state = TSTATE_TASK_READYTORUN;
+			pndtcb->task_state = TSTATE_TASK_RUNNING;
+			ret = true;
+		} else {
+			pndtcb->task_state = TSTATE_TASK_READYTORUN;
+		}
+#else
 		/* Search the g_readytorun list to find the location to insert the
 		 * new pndtcb. Each is list is maintained in ascending sched_priority
 		 * order.
@@ -175,6 +190,7 @@ bool sched_mergepending(void)
 		/* Set up for the next time through */
 
 		rtrtcb = pndtcb;
+#endif
 	}
 
 	/* Mark the input list empty */
@@ -0,0 +1,219 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <queue.h>
+#include <assert.h>
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_READYTORUN_BITMAP
+
+/****************************************************************************
+ * Global Variables
+ ****************************************************************************/
+
+/* The g_readytorun list keeps its order, so everything walking it works
+ * unchanged.  Next to it, g_readytorun_tail[] points to the last TCB of each
+ * priority (so that TCBs of one priority form a FIFO) and g_readytorun_map
+ * has one bit per priority that has at least one ready TCB.  Finding where a
+ * TCB goes is then a bitmap search instead of a walk over all ready TCBs.
+ */
+
+FAR struct tcb_s *g_readytorun_tail[SCHED_PRIORITY_MAX + 1];
+uint32_t g_readytorun_map[READYTORUN_MAP_WORDS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_rtrmap_above
+ *
+ * Description:
+ *   Return the lowest priority above 'priority' with a ready TCB, or -1 if
+ *   there is none.  The lowest set bit is isolated and found with CLZ,
+ *   which is a single instruction on the ARM cores.
+ *
+ ****************************************************************************/
+
+static int sched_rtrmap_above(uint8_t priority)
+{
+	uint32_t bits;
+	int word = priority >> 5;
+
+	bits = g_readytorun_map[word] & ~((2u << (priority & 31)) - 1);
+	while (bits == 0) {
+		if (++word >= READYTORUN_MAP_WORDS) {
+			return -1;
+		}
+		bits = g_readytorun_map[word];
+	}
+
+	return (word << 5) + 31 - __builtin_clz(bits & -bits);
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: sched_rtrmap_add
+ *
+ * Description:
+ *   Add a TCB to the g_readytorun list behind all TCBs of the same or a
+ *   higher priority.  This is what sched_addprioritized() does for the
+ *   g_readytorun list, without walking it.
+ *
+ * Inputs:
+ *   tcb - Points to the TCB to add
+ *
+ * Return Value:
+ *   true if the head of the list has changed.
+ *
+ * Assumptions:
+ *   Same as sched_addprioritized().
+ *
+ ****************************************************************************/
+
+bool sched_rtrmap_add(FAR struct tcb_s *tcb)
+{
+	FAR dq_queue_t *list = (FAR dq_queue_t *)&g_readytorun;
+	FAR struct tcb_s *prev;
+	uint8_t priority = tcb->sched_priority;
+	int above;
+
+	prev = g_readytorun_tail[priority];
+	if (prev == NULL) {
+		/* First TCB of this priority, it goes behind the last TCB of the
+		 * next higher priority in the list.
+		 */
+
+		above = sched_rtrmap_above(priority);
+		if (above >= 0) {
+			prev = g_readytorun_tail[above];
+			DEBUGASSERT(prev != NULL);
+		}
+		g_readytorun_map[priority >> 5] |= (uint32_t)1 << (priority & 31);
+	}
+	g_readytorun_tail[priority] = tcb;
+
+	if (prev == NULL) {
+		/* Nothing of a higher or the same priority is ready */
+
+		tcb->flink = (FAR struct tcb_s *)list->head;
+		tcb->blink = NULL;
+		if (list->head) {
+			((FAR struct tcb_s *)list->head)->blink = tcb;
+		} else {
+			list->tail = (FAR dq_entry_t *)tcb;
+		}
+		list->head = (FAR dq_entry_t *)tcb;
+		return true;
+	}
+
+	tcb->flink = prev->flink;
+	tcb->blink = prev;
+	if (prev->flink) {
+		prev->flink->blink = tcb;
+	} else {
+		list->tail = (FAR dq_entry_t *)tcb;
+	}
+	prev->flink = tcb;
+
+	return false;
+}
+
+/****************************************************************************
+ * Name: sched_rtrmap_rem
+ *
+ * Description:
+ *   Remove a TCB from the g_readytorun list and the priority index.  Any
+ *   code removing a TCB from g_readytorun has to come through here, which
+ *   sched_tasklist_rem() takes care of.
+ *
+ * Inputs:
+ *   tcb - Points to the TCB to remove
+ *
+ * Assumptions:
+ *   The caller has established a critical section.
+ *
+ ****************************************************************************/
+
+void sched_rtrmap_rem(FAR struct tcb_s *tcb)
+{
+	uint8_t priority = tcb->sched_priority;
+
+	if (g_readytorun_tail[priority] == tcb) {
+		if (tcb->blink && tcb->blink->sched_priority == priority) {
+			g_readytorun_tail[priority] = tcb->blink;
+		} else {
+			g_readytorun_tail[priority] = NULL;
+			g_readytorun_map[priority >> 5] &= ~((uint32_t)1 << (priority & 31));
+		}
+	}
+
+	dq_rem((FAR dq_entry_t *)tcb, (FAR dq_queue_t *)&g_readytorun);
+}
+
+/****************************************************************************
+ * Name: sched_rtrmap_setpriority
+ *
+ * Description:
+ *   Change the priority of the running task without moving it.  The caller
+ *   has made sure it stays ahead of every other ready TCB, which is the
+ *   only case where sched_setpriority() changes a priority in place.
+ *
+ * Inputs:
+ *   tcb - The running task at the head of g_readytorun
+ *   priority - Its new priority
+ *
+ ****************************************************************************/
+
+void sched_rtrmap_setpriority(FAR struct tcb_s *tcb, uint8_t priority)
+{
+	uint8_t old = tcb->sched_priority;
+
+	DEBUGASSERT(tcb->blink == NULL);
+	DEBUGASSERT(tcb->flink == NULL || tcb->flink->sched_priority <= priority);
+
+	if (g_readytorun_tail[old] == tcb) {
+		g_readytorun_tail[old] = NULL;
+		g_readytorun_map[old >> 5] &= ~((uint32_t)1 << (old & 31));
+	}
+
+	tcb->sched_priority = priority;
+
+	/* Being the head, it is the last of its priority only if nothing else
+	 * of that priority is ready.
+	 */
+
+	if (g_readytorun_tail[priority] == NULL) {
+		g_readytorun_tail[priority] = tcb;
+		g_readytorun_map[priority >> 5] |= (uint32_t)1 << (priority & 31);
+	}
+}
+
+#endif /* CONFIG_SCHED_READYTORUN_BITMAP */
@@ -66,6 +66,7 @@
 #include "sched/sched.h"
 #include "group/group.h"
 #include "timer/timer.h"
+#include "semaphore/semaphore.h"
 #ifdef CONFIG_BINARY_MANAGER
 #include "binary_manager/binary_manager_internal.h"
 #endif
@@ -157,6 +158,10 @@ int sched_releasetcb(FAR struct tcb_s *tcb, uint8_t ttype)
 			sched_releasepid(tcb->pid);
 		}
 
+		/* Drop any holder entries that still refer to this TCB */
+
+		sem_releaseall(tcb);
+
 		/* Delete the thread's stack if one has been allocated */
 
 		if (tcb->stack_alloc_ptr) {
@@ -138,7 +138,7 @@ bool sched_removereadytorun(FAR struct tcb_s *rtcb)
 
 	/* Remove the TCB from the ready-to-run list */
 
-	dq_rem((FAR dq_entry_t *)rtcb, tasklist);
+	sched_tasklist_rem(rtcb, tasklist);
 
 	/* Since the TCB is not in any list, it is now invalid */
 
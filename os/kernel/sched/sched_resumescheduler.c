@@ -29,6 +29,7 @@
 #include <tinyara/sched.h>
 #include <tinyara/clock.h>
 #include <tinyara/sched_note.h>
+#include <tinyara/sched_trace.h>
 
 #include "irq/irq.h"
 #include "sched/sched.h"
@@ -74,6 +75,9 @@ void sched_resume_scheduler(FAR struct tcb_s *tcb)
 #ifdef CONFIG_SCHED_INSTRUMENTATION
   sched_note_resume(tcb);
 #endif
+#ifdef CONFIG_SCHED_TRACE
+  sched_trace_switch(tcb);
+#endif
 }
 
 #endif /* CONFIG_RR_INTERVAL > 0 || CONFIG_SCHED_RESUMESCHEDULER */
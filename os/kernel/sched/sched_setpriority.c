@@ -236,7 +236,7 @@ int sched_setpriority(FAR struct tcb_s *tcb, int sched_priority)
 				} while (sched_priority < ntcb->sched_priority);
 
 				/* Change the task priority */
-				tcb->sched_priority = (uint8_t)sched_priority;
+				sched_running_setpriority(tcb, sched_priority);
 
 			} else {
 				up_reprioritize_rtr(tcb, (uint8_t)sched_priority);
@@ -248,7 +248,7 @@ int sched_setpriority(FAR struct tcb_s *tcb, int sched_priority)
 		else {
 			/* Change the task priority */
 
-			tcb->sched_priority = (uint8_t)sched_priority;
+			sched_running_setpriority(tcb, sched_priority);
 		}
 		break;
 
@@ -0,0 +1,188 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <tinyara/arch.h>
+#include <tinyara/irq.h>
+#include <tinyara/clock.h>
+#include <tinyara/sched_trace.h>
+#ifdef CONFIG_SMP
+#include <tinyara/spinlock.h>
+#endif
+
+#include "sched/sched.h"
+
+#ifdef CONFIG_SCHED_TRACE
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#if (CONFIG_SCHED_TRACE_NEVENTS & (CONFIG_SCHED_TRACE_NEVENTS - 1)) != 0
+#error "CONFIG_SCHED_TRACE_NEVENTS must be a power of two"
+#endif
+
+#define SCHED_TRACE_MASK (CONFIG_SCHED_TRACE_NEVENTS - 1)
+
+#ifdef CONFIG_ARCH_HAVE_TRACE_TIMESTAMP
+#define sched_trace_time() up_trace_timestamp()
+#else
+#define sched_trace_time() ((uint32_t)clock_systimer())
+#endif
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* Each CPU only ever writes its own buffer, with its interrupts disabled,
+ * so recording needs neither a spinlock nor the critical section.  head
+ * counts all events since boot and is advanced after the event is written.
+ */
+
+struct sched_trace_cpu_s {
+	volatile uint32_t head;
+	pid_t running;
+	struct sched_trace_event_s events[CONFIG_SCHED_TRACE_NEVENTS];
+};
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+static struct sched_trace_cpu_s g_sched_trace[SCHED_TRACE_NCPUS];
+static volatile bool g_sched_trace_enabled = true;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static inline void sched_trace_put(FAR struct sched_trace_cpu_s *trace, int cpu, uint8_t type, pid_t pid, uint32_t arg)
+{
+	FAR struct sched_trace_event_s *event;
+	uint32_t head = trace->head;
+
+	event = &trace->events[head & SCHED_TRACE_MASK];
+	event->time = sched_trace_time();
+	event->arg = arg;
+	event->pid = pid;
+	event->type = type;
+	event->cpu = cpu;
+
+#ifdef CONFIG_SMP
+	/* Another CPU may be taking a snapshot */
+
+	SP_DMB();
+#endif
+	trace->head = head + 1;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+void sched_trace_add(uint8_t type, pid_t pid, uint32_t arg)
+{
+	irqstate_t flags;
+	int cpu;
+
+	if (!g_sched_trace_enabled) {
+		return;
+	}
+
+	flags = irqsave();
+	cpu = this_cpu();
+	sched_trace_put(&g_sched_trace[cpu], cpu, type, pid, arg);
+	irqrestore(flags);
+}
+
+void sched_trace_switch(FAR struct tcb_s *tcb)
+{
+	FAR struct sched_trace_cpu_s *trace;
+	irqstate_t flags;
+	uint32_t arg;
+	int cpu;
+
+	if (!g_sched_trace_enabled) {
+		return;
+	}
+
+	flags = irqsave();
+	cpu = this_cpu();
+	trace = &g_sched_trace[cpu];
+	if (trace->running != tcb->pid) {
+		arg = (uint16_t)trace->running | ((uint32_t)tcb->sched_priority << 16);
+		trace->running = tcb->pid;
+		sched_trace_put(trace, cpu, SCHED_TRACE_SWITCH, tcb->pid, arg);
+	}
+	irqrestore(flags);
+}
+
+void sched_trace_enable(bool enable)
+{
+	g_sched_trace_enabled = enable;
+}
+
+int sched_trace_snapshot(int cpu, FAR struct sched_trace_event_s *events, FAR uint32_t *total)
+{
+	FAR struct sched_trace_cpu_s *trace;
+	uint32_t first;
+	uint32_t head;
+	uint32_t i;
+
+	if (cpu < 0 || cpu >= SCHED_TRACE_NCPUS) {
+		*total = 0;
+		return 0;
+	}
+
+	trace = &g_sched_trace[cpu];
+	head = trace->head;
+#ifdef CONFIG_SMP
+	SP_DMB();
+#endif
+	first = head > CONFIG_SCHED_TRACE_NEVENTS ? head - CONFIG_SCHED_TRACE_NEVENTS : 0;
+
+	for (i = first; i != head; i++) {
+		events[i - first] = trace->events[i & SCHED_TRACE_MASK];
+	}
+
+	/* Anything recorded meanwhile has overwritten the oldest events, which
+	 * are dropped from the copy.
+	 */
+
+	*total = trace->head;
+	if (*total - first > CONFIG_SCHED_TRACE_NEVENTS) {
+		i = *total - first - CONFIG_SCHED_TRACE_NEVENTS;
+		if (i >= head - first) {
+			return 0;
+		}
+		memmove(events, events + i, (head - first - i) * sizeof(struct sched_trace_event_s));
+		first += i;
+	}
+
+	return head - first;
+}
+
+#endif							/* CONFIG_SCHED_TRACE */
@@ -104,41 +104,44 @@ static FAR struct semholder_s *g_freeholders;
  * Name: sem_allocholder
  ****************************************************************************/
 
-static inline FAR struct semholder_s *sem_allocholder(sem_t *sem)
+static inline FAR struct semholder_s *sem_allocholder(sem_t *sem, FAR struct tcb_s *htcb)
 {
 	FAR struct semholder_s *pholder;
 
-	/* Check if the "built-in" holder is being used.  We have this built-in
-	 * holder to optimize for the simplest case where semaphores are only
-	 * used to implement mutexes.
+	/* Use the holder built into the semaphore if it is free.  This is all
+	 * that is ever needed when the semaphore is used as a mutex.
 	 */
 
+	if (!sem->holder.htcb) {
+		pholder = &sem->holder;
+	}
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-	pholder = g_freeholders;
-	if (pholder) {
+	else if (g_freeholders) {
 		/* Remove the holder from the free list an put it into the semaphore's
 		 * holder list
 		 */
 
+		pholder = g_freeholders;
 		g_freeholders = pholder->flink;
 		pholder->flink = sem->hhead;
 		sem->hhead = pholder;
-
-		/* Make sure the initial count is zero */
-
-		pholder->counts = 0;
-	}
-#else
-	if (!sem->holder.htcb) {
-		pholder = &sem->holder;
-		pholder->counts = 0;
 	}
 #endif
 	else {
 		sdbg("Insufficient pre-allocated holders\n");
-		pholder = NULL;
+		return NULL;
 	}
 
+	/* Make sure the initial count is zero and add it to the semaphores held
+	 * by the thread.
+	 */
+
+	pholder->counts = 0;
+	pholder->sem = sem;
+	pholder->htcb = htcb;
+	pholder->tlink = htcb->holdsem;
+	htcb->holdsem = pholder;
+
 	return pholder;
 }
 
@@ -150,7 +153,7 @@ static inline FAR struct semholder_s *sem_findorallocateholder(sem_t *sem, FAR s
 {
 	FAR struct semholder_s *pholder = sem_findholder(sem, htcb);
 	if (!pholder) {
-		pholder = sem_allocholder(sem);
+		pholder = sem_allocholder(sem, htcb);
 	}
 
 	return pholder;
@@ -162,17 +165,36 @@ static inline FAR struct semholder_s *sem_findorallocateholder(sem_t *sem, FAR s
 
 void sem_freeholder(sem_t *sem, FAR struct semholder_s *pholder)
 {
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
 	FAR struct semholder_s *curr;
 	FAR struct semholder_s *prev;
-#endif
+
+	/* Remove the holder from the semaphores held by the thread.  A thread
+	 * rarely holds more than a few.
+	 */
+
+	if (pholder->htcb) {
+		for (prev = NULL, curr = pholder->htcb->holdsem; curr && curr != pholder; prev = curr, curr = curr->tlink) ;
+
+		if (curr) {
+			if (prev) {
+				prev->tlink = pholder->tlink;
+			} else {
+				pholder->htcb->holdsem = pholder->tlink;
+			}
+		}
+	}
 
 	/* Release the holder and counts */
 
 	pholder->htcb = NULL;
+	pholder->tlink = NULL;
 	pholder->counts = 0;
 
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
+	if (pholder == &sem->holder) {
+		return;
+	}
+
 	/* Search the list for the matching holder */
 
 	for (prev = NULL, curr = sem->hhead; curr && curr != pholder; prev = curr, curr = curr->flink) ;
@@ -206,25 +228,26 @@ static int sem_foreachholder(FAR sem_t *sem, holderhandler_t handler, FAR void *
 #endif
 	int ret = 0;
 
+	/* The built-in holder comes first, it may hold a NULL holder */
+
+	if (sem->holder.htcb) {
+		ret = handler(&sem->holder, sem, arg);
+	}
+
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-	for (pholder = sem->hhead; pholder && ret == 0; pholder = next)
-#else
-	pholder = &sem->holder;
-#endif
-	{
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
+	for (pholder = sem->hhead; pholder && ret == 0; pholder = next) {
 		/* In case this holder gets deleted */
 
 		next = pholder->flink;
-#endif
-		/* The initial "built-in" container may hold a NULL holder */
-
 		if (pholder->htcb) {
 			/* Call the handler */
 
 			ret = handler(pholder, sem, arg);
 		}
 	}
+#else
+	UNUSED(pholder);
+#endif
 
 	return ret;
 }
@@ -233,13 +256,11 @@ static int sem_foreachholder(FAR sem_t *sem, holderhandler_t handler, FAR void *
  * Name: sem_recoverholders
  ****************************************************************************/
 
-#if CONFIG_SEM_PREALLOCHOLDERS > 0
 static int sem_recoverholders(FAR struct semholder_s *pholder, FAR sem_t *sem, FAR void *arg)
 {
 	sem_freeholder(sem, pholder);
 	return 0;
 }
-#endif
 
 #ifdef CONFIG_PRIORITY_INHERITANCE
 
@@ -728,8 +749,11 @@ void sem_initholders(void)
  * Name: sem_destroyholder
  *
  * Description:
- *   Called from sem_destroyholder() to handle any holders of a semaphore
- *   when it is destroyed.
+ *   Called from sem_destroy() to handle any holders of a semaphore
+ *   when it is destroyed.  The holder records are linked into the lists of
+ *   the holder threads through the semaphore itself, so this is the last
+ *   point at which they can be unlinked: a semaphore on which counts are
+ *   still held must be destroyed before its memory is freed or reused.
  *
  * Parameters:
  *   sem - A reference to the semaphore being destroyed
@@ -743,6 +767,8 @@ void sem_initholders(void)
 
 void sem_destroyholder(FAR sem_t *sem)
 {
+	irqstate_t flags;
+
 	/* It is an error if a semaphore is destroyed while there are any holders
 	 * (except perhaps the thread release the semaphore itself).  Hmmm.. but
 	 * we actually have to assume that the caller knows what it is doing because
@@ -751,21 +777,20 @@ void sem_destroyholder(FAR sem_t *sem)
 	 * state of any of the holder threads.
 	 *
 	 * So just recover any stranded holders and hope the task knows what it is
-	 * doing.
+	 * doing.  Interrupts are disabled because the lists of the holder threads
+	 * are changed, as sem_releaseall() does.
 	 */
 
+	flags = enter_critical_section();
+	if (sem->holder.htcb
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-	if (sem->hhead) {
+		|| sem->hhead
+#endif
+	   ) {
 		sdbg("Semaphore destroyed with holders\n");
 		(void)sem_foreachholder(sem, sem_recoverholders, NULL);
 	}
-#else
-	if (sem->holder.htcb) {
-		sdbg("Semaphore destroyed with holder\n");
-	}
-
-	sem->holder.htcb = NULL;
-#endif
+	leave_critical_section(flags);
 }
 
 /****************************************************************************
@@ -774,30 +799,66 @@ void sem_destroyholder(FAR sem_t *sem)
 
 struct semholder_s *sem_findholder(sem_t *sem, FAR struct tcb_s *htcb)
 {
+#if CONFIG_SEM_PREALLOCHOLDERS > 0
 	FAR struct semholder_s *pholder;
+#endif
+
+	/* The built-in holder is the only one unless several threads hold
+	 * counts at the same time.
+	 */
+
+	if (sem->holder.htcb == htcb) {
+		return &sem->holder;
+	}
 
 	/* Try to find the holder in the list of holders associated with this
 	 * semaphore
 	 */
 
 #if CONFIG_SEM_PREALLOCHOLDERS > 0
-	for (pholder = sem->hhead; pholder; pholder = pholder->flink)
-#else
-	pholder = &sem->holder;
-#endif
-	{
+	for (pholder = sem->hhead; pholder; pholder = pholder->flink) {
 		if (pholder->htcb == htcb) {
 			/* Got it! */
 
 			return pholder;
 		}
 	}
+#endif
 
 	/* The holder does not appear in the list */
 
 	return NULL;
 }
 
+/****************************************************************************
+ * Name: sem_releaseall
+ *
+ * Description:
+ *   Called when the TCB of a thread is released to drop its holder entries
+ *   on all semaphores on which it still holds counts, so that no semaphore
+ *   keeps a reference to the freed TCB.  The counts themselves are lost.
+ *
+ * Parameters:
+ *   htcb - The TCB of the thread being released
+ *
+ * Return Value:
+ *   None
+ *
+ * Assumptions:
+ *   Interrupts are disabled.
+ *
+ ****************************************************************************/
+
+void sem_releaseall(FAR struct tcb_s *htcb)
+{
+	FAR struct semholder_s *pholder;
+
+	while ((pholder = htcb->holdsem) != NULL) {
+		sdbg("TCB 0x%08x released with counts on 0x%08x\n", htcb, pholder->sem);
+		sem_freeholder(pholder->sem, pholder);
+	}
+}
+
 /****************************************************************************
  * Name: sem_addholder_tcb
  *
@@ -836,11 +897,7 @@ void sem_addholder_tcb(FAR struct tcb_s *htcb, FAR sem_t *sem)
 		/* Find or allocate a container for this new holder */
 		pholder = sem_findorallocateholder(sem, htcb);
 		if (pholder != NULL) {
-			/*
-			 * Then set the holder and increment the number of
-			 * counts held by this holder
-			 */
-			pholder->htcb = htcb;
+			/* Increment the number of counts held by this holder */
 			pholder->counts++;
 		}
 #if defined(CONFIG_PRIORITY_INHERITANCE) && !defined(CONFIG_BINMGR_RECOVERY)
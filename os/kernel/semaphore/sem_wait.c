@@ -62,6 +62,7 @@
 #include <assert.h>
 #include <tinyara/arch.h>
 #include <tinyara/cancelpt.h>
+#include <tinyara/sched_trace.h>
 
 #include "sched/sched.h"
 #include "semaphore/semaphore.h"
@@ -217,6 +218,7 @@ int sem_wait(FAR sem_t *sem)
 			/* Add the TCB to the prioritized semaphore wait queue */
 
 			set_errno(0);
+			sched_trace_sem_wait(rtcb, sem);
 			up_block_task(rtcb, TSTATE_WAIT_SEM);
 
 			/* When we resume at this point, either (1) the semaphore has been
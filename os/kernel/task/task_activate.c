@@ -133,8 +133,10 @@ int task_activate(FAR struct tcb_s *tcb)
 	pid_t hash_pid;
 	struct mm_heap_s *heap = kmm_get_heap(tcb->stack_alloc_ptr);
 
+	/* A slot held by another pid belongs to a dead task, take it over */
+
 	hash_pid = PIDHASH(tcb->pid);
-	if (heap && heap->alloc_list[hash_pid].pid == HEAPINFO_INIT_INFO) {
+	if (heap && heap->alloc_list[hash_pid].pid != tcb->pid) {
 		heap->alloc_list[hash_pid].pid = tcb->pid;
 		heap->alloc_list[hash_pid].curr_alloc_size = 0;
 		heap->alloc_list[hash_pid].peak_alloc_size = 0;
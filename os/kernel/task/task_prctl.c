@@ -76,6 +76,9 @@
 #endif
 #include "sched/sched.h"
 #include "task/task.h"
+#ifdef CONFIG_WDOG_TIMER_SLACK
+#include "wdog/wdog.h"
+#endif
 
 #ifdef CONFIG_TASK_MONITOR
 #include "task_monitor/task_monitor_internal.h"
@@ -431,6 +434,28 @@ int prctl(int option, ...)
 		va_end(ap);
 		return OK;
 	}
+#ifdef CONFIG_WDOG_TIMER_SLACK
+	case PR_SET_TIMERSLACK:
+	{
+		int slack = va_arg(ap, int);
+		if (slack < 0) {
+			err = EINVAL;
+			goto errout;
+		}
+		if (slack == 0) {
+			slack = CONFIG_WDOG_TIMER_SLACK_DEFAULT;
+		}
+		this_task()->timer_slack = WDOG_USEC2SLACK(slack);
+		va_end(ap);
+		return OK;
+	}
+	case PR_GET_TIMERSLACK:
+	{
+		int slack = TICK2USEC(this_task()->timer_slack);
+		va_end(ap);
+		return slack;
+	}
+#endif
 	default:
 		sdbg("Unrecognized option: %d\n", option);
 		err = EINVAL;
@@ -472,6 +472,12 @@ static int thread_schedsetup(FAR struct tcb_s *tcb, int priority, start_t start,
 		(void)sigprocmask(SIG_SETMASK, NULL, &tcb->sigprocmask);
 #endif
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+		/* All threads inherit the timer slack of their creator */
+
+		tcb->timer_slack = this_task()->timer_slack;
+#endif
+
 		/* Initialize the task state.  It does not get a valid state
 		 * until it is activated.
 		 */
@@ -207,7 +207,7 @@ int task_terminate(pid_t pid, bool nonblocking)
 
 	/* Remove the task from the task list */
 
-	dq_rem((FAR dq_entry_t *)dtcb, tasklist);
+	sched_tasklist_rem(dtcb, tasklist);
 
 	/* If the task was terminated by another task, it may be in an unknown
 	 * state.  Make some feeble effort to recover the state.
@@ -138,7 +138,7 @@ int task_terminate_unloaded(FAR struct tcb_s *tcb)
 	sig_cleanup(tcb);
 
 	saved_state = enter_critical_section();
-	dq_rem((FAR dq_entry_t *)tcb, (dq_queue_t *)g_tasklisttable[tcb->task_state].list);
+	sched_tasklist_rem(tcb, g_tasklisttable[tcb->task_state].list);
 	leave_critical_section(saved_state);
 
 #ifdef CONFIG_TASK_MONITOR
@@ -65,6 +65,7 @@
 #include <tinyara/wdog.h>
 #include <tinyara/kmalloc.h>
 
+#include "sched/sched.h"
 #include "timer/timer.h"
 
 #ifndef CONFIG_DISABLE_POSIX_TIMERS
@@ -229,6 +230,14 @@ int timer_create(clockid_t clockid, FAR struct sigevent *evp, FAR timer_t *timer
 	ret->pt_delay = 0;
 	ret->pt_wdog = wdog;
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+	/* A periodic timer is restarted from the timer interrupt, where the
+	 * slack of the owner would not apply, so give it to the watchdog.
+	 */
+
+	(void)wd_setslack(wdog, this_task()->timer_slack);
+#endif
+
 	if (evp) {
 		ret->pt_signo = evp->sigev_signo;
 #ifdef CONFIG_CAN_PASS_STRUCTS
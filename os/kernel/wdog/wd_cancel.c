@@ -108,8 +108,10 @@
 
 int wd_cancel(WDOG_ID wdog)
 {
+#ifndef CONFIG_WDOG_TIMING_WHEEL
 	FAR struct wdog_s *curr;
 	FAR struct wdog_s *prev;
+#endif
 	irqstate_t state;
 	int ret = ERROR;
 
@@ -124,6 +126,25 @@ int wd_cancel(WDOG_ID wdog)
 	 */
 
 	if (wdog && WDOG_ISACTIVE(wdog)) {
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+#ifdef CONFIG_SCHED_TICKLESS
+		bool first = (wdog->expire - g_wdnow) <= wd_wheel_next();
+#endif
+
+		/* The watchdog knows its slot of the wheel */
+
+		wd_wheel_remove(wdog);
+
+#ifdef CONFIG_SCHED_TICKLESS
+		/* If it was the next to expire, reassess the interval timer that
+		 * will generate the next interval event.
+		 */
+
+		if (first) {
+			sched_timer_reassess();
+		}
+#endif
+#else
 		/* Search the g_wdactivelist for the target FCB.  We can't use sq_rem
 		 * to do this because there are additional operations that need to be
 		 * done.
@@ -169,9 +190,11 @@ int wd_cancel(WDOG_ID wdog)
 			sched_timer_reassess();
 		}
 
+		wdog->next = NULL;
+#endif
+
 		/* Mark the watchdog inactive */
 
-		wdog->next = NULL;
 		WDOG_CLRACTIVE(wdog);
 
 		/* Return success */
@@ -41,7 +41,11 @@ static inline void wd_dump(struct wdog_s *wdog)
 {
 	int index = 0;
 	lldbg("Wdog address = 0x%08x\n", wdog);
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	lldbg("expire: %u\n", wdog->expire);
+#else
 	lldbg("lag: %d\n", wdog->lag);
+#endif
 	lldbg("flags: %u\n", wdog->flags);
 	lldbg("pid: %d\n", wdog->pid);
 	lldbg("func: %p\n", wdog->func);
@@ -1,6 +1,6 @@
 /****************************************************************************
  *
- * Copyright 2016 Samsung Electronics All Rights Reserved.
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
  *
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
@@ -15,38 +15,44 @@
  * language governing permissions and limitations under the License.
  *
  ****************************************************************************/
-#ifndef __RW_LOCKS_H__
-#define __RW_LOCKS_H__
 
 /****************************************************************************
  * Included Files
  ****************************************************************************/
-#include <sys/types.h>
 
-/****************************************************************************
-* Public Type Definitions
-****************************************************************************/
-struct rw_lock_s {
-	pthread_mutex_t mutex;
-	pthread_cond_t noWriters;
-	pthread_cond_t noActiveWriter;
-	pthread_cond_t noReaders;
-	int readers;
-	int writers;
-	bool writerActive;
-};
+#include <tinyara/config.h>
 
-/****************************************************************************
-* Global Function Prototypes
-****************************************************************************/
-void rw_init(struct rw_lock_s *rwLock);
-void rw_lock_read(struct rw_lock_s *rwLock);
-void rw_unlock_read(struct rw_lock_s *rwLock);
+#include <tinyara/irq.h>
+#include <tinyara/wdog.h>
+
+#include "wdog/wdog.h"
 
-int rw_trylock_write(struct rw_lock_s *rwLock);
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
 
-void rw_lock_write(struct rw_lock_s *rwLock);
+/****************************************************************************
+ * Name: wd_getstats
+ *
+ * Description:
+ *   Copy the counters of watchdog expirations since boot: the timer events
+ *   that expired watchdogs, the watchdogs that expired and the watchdogs
+ *   whose expiry was moved within their timer slack.  The difference of
+ *   two copies gives the wakeups caused by watchdogs in between.
+ *
+ * Parameters:
+ *   stats - Location to return the counters.
+ *
+ * Return Value:
+ *   None
+ *
+ ****************************************************************************/
 
-void rw_unlock_write(struct rw_lock_s *rwLock);
+void wd_getstats(FAR struct wdog_stats_s *stats)
+{
+	irqstate_t flags;
 
-#endif							/* __RW_LOCKS_H__ */
+	flags = enter_critical_section();
+	*stats = g_wdstats;
+	leave_critical_section(flags);
+}
@@ -109,6 +109,14 @@ int wd_gettime(WDOG_ID wdog)
 	/* Verify the wdog */
 
 	flags = enter_critical_section();
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	if (wdog && WDOG_ISACTIVE(wdog)) {
+		int delay = (int)(wdog->expire - wd_wheel_now());
+
+		leave_critical_section(flags);
+		return delay;
+	}
+#else
 	if (wdog && WDOG_ISACTIVE(wdog)) {
 		/* Traverse the watchdog list accumulating lag times until we find the wdog
 		 * that we are looking for
@@ -125,6 +133,7 @@ int wd_gettime(WDOG_ID wdog)
 			}
 		}
 	}
+#endif
 
 	leave_critical_section(flags);
 	return 0;
@@ -150,6 +159,20 @@ int wd_gettime(WDOG_ID wdog)
 
 int wd_getdelay(void)
 {
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	/* This may be earlier than the next expiration if watchdogs have to move
+	 * down the wheel first, which only costs an early wakeup.
+	 */
+
+	uint32_t next = wd_wheel_next();
+
+	if (next == 0) {
+		return 0;
+	}
+
+	return next > g_wdmissed ? next - g_wdmissed : 1;
+#else
 	return (g_wdactivelist.head) ? ((FAR struct wdog_s *)g_wdactivelist.head)->lag : 0;
+#endif
 }
 #endif
@@ -72,6 +72,14 @@ clock_t wd_getwakeupdelay(void)
 	irqstate_t flags;
 
 	flags = enter_critical_section();
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	curr = wd_wheel_first(WDOGF_WAKEUP);
+	if (curr) {
+		delay = (clock_t)(curr->expire - wd_wheel_now());
+		leave_critical_section(flags);
+		return delay;
+	}
+#else
 	for (curr = (FAR struct wdog_s *)g_wdactivelist.head; curr; curr = curr->next) {
 		delay += curr->lag;
 		if (WDOG_ISWAKEUP(curr)) {
@@ -79,6 +87,7 @@ clock_t wd_getwakeupdelay(void)
 			return delay;
 		}
 	}
+#endif
 
 	leave_critical_section(flags);
 	return 0;
@@ -92,6 +92,10 @@ sq_queue_t g_wdactivelist;
 
 uint16_t g_wdnfree;
 
+/* Counters of watchdog expirations and coalescing */
+
+struct wdog_stats_s g_wdstats;
+
 /************************************************************************
  * Private Data
  ************************************************************************/
@@ -0,0 +1,64 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <errno.h>
+
+#include <tinyara/wdog.h>
+
+#include "wdog/wdog.h"
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_setslack
+ *
+ * Description:
+ *   Give a watchdog its own timer slack, the number of ticks it may expire
+ *   later than asked so that it shares a timer event with other watchdogs.
+ *   This overrides the timer slack of the task that starts the watchdog.
+ *   A slack of zero makes the watchdog exact.
+ *
+ * Parameters:
+ *   wdog  - ID of the watchdog.
+ *   slack - The timer slack in ticks.
+ *
+ * Return Value:
+ *   Returns OK or ERROR
+ *
+ ****************************************************************************/
+
+int wd_setslack(WDOG_ID wdog, int slack)
+{
+	if (!wdog || slack < 0 || slack > UINT16_MAX) {
+		set_errno(EINVAL);
+		return ERROR;
+	}
+
+	wdog->slack = (uint16_t)slack;
+	wdog->flags |= WDOGF_SLACK;
+	return OK;
+}
@@ -59,6 +59,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdarg.h>
+#include <limits.h>
 #include <unistd.h>
 #include <sched.h>
 #include <assert.h>
@@ -111,6 +112,217 @@ typedef void (*wdentry4_t)(int argc, uint32_t arg1, uint32_t arg2, uint32_t arg3
 /****************************************************************************
  * Private Functions
  ****************************************************************************/
+/****************************************************************************
+ * Name: wd_execute
+ *
+ * Description:
+ *   Execute the function of a watchdog that has expired and has been
+ *   removed from the active watchdogs.
+ *
+ * Parameters:
+ *   wdog - The expired watchdog
+ *
+ * Return Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static inline void wd_execute(FAR struct wdog_s *wdog)
+{
+	/* Indicate that the watchdog is no longer active. */
+
+	WDOG_CLRACTIVE(wdog);
+	g_wdstats.expired++;
+
+	/* Execute the watchdog function */
+
+	up_setpicbase(wdog->picbase);
+	switch (wdog->argc) {
+	default:
+		wd_corruption_dbg(wdog);
+		DEBUGPANIC();
+		break;
+
+	case 0:
+		(*((wdentry0_t)(wdog->func)))(0);
+		break;
+
+#if CONFIG_MAX_WDOGPARMS > 0
+	case 1:
+		(*((wdentry1_t)(wdog->func)))(1, wdog->parm[0]);
+		break;
+#endif
+#if CONFIG_MAX_WDOGPARMS > 1
+	case 2:
+		(*((wdentry2_t)(wdog->func)))(2, wdog->parm[0], wdog->parm[1]);
+		break;
+#endif
+#if CONFIG_MAX_WDOGPARMS > 2
+	case 3:
+		(*((wdentry3_t)(wdog->func)))(3, wdog->parm[0], wdog->parm[1], wdog->parm[2]);
+		break;
+#endif
+#if CONFIG_MAX_WDOGPARMS > 3
+	case 4:
+		(*((wdentry4_t)(wdog->func)))(4, wdog->parm[0], wdog->parm[1], wdog->parm[2], wdog->parm[3]);
+		break;
+#endif
+	}
+}
+
+/****************************************************************************
+ * Name: wd_countwakeup
+ *
+ * Description:
+ *   Count a timer event as a wakeup if it expired watchdogs.
+ *
+ * Parameters:
+ *   expired - The number of expired watchdogs before the timer event
+ *
+ * Return Value:
+ *   None
+ *
+ ****************************************************************************/
+
+static inline void wd_countwakeup(uint32_t expired)
+{
+	if (g_wdstats.expired != expired) {
+		g_wdstats.wakeups++;
+	}
+}
+
+#ifdef CONFIG_WDOG_TIMER_SLACK
+/****************************************************************************
+ * Name: wd_slack
+ *
+ * Description:
+ *   Return the timer slack of a watchdog that is being started: its own if
+ *   it has one, else the one of the calling task.  Watchdogs started from
+ *   interrupt handlers are exact.
+ *
+ ****************************************************************************/
+
+static inline int wd_slack(FAR struct wdog_s *wdog)
+{
+	if ((wdog->flags & WDOGF_SLACK) != 0) {
+		return wdog->slack;
+	}
+
+	if (up_interrupt_context()) {
+		return 0;
+	}
+
+	return this_task()->timer_slack;
+}
+
+/****************************************************************************
+ * Name: wd_coalesce
+ *
+ * Description:
+ *   Choose when a watchdog expires, between 'delay' and 'delay' + 'slack'
+ *   ticks from now.  It joins the next expiry already planned if that is
+ *   in range.  Otherwise it expires on a multiple of the largest power of
+ *   two not above its slack, where the watchdogs started later with a
+ *   similar slack meet it.
+ *
+ * Parameters:
+ *   delay - The exact delay in ticks
+ *   slack - The tolerated extra delay in ticks
+ *
+ * Return Value:
+ *   The delay to use
+ *
+ * Assumptions:
+ *   Called in a critical section, after the interval timer was cancelled
+ *   so that the delay of the next expiry is up to date.
+ *
+ ****************************************************************************/
+
+static int wd_coalesce(int delay, int slack)
+{
+	uint32_t next;
+	uint32_t align;
+	uint32_t expire;
+
+	if (slack <= 0 || delay > INT_MAX - slack) {
+		return delay;
+	}
+
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	next = wd_wheel_next();
+#ifdef CONFIG_SCHED_TICKSUPPRESS
+	/* wd_wheel_next() counts from before the ticks not processed yet */
+
+	next = next > g_wdmissed ? next - g_wdmissed : 0;
+#endif
+#else
+	next = 0;
+	if (g_wdactivelist.head && ((FAR struct wdog_s *)g_wdactivelist.head)->lag > 0) {
+		next = ((FAR struct wdog_s *)g_wdactivelist.head)->lag;
+	}
+#endif
+
+	if (next >= delay && next - delay <= slack) {
+		return next;
+	}
+
+	for (align = 1; (align << 1) <= slack; align <<= 1) {
+	}
+
+	expire = (uint32_t)clock_systimer() + delay;
+	return delay + ((align - (expire & (align - 1))) & (align - 1));
+}
+#endif							/* CONFIG_WDOG_TIMER_SLACK */
+
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+/****************************************************************************
+ * Name: wd_advance
+ *
+ * Description:
+ *   Advance the timing wheel by a number of ticks and execute the watchdogs
+ *   that expire meanwhile, in the order of their expiration.  Stretches
+ *   without anything to do are skipped in one step.
+ *
+ * Parameters:
+ *   ticks - The number of ticks that have elapsed
+ *
+ * Return Value:
+ *   None
+ *
+ * Assumptions:
+ *   Called from interrupt handler logic with interrupts disabled.
+ *
+ ****************************************************************************/
+
+static void wd_advance(uint32_t ticks)
+{
+	FAR struct wdog_s *wdog;
+	uint32_t next;
+
+#ifdef CONFIG_SCHED_TICKSUPPRESS
+	/* Catch up with the ticks reported by wd_timer_nohz() */
+
+	ticks += g_wdmissed;
+	g_wdmissed = 0;
+#endif
+
+	while (ticks > 0) {
+		next = wd_wheel_next();
+		if (next == 0 || next > ticks) {
+			wd_wheel_step(ticks);
+			break;
+		}
+
+		wd_wheel_step(next);
+		ticks -= next;
+
+		while ((wdog = wd_wheel_expired()) != NULL) {
+			wd_execute(wdog);
+		}
+	}
+}
+
+#else
 /****************************************************************************
  * Name: wd_expiration
  *
@@ -152,47 +364,11 @@ static inline void wd_expiration(void)
 				((FAR struct wdog_s *)g_wdactivelist.head)->lag += wdog->lag;
 			}
 
-			/* Indicate that the watchdog is no longer active. */
-
-			WDOG_CLRACTIVE(wdog);
-
-			/* Execute the watchdog function */
-
-			up_setpicbase(wdog->picbase);
-			switch (wdog->argc) {
-			default:
-				wd_corruption_dbg(wdog);
-				DEBUGPANIC();
-				break;
-
-			case 0:
-				(*((wdentry0_t)(wdog->func)))(0);
-				break;
-
-#if CONFIG_MAX_WDOGPARMS > 0
-			case 1:
-				(*((wdentry1_t)(wdog->func)))(1, wdog->parm[0]);
-				break;
-#endif
-#if CONFIG_MAX_WDOGPARMS > 1
-			case 2:
-				(*((wdentry2_t)(wdog->func)))(2, wdog->parm[0], wdog->parm[1]);
-				break;
-#endif
-#if CONFIG_MAX_WDOGPARMS > 2
-			case 3:
-				(*((wdentry3_t)(wdog->func)))(3, wdog->parm[0], wdog->parm[1], wdog->parm[2]);
-				break;
-#endif
-#if CONFIG_MAX_WDOGPARMS > 3
-			case 4:
-				(*((wdentry4_t)(wdog->func)))(4, wdog->parm[0], wdog->parm[1], wdog->parm[2], wdog->parm[3]);
-				break;
-#endif
-			}
+			wd_execute(wdog);
 		}
 	}
 }
+#endif							/* CONFIG_WDOG_TIMING_WHEEL */
 
 /****************************************************************************
  * Public Functions
@@ -234,11 +410,16 @@ static inline void wd_expiration(void)
 int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
 {
 	va_list ap;
+#ifndef CONFIG_WDOG_TIMING_WHEEL
 	FAR struct wdog_s *curr;
 	FAR struct wdog_s *prev;
 	FAR struct wdog_s *next;
 	int32_t now;
+#endif
 	irqstate_t state;
+#ifdef CONFIG_WDOG_TIMER_SLACK
+	int exact;
+#endif
 	int i;
 
 	/* Verify the wdog */
@@ -298,6 +479,21 @@ int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
 	(void)sched_timer_cancel();
 #endif
 
+#ifdef CONFIG_WDOG_TIMER_SLACK
+	/* Move the expiry within the slack to share a timer event */
+
+	exact = delay;
+	delay = wd_coalesce(delay, wd_slack(wdog));
+	if (delay != exact) {
+		g_wdstats.coalesced++;
+	}
+#endif
+
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+	/* Hang the watchdog into the wheel slot of its expiration time */
+
+	wd_wheel_add(wdog, delay);
+#else
 	/* Do the easy case first -- when the watchdog timer queue is empty. */
 
 	if (g_wdactivelist.head == NULL) {
@@ -369,9 +565,13 @@ int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
 		}
 	}
 
-	/* Put the lag into the watchdog structure and mark it as active. */
+	/* Put the lag into the watchdog structure */
 
 	wdog->lag = delay;
+#endif
+
+	/* Mark the watchdog as active */
+
 	WDOG_SETACTIVE(wdog);
 
 #ifdef CONFIG_SCHED_TICKLESS
@@ -412,10 +612,47 @@ int wd_start(WDOG_ID wdog, int delay, wdentry_t wdentry, int argc, ...)
  *
  ****************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+#ifdef CONFIG_SCHED_TICKLESS
+unsigned int wd_timer(int ticks)
+{
+	uint32_t expired = g_wdstats.expired;
+
+	wd_advance(ticks > 0 ? ticks : 0);
+	wd_countwakeup(expired);
+
+	/* Return the delay until the wheel needs to be looked at again */
+
+	return wd_wheel_next();
+}
+
+#else
+void wd_timer(void)
+{
+	uint32_t expired = g_wdstats.expired;
+
+	wd_advance(1);
+	wd_countwakeup(expired);
+}
+#endif							/* CONFIG_SCHED_TICKLESS */
+
+#ifdef CONFIG_SCHED_TICKSUPPRESS
+void wd_timer_nohz(clock_t ticks)
+{
+	/* The ticks are processed, and the watchdogs that expired meanwhile are
+	 * executed, when wd_timer is called next.
+	 */
+
+	g_wdmissed += ticks;
+}
+#endif
+
+#else							/* CONFIG_WDOG_TIMING_WHEEL */
 #ifdef CONFIG_SCHED_TICKLESS
 unsigned int wd_timer(int ticks)
 {
 	FAR struct wdog_s *wdog;
+	uint32_t expired = g_wdstats.expired;
 	int decr;
 
 	/* Check if there are any active watchdogs to process */
@@ -447,6 +684,8 @@ unsigned int wd_timer(int ticks)
 		wd_expiration();
 	}
 
+	wd_countwakeup(expired);
+
 	/* Return the delay for the next watchdog to expire */
 
 	return g_wdactivelist.head ? ((FAR struct wdog_s *)g_wdactivelist.head)->lag : 0;
@@ -460,11 +699,14 @@ void wd_timer(void)
 	if (g_wdactivelist.head) {
 		/* There are.  Decrement the lag counter */
 
+		uint32_t expired = g_wdstats.expired;
+
 		--(((FAR struct wdog_s *)g_wdactivelist.head)->lag);
 
 		/* Check if the watchdog at the head of the list is ready to run */
 
 		wd_expiration();
+		wd_countwakeup(expired);
 	}
 
 }
@@ -491,3 +733,4 @@ void wd_timer_nohz(clock_t ticks)
 	}
 }
 #endif
+#endif							/* CONFIG_WDOG_TIMING_WHEEL */
@@ -0,0 +1,308 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <assert.h>
+
+#include <tinyara/wdog.h>
+
+#include "wdog/wdog.h"
+
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Level 0 has a slot per tick for the next 64 ticks, level 1 a slot per 64
+ * ticks for the next 4096 ticks and so on.  When the time reaches the start
+ * of a slot of an upper level, the watchdogs in it are moved down.
+ * Watchdogs beyond the range of the top level wait in its last slot and are
+ * placed again when it is reached.
+ */
+
+#define WHEEL_SHIFT(l)       ((l) * WDOG_WHEEL_BITS)
+#define WHEEL_SLOT(l, i)     (((l) << WDOG_WHEEL_BITS) + (i))
+#define WHEEL_RANGE(l)       ((uint32_t)1 << WHEEL_SHIFT((l) + 1))
+
+/****************************************************************************
+ * Public Variables
+ ****************************************************************************/
+
+/* The current time of the wheel in ticks */
+
+uint32_t g_wdnow;
+
+#ifdef CONFIG_SCHED_TICKSUPPRESS
+/* Ticks reported by wd_timer_nohz() that the wheel has not processed yet */
+
+uint32_t g_wdmissed;
+#endif
+
+/****************************************************************************
+ * Private Variables
+ ****************************************************************************/
+
+static FAR struct wdog_s *g_wdwheel[WDOG_WHEEL_LEVELS * WDOG_WHEEL_SIZE];
+
+/* One bit per non-empty slot, so that the next expiration is found without
+ * looking at the slots.
+ */
+
+static uint64_t g_wdwheelmap[WDOG_WHEEL_LEVELS];
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+static void wd_wheel_link(FAR struct wdog_s *wdog)
+{
+	uint32_t delta = wdog->expire - g_wdnow;
+	uint32_t expire = wdog->expire;
+	int level;
+	int index;
+
+	for (level = 0; level < WDOG_WHEEL_LEVELS - 1; level++) {
+		if (delta < WHEEL_RANGE(level)) {
+			break;
+		}
+	}
+
+	if (delta >= WHEEL_RANGE(WDOG_WHEEL_LEVELS - 1)) {
+		expire = g_wdnow + WHEEL_RANGE(WDOG_WHEEL_LEVELS - 1) - 1;
+	}
+
+	index = (expire >> WHEEL_SHIFT(level)) & WDOG_WHEEL_MASK;
+	wdog->slot = WHEEL_SLOT(level, index);
+	wdog->prev = NULL;
+	wdog->next = g_wdwheel[wdog->slot];
+	if (wdog->next) {
+		wdog->next->prev = wdog;
+	}
+	g_wdwheel[wdog->slot] = wdog;
+	g_wdwheelmap[level] |= (uint64_t)1 << index;
+}
+
+/* Distance from 'index' to the next non-empty slot of a level, the slot at
+ * 'index' itself counting as 64 slots away.  Zero if the level is empty.
+ */
+
+static int wd_wheel_distance(int level, int index)
+{
+	uint64_t map = g_wdwheelmap[level];
+	int start = (index + 1) & WDOG_WHEEL_MASK;
+
+	if (map == 0) {
+		return 0;
+	}
+
+	if (start != 0) {
+		map = (map >> start) | (map << (WDOG_WHEEL_SIZE - start));
+	}
+
+	return __builtin_ctzll(map) + 1;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: wd_wheel_add
+ *
+ * Description:
+ *   Arm a watchdog to expire 'delay' ticks from now.
+ *
+ * Assumptions:
+ *   Called within a critical section.
+ *
+ ****************************************************************************/
+
+void wd_wheel_add(FAR struct wdog_s *wdog, int delay)
+{
+	wdog->expire = wd_wheel_now() + delay;
+	wd_wheel_link(wdog);
+}
+
+/****************************************************************************
+ * Name: wd_wheel_remove
+ *
+ * Description:
+ *   Disarm a watchdog.  The slot is recorded in the watchdog, so this does
+ *   not depend on the number of active watchdogs.
+ *
+ * Assumptions:
+ *   Called within a critical section.
+ *
+ ****************************************************************************/
+
+void wd_wheel_remove(FAR struct wdog_s *wdog)
+{
+	if (wdog->prev) {
+		wdog->prev->next = wdog->next;
+	} else {
+		DEBUGASSERT(g_wdwheel[wdog->slot] == wdog);
+		g_wdwheel[wdog->slot] = wdog->next;
+		if (wdog->next == NULL) {
+			g_wdwheelmap[wdog->slot >> WDOG_WHEEL_BITS] &= ~((uint64_t)1 << (wdog->slot & WDOG_WHEEL_MASK));
+		}
+	}
+
+	if (wdog->next) {
+		wdog->next->prev = wdog->prev;
+	}
+
+	wdog->next = NULL;
+	wdog->prev = NULL;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_next
+ *
+ * Description:
+ *   Return the number of ticks until the wheel has something to do, either
+ *   because a watchdog expires or because watchdogs move down a level, or
+ *   zero if no watchdog is active.  This is never later than the next
+ *   expiration, so it can be used to program a tickless timer.
+ *
+ ****************************************************************************/
+
+uint32_t wd_wheel_next(void)
+{
+	uint32_t next = 0;
+	uint32_t ticks;
+	uint32_t base;
+	int distance;
+	int level;
+
+	for (level = 0; level < WDOG_WHEEL_LEVELS; level++) {
+		base = g_wdnow >> WHEEL_SHIFT(level);
+		distance = wd_wheel_distance(level, base & WDOG_WHEEL_MASK);
+		if (distance == 0) {
+			continue;
+		}
+
+		/* Slots of level 0 expire at their tick, slots of the upper levels
+		 * are cascaded at the first tick they cover.
+		 */
+
+		ticks = ((base + distance) << WHEEL_SHIFT(level)) - g_wdnow;
+		if (next == 0 || ticks < next) {
+			next = ticks;
+		}
+	}
+
+	return next;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_step
+ *
+ * Description:
+ *   Advance the wheel by 'ticks', which must not exceed wd_wheel_next().
+ *   Watchdogs of an upper level slot that is reached are moved down.
+ *   Watchdogs that expire are then taken with wd_wheel_expired().
+ *
+ ****************************************************************************/
+
+void wd_wheel_step(uint32_t ticks)
+{
+	FAR struct wdog_s *wdog;
+	FAR struct wdog_s *next;
+	int level;
+	int index;
+
+	g_wdnow += ticks;
+
+	for (level = 1; level < WDOG_WHEEL_LEVELS; level++) {
+		if ((g_wdnow & ((1u << WHEEL_SHIFT(level)) - 1)) != 0) {
+			break;
+		}
+
+		index = (g_wdnow >> WHEEL_SHIFT(level)) & WDOG_WHEEL_MASK;
+		wdog = g_wdwheel[WHEEL_SLOT(level, index)];
+		g_wdwheel[WHEEL_SLOT(level, index)] = NULL;
+		g_wdwheelmap[level] &= ~((uint64_t)1 << index);
+
+		for (; wdog; wdog = next) {
+			next = wdog->next;
+			wd_wheel_link(wdog);
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: wd_wheel_expired
+ *
+ * Description:
+ *   Remove and return a watchdog that expires at the current tick, or NULL
+ *   if there is none left.
+ *
+ ****************************************************************************/
+
+FAR struct wdog_s *wd_wheel_expired(void)
+{
+	FAR struct wdog_s *wdog = g_wdwheel[WHEEL_SLOT(0, g_wdnow & WDOG_WHEEL_MASK)];
+
+	if (wdog) {
+		DEBUGASSERT(wdog->expire == g_wdnow);
+		wd_wheel_remove(wdog);
+	}
+
+	return wdog;
+}
+
+/****************************************************************************
+ * Name: wd_wheel_first
+ *
+ * Description:
+ *   Return the first active watchdog matching 'flags' (any watchdog if
+ *   zero) to expire, or NULL.  This looks at every active watchdog and is
+ *   meant for the rare callers that need more than the next expiration.
+ *
+ ****************************************************************************/
+
+FAR struct wdog_s *wd_wheel_first(uint8_t flags)
+{
+	FAR struct wdog_s *first = NULL;
+	FAR struct wdog_s *wdog;
+	int slot;
+
+	for (slot = 0; slot < WDOG_WHEEL_LEVELS * WDOG_WHEEL_SIZE; slot++) {
+		for (wdog = g_wdwheel[slot]; wdog; wdog = wdog->next) {
+			if ((wdog->flags & flags) != flags) {
+				continue;
+			}
+
+			if (first == NULL || (int32_t)(wdog->expire - first->expire) < 0) {
+				first = wdog;
+			}
+		}
+	}
+
+	return first;
+}
+
+#endif							/* CONFIG_WDOG_TIMING_WHEEL */
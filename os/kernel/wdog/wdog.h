@@ -63,12 +63,37 @@
 #include <stdbool.h>
 
 #include <tinyara/compiler.h>
+#include <tinyara/clock.h>
 #include <tinyara/wdog.h>
 
 /************************************************************************
  * Pre-processor Definitions
  ************************************************************************/
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+#define WDOG_WHEEL_BITS    6
+#define WDOG_WHEEL_SIZE    (1 << WDOG_WHEEL_BITS)
+#define WDOG_WHEEL_MASK    (WDOG_WHEEL_SIZE - 1)
+#define WDOG_WHEEL_LEVELS  4
+
+/* The time new watchdogs are started from, including ticks that were
+ * reported by wd_timer_nohz() but not processed yet.
+ */
+
+#ifdef CONFIG_SCHED_TICKSUPPRESS
+#define wd_wheel_now()     (g_wdnow + g_wdmissed)
+#else
+#define wd_wheel_now()     (g_wdnow)
+#endif
+#endif
+
+#ifdef CONFIG_WDOG_TIMER_SLACK
+/* A timer slack in microseconds as the whole ticks that fit in it */
+
+#define WDOG_USEC2SLACK(usec) \
+	((usec) / USEC_PER_TICK < UINT16_MAX ? (usec) / USEC_PER_TICK : UINT16_MAX)
+#endif
+
 /************************************************************************
  * Public Type Declarations
  ************************************************************************/
@@ -97,6 +122,17 @@ extern sq_queue_t g_wdfreelist;
 
 extern sq_queue_t g_wdactivelist;
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+/* With the timing wheel, active watchdogs are kept in the wheel instead
+ * of g_wdactivelist and expire when g_wdnow reaches their expire tick.
+ */
+
+extern uint32_t g_wdnow;
+#ifdef CONFIG_SCHED_TICKSUPPRESS
+extern uint32_t g_wdmissed;
+#endif
+#endif
+
 /* This is the number of free, pre-allocated watchdog structures in the
  * g_wdfreelist.  This value is used to enforce a reserve for interrupt
  * handlers.
@@ -104,6 +140,10 @@ extern sq_queue_t g_wdactivelist;
 
 extern uint16_t g_wdnfree;
 
+/* Counters of watchdog expirations and coalescing, see wd_getstats() */
+
+extern struct wdog_stats_s g_wdstats;
+
 /************************************************************************
  * Public Function Prototypes
  ************************************************************************/
@@ -206,6 +246,19 @@ void wd_corruption_dbg(struct wdog_s *wdog);
 struct tcb_s;
 void wd_recover(FAR struct tcb_s *tcb);
 
+#ifdef CONFIG_WDOG_TIMING_WHEEL
+/* Timing wheel operations, see wd_wheel.c.  All of them are called within
+ * a critical section.
+ */
+
+void wd_wheel_add(FAR struct wdog_s *wdog, int delay);
+void wd_wheel_remove(FAR struct wdog_s *wdog);
+uint32_t wd_wheel_next(void);
+void wd_wheel_step(uint32_t ticks);
+FAR struct wdog_s *wd_wheel_expired(void);
+FAR struct wdog_s *wd_wheel_first(uint8_t flags);
+#endif
+
 #undef EXTERN
 #ifdef __cplusplus
 }
@@ -23,6 +23,7 @@
 #ifdef CONFIG_ARCH_LOWPUTC
 #include <sched.h>
 #endif
+#include <semaphore.h>
 #include <arch/irq.h>
 #include <tinyara/arch.h>
 #include <tinyara/logm.h>
@@ -79,6 +80,7 @@ int logm_internal(int flag, int indx, int priority, const char *fmt, va_list ap)
 {
 	irqstate_t flags;
 	int ret = 0;
+	bool wakeup;
 	struct lib_outstream_s strm;
 #ifdef CONFIG_LOGM_TIMESTAMP
 	struct timespec ts;
@@ -113,7 +115,19 @@ int logm_internal(int flag, int indx, int priority, const char *fmt, va_list ap)
 			g_logm_dropmsg_count = 1;
 			g_logm_overflow_offset = g_logm_tail;
 		}
+
+#ifdef CONFIG_LOGM_BINARY
+		/* Keep the message in order with the binary records */
+
+		logm_binary_mark(g_logm_tail);
+#endif
+
+		wakeup = logm_wakeup_needed((g_logm_tail - g_logm_head + logm_bufsize) % logm_bufsize, logm_bufsize);
 		leave_critical_section(flags);
+
+		if (wakeup) {
+			sem_post(&g_logm_wakeup);
+		}
 	} else {
 		/* Low Output: Sytem is not yet completely ready or this is called from interrupt handler */
 #ifdef CONFIG_ARCH_LOWPUTC
@@ -135,7 +149,19 @@ int logm(int flag, int indx, int priority, const char *fmt, ...)
 	/* LOGIC for initial test here */
 
 	va_start(ap, fmt);
-	ret = logm_internal(flag, indx, priority, fmt, ap);
+#ifdef CONFIG_LOGM_BINARY
+	/* The formatting of the string literals of the debug macros is left to
+	 * the logm task.  Any other format may be gone or rewritten by then, a
+	 * buffer that is reused for each message for example.
+	 */
+
+	if (LOGM_STATUS(LOGM_READY) && flag == LOGM_NORMAL && !up_interrupt_context() && is_kernel_text_space((FAR void *)fmt)) {
+		ret = logm_binary(priority, fmt, ap);
+	} else
+#endif
+	{
+		ret = logm_internal(flag, indx, priority, fmt, ap);
+	}
 	va_end(ap);
 
 	return ret;
@@ -20,6 +20,10 @@
 
 #include <tinyara/config.h>
 #include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <semaphore.h>
 
 /****************************************************************************
  * Preprocessor Definitions
@@ -51,11 +55,70 @@
 #define LOGM_STATUS_SET(a) (logm_status |= (a))
 #define LOGM_STATUS_CLEAR(a) (logm_status &= ~(a))
 
+/* What the logm task waits for, a logger posts g_logm_wakeup only when the
+ * task waits for what it has just done.
+ */
+
+#define LOGM_WAIT_NONE   0		/* Not waiting */
+#define LOGM_WAIT_EMPTY  1		/* Idle, wake up on the first message */
+#define LOGM_WAIT_BATCH  2		/* Gathering, wake up when half full */
+
+#ifdef CONFIG_LOGM_BINARY
+#ifdef CONFIG_SMP
+#define LOGM_NCPUS CONFIG_SMP_NCPUS
+#else
+#define LOGM_NCPUS 1
+#endif
+
+#define LOGM_BINARY_BUFSIZE  (CONFIG_LOGM_BINARY_BUFFER_SIZE & ~3)
+#define LOGM_BINARY_RECSIZE  (CONFIG_LOGM_BINARY_RECORD_SIZE & ~3)
+
+/* Record flags */
+
+#define LOGM_BINREC_TRUNCATED BIT(0)	/* Some arguments did not fit */
+
+/* Each record starts with a 'LOGM' sync word in the raw output */
+
+#define LOGM_BINARY_MAGIC 0x4d474f4c
+#endif
+
 /****************************************************************************
  * Private Declarations
  ****************************************************************************/
 
-/* Structure for a single debug message */
+#ifdef CONFIG_LOGM_BINARY
+/* A binary record.  The arguments follow the header as 32-bit words in the
+ * order of the conversions of 'fmt': two words for 64-bit integers and
+ * doubles, and for %s the string length followed by the NUL terminated
+ * string padded to a word.  A record with 'len' 0 marks the end of the ring
+ * data, the next record is at the start of the ring.
+ *
+ * A record with a NULL 'fmt' stands for a message of the text buffer, its
+ * only data word is the offset where that message ends.  'seq' orders all
+ * records and text messages of all CPUs as they were logged.
+ */
+
+struct logm_binrec_s {
+	uint16_t len;				/* Size of the record in bytes */
+	uint8_t priority;			/* Log priority */
+	uint8_t flags;				/* LOGM_BINREC_* */
+	uint32_t ticks;				/* System time of the message */
+	FAR const char *fmt;		/* Format string, never copied */
+	uint32_t seq;				/* Order of the message */
+	uint32_t data[];			/* Arguments */
+};
+
+/* The ring of one CPU.  Only that CPU adds records, with its interrupts
+ * disabled, and only the logm task removes them, so the ring needs no lock.
+ */
+
+struct logm_binring_s {
+	volatile uint32_t head;		/* Next record to output, moved by logm task */
+	volatile uint32_t tail;		/* Where the next record goes */
+	volatile uint32_t dropped;	/* Records dropped as the ring was full */
+	uint8_t buf[LOGM_BINARY_BUFSIZE];
+};
+#endif
 
 #undef EXTERN
 #if defined(__cplusplus)
@@ -74,12 +137,51 @@ EXTERN int logm_bufsize;
 EXTERN uint8_t logm_status;
 EXTERN volatile int new_logm_bufsize;
 EXTERN volatile int logm_print_interval;
+EXTERN volatile uint8_t g_logm_waitstate;
+EXTERN sem_t g_logm_wakeup;
+#ifdef CONFIG_LOGM_BINARY
+EXTERN struct logm_binring_s g_logm_binring[LOGM_NCPUS];
+EXTERN volatile uint32_t g_logm_seq;
+#endif
+
+/****************************************************************************
+ * Inline Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: logm_wakeup_needed
+ *
+ * Description:
+ *   Check if a logger that has just queued a message must wake up the logm
+ *   task, given the bytes now used in a buffer of 'size' bytes.  It returns
+ *   true only to the one logger that must post g_logm_wakeup.
+ *
+ ****************************************************************************/
+
+static inline bool logm_wakeup_needed(int used, int size)
+{
+	uint8_t state = __atomic_load_n(&g_logm_waitstate, __ATOMIC_RELAXED);
+
+	if (state == LOGM_WAIT_EMPTY || (state == LOGM_WAIT_BATCH && used >= size / 2)) {
+		return __atomic_compare_exchange_n(&g_logm_waitstate, &state, LOGM_WAIT_NONE, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+	}
+
+	return false;
+}
 
 /************************************************************************************
  * Private Function Prototypes
  ************************************************************************************/
 int logm_task(int argc, char *argv[]);
+void logm_wakeup(void);
 void logm_register_tashcmds(void);
+void logm_flush_text(int stop);
+#ifdef CONFIG_LOGM_BINARY
+int logm_binary(int priority, FAR const char *fmt, va_list ap);
+void logm_binary_mark(int offset);
+bool logm_binary_empty(void);
+void logm_binary_flush(FAR FILE *stream);
+#endif
 
 #undef EXTERN
 #if defined(__cplusplus)
@@ -0,0 +1,662 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <semaphore.h>
+#include <arch/irq.h>
+#include <tinyara/irq.h>
+#include <tinyara/clock.h>
+#include <tinyara/streams.h>
+#include "logm.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Longest conversion specification that is formatted, with the '*' widths
+ * replaced by their values.
+ */
+
+#define LOGM_SPEC_MAX 24
+
+/****************************************************************************
+ * Private Types
+ ****************************************************************************/
+
+/* How the argument of a conversion is stored in a record */
+
+enum logm_argclass_e {
+	LOGM_ARG_NONE,				/* No argument, output as it is */
+	LOGM_ARG_INT,				/* int, one word */
+	LOGM_ARG_LONG,				/* long or size_t, one word */
+	LOGM_ARG_LLONG,				/* long long, two words */
+	LOGM_ARG_DOUBLE,			/* double, two words */
+	LOGM_ARG_PTR,				/* Pointer, one word */
+	LOGM_ARG_STR,				/* Copied string */
+	LOGM_ARG_COUNT				/* %n, the pointer is not stored */
+};
+
+struct logm_conv_s {
+	FAR const char *start;		/* The '%' of the conversion */
+	int len;					/* Length of the conversion */
+	uint8_t nstar;				/* Number of '*' width and precision */
+	uint8_t argclass;			/* enum logm_argclass_e */
+	bool ldouble;				/* The argument is a long double */
+};
+
+/****************************************************************************
+ * Public Data
+ ****************************************************************************/
+
+struct logm_binring_s g_logm_binring[LOGM_NCPUS];
+volatile uint32_t g_logm_seq;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: logm_nextconv
+ *
+ * Description:
+ *   Find the next conversion of 'fmt' that takes an argument or is not
+ *   understood, skipping "%%".
+ *
+ * Return Value:
+ *   The character after the conversion, or NULL if there is none.
+ *
+ ****************************************************************************/
+
+static FAR const char *logm_nextconv(FAR const char *fmt, FAR struct logm_conv_s *conv)
+{
+	FAR const char *p;
+	int nlong = 0;
+
+	while ((fmt = strchr(fmt, '%')) != NULL && fmt[1] == '%') {
+		fmt += 2;
+	}
+
+	if (fmt == NULL) {
+		return NULL;
+	}
+
+	conv->start = fmt;
+	conv->nstar = 0;
+	conv->ldouble = false;
+
+	/* Flags, width and precision */
+
+	for (p = fmt + 1; *p == '-' || *p == '+' || *p == ' ' || *p == '#' || *p == '0'; p++) {
+	}
+
+	if (*p == '*') {
+		conv->nstar++;
+		p++;
+	} else {
+		while (*p >= '0' && *p <= '9') {
+			p++;
+		}
+	}
+
+	if (*p == '.') {
+		p++;
+		if (*p == '*') {
+			conv->nstar++;
+			p++;
+		} else {
+			while (*p >= '0' && *p <= '9') {
+				p++;
+			}
+		}
+	}
+
+	/* Length modifiers */
+
+	for (;; p++) {
+		if (*p == 'l') {
+			nlong++;
+		} else if (*p == 'j' || *p == 'q' || *p == 'L') {
+			nlong = 2;
+			conv->ldouble = (*p == 'L');
+		} else if (*p == 'z' || *p == 't') {
+			nlong = 1;
+		} else if (*p != 'h') {
+			break;
+		}
+	}
+
+	switch (*p) {
+	case 'd':
+	case 'i':
+	case 'u':
+	case 'o':
+	case 'x':
+	case 'X':
+		conv->argclass = nlong >= 2 ? LOGM_ARG_LLONG : nlong ? LOGM_ARG_LONG : LOGM_ARG_INT;
+		break;
+	case 'c':
+		conv->argclass = LOGM_ARG_INT;
+		break;
+	case 'e':
+	case 'E':
+	case 'f':
+	case 'F':
+	case 'g':
+	case 'G':
+	case 'a':
+	case 'A':
+		conv->argclass = LOGM_ARG_DOUBLE;
+		break;
+	case 'p':
+		conv->argclass = LOGM_ARG_PTR;
+		break;
+	case 's':
+		conv->argclass = LOGM_ARG_STR;
+		break;
+	case 'n':
+		conv->argclass = LOGM_ARG_COUNT;
+		break;
+	default:
+		conv->argclass = LOGM_ARG_NONE;
+		conv->nstar = 0;
+		break;
+	}
+
+	if (*p != '\0') {
+		p++;
+	}
+
+	conv->len = p - fmt;
+	return p;
+}
+
+/* Fewest words the argument of a conversion takes in a record */
+
+static int logm_argwords(FAR const struct logm_conv_s *conv)
+{
+	switch (conv->argclass) {
+	case LOGM_ARG_INT:
+	case LOGM_ARG_LONG:
+	case LOGM_ARG_PTR:
+		return conv->nstar + 1;
+	case LOGM_ARG_LLONG:
+	case LOGM_ARG_DOUBLE:
+	case LOGM_ARG_STR:
+		return conv->nstar + 2;
+	default:
+		return conv->nstar;
+	}
+}
+
+/****************************************************************************
+ * Name: logm_encode
+ *
+ * Description:
+ *   Copy the arguments of 'fmt' into the data of 'rec'.  Longs and pointers
+ *   are 32 bits on the targets of logm.
+ *
+ * Return Value:
+ *   The size of the record in bytes.
+ *
+ ****************************************************************************/
+
+static int logm_encode(FAR struct logm_binrec_s *rec, FAR const char *fmt, va_list ap)
+{
+	FAR uint32_t *word = rec->data;
+	FAR uint32_t *end = (FAR uint32_t *)((FAR uint8_t *)rec + LOGM_BINARY_RECSIZE);
+	struct logm_conv_s conv;
+	FAR const char *str;
+	long long llval;
+	double dval;
+	size_t len;
+	int i;
+
+	rec->flags = 0;
+
+	while ((fmt = logm_nextconv(fmt, &conv)) != NULL) {
+		if (word + logm_argwords(&conv) > end) {
+			rec->flags |= LOGM_BINREC_TRUNCATED;
+			break;
+		}
+
+		for (i = 0; i < conv.nstar; i++) {
+			*word++ = (uint32_t)va_arg(ap, int);
+		}
+
+		switch (conv.argclass) {
+		case LOGM_ARG_INT:
+			*word++ = (uint32_t)va_arg(ap, int);
+			break;
+		case LOGM_ARG_LONG:
+			*word++ = (uint32_t)va_arg(ap, long);
+			break;
+		case LOGM_ARG_LLONG:
+			llval = va_arg(ap, long long);
+			memcpy(word, &llval, sizeof(llval));
+			word += 2;
+			break;
+		case LOGM_ARG_DOUBLE:
+			dval = conv.ldouble ? (double)va_arg(ap, long double) : va_arg(ap, double);
+			memcpy(word, &dval, sizeof(dval));
+			word += 2;
+			break;
+		case LOGM_ARG_PTR:
+			*word++ = (uint32_t)(uintptr_t)va_arg(ap, FAR void *);
+			break;
+		case LOGM_ARG_STR:
+			str = va_arg(ap, FAR const char *);
+			if (str == NULL) {
+				str = "(null)";
+			}
+
+			/* The length word, the string and its NUL terminator */
+
+			len = strnlen(str, (end - word - 1) * sizeof(uint32_t) - 1);
+			*word = len;
+			memcpy(word + 1, str, len);
+			((FAR char *)(word + 1))[len] = '\0';
+			word += 1 + (len + sizeof(uint32_t)) / sizeof(uint32_t);
+
+			if (str[len] != '\0') {
+				rec->flags |= LOGM_BINREC_TRUNCATED;
+				return (FAR uint8_t *)word - (FAR uint8_t *)rec;
+			}
+			break;
+		case LOGM_ARG_COUNT:
+			(void)va_arg(ap, FAR void *);
+			break;
+		default:
+			break;
+		}
+	}
+
+	return (FAR uint8_t *)word - (FAR uint8_t *)rec;
+}
+
+/****************************************************************************
+ * Name: logm_ring_put
+ *
+ * Description:
+ *   Add a record to the ring of this CPU, with the local interrupts
+ *   disabled.  One word stays free so that a full ring differs from an empty
+ *   one.
+ *
+ * Return Value:
+ *   The bytes used in the ring, or -1 if the record does not fit.
+ *
+ ****************************************************************************/
+
+static int logm_ring_put(FAR struct logm_binring_s *ring, FAR const struct logm_binrec_s *rec)
+{
+	uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+	uint32_t tail = ring->tail;
+	uint32_t pos = tail;
+
+	if (tail >= head) {
+		if (LOGM_BINARY_BUFSIZE - tail < rec->len || (tail + rec->len == LOGM_BINARY_BUFSIZE && head == 0)) {
+			/* Wrap to the start of the ring if the record fits there */
+
+			if (rec->len >= head) {
+				return -1;
+			}
+
+			((FAR struct logm_binrec_s *)&ring->buf[tail])->len = 0;
+			pos = 0;
+		}
+	} else if (tail + rec->len >= head) {
+		return -1;
+	}
+
+	memcpy(&ring->buf[pos], rec, rec->len);
+	tail = (pos + rec->len) % LOGM_BINARY_BUFSIZE;
+	__atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+
+	return (tail + LOGM_BINARY_BUFSIZE - head) % LOGM_BINARY_BUFSIZE;
+}
+
+/* Output the text of 'fmt' up to 'end', or all of it if 'end' is NULL */
+
+static void logm_putliteral(FAR struct lib_outstream_s *stream, FAR const char *fmt, FAR const char *end)
+{
+	while (*fmt != '\0' && fmt != end) {
+		if (fmt[0] == '%' && fmt[1] == '%') {
+			fmt++;
+		}
+		stream->put(stream, *fmt++);
+	}
+}
+
+/****************************************************************************
+ * Name: logm_putconv
+ *
+ * Description:
+ *   Format one conversion with its argument in the record data at 'word'.
+ *
+ * Return Value:
+ *   The data after the argument, or NULL if the argument is not in the
+ *   record.
+ *
+ ****************************************************************************/
+
+static FAR const uint32_t *logm_putconv(FAR struct lib_outstream_s *stream, FAR const struct logm_conv_s *conv, FAR const uint32_t *word, FAR const uint32_t *end)
+{
+	char spec[LOGM_SPEC_MAX];
+	long long llval;
+	double dval;
+	int len = 0;
+	int i;
+
+	if (word + logm_argwords(conv) > end || (conv->argclass == LOGM_ARG_STR && word + conv->nstar + 1 + (word[conv->nstar] + sizeof(uint32_t)) / sizeof(uint32_t) > end)) {
+		return NULL;
+	}
+
+	/* Replace the '*' widths by the values that were passed for them, a
+	 * long double was stored as a double.
+	 */
+
+	for (i = 0; i < conv->len && len < LOGM_SPEC_MAX - 1; i++) {
+		if (conv->start[i] == '*') {
+			len += snprintf(&spec[len], LOGM_SPEC_MAX - len, "%d", (int)*word++);
+		} else if (conv->start[i] == 'L') {
+			len += snprintf(&spec[len], LOGM_SPEC_MAX - len, "%s", conv->argclass == LOGM_ARG_DOUBLE ? "" : "ll");
+		} else {
+			spec[len++] = conv->start[i];
+		}
+	}
+
+	if (len >= LOGM_SPEC_MAX - 1) {
+		len = LOGM_SPEC_MAX - 1;
+	}
+	spec[len] = '\0';
+
+	switch (conv->argclass) {
+	case LOGM_ARG_INT:
+		lib_sprintf(stream, spec, (int)*word++);
+		break;
+	case LOGM_ARG_LONG:
+		lib_sprintf(stream, spec, (long)*word++);
+		break;
+	case LOGM_ARG_LLONG:
+		memcpy(&llval, word, sizeof(llval));
+		lib_sprintf(stream, spec, llval);
+		word += 2;
+		break;
+	case LOGM_ARG_DOUBLE:
+		memcpy(&dval, word, sizeof(dval));
+		lib_sprintf(stream, spec, dval);
+		word += 2;
+		break;
+	case LOGM_ARG_PTR:
+		lib_sprintf(stream, spec, (FAR void *)(uintptr_t)*word++);
+		break;
+	case LOGM_ARG_STR:
+		lib_sprintf(stream, spec, (FAR const char *)(word + 1));
+		word += 1 + (*word + sizeof(uint32_t)) / sizeof(uint32_t);
+		break;
+	case LOGM_ARG_COUNT:
+		break;
+	default:
+		logm_putliteral(stream, conv->start, conv->start + conv->len);
+		break;
+	}
+
+	return word;
+}
+
+#ifndef CONFIG_LOGM_BINARY_RAW
+/* Format a record the way logm_internal() formats a message */
+
+static void logm_format(FAR struct lib_outstream_s *stream, FAR const struct logm_binrec_s *rec)
+{
+	FAR const uint32_t *word = rec->data;
+	FAR const uint32_t *end = (FAR const uint32_t *)((FAR const uint8_t *)rec + rec->len);
+	FAR const char *fmt = rec->fmt;
+	FAR const char *next;
+	struct logm_conv_s conv;
+
+#ifdef CONFIG_LOGM_TIMESTAMP
+	(void)lib_sprintf(stream, "[%4d.%4d] ", (int)(rec->ticks / TICK_PER_SEC), (int)((rec->ticks % TICK_PER_SEC) * 10000 / TICK_PER_SEC));
+#endif
+
+	while ((next = logm_nextconv(fmt, &conv)) != NULL) {
+		logm_putliteral(stream, fmt, conv.start);
+		word = logm_putconv(stream, &conv, word, end);
+		if (word == NULL) {
+			(void)lib_sprintf(stream, "...\n");
+			return;
+		}
+		fmt = next;
+	}
+
+	logm_putliteral(stream, fmt, NULL);
+}
+#endif
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: logm_binary
+ *
+ * Description:
+ *   Queue a message as a binary record in the ring of this CPU.  The record
+ *   is built on the stack, the interrupts of this CPU are disabled only to
+ *   copy it into the ring.
+ *
+ * Return Value:
+ *   The size of the record, or 0 if it was dropped.
+ *
+ ****************************************************************************/
+
+int logm_binary(int priority, FAR const char *fmt, va_list ap)
+{
+	uint32_t buf[LOGM_BINARY_RECSIZE / sizeof(uint32_t)];
+	FAR struct logm_binrec_s *rec = (FAR struct logm_binrec_s *)buf;
+	FAR struct logm_binring_s *ring;
+	irqstate_t flags;
+	bool wakeup = false;
+	int used;
+
+	rec->len = logm_encode(rec, fmt, ap);
+	rec->priority = priority;
+	rec->fmt = fmt;
+	rec->ticks = (uint32_t)clock_systimer();
+
+	flags = irqsave();
+#ifdef CONFIG_SMP
+	ring = &g_logm_binring[up_cpu_index()];
+#else
+	ring = &g_logm_binring[0];
+#endif
+
+	/* The ring of a CPU is filled with interrupts off, so its records are
+	 * in the order of their sequence numbers.
+	 */
+
+	rec->seq = __atomic_fetch_add(&g_logm_seq, 1, __ATOMIC_RELAXED);
+	used = logm_ring_put(ring, rec);
+	if (used < 0) {
+		__atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+	} else {
+		wakeup = logm_wakeup_needed(used, LOGM_BINARY_BUFSIZE);
+	}
+	irqrestore(flags);
+
+	if (wakeup) {
+		sem_post(&g_logm_wakeup);
+	}
+
+	return used < 0 ? 0 : rec->len;
+}
+
+/****************************************************************************
+ * Name: logm_binary_mark
+ *
+ * Description:
+ *   Queue a record for the text message that ends at 'offset' of the text
+ *   buffer, so that the logm task writes it out between the binary records
+ *   logged before and after it.  Called from logm_internal() within the
+ *   critical section.  If the ring is full the text is written out after
+ *   the binary records instead.
+ *
+ ****************************************************************************/
+
+void logm_binary_mark(int offset)
+{
+	uint32_t buf[(sizeof(struct logm_binrec_s) + sizeof(uint32_t)) / sizeof(uint32_t)];
+	FAR struct logm_binrec_s *rec = (FAR struct logm_binrec_s *)buf;
+	FAR struct logm_binring_s *ring;
+
+#ifdef CONFIG_SMP
+	ring = &g_logm_binring[up_cpu_index()];
+#else
+	ring = &g_logm_binring[0];
+#endif
+
+	rec->len = sizeof(buf);
+	rec->priority = 0;
+	rec->flags = 0;
+	rec->ticks = 0;
+	rec->fmt = NULL;
+	rec->seq = __atomic_fetch_add(&g_logm_seq, 1, __ATOMIC_RELAXED);
+	rec->data[0] = offset;
+
+	(void)logm_ring_put(ring, rec);
+}
+
+/****************************************************************************
+ * Name: logm_binary_empty
+ *
+ * Description:
+ *   Check if no CPU has binary records queued.
+ *
+ ****************************************************************************/
+
+bool logm_binary_empty(void)
+{
+	int cpu;
+
+	for (cpu = 0; cpu < LOGM_NCPUS; cpu++) {
+		if (g_logm_binring[cpu].head != __atomic_load_n(&g_logm_binring[cpu].tail, __ATOMIC_ACQUIRE)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/****************************************************************************
+ * Name: logm_binary_flush
+ *
+ * Description:
+ *   Write out the queued binary records of all CPUs, formatted or raw with
+ *   CONFIG_LOGM_BINARY_RAW, merged in the order they were logged.  The text
+ *   buffer is written up to each text message met on the way, the rest of
+ *   it is left to the caller.  Called by the logm task only.
+ *
+ ****************************************************************************/
+
+void logm_binary_flush(FAR FILE *stream)
+{
+	FAR struct logm_binring_s *ring;
+	FAR struct logm_binrec_s *rec;
+	FAR struct logm_binrec_s *first;
+#ifdef CONFIG_LOGM_BINARY_RAW
+	uint32_t magic = LOGM_BINARY_MAGIC;
+#else
+	struct lib_stdoutstream_s strm;
+#endif
+	uint32_t head[LOGM_NCPUS];
+	uint32_t tail[LOGM_NCPUS];
+	uint32_t dropped;
+	int cpu;
+	int next;
+
+#ifndef CONFIG_LOGM_BINARY_RAW
+	lib_stdoutstream(&strm, stream);
+#endif
+
+	/* Records queued after this are left for the next flush */
+
+	for (cpu = 0; cpu < LOGM_NCPUS; cpu++) {
+		head[cpu] = g_logm_binring[cpu].head;
+		tail[cpu] = __atomic_load_n(&g_logm_binring[cpu].tail, __ATOMIC_ACQUIRE);
+	}
+
+	for (;;) {
+		/* Take the oldest of the first records of the rings */
+
+		first = NULL;
+		next = 0;
+		for (cpu = 0; cpu < LOGM_NCPUS; cpu++) {
+			if (head[cpu] == tail[cpu]) {
+				continue;
+			}
+
+			rec = (FAR struct logm_binrec_s *)&g_logm_binring[cpu].buf[head[cpu]];
+			if (rec->len == 0) {
+				head[cpu] = 0;
+				rec = (FAR struct logm_binrec_s *)g_logm_binring[cpu].buf;
+			}
+
+			if (first == NULL || (int32_t)(rec->seq - first->seq) < 0) {
+				first = rec;
+				next = cpu;
+			}
+		}
+
+		if (first == NULL) {
+			break;
+		}
+
+		if (first->fmt == NULL) {
+			logm_flush_text((int)first->data[0]);
+		} else {
+#ifdef CONFIG_LOGM_BINARY_RAW
+			fwrite(&magic, sizeof(magic), 1, stream);
+			fwrite(first, first->len, 1, stream);
+#else
+			logm_format(&strm.public, first);
+#endif
+		}
+
+		head[next] = (head[next] + first->len) % LOGM_BINARY_BUFSIZE;
+
+		/* Give the space back as soon as the record is out */
+
+		__atomic_store_n(&g_logm_binring[next].head, head[next], __ATOMIC_RELEASE);
+	}
+
+	for (cpu = 0; cpu < LOGM_NCPUS; cpu++) {
+		ring = &g_logm_binring[cpu];
+		dropped = __atomic_exchange_n(&ring->dropped, 0, __ATOMIC_RELAXED);
+		if (dropped > 0) {
+			fprintf(stream, "\n[LOGM BUFFER OVERFLOW] %u messages are dropped\n", (unsigned int)dropped);
+		}
+	}
+}
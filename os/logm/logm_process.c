@@ -19,11 +19,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <semaphore.h>
 #include <sys/types.h>
 #include <arch/irq.h>
 #include <tinyara/logm.h>
 #include <tinyara/config.h>
+#include <tinyara/clock.h>
 #include <tinyara/kmalloc.h>
+#include <tinyara/semaphore.h>
 #include "logm.h"
 #ifdef CONFIG_LOGM_TEST
 #include "logm_test.h"
@@ -33,6 +36,8 @@ uint8_t logm_status;
 int logm_bufsize = LOGM_BUFFER_SIZE;
 char * g_logm_rsvbuf = NULL;
 volatile int logm_print_interval = LOGM_PRINT_INTERVAL * 1000;
+volatile uint8_t g_logm_waitstate = LOGM_WAIT_NONE;
+sem_t g_logm_wakeup;
 
 static int logm_change_bufsize(int buflen)
 {
@@ -63,13 +68,105 @@ static int logm_change_bufsize(int buflen)
 	return OK;
 }
 
+static bool logm_empty(void)
+{
+#ifdef CONFIG_LOGM_BINARY
+	if (!logm_binary_empty()) {
+		return false;
+	}
+#endif
+	return g_logm_head == g_logm_tail && !LOGM_STATUS(LOGM_BUFFER_RESIZE_REQ);
+}
+
+/* Write out the text buffer in contiguous runs, up to the overflow point
+ * at most so that the drop notice comes where the messages were lost.  The
+ * output stops at offset 'stop', or goes on to the tail if 'stop' is -1.
+ */
+
+void logm_flush_text(int stop)
+{
+	int tail;
+	int end;
+
+	while (g_logm_head != stop && g_logm_head != (tail = g_logm_tail)) {
+		end = tail < g_logm_head ? logm_bufsize : tail;
+		if (stop > g_logm_head && stop < end) {
+			end = stop;
+		}
+		if (g_logm_overflow_offset > g_logm_head && g_logm_overflow_offset < end) {
+			end = g_logm_overflow_offset;
+		}
+
+		fwrite(&g_logm_rsvbuf[g_logm_head], 1, end - g_logm_head, stdout);
+		g_logm_head = end % logm_bufsize;
+		if (LOGM_STATUS(LOGM_BUFFER_OVERFLOW)) {
+			LOGM_STATUS_CLEAR(LOGM_BUFFER_OVERFLOW);
+		}
+		if (g_logm_overflow_offset >= 0 && g_logm_overflow_offset == g_logm_head) {
+			fprintf(stdout, "\n[LOGM BUFFER OVERFLOW] %d messages are dropped\n", g_logm_dropmsg_count);
+			g_logm_overflow_offset = -1;
+		}
+	}
+}
+
+/****************************************************************************
+ * Name: logm_wait
+ *
+ * Description:
+ *   Wait until a logger or logm_wakeup() posts g_logm_wakeup for 'state',
+ *   or for at most 'delay' ticks if 'delay' is not zero.
+ *
+ ****************************************************************************/
+
+static void logm_wait(uint8_t state, uint32_t delay)
+{
+	uint8_t expected = state;
+
+	__atomic_store_n(&g_logm_waitstate, state, __ATOMIC_SEQ_CST);
+
+	/* A message queued before the state was set did not post */
+
+	if (state == LOGM_WAIT_EMPTY && !logm_empty() && __atomic_compare_exchange_n(&g_logm_waitstate, &expected, LOGM_WAIT_NONE, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+		return;
+	}
+
+	if (delay > 0) {
+		(void)sem_tickwait(&g_logm_wakeup, clock_systimer(), delay);
+	} else {
+		(void)sem_wait(&g_logm_wakeup);
+	}
+
+	/* A post that raced with the timeout only costs one early flush */
+
+	__atomic_store_n(&g_logm_waitstate, LOGM_WAIT_NONE, __ATOMIC_RELEASE);
+}
+
+/****************************************************************************
+ * Name: logm_wakeup
+ *
+ * Description:
+ *   Wake up the logm task if it waits, to act on a changed setting.
+ *
+ ****************************************************************************/
+
+void logm_wakeup(void)
+{
+	if (__atomic_exchange_n(&g_logm_waitstate, LOGM_WAIT_NONE, __ATOMIC_ACQ_REL) != LOGM_WAIT_NONE) {
+		sem_post(&g_logm_wakeup);
+	}
+}
+
 int logm_task(int argc, char *argv[])
 {
 	irqstate_t flags;
+	uint32_t delay;
 
 	g_logm_rsvbuf = (char *)kmm_malloc(logm_bufsize);
 	memset(g_logm_rsvbuf, 0, logm_bufsize);
 
+	sem_init(&g_logm_wakeup, 0, 0);
+	sem_setprotocol(&g_logm_wakeup, SEM_PRIO_NONE);
+
 	/* Now logm is ready */
 	LOGM_STATUS_SET(LOGM_READY);
 
@@ -78,18 +175,26 @@ int logm_task(int argc, char *argv[])
 #endif
 
 	while (1) {
-		while (g_logm_head != g_logm_tail) {
-			fputc(g_logm_rsvbuf[g_logm_head], stdout);
-			g_logm_head = (g_logm_head + 1) % logm_bufsize;
-			if (LOGM_STATUS(LOGM_BUFFER_OVERFLOW)) {
-				LOGM_STATUS_CLEAR(LOGM_BUFFER_OVERFLOW);
-			}
-			if (g_logm_overflow_offset >= 0 && g_logm_overflow_offset == g_logm_head) {
-				fprintf(stdout, "\n[LOGM BUFFER OVERFLOW] %d messages are dropped\n", g_logm_dropmsg_count);
-				g_logm_overflow_offset = -1;
-			}
+		/* Sleep until there is something to print, then give the loggers
+		 * the flushing interval to add more unless they fill half of a
+		 * buffer first.
+		 */
+
+		if (logm_empty()) {
+			logm_wait(LOGM_WAIT_EMPTY, 0);
+		}
+
+		delay = USEC2TICK(logm_print_interval);
+		if (delay > 0 && !LOGM_STATUS(LOGM_BUFFER_RESIZE_REQ)) {
+			logm_wait(LOGM_WAIT_BATCH, delay);
 		}
 
+#ifdef CONFIG_LOGM_BINARY
+		logm_binary_flush(stdout);
+#endif
+		logm_flush_text(-1);
+		fflush(stdout);
+
 		if (LOGM_STATUS(LOGM_BUFFER_RESIZE_REQ)) {
 			flags = enter_critical_section();
 			if (logm_change_bufsize(new_logm_bufsize) != OK) {
@@ -97,7 +202,6 @@ int logm_task(int argc, char *argv[])
 			}
 			leave_critical_section(flags);
 		}
-		usleep(logm_print_interval);
 	}
 
 	kmm_free(g_logm_rsvbuf);
@@ -91,6 +91,7 @@ static int logm_tash(int argc, char **args)
 			if (optarg != NULL && atoi(optarg) > 0) {
 				logm_set_values(LOGM_BUFSIZE, atoi(optarg));
 				LOGM_STATUS_SET(LOGM_BUFFER_RESIZE_REQ);
+				logm_wakeup();
 			}
 			break;
 		case 'i':
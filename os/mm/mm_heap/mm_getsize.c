@@ -29,10 +29,17 @@
  ****************************************************************************/
 
 /****************************************************************************
- * Private Functions
+ * Public Functions
  ****************************************************************************/
 
-static size_t mm_get_largest_freesize_from_specific_heap(struct mm_heap_s *heap)
+/****************************************************************************
+ * Name: mm_get_largest_freesize_from_specific_heap
+ *
+ * Description:
+ *   Returns the largest free node size in the given heap
+ ****************************************************************************/
+
+size_t mm_get_largest_freesize_from_specific_heap(struct mm_heap_s *heap)
 {
 	size_t largest_size = 0;
 	struct mm_freenode_s *fnode;
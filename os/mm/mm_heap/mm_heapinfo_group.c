@@ -64,6 +64,34 @@ int heapinfo_max_group;
 struct heapinfo_group_s heapinfo_group[HEAPINFO_USER_GROUP_NUM];
 struct heapinfo_group_info_s group_info[HEAPINFO_THREAD_NUM];
 
+/* Index into group_info of the thread that holds each pid hash, so the
+ * allocator finds the group of a thread without searching group_info.
+ */
+
+static int g_group_slot[CONFIG_MAX_TASKS];
+
+/****************************************************************************
+ * Name: heapinfo_find_group
+ *
+ * Description:
+ * Return the group of a task/thread or HEAPINFO_INVALID_GROUPID
+ ****************************************************************************/
+int heapinfo_find_group(pid_t pid)
+{
+	int slot;
+
+	if (pid < 0) {
+		return HEAPINFO_INVALID_GROUPID;
+	}
+
+	slot = g_group_slot[PIDHASH(pid)];
+	if (slot < 0 || group_info[slot].pid != pid) {
+		return HEAPINFO_INVALID_GROUPID;
+	}
+
+	return group_info[slot].group;
+}
+
 /****************************************************************************
  * Name: heapinfo_update_group
  *
@@ -72,33 +100,27 @@ struct heapinfo_group_info_s group_info[HEAPINFO_THREAD_NUM];
  ****************************************************************************/
 void heapinfo_update_group(mmsize_t size, pid_t pid)
 {
-	int check_idx;
 	int group_num;
-	int stack_pid;
+	struct heapinfo_group_s *group;
 
 	if (pid == HEAPINFO_INIT_INFO) {
 		/* Invalid PID */
 		mdbg("Invalid PID : %d\n", pid);
 		return;
 	}
-	for (check_idx = 0; check_idx < HEAPINFO_THREAD_NUM; check_idx++) {
-		if (pid == group_info[check_idx].pid) {
-			group_num = group_info[check_idx].group;
-			heapinfo_group[group_num].curr_size += size;
-			/* Update peak size */
-			if (heapinfo_group[group_num].peak_size < heapinfo_group[group_num].curr_size) {
-				heapinfo_group[group_num].peak_size = heapinfo_group[group_num].curr_size;
-				/* calculate the summation of stacks */
-				heapinfo_group[group_num].stack_size = 0;
-				for (stack_pid = 0; stack_pid < HEAPINFO_THREAD_NUM; stack_pid++) {
-					if (group_info[stack_pid].pid != HEAPINFO_INIT_INFO && group_info[stack_pid].group == group_num) {
-						heapinfo_group[group_num].stack_size += group_info[stack_pid].stack_size;
-					}
-				}
-				heapinfo_group[group_num].heap_size = heapinfo_group[group_num].peak_size - heapinfo_group[group_num].stack_size;
-			}
-			break;
-		}
+
+	group_num = heapinfo_find_group(pid);
+	if (group_num == HEAPINFO_INVALID_GROUPID) {
+		return;
+	}
+
+	group = &heapinfo_group[group_num];
+	group->curr_size += size;
+	/* Update peak size */
+	if (group->peak_size < group->curr_size) {
+		group->peak_size = group->curr_size;
+		group->stack_size = group->curr_stack_size;
+		group->heap_size = group->peak_size - group->stack_size;
 	}
 }
 
@@ -120,6 +142,12 @@ void heapinfo_update_group_info(pid_t pid, int group, int type)
 			group_info[info_idx].group = group;
 			group_info[info_idx].stack_size = 0;
 		}
+		for (info_idx = 0; info_idx < HEAPINFO_USER_GROUP_NUM; info_idx++) {
+			heapinfo_group[info_idx].curr_stack_size = 0;
+		}
+		for (info_idx = 0; info_idx < CONFIG_MAX_TASKS; info_idx++) {
+			g_group_slot[info_idx] = -1;
+		}
 		break;
 	case HEAPINFO_ADD_INFO:
 		if (group > heapinfo_max_group) {
@@ -129,9 +157,11 @@ void heapinfo_update_group_info(pid_t pid, int group, int type)
 			if (group_info[info_idx].pid <= 0) {
 				group_info[info_idx].pid = pid;
 				group_info[info_idx].group = group;
+				g_group_slot[PIDHASH(pid)] = info_idx;
 				tcb = sched_gettcb(pid);
 				if (tcb) {
 					group_info[info_idx].stack_size = tcb->adj_stack_size;
+					heapinfo_group[group].curr_stack_size += tcb->adj_stack_size;
 					heapinfo_update_group(tcb->adj_stack_size, pid);
 				}
 				break;
@@ -139,15 +169,15 @@ void heapinfo_update_group_info(pid_t pid, int group, int type)
 		}
 		break;
 	case HEAPINFO_DEL_INFO:
-		for (info_idx = 0; info_idx < HEAPINFO_THREAD_NUM; info_idx++) {
-			if (pid == group_info[info_idx].pid) {
-				heapinfo_update_group((-1) * group_info[info_idx].stack_size, pid);
+		info_idx = g_group_slot[PIDHASH(pid)];
+		if (info_idx >= 0 && pid == group_info[info_idx].pid) {
+			heapinfo_update_group((-1) * group_info[info_idx].stack_size, pid);
+			heapinfo_group[group_info[info_idx].group].curr_stack_size -= group_info[info_idx].stack_size;
 
-				group_info[info_idx].pid = -1;
-				group_info[info_idx].group = -1;
-				group_info[info_idx].stack_size = 0;
-				break;
-			}
+			group_info[info_idx].pid = -1;
+			group_info[info_idx].group = -1;
+			group_info[info_idx].stack_size = 0;
+			g_group_slot[PIDHASH(pid)] = -1;
 		}
 		break;
 	default:
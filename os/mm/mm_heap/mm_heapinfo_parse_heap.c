@@ -93,34 +93,19 @@ static inline int check_watchdog_state(int wd_fd, bool *is_watchdog_running)
 	return OK;
 }
 #endif
-/****************************************************************************
- * Public Functions
- ****************************************************************************/
-
-#ifdef CONFIG_DEBUG_MM_HEAPINFO
 
 /****************************************************************************
- * Name: heapinfo_parse
+ * Name: heapinfo_walk_heap
  *
  * Description:
- *   This function walk through heap and displays alloc info.
+ *   Walk through the heap to display the nodes asked by mode and pid, and
+ *   collect the free nodes and the allocations of dead threads on the way.
+ *   Returns ERROR if the walk was stopped to keep the watchdog alive.
  ****************************************************************************/
-void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
+static int heapinfo_walk_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid, pid_t *nonsched_list, size_t *nonsched_size, int *ordblks)
 {
 	struct mm_allocnode_s *node;
-	size_t mxordblk = 0;
-	int    ordblks  = 0;		/* Number of non-inuse chunks */
-	size_t fordblks = 0;		/* Total non-inuse space */
-	size_t heap_resource;
-	size_t stack_resource;
-	size_t nonsched_resource;
-	int nonsched_idx;
 	struct sched_param sched_data;
-	size_t heap_size;
-
-	/* This nonsched can be 3 types : group resources, freed when child task finished, leak */
-	pid_t nonsched_list[CONFIG_MAX_TASKS];
-	size_t nonsched_size[CONFIG_MAX_TASKS];
 
 #if CONFIG_KMM_REGIONS > 1
 	int region;
@@ -128,15 +113,6 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 #define region 0
 #endif
 
-#ifdef CONFIG_DEBUG_CHECK_FRAGMENTATION
-	int ndx;
-	int nodelist_cnt[MM_NNODES] = {0, };
-	size_t nodelist_size[MM_NNODES] = {0, };
-	FAR struct mm_freenode_s *fnode;
-#endif
-
-	ASSERT(mm_check_heap_corruption(heap) == OK);
-
 #ifdef CONFIG_WATCHDOG
 	bool is_watchdog_running;
 	int wd_fd = open(CONFIG_WATCHDOG_DEVPATH, O_RDONLY);
@@ -150,20 +126,11 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 		mfdbg("WARNING: It might reboot by watchdog during the printing heap usage log.\n");
 #else
 		mfdbg("It doesn't print the heap usage dump to prevent watchdog reboot.\n");
-		return;
+		return ERROR;
 #endif
 	}
 #endif
 
-	/* initialize the heap, stack and nonsched resource */
-	nonsched_resource = 0;
-	heap_resource = 0;
-	stack_resource = 0;
-	for (nonsched_idx = 0; nonsched_idx < CONFIG_MAX_TASKS; nonsched_idx++) {
-		nonsched_list[nonsched_idx] = HEAPINFO_NONSCHED;
-		nonsched_size[nonsched_idx] = 0;
-	}
-
 	/* Visit each region */
 
 #if CONFIG_KMM_REGIONS > 1
@@ -173,19 +140,17 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 		/* Visit each node in the region
 		 * Retake the semaphore for each region to reduce latencies
 		 */
-		DEBUGASSERT(mm_takesemaphore(heap));
-
-		if (mode != HEAPINFO_SIMPLE) {
-			heap_dbg("****************************************************************\n");
-			heap_dbg("REGION #%d Start=0x%p, End=0x%p, Size=%d\n",
-				region,
-				heap->mm_heapstart[region],
-				heap->mm_heapend[region],
-				(int)heap->mm_heapend[region] - (int)heap->mm_heapstart[region] + SIZEOF_MM_ALLOCNODE);
-			heap_dbg("****************************************************************\n");
-			heap_dbg("  MemAddr |   Size   | Status |    Owner   |  Pid  |\n");
-			heap_dbg("----------|----------|--------|------------|-------|\n");
-		}
+		DEBUGVERIFY(mm_takesemaphore(heap));
+
+		heap_dbg("****************************************************************\n");
+		heap_dbg("REGION #%d Start=0x%p, End=0x%p, Size=%d\n",
+			region,
+			heap->mm_heapstart[region],
+			heap->mm_heapend[region],
+			(int)heap->mm_heapend[region] - (int)heap->mm_heapstart[region] + SIZEOF_MM_ALLOCNODE);
+		heap_dbg("****************************************************************\n");
+		heap_dbg("  MemAddr |   Size   | Status |    Owner   |  Pid  |\n");
+		heap_dbg("----------|----------|--------|------------|-------|\n");
 
 		for (node = heap->mm_heapstart[region]; node < heap->mm_heapend[region]; node = (struct mm_allocnode_s *)((char *)node + node->size)) {
 			ASSERT(node->size);
@@ -201,28 +166,17 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 				}
 
 #if CONFIG_TASK_NAME_SIZE > 0
-				if (node->pid == HEAPINFO_INT && mode != HEAPINFO_SIMPLE) {
+				if (node->pid == HEAPINFO_INT) {
 					heap_dbg("INT Context\n");
-				} else if (node->pid < 0 && sched_getparam((-1) * (node->pid), &sched_data) != ERROR) {
-					stack_resource += node->size;
-				} else if (sched_getparam(node->pid, &sched_data) == ERROR) {
+				} else if (sched_getparam(node->pid < 0 ? -(node->pid) : node->pid, &sched_data) == ERROR) {
 					nonsched_list[PIDHASH(node->pid)] = node->pid;
 					nonsched_size[PIDHASH(node->pid)] += node->size;
-					nonsched_resource += node->size;
-				} else {
-					heap_resource += node->size;
 				}
 #else
-				if (mode != HEAPINFO_SIMPLE) {
-					heap_dbg("\n");
-				}
+				heap_dbg("\n");
 #endif
 			} else {
-				ordblks++;
-				fordblks += node->size;
-				if (node->size > mxordblk) {
-					mxordblk = node->size;
-				}
+				(*ordblks)++;
 				if (mode == HEAPINFO_DETAIL_ALL || mode == HEAPINFO_DETAIL_FREE || mode == HEAPINFO_DETAIL_SPECIFIC_HEAP) {
 					heap_dbg("0x%x | %8d |   %c    |            |       |\n", node, node->size, 'F');
 				}
@@ -240,45 +194,153 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 					mfdbg("It stops printing heap usage, to prevent watchdog reboot.\n");
 					mm_givesemaphore(heap);
 					close(wd_fd);
-					return;
+					return ERROR;
 				}
 #endif
 			}
 #endif
 		}
 
-		if (mode != HEAPINFO_SIMPLE) {
-			heap_dbg("** PID(S) in Pid column means that mem is used for stack of PID\n\n");
-		}
+		heap_dbg("** PID(S) in Pid column means that mem is used for stack of PID\n\n");
 		mm_givesemaphore(heap);
 	}
 #undef region
 
+#ifdef CONFIG_WATCHDOG
+	if (is_watchdog_running) {
+		close(wd_fd);
+	}
+#endif
+	return OK;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+#ifdef CONFIG_DEBUG_MM_HEAPINFO
+
+/****************************************************************************
+ * Name: heapinfo_get_usage
+ *
+ * Description:
+ *   Get the usage of a heap from the counters kept by the allocator.  The
+ *   allocated nodes are not visited, but the largest free size is found by
+ *   scanning the heads of the free lists with the heap locked, which costs
+ *   up to MM_NNODES steps.  The per-thread counters are read afterwards
+ *   without the lock.
+ ****************************************************************************/
+void heapinfo_get_usage(FAR struct mm_heap_s *heap, FAR struct heapinfo_usage_s *usage)
+{
+	struct sched_param sched_data;
+	size_t reserved;
+	size_t used;
+	int alloc_idx;
+	pid_t pid;
+
+	DEBUGASSERT(heap && usage);
+
+	DEBUGVERIFY(mm_takesemaphore(heap));
+	usage->heap_size = heap->mm_heapsize;
+	usage->curr_alloc_size = heap->total_alloc_size;
+	usage->peak_alloc_size = heap->peak_alloc_size;
+	usage->stack_size = heap->stack_alloc_size;
+	usage->alloc_count = heap->total_alloc_count;
+	usage->largest_free_size = mm_get_largest_freesize_from_specific_heap(heap);
+	mm_givesemaphore(heap);
+
+	usage->free_size = usage->heap_size - usage->curr_alloc_size;
+
+	/* The counters per pid do not include the stacks, what is neither a
+	 * stack nor counted for an alive thread was allocated by dead threads.
+	 */
+	usage->alive_size = 0;
+	for (alloc_idx = 0; alloc_idx < CONFIG_MAX_TASKS; alloc_idx++) {
+		pid = heap->alloc_list[alloc_idx].pid;
+		if (pid != HEAPINFO_INIT_INFO && sched_getparam(pid, &sched_data) != ERROR) {
+			usage->alive_size += heap->alloc_list[alloc_idx].curr_alloc_size;
+		}
+	}
+
+	/* The guard nodes at both ends of each region are counted as allocated */
+#if CONFIG_KMM_REGIONS > 1
+	reserved = heap->mm_nregions * 2 * SIZEOF_MM_ALLOCNODE;
+#else
+	reserved = 2 * SIZEOF_MM_ALLOCNODE;
+#endif
+	used = reserved + usage->stack_size + usage->alive_size;
+	usage->dead_size = usage->curr_alloc_size > used ? usage->curr_alloc_size - used : 0;
+}
+
+/****************************************************************************
+ * Name: heapinfo_parse
+ *
+ * Description:
+ *   This function displays alloc info.  The summary comes from the counters
+ *   kept by the allocator, the heap is walked only for the detailed views.
+ ****************************************************************************/
+void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
+{
+	struct heapinfo_usage_s usage;
+	int ordblks = 0;		/* Number of non-inuse chunks */
+	int nonsched_idx;
+	size_t heap_size;
+	bool walked;
+
+	/* This nonsched can be 3 types : group resources, freed when child task finished, leak */
+	pid_t nonsched_list[CONFIG_MAX_TASKS];
+	size_t nonsched_size[CONFIG_MAX_TASKS];
+
+#ifdef CONFIG_DEBUG_CHECK_FRAGMENTATION
+	int ndx;
+	int nodelist_cnt[MM_NNODES] = {0, };
+	size_t nodelist_size[MM_NNODES] = {0, };
+	FAR struct mm_freenode_s *fnode;
+#endif
+
+	ASSERT(mm_check_heap_corruption(heap) == OK);
+
+	walked = (mode != HEAPINFO_SIMPLE || pid != HEAPINFO_PID_ALL);
+	if (walked) {
+		for (nonsched_idx = 0; nonsched_idx < CONFIG_MAX_TASKS; nonsched_idx++) {
+			nonsched_list[nonsched_idx] = HEAPINFO_NONSCHED;
+			nonsched_size[nonsched_idx] = 0;
+		}
+
+		if (heapinfo_walk_heap(heap, mode, pid, nonsched_list, nonsched_size, &ordblks) != OK) {
+			return;
+		}
+	}
+
+	heapinfo_get_usage(heap, &usage);
+
 	heap_dbg("\n****************************************************************\n");
 	heap_dbg("     Summary of Heap Usages (Size in Bytes)\n");
 	heap_dbg("****************************************************************\n");
-	heap_size = heap->mm_heapsize;
+	heap_size = usage.heap_size;
 
 	heap_dbg("Total                           : %u (100%%)\n", heap_size);
 	heap_dbg("  - Allocated (Current / Peak)  : %u (%d%%) / %u (%d%%)\n",\
-		heap->total_alloc_size, (size_t)((uint64_t)(heap->total_alloc_size) * 100 / heap_size),\
-		heap->peak_alloc_size,  (size_t)((uint64_t)(heap->peak_alloc_size) * 100 / heap_size));
-	heap_dbg("  - Free (Current)              : %u (%d%%)\n", fordblks, (size_t)((uint64_t)fordblks * 100 / heap_size));
+		usage.curr_alloc_size, (size_t)((uint64_t)(usage.curr_alloc_size) * 100 / heap_size),\
+		usage.peak_alloc_size,  (size_t)((uint64_t)(usage.peak_alloc_size) * 100 / heap_size));
+	heap_dbg("  - Free (Current)              : %u (%d%%)\n", usage.free_size, (size_t)((uint64_t)usage.free_size * 100 / heap_size));
 	heap_dbg("  - Reserved                    : %u\n", SIZEOF_MM_ALLOCNODE * 2);
 
 	heap_dbg("\n****************************************************************\n");
 	heap_dbg("     Details of Heap Usages (Size in Bytes)\n");
 	heap_dbg("****************************************************************\n");
 	heap_dbg("< Free >\n");
-	heap_dbg("  - Number of Free Node               : %d\n", ordblks);
-	heap_dbg("  - Largest Free Node Size            : %u\n", mxordblk);
+	if (walked) {
+		heap_dbg("  - Number of Free Node               : %d\n", ordblks);
+	}
+	heap_dbg("  - Largest Free Node Size            : %u\n", usage.largest_free_size);
 	heap_dbg("\n< Allocation >\n");
+	heap_dbg("  - Number of Alive Allocation        : %d\n", usage.alloc_count);
 	heap_dbg("  - Current Size (Alive Allocation) = (1) + (2) + (3)\n");
-	heap_dbg("     . by Dead Threads (*) (1)        : %u\n", nonsched_resource);
+	heap_dbg("     . by Dead Threads (*) (1)        : %u\n", usage.dead_size);
 	heap_dbg("     . by Alive Threads\n");
-	heap_dbg("        - Sum of \"STACK\"(**) (2)      : %u\n", stack_resource);
-	heap_dbg("        - Sum of \"CURR_HEAP\" (3)      : %u\n", heap_resource - SIZEOF_MM_ALLOCNODE);	// Because of above for loop (node < heap->mm_heapend[region];),
-													// one of SIZEOF_MM_ALLOCNODE is subtracted.
+	heap_dbg("        - Sum of \"STACK\"(**) (2)      : %u\n", usage.stack_size);
+	heap_dbg("        - Sum of \"CURR_HEAP\" (3)      : %u\n", usage.alive_size);
 	heap_dbg("** NOTE **\n");
 	heap_dbg("(*)  Alive allocation by dead threads might be used by others or might be a leakage.\n");
 	heap_dbg("(**) Only Idle task has a separate stack region,\n");
@@ -303,7 +365,7 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 	}
 #endif
 
-	if (mode != HEAPINFO_SIMPLE) {
+	if (walked) {
 		heap_dbg("\n< by Dead Threads >\n");
 		heap_dbg(" Pid | Size \n");
 		heap_dbg("-----|------\n");
@@ -313,11 +375,6 @@ void heapinfo_parse_heap(FAR struct mm_heap_s *heap, int mode, pid_t pid)
 			}
 		}
 	}
-#ifdef CONFIG_WATCHDOG
-	if (is_watchdog_running) {
-		close(wd_fd);
-	}
-#endif
 	return;
 }
 #endif
@@ -70,6 +70,8 @@ void heapinfo_add_size(struct mm_heap_s *heap, pid_t pid, mmsize_t size)
 {
 	pid_t hash_pid;
 
+	heap->total_alloc_count++;
+
 	hash_pid = PIDHASH(pid);
 	if (heap->alloc_list[hash_pid].pid == HEAPINFO_INIT_INFO || heap->alloc_list[hash_pid].pid == pid) {
 		heap->alloc_list[hash_pid].pid = pid;
@@ -91,6 +93,14 @@ void heapinfo_subtract_size(struct mm_heap_s *heap, pid_t pid, mmsize_t size)
 {
 	pid_t hash_pid;
 
+	heap->total_alloc_count--;
+	if (pid < 0) {
+		/* A stack node, see heapinfo_set_stack_node() */
+
+		heap->stack_alloc_size -= size;
+		return;
+	}
+
 	hash_pid = PIDHASH(pid);
 	if (heap->alloc_list[hash_pid].pid == pid) {
 			heap->alloc_list[hash_pid].curr_alloc_size -= size;
@@ -187,18 +197,18 @@ void heapinfo_exclude_stacksize(void *stack_ptr)
 	node = (struct mm_allocnode_s *)(stack_ptr - SIZEOF_MM_ALLOCNODE);
 
 	DEBUGASSERT(node);
+	heap->stack_alloc_size += node->size;
 	hash_pid = PIDHASH(node->pid);
 	heap->alloc_list[hash_pid].curr_alloc_size -= node->size;
+	if (heap->alloc_list[hash_pid].pid == node->pid) {
+		heap->alloc_list[hash_pid].num_alloc_free--;
+	}
 #ifdef CONFIG_HEAPINFO_USER_GROUP
-	int check_idx;
 	int group_num;
 
-	for (check_idx = 0; check_idx <= heapinfo_max_group; check_idx++) {
-		if (node->pid == group_info[check_idx].pid) {
-			group_num = group_info[check_idx].group;
-			heapinfo_group[group_num].curr_size -= node->size;
-			break;
-		}
+	group_num = heapinfo_find_group(node->pid);
+	if (group_num != HEAPINFO_INVALID_GROUPID) {
+		heapinfo_group[group_num].curr_size -= node->size;
 	}
 #endif
 }
@@ -240,6 +250,31 @@ void heapinfo_dealloc_tcbinfo(void *address, pid_t pid)
 	}
 }
 
+/************************************************************************
+ * Name: heapinfo_get_tcbinfo
+ *
+ * Description:  Copy the running allocation counters of a task from a
+ *   heap, without walking the heap.
+ *
+ * Return Value:  OK, or ERROR if the heap has no counters for the task.
+ ************************************************************************/
+int heapinfo_get_tcbinfo(struct mm_heap_s *heap, pid_t pid, heapinfo_tcb_info_t *info)
+{
+	pid_t hash_pid;
+
+	DEBUGASSERT(heap && info);
+	hash_pid = PIDHASH(pid);
+	if (heap->alloc_list[hash_pid].pid != pid) {
+		return ERROR;
+	}
+
+	*info = heap->alloc_list[hash_pid];
+
+	/* The slot could be taken over by another task while it was copied */
+
+	return info->pid == pid ? OK : ERROR;
+}
+
 /************************************************************************
  * Name: heapinfo_dump_heap
  *
@@ -276,6 +276,8 @@ int mm_initialize(FAR struct mm_heap_s *heap, FAR void *heapstart, size_t heapsi
 		return ret;
 	}
 #ifdef CONFIG_DEBUG_MM_HEAPINFO
+	heap->stack_alloc_size = 0;
+	heap->total_alloc_count = 0;
 	for (i = 0; i < CONFIG_MAX_TASKS; i++) {
 		heap->alloc_list[i].pid = HEAPINFO_INIT_INFO;
 	}
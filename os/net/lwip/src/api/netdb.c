@@ -62,6 +62,7 @@
 #include "lwip/ip_addr.h"
 #include "lwip/api.h"
 #include "lwip/dns.h"
+#include "lwip/dns_cache.h"
 
 #include <string.h>				/* memset */
 #include <stdlib.h>				/* atoi */
@@ -92,6 +93,36 @@ int h_errno;
 #define HOSTENT_STORAGE static
 #endif							/* LWIP_DNS_API_STATIC_HOSTENT */
 
+/**
+ * Resolve name without a round trip through the tcpip thread when it is in
+ * address notation or in the DNS answer cache, ask the resolver otherwise.
+ * This is the only place the answer cache is consulted, the resolver only
+ * fills it, so every lookup is counted once in the cache statistics.
+ */
+static err_t netdb_gethostbyname(const char *name, ip_addr_t *addr, u8_t dns_addrtype)
+{
+#if LWIP_DNS_CACHE
+	err_t err;
+#endif
+
+	if (ipaddr_aton(name, addr)) {
+#if LWIP_IPV4 && LWIP_IPV6
+		if ((IP_IS_V6(addr) && (dns_addrtype != LWIP_DNS_ADDRTYPE_IPV4)) || (IP_IS_V4(addr) && (dns_addrtype != LWIP_DNS_ADDRTYPE_IPV6)))
+#endif							/* LWIP_IPV4 && LWIP_IPV6 */
+		{
+			return ERR_OK;
+		}
+	}
+#if LWIP_DNS_CACHE
+	err = dns_cache_lookup(name, addr, dns_addrtype);
+	if (err == ERR_OK || err == ERR_VAL) {
+		return err;
+	}
+#endif							/* LWIP_DNS_CACHE */
+
+	return netconn_gethostbyname_addrtype(name, addr, dns_addrtype);
+}
+
 /**
  * Returns an entry containing addresses of address family AF_INET
  * for the host with name name.
@@ -114,7 +145,7 @@ struct hostent *lwip_gethostbyname(const char *name)
 	HOSTENT_STORAGE char s_hostname[DNS_MAX_NAME_LENGTH + 1];
 
 	/* query host IP address */
-	err = netconn_gethostbyname(name, &addr);
+	err = netdb_gethostbyname(name, &addr, LWIP_DNS_ADDRTYPE_DEFAULT);
 	if (err != ERR_OK) {
 		LWIP_DEBUGF(DNS_DEBUG, ("lwip_gethostbyname(%s) failed, err=%d\n", name, err));
 		h_errno = HOST_NOT_FOUND;
@@ -212,7 +243,7 @@ int lwip_gethostbyname_r(const char *name, struct hostent *ret, char *buf, size_
 	hostname = ((char *)h) + sizeof(struct gethostbyname_r_helper);
 
 	/* query host IP address */
-	err = netconn_gethostbyname(name, &h->addr);
+	err = netdb_gethostbyname(name, &h->addr, LWIP_DNS_ADDRTYPE_DEFAULT);
 	if (err != ERR_OK) {
 		LWIP_DEBUGF(DNS_DEBUG, ("lwip_gethostbyname(%s) failed, err=%d\n", name, err));
 		*h_errnop = HOST_NOT_FOUND;
@@ -344,8 +375,10 @@ int lwip_getaddrinfo(const char *nodename, const char *servname, const struct ad
 			} else if (ai_family == AF_INET6) {
 				type = NETCONN_DNS_IPV6;
 			}
+#else
+			u8_t type = LWIP_DNS_ADDRTYPE_DEFAULT;
 #endif							/* LWIP_IPV4 && LWIP_IPV6 */
-			err = netconn_gethostbyname_addrtype(nodename, &addr, type);
+			err = netdb_gethostbyname(nodename, &addr, type);
 			if (err != ERR_OK) {
 				return EAI_FAIL;
 			}
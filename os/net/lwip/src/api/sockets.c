@@ -257,6 +257,8 @@ struct lwip_select_cb {
 #else
 	/** Pointer to semaphore used post output event */
 	sys_sem_t *poll_sem;
+	/** pollfd whose revents is set with the event, as epoll looks at it */
+	struct pollfd *fds;
 	/** Pointer to event-set of requested poll events */
 	pollevent_t events;
 	/** socket descriptor value */
@@ -1690,6 +1692,7 @@ static int lwip_poll_setup(int fd, struct lwip_sock *sock, struct pollfd *fds)
 	select_cb->prev = NULL;
 	select_cb->sem_signalled = 0;
 	select_cb->poll_sem = fds->sem;
+	select_cb->fds = fds;
 	select_cb->events = fds->events;
 	select_cb->sfd = fd;
 
@@ -1906,12 +1909,16 @@ again:
 			/* semaphore not signalled yet */
 			int do_signal = 0;
 			int check_set = 0;
+#if !LWIP_SELECT
+			pollevent_t revents = 0;
+#endif
 			/* Test this select call for our socket */
 			if (sock->rcvevent > 0) {
 #if LWIP_SELECT
 				check_set = scb->readset && FD_ISSET(s, scb->readset);
 #else
 				check_set = (scb->sfd == s) && (scb->events & POLLIN);
+				revents |= check_set ? POLLIN : 0;
 #endif
 				if (check_set) {
 					do_signal = 1;
@@ -1922,6 +1929,7 @@ again:
 				check_set = scb->writeset && FD_ISSET(s, scb->writeset);
 #else
 				check_set = (scb->sfd == s) && (scb->events & POLLOUT);
+				revents |= check_set ? POLLOUT : 0;
 #endif
 				if (!do_signal && check_set) {
 					do_signal = 1;
@@ -1932,6 +1940,7 @@ again:
 				check_set = scb->exceptset && FD_ISSET(s, scb->exceptset);
 #else
 				check_set = (scb->sfd == s) && (scb->events & POLLERR);
+				revents |= check_set ? POLLERR : 0;
 #endif
 				if (!do_signal && check_set) {
 					do_signal = 1;
@@ -1944,6 +1953,9 @@ again:
 #if LWIP_SELECT
 				sys_sem_signal(&scb->sem);
 #else
+				/* Report the events like a driver does for poll(), epoll
+				   only looks again at the descriptors with revents set. */
+				scb->fds->revents |= revents;
 				sys_sem_signal(scb->poll_sem);
 #endif
 			}
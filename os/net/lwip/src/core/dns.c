@@ -108,6 +108,7 @@
 #include "lwip/mem.h"
 #include "lwip/memp.h"
 #include "lwip/dns.h"
+#include "lwip/dns_cache.h"
 #include "lwip/prot/dns.h"
 
 #include <string.h>
@@ -363,6 +364,9 @@ void dns_init(void)
 #if DNS_LOCAL_HOSTLIST
 	dns_init_local();
 #endif
+#if LWIP_DNS_CACHE
+	dns_cache_init();
+#endif
 }
 
 /**
@@ -1088,6 +1092,9 @@ static void dns_correct_response(u8_t idx, u32_t ttl)
 	if (entry->ttl > DNS_MAX_TTL) {
 		entry->ttl = DNS_MAX_TTL;
 	}
+#if LWIP_DNS_CACHE
+	dns_cache_insert(entry->name, &entry->ipaddr, LWIP_DNS_ADDRTYPE_ARG_OR_ZERO(entry->reqaddrtype), entry->ttl);
+#endif
 	dns_call_found(idx, &entry->ipaddr);
 
 	if (entry->ttl == 0) {
@@ -1259,6 +1266,12 @@ static void dns_recv(void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_ad
 #endif							/* LWIP_IPV4 && LWIP_IPV6 */
 					LWIP_DEBUGF(DNS_DEBUG, ("dns_recv: \"%s\": error in response\n", entry->name));
 				}
+#if LWIP_DNS_CACHE && DNS_CACHE_NEG_TTL
+				/* RFC 2308: remember NXDOMAIN and NODATA, but not server failures */
+				if ((hdr.flags2 & DNS_FLAG2_ERR_MASK) == DNS_FLAG2_ERR_NONE || (hdr.flags2 & DNS_FLAG2_ERR_MASK) == DNS_FLAG2_ERR_NAME) {
+					dns_cache_insert_negative(entry->name, LWIP_DNS_ADDRTYPE_ARG_OR_ZERO(entry->reqaddrtype));
+				}
+#endif
 				/* call callback to indicate error, clean up memory and return */
 				pbuf_free(p);
 				dns_call_found(i, NULL);
@@ -1526,4 +1539,32 @@ err_t dns_gethostbyname_addrtype(const char *hostname, ip_addr_t *addr, dns_foun
 					   LWIP_DNS_ISMDNS_ARG(is_mdns));
 }
 
+#if LWIP_DNS_CACHE
+/**
+ * Send a query for a name even if it is cached, used by the answer cache to
+ * refresh an entry before it expires. The answer replaces the cached one.
+ *
+ * @return ERR_INPROGRESS if the query is queued, an error otherwise
+ */
+err_t dns_refresh(const char *hostname, dns_found_callback found, void *callback_arg, u8_t dns_addrtype)
+{
+	size_t hostnamelen = strlen(hostname);
+
+#if ((LWIP_DNS_SECURE & LWIP_DNS_SECURE_RAND_SRC_PORT) == 0)
+	if (dns_pcbs[0] == NULL) {
+		return ERR_ARG;
+	}
+#endif
+	if (hostnamelen >= DNS_MAX_NAME_LENGTH || ip_addr_isany_val(dns_servers[0])) {
+		return ERR_ARG;
+	}
+#if !(LWIP_IPV4 && LWIP_IPV6)
+	LWIP_UNUSED_ARG(dns_addrtype);
+#endif
+
+	return dns_enqueue(hostname, hostnamelen, found, callback_arg LWIP_DNS_ADDRTYPE_ARG(dns_addrtype)
+					   LWIP_DNS_ISMDNS_ARG(0));
+}
+#endif							/* LWIP_DNS_CACHE */
+
 #endif							/* LWIP_DNS */
@@ -0,0 +1,317 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/**
+ * @file
+ * DNS answer cache
+ *
+ * A fixed table of DNS_CACHE_SIZE names with least recently used
+ * replacement. Positive entries live for the TTL of the answer, negative
+ * entries for DNS_CACHE_NEG_TTL seconds. A hit on an entry close to its
+ * expiry schedules a refresh query on the tcpip thread so that names in
+ * steady use never fall out of the cache.
+ */
+
+#include "lwip/opt.h"
+
+#if LWIP_DNS && LWIP_DNS_CACHE
+
+#include "lwip/def.h"
+#include "lwip/sys.h"
+#include "lwip/tcpip.h"
+#include "lwip/dns.h"
+#include "lwip/dns_cache.h"
+
+#include <string.h>
+
+#define DNS_CACHE_UNUSED    0
+#define DNS_CACHE_VALID     1
+#define DNS_CACHE_NEGATIVE  2
+
+#if LWIP_IPV4 && LWIP_IPV6
+#define DNS_CACHE_ADDRTYPE_MATCH(t, ip) (((t) == LWIP_DNS_ADDRTYPE_IPV4_IPV6) || ((t) == LWIP_DNS_ADDRTYPE_IPV6_IPV4) || \
+										 ((IP_IS_V6_VAL(ip) != 0) == ((t) == LWIP_DNS_ADDRTYPE_IPV6)))
+#else
+#define DNS_CACHE_ADDRTYPE_MATCH(t, ip) 1
+#endif
+
+/* sys_now() based times, compared as signed differences to survive wrap */
+#define DNS_CACHE_EXPIRED(e, now) ((s32_t)((now) - (e)->expires) >= 0)
+
+struct dns_cache_entry {
+	ip_addr_t ipaddr;
+	u32_t expires;				/* sys_now() at which the entry expires */
+	u32_t lifetime;				/* TTL the entry was stored with, in ms */
+	u32_t used;					/* sys_now() of the last hit, for LRU replacement */
+	u8_t state;
+	u8_t addrtype;
+	u8_t prefetching;
+	char name[DNS_CACHE_NAME_LEN];
+};
+
+static struct dns_cache_entry dns_cache[DNS_CACHE_SIZE];
+static struct dns_cache_stats dns_cache_stats;
+static sys_mutex_t dns_cache_lock;
+
+/* Find the entry for name which a new answer of type addrtype replaces, or
+ * else a free, an expired or the least recently used entry. */
+static struct dns_cache_entry *dns_cache_slot(const char *name, u8_t dns_addrtype, u32_t now)
+{
+	struct dns_cache_entry *victim = NULL;
+	struct dns_cache_entry *e;
+	u8_t i;
+
+	for (i = 0; i < DNS_CACHE_SIZE; i++) {
+		e = &dns_cache[i];
+		if (e->state != DNS_CACHE_UNUSED && lwip_strnicmp(name, e->name, DNS_CACHE_NAME_LEN) == 0) {
+			if (e->state == DNS_CACHE_NEGATIVE ? (e->addrtype == dns_addrtype) : DNS_CACHE_ADDRTYPE_MATCH(dns_addrtype, e->ipaddr)) {
+				return e;
+			}
+		}
+		if (e->state == DNS_CACHE_UNUSED || DNS_CACHE_EXPIRED(e, now)) {
+			if (victim == NULL || victim->state != DNS_CACHE_UNUSED) {
+				victim = e;
+				victim->state = DNS_CACHE_UNUSED;
+			}
+		} else if (victim == NULL || (victim->state != DNS_CACHE_UNUSED && (s32_t)(e->used - victim->used) < 0)) {
+			victim = e;
+		}
+	}
+
+	if (victim->state != DNS_CACHE_UNUSED) {
+		dns_cache_stats.evictions++;
+	}
+
+	return victim;
+}
+
+static err_t dns_cache_store(const char *name, const ip_addr_t *addr, u8_t dns_addrtype, u32_t lifetime)
+{
+	struct dns_cache_entry *e;
+	u32_t now;
+
+	if (strlen(name) >= DNS_CACHE_NAME_LEN || lifetime == 0) {
+		return ERR_ARG;
+	}
+
+	sys_mutex_lock(&dns_cache_lock);
+
+	now = sys_now();
+	e = dns_cache_slot(name, dns_addrtype, now);
+	strncpy(e->name, name, DNS_CACHE_NAME_LEN);
+	if (addr != NULL) {
+		ip_addr_copy(e->ipaddr, *addr);
+		e->state = DNS_CACHE_VALID;
+	} else {
+		ip_addr_set_zero(&e->ipaddr);
+		e->state = DNS_CACHE_NEGATIVE;
+	}
+	e->addrtype = dns_addrtype;
+	e->lifetime = lifetime;
+	e->expires = now + lifetime;
+	e->used = now;
+	e->prefetching = 0;
+	dns_cache_stats.inserts++;
+
+	sys_mutex_unlock(&dns_cache_lock);
+
+	return ERR_OK;
+}
+
+#if DNS_CACHE_PREFETCH
+static void dns_cache_prefetch_done(u8_t idx, const char *name)
+{
+	struct dns_cache_entry *e = &dns_cache[idx];
+
+	sys_mutex_lock(&dns_cache_lock);
+	if (e->prefetching && lwip_strnicmp(name, e->name, DNS_CACHE_NAME_LEN) == 0) {
+		e->prefetching = 0;
+	}
+	sys_mutex_unlock(&dns_cache_lock);
+}
+
+/* A successful refresh has already replaced the entry from dns_recv(),
+ * only a failed one is left to clear the flag so a later hit retries. */
+static void dns_cache_prefetch_found(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+	if (ipaddr == NULL) {
+		dns_cache_prefetch_done((u8_t)(mem_ptr_t)arg, name);
+	}
+}
+
+/* Runs on the tcpip thread */
+static void dns_cache_prefetch(void *arg)
+{
+	u8_t idx = (u8_t)(mem_ptr_t)arg;
+	struct dns_cache_entry *e = &dns_cache[idx];
+	char name[DNS_CACHE_NAME_LEN];
+	u8_t dns_addrtype;
+
+	sys_mutex_lock(&dns_cache_lock);
+	if (!e->prefetching || e->state != DNS_CACHE_VALID) {
+		sys_mutex_unlock(&dns_cache_lock);
+		return;
+	}
+	memcpy(name, e->name, DNS_CACHE_NAME_LEN);
+	dns_addrtype = e->addrtype;
+	dns_cache_stats.prefetches++;
+	sys_mutex_unlock(&dns_cache_lock);
+
+	if (dns_refresh(name, dns_cache_prefetch_found, arg, dns_addrtype) != ERR_INPROGRESS) {
+		dns_cache_prefetch_done(idx, name);
+	}
+}
+#endif							/* DNS_CACHE_PREFETCH */
+
+void dns_cache_init(void)
+{
+	if (sys_mutex_new(&dns_cache_lock) != ERR_OK) {
+		LWIP_ASSERT("failed to create dns cache lock", 0);
+	}
+}
+
+err_t dns_cache_lookup(const char *name, ip_addr_t *addr, u8_t dns_addrtype)
+{
+	struct dns_cache_entry *e;
+	err_t err = ERR_ARG;
+	u32_t now;
+	u8_t i;
+#if DNS_CACHE_PREFETCH
+	s16_t prefetch = -1;
+#endif
+
+	if (strlen(name) >= DNS_CACHE_NAME_LEN) {
+		return ERR_ARG;
+	}
+
+	sys_mutex_lock(&dns_cache_lock);
+
+	now = sys_now();
+	dns_cache_stats.lookups++;
+	for (i = 0; i < DNS_CACHE_SIZE; i++) {
+		e = &dns_cache[i];
+		if (e->state == DNS_CACHE_UNUSED || lwip_strnicmp(name, e->name, DNS_CACHE_NAME_LEN) != 0) {
+			continue;
+		}
+		if (DNS_CACHE_EXPIRED(e, now)) {
+			e->state = DNS_CACHE_UNUSED;
+			dns_cache_stats.expired++;
+			continue;
+		}
+		if (e->state == DNS_CACHE_NEGATIVE) {
+			if (e->addrtype == dns_addrtype) {
+				dns_cache_stats.negative_hits++;
+				err = ERR_VAL;
+				break;
+			}
+			continue;
+		}
+		if (!DNS_CACHE_ADDRTYPE_MATCH(dns_addrtype, e->ipaddr)) {
+			continue;
+		}
+
+		ip_addr_copy(*addr, e->ipaddr);
+		e->used = now;
+		dns_cache_stats.hits++;
+		err = ERR_OK;
+#if DNS_CACHE_PREFETCH
+		if (!e->prefetching && e->expires - now <= e->lifetime / 100 * DNS_CACHE_PREFETCH) {
+			e->prefetching = 1;
+			prefetch = i;
+		}
+#endif
+		break;
+	}
+	if (err == ERR_ARG) {
+		dns_cache_stats.misses++;
+	}
+
+	sys_mutex_unlock(&dns_cache_lock);
+
+#if DNS_CACHE_PREFETCH
+	if (prefetch >= 0 && tcpip_callback_with_block(dns_cache_prefetch, (void *)(mem_ptr_t)prefetch, 0) != ERR_OK) {
+		dns_cache_prefetch_done((u8_t)prefetch, name);
+	}
+#endif
+
+	return err;
+}
+
+err_t dns_cache_insert(const char *name, const ip_addr_t *addr, u8_t dns_addrtype, u32_t ttl)
+{
+	if (addr == NULL) {
+		return ERR_ARG;
+	}
+#if LWIP_IPV4 && LWIP_IPV6
+	/* an answer only replaces a cached answer of the same family */
+	dns_addrtype = IP_IS_V6(addr) ? LWIP_DNS_ADDRTYPE_IPV6 : LWIP_DNS_ADDRTYPE_IPV4;
+#endif
+
+	/* RFC 1035: a zero TTL answer is only good for the transaction in progress */
+	return dns_cache_store(name, addr, dns_addrtype, ttl * 1000);
+}
+
+err_t dns_cache_insert_negative(const char *name, u8_t dns_addrtype)
+{
+	return dns_cache_store(name, NULL, dns_addrtype, DNS_CACHE_NEG_TTL * 1000);
+}
+
+void dns_cache_flush(void)
+{
+	u8_t i;
+
+	sys_mutex_lock(&dns_cache_lock);
+	for (i = 0; i < DNS_CACHE_SIZE; i++) {
+		dns_cache[i].state = DNS_CACHE_UNUSED;
+		dns_cache[i].prefetching = 0;
+	}
+	sys_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_cache_get_stats(struct dns_cache_stats *stats)
+{
+	sys_mutex_lock(&dns_cache_lock);
+	memcpy(stats, &dns_cache_stats, sizeof(struct dns_cache_stats));
+	sys_mutex_unlock(&dns_cache_lock);
+}
+
+void dns_cache_foreach(dns_cache_entry_fn fn, void *arg)
+{
+	struct dns_cache_info info;
+	struct dns_cache_entry *e;
+	u32_t now;
+	u8_t i;
+
+	sys_mutex_lock(&dns_cache_lock);
+
+	now = sys_now();
+	for (i = 0; i < DNS_CACHE_SIZE; i++) {
+		e = &dns_cache[i];
+		if (e->state == DNS_CACHE_UNUSED || DNS_CACHE_EXPIRED(e, now)) {
+			continue;
+		}
+		info.name = e->name;
+		info.ipaddr = e->state == DNS_CACHE_NEGATIVE ? NULL : &e->ipaddr;
+		info.ttl = (e->expires - now) / 1000;
+		info.prefetching = e->prefetching;
+		fn(&info, arg);
+	}
+
+	sys_mutex_unlock(&dns_cache_lock);
+}
+
+#endif							/* LWIP_DNS && LWIP_DNS_CACHE */
@@ -124,6 +124,9 @@ void dns_setserver(u8_t numdns, const ip_addr_t * dnsserver);
 const ip_addr_t *dns_getserver(u8_t numdns);
 err_t dns_gethostbyname(const char *hostname, ip_addr_t * addr, dns_found_callback found, void *callback_arg);
 err_t dns_gethostbyname_addrtype(const char *hostname, ip_addr_t * addr, dns_found_callback found, void *callback_arg, u8_t dns_addrtype);
+#if LWIP_DNS_CACHE
+err_t dns_refresh(const char *hostname, dns_found_callback found, void *callback_arg, u8_t dns_addrtype);
+#endif
 
 #if DNS_LOCAL_HOSTLIST
 size_t dns_local_iterate(dns_found_callback iterator_fn, void *iterator_arg);
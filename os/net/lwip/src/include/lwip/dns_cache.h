@@ -0,0 +1,107 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+/**
+ * @file
+ * DNS answer cache
+ *
+ * The resolver stores every answer here together with its TTL and, for
+ * names the server reported as non-existent, a negative entry. Lookups are
+ * protected by a mutex so the netdb functions can consult the cache from
+ * the calling task before handing the request to the tcpip thread.
+ */
+
+#ifndef LWIP_HDR_DNS_CACHE_H
+#define LWIP_HDR_DNS_CACHE_H
+
+#include "lwip/opt.h"
+
+#if LWIP_DNS && LWIP_DNS_CACHE
+
+#include "lwip/ip_addr.h"
+#include "lwip/err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Cache counters, shown in /proc/dnscache */
+struct dns_cache_stats {
+	u32_t lookups;
+	u32_t hits;
+	u32_t negative_hits;
+	u32_t misses;
+	u32_t expired;
+	u32_t inserts;
+	u32_t evictions;
+	u32_t prefetches;
+};
+
+/** A live entry, as passed to the dns_cache_foreach() callback */
+struct dns_cache_info {
+	const char *name;
+	const ip_addr_t *ipaddr;	/* NULL for a negative entry */
+	u32_t ttl;					/* Seconds left */
+	u8_t prefetching;
+};
+
+typedef void (*dns_cache_entry_fn)(const struct dns_cache_info *info, void *arg);
+
+void dns_cache_init(void);
+
+/**
+ * Look up a name in the cache.
+ *
+ * @param name the name to look up
+ * @param addr where to store the address on a hit
+ * @param dns_addrtype one of the LWIP_DNS_ADDRTYPE_* values
+ * @return ERR_OK on a hit, ERR_VAL if the name is known not to exist,
+ *         ERR_ARG if the resolver has to be asked
+ */
+err_t dns_cache_lookup(const char *name, ip_addr_t *addr, u8_t dns_addrtype);
+
+/**
+ * Store an answer, replacing an older answer for the same name or the least
+ * recently used entry.
+ *
+ * @param ttl time to live of the answer in seconds
+ * @return ERR_OK if the answer is cached, ERR_ARG if it is not cacheable
+ */
+err_t dns_cache_insert(const char *name, const ip_addr_t *addr, u8_t dns_addrtype, u32_t ttl);
+
+/**
+ * Remember that the server reported name as non-existent (NXDOMAIN or an
+ * answer without a record of the requested type).
+ */
+err_t dns_cache_insert_negative(const char *name, u8_t dns_addrtype);
+
+void dns_cache_flush(void);
+void dns_cache_get_stats(struct dns_cache_stats *stats);
+
+/**
+ * Call fn for every entry that has not expired. The cache is locked while
+ * the entries are visited, so fn must not call back into the cache.
+ */
+void dns_cache_foreach(dns_cache_entry_fn fn, void *arg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif							/* LWIP_DNS && LWIP_DNS_CACHE */
+
+#endif							/* LWIP_HDR_DNS_CACHE_H */
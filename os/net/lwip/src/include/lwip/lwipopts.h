@@ -1210,6 +1210,14 @@
 #endif
 #endif /* CONFIG_NET_DNS_LOCAL_HOSTLIST */
 
+#ifdef CONFIG_NET_DNS_CACHE
+#define LWIP_DNS_CACHE 1
+#define DNS_CACHE_SIZE CONFIG_NET_DNS_CACHE_SIZE
+#define DNS_CACHE_NAME_LEN CONFIG_NET_DNS_CACHE_NAME_LEN
+#define DNS_CACHE_NEG_TTL CONFIG_NET_DNS_CACHE_NEG_TTL
+#define DNS_CACHE_PREFETCH CONFIG_NET_DNS_CACHE_PREFETCH
+#endif
+
 #endif /* LWIP_DNS */
 /* ---------- End of DNS options ---------*/
 
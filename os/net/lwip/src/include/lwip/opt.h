@@ -1017,6 +1017,33 @@
 #define DNS_MAX_SERVERS                 2
 #endif
 
+/** LWIP_DNS_CACHE==1: Keep answers in a TTL honouring cache shared with
+ * the netdb functions, see dns_cache.h. */
+#ifndef LWIP_DNS_CACHE
+#define LWIP_DNS_CACHE                  0
+#endif
+
+/** Number of names kept in the answer cache. */
+#ifndef DNS_CACHE_SIZE
+#define DNS_CACHE_SIZE                  8
+#endif
+
+/** Longest name (including the terminating NUL) kept in the answer cache. */
+#ifndef DNS_CACHE_NAME_LEN
+#define DNS_CACHE_NAME_LEN              64
+#endif
+
+/** Seconds a non-existent name is answered from the cache, 0 to disable. */
+#ifndef DNS_CACHE_NEG_TTL
+#define DNS_CACHE_NEG_TTL               30
+#endif
+
+/** Refresh a cached name on a hit when less than this percentage of its
+ * TTL is left, 0 to disable. */
+#ifndef DNS_CACHE_PREFETCH
+#define DNS_CACHE_PREFETCH              10
+#endif
+
 /** DNS do a name checking between the query and the response. */
 #ifndef DNS_DOES_NAME_CHECK
 #define DNS_DOES_NAME_CHECK             1
@@ -18,6 +18,7 @@
 
 #include <tinyara/config.h>
 #include <tinyara/pm/pm.h>
+#include <tinyara/wdog.h>
 #include <time.h>
 #include <queue.h>
 #include <debug.h>
@@ -45,6 +46,7 @@ struct pm_metric_s {
 	uint32_t board_sleep_ticks;						 /* The amount of time (in ticks) board was in sleep */
 	uint32_t wakeup_src_counts[PM_WAKEUP_SRC_COUNT]; /* It counts the frequency of wakeup sources */
 	uint32_t total_try_ticks;						 /* Total duration of time pm tries to make board sleep */
+	struct wdog_stats_s wdog_stats;					 /* Watchdog expirations, counted from the start */
 };
 
 typedef struct pm_metric_s pm_metric_t;
@@ -56,6 +58,8 @@ static void pm_print_metrics(double total_time, int n_domains)
 {
 	int index;
 	enum pm_state_e pm_state;
+	uint32_t wakeups = 0;
+	double seconds = ((double)TICK2MSEC((int)total_time)) / 1000.0;
 	pmdbg("\n");
 	pmdbg("TOTAL METRICS TIME [1] = %dms\n", TICK2MSEC((int)total_time));
 	pmdbg("TOTAL SLEEP TRY TIME [2] = %dms\n", TICK2MSEC(g_pm_metrics->total_try_ticks));
@@ -80,9 +84,21 @@ static void pm_print_metrics(double total_time, int n_domains)
 	pmdbg("----------------|--------\n");
 	for (index = 0; index < PM_WAKEUP_SRC_COUNT; index++) {
 		pmdbg(" %14s | %6d \n", wakeup_src_name[index], g_pm_metrics->wakeup_src_counts[index]);
+		wakeups += g_pm_metrics->wakeup_src_counts[index];
 	}
 	pmdbg("\n");
 	pmdbg("\n");
+	pmdbg("      WAKEUPS       | COUNTS | PER SECOND \n");
+	pmdbg("--------------------|--------|------------\n");
+	pmdbg(" %18s | %6u | %10.2f \n", "BOARD SLEEP [5]", wakeups, seconds > 0 ? wakeups / seconds : 0.0);
+	pmdbg(" %18s | %6u | %10.2f \n", "TIMER EVENTS [6]", g_pm_metrics->wdog_stats.wakeups, seconds > 0 ? g_pm_metrics->wdog_stats.wakeups / seconds : 0.0);
+	pmdbg(" %18s | %6u | %10.2f \n", "TIMERS EXPIRED", g_pm_metrics->wdog_stats.expired, seconds > 0 ? g_pm_metrics->wdog_stats.expired / seconds : 0.0);
+	pmdbg(" %18s | %6u | %10.2f \n", "TIMERS COALESCED", g_pm_metrics->wdog_stats.coalesced, seconds > 0 ? g_pm_metrics->wdog_stats.coalesced / seconds : 0.0);
+	pmdbg("\n");
+	pmdbg("*[5] = times the board woke up from sleep, from any wakeup source.\n");
+	pmdbg("*[6] = timer interrupts that expired at least one timer.\n");
+	pmdbg("\n");
+	pmdbg("\n");
 	pmdbg(" BOARD STATE | PM STATE |          TIME          \n");
 	pmdbg("-------------|----------|------------------------\n");
 	for (pm_state = PM_NORMAL; pm_state < PM_SLEEP; pm_state++) {
@@ -256,6 +272,7 @@ void pm_metrics_update_wakehandler(clock_t missing_tick, pm_wakeup_reason_code_t
 int pm_metrics(int milliseconds)
 {
 	clock_t start_time, end_time;
+	struct wdog_stats_s wdog_stats;
 	irqstate_t flags;
 	int index;
 	int n_domains;
@@ -290,6 +307,7 @@ int pm_metrics(int milliseconds)
 	flags = enter_critical_section();
 	start_time = clock_systimer();
 	g_pm_metrics->state_metrics.stime = start_time;
+	wd_getstats(&g_pm_metrics->wdog_stats);
 	for (index = 0; (index < CONFIG_PM_NDOMAINS) && pm_domain_map[index]; index++) {
 		pm_metrics_update_domain(index);
 		g_pm_metrics->domain_metrics.stime[index] = start_time;
@@ -316,6 +334,10 @@ int pm_metrics(int milliseconds)
 	flags = enter_critical_section();
 	g_pm_metrics_running = false;
 	end_time = clock_systimer();
+	wd_getstats(&wdog_stats);
+	g_pm_metrics->wdog_stats.wakeups = wdog_stats.wakeups - g_pm_metrics->wdog_stats.wakeups;
+	g_pm_metrics->wdog_stats.expired = wdog_stats.expired - g_pm_metrics->wdog_stats.expired;
+	g_pm_metrics->wdog_stats.coalesced = wdog_stats.coalesced - g_pm_metrics->wdog_stats.coalesced;
 	for (index = 0; (index < CONFIG_PM_NDOMAINS) && pm_domain_map[index]; index++) {
 		if (g_pmglobals.suspend_count[index]) {
 			g_pm_metrics->domain_metrics.suspend_ticks[index] += end_time - g_pm_metrics->domain_metrics.stime[index];
@@ -205,10 +205,20 @@ SYSCALL_LOOKUP(aio_read,                1, SYS_aio_read)
 SYSCALL_LOOKUP(aio_write,               1, SYS_aio_write)
 SYSCALL_LOOKUP(aio_fsync,               2, SYS_aio_fsync)
 SYSCALL_LOOKUP(aio_cancel,              2, SYS_aio_cancel)
+#    ifdef CONFIG_FS_AIO_RING
+SYSCALL_LOOKUP(aio_ring_submit,         1, STUB_aio_ring_submit)
+SYSCALL_LOOKUP(aio_ring_wait,           3, STUB_aio_ring_wait)
+#    endif
 #  endif
 #  ifndef CONFIG_DISABLE_POLL
 SYSCALL_LOOKUP(poll,                    3, STUB_poll)
 SYSCALL_LOOKUP(select,                  5, STUB_select)
+#    ifdef CONFIG_FS_EPOLL
+SYSCALL_LOOKUP(epoll_create,            1, STUB_epoll_create)
+SYSCALL_LOOKUP(epoll_create1,           1, STUB_epoll_create1)
+SYSCALL_LOOKUP(epoll_ctl,               4, STUB_epoll_ctl)
+SYSCALL_LOOKUP(epoll_wait,              4, STUB_epoll_wait)
+#    endif
 #  endif
 #endif
 
@@ -241,6 +251,14 @@ SYSCALL_LOOKUP(rewinddir,               1, STUB_rewinddir)
 SYSCALL_LOOKUP(seekdir,                 2, STUB_seekdir)
 SYSCALL_LOOKUP(stat,                    2, STUB_stat)
 SYSCALL_LOOKUP(statfs,                  2, STUB_statfs)
+#if defined(CONFIG_FS_SPLICE)
+SYSCALL_LOOKUP(splice,                  6, STUB_splice)
+SYSCALL_LOOKUP(tee,                     4, STUB_tee)
+#endif
+#if defined(CONFIG_FS_VECTORED_IO)
+SYSCALL_LOOKUP(readv,                   3, STUB_readv)
+SYSCALL_LOOKUP(writev,                  3, STUB_writev)
+#endif
 
 #  if CONFIG_NFILE_STREAMS > 0
 SYSCALL_LOOKUP(fs_fdopen,               3, STUB_fs_fdopen)
@@ -318,6 +336,12 @@ SYSCALL_LOOKUP(mq_setattr,              3, STUB_mq_setattr)
 SYSCALL_LOOKUP(mq_timedreceive,         5, STUB_mq_timedreceive)
 SYSCALL_LOOKUP(mq_timedsend,            5, STUB_mq_timedsend)
 SYSCALL_LOOKUP(mq_unlink,               1, STUB_mq_unlink)
+#  ifdef CONFIG_MQ_ZEROCOPY
+SYSCALL_LOOKUP(mq_buf_alloc,            1, STUB_mq_buf_alloc)
+SYSCALL_LOOKUP(mq_buf_free,             1, STUB_mq_buf_free)
+SYSCALL_LOOKUP(mq_receive_buf,          3, STUB_mq_receive_buf)
+SYSCALL_LOOKUP(mq_send_buf,             4, STUB_mq_send_buf)
+#  endif
 #endif
 
 /* The following are defined only if environment variables are supported */
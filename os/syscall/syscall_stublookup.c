@@ -202,11 +202,20 @@ uintptr_t STUB_poll(int nbr, uintptr_t parm1, uintptr_t parm2,
 					uintptr_t parm3);
 uintptr_t STUB_select(int nbr, uintptr_t parm1, uintptr_t parm2,
 					  uintptr_t parm3, uintptr_t parm4, uintptr_t parm5);
+uintptr_t STUB_epoll_create(int nbr, uintptr_t parm1);
+uintptr_t STUB_epoll_create1(int nbr, uintptr_t parm1);
+uintptr_t STUB_epoll_ctl(int nbr, uintptr_t parm1, uintptr_t parm2,
+						 uintptr_t parm3, uintptr_t parm4);
+uintptr_t STUB_epoll_wait(int nbr, uintptr_t parm1, uintptr_t parm2,
+						  uintptr_t parm3, uintptr_t parm4);
 
 uintptr_t STUB_aio_read(int nbr, uintptr_t parm1);
 uintptr_t STUB_aio_write(int nbr, uintptr_t parm1);
 uintptr_t STUB_aio_fsync(int nbr, uintptr_t parm1, uintptr_t parm2);
 uintptr_t STUB_aio_cancel(int nbr, uintptr_t parm1, uintptr_t parm2);
+uintptr_t STUB_aio_ring_submit(int nbr, uintptr_t parm1);
+uintptr_t STUB_aio_ring_wait(int nbr, uintptr_t parm1, uintptr_t parm2,
+							 uintptr_t parm3);
 
 /* Board support */
 
@@ -238,6 +247,15 @@ uintptr_t STUB_rewinddir(int nbr, uintptr_t parm1);
 uintptr_t STUB_seekdir(int nbr, uintptr_t parm1, uintptr_t parm2);
 uintptr_t STUB_stat(int nbr, uintptr_t parm1, uintptr_t parm2);
 uintptr_t STUB_statfs(int nbr, uintptr_t parm1, uintptr_t parm2);
+uintptr_t STUB_splice(int nbr, uintptr_t parm1, uintptr_t parm2,
+					  uintptr_t parm3, uintptr_t parm4, uintptr_t parm5,
+					  uintptr_t parm6);
+uintptr_t STUB_tee(int nbr, uintptr_t parm1, uintptr_t parm2,
+				   uintptr_t parm3, uintptr_t parm4);
+uintptr_t STUB_readv(int nbr, uintptr_t parm1, uintptr_t parm2,
+					 uintptr_t parm3);
+uintptr_t STUB_writev(int nbr, uintptr_t parm1, uintptr_t parm2,
+					  uintptr_t parm3);
 
 uintptr_t STUB_fs_fdopen(int nbr, uintptr_t parm1, uintptr_t parm2,
 						 uintptr_t parm3);
@@ -326,6 +344,12 @@ uintptr_t STUB_mq_timedreceive(int nbr, uintptr_t parm1, uintptr_t parm2,
 uintptr_t STUB_mq_timedsend(int nbr, uintptr_t parm1, uintptr_t parm2,
 							uintptr_t parm3, uintptr_t parm4, uintptr_t parm5);
 uintptr_t STUB_mq_unlink(int nbr, uintptr_t parm1);
+uintptr_t STUB_mq_buf_alloc(int nbr, uintptr_t parm1);
+uintptr_t STUB_mq_buf_free(int nbr, uintptr_t parm1);
+uintptr_t STUB_mq_receive_buf(int nbr, uintptr_t parm1, uintptr_t parm2,
+							  uintptr_t parm3);
+uintptr_t STUB_mq_send_buf(int nbr, uintptr_t parm1, uintptr_t parm2,
+						   uintptr_t parm3, uintptr_t parm4);
 
 /* The following are defined only if environment variables are supported */
 
@@ -122,8 +122,12 @@ int work_cancel(int qid, FAR struct work_s *work)
 #ifdef CONFIG_SCHED_LPWORK
 		if (qid == LPWORK) {
 			/* Cancel low priority work */
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+			return lpwork_cancel(work);
+#else
 			struct lp_wqueue_s *lwq = get_lpwork();
 			return work_qcancel((FAR struct wqueue_s *)lwq, work);
+#endif
 		} else
 #endif
 		{
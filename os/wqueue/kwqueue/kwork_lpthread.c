@@ -153,7 +153,11 @@ static int work_lpthread(int argc, char *argv[])
 			 * to wait indefinitely until a signal is received.
 			 */
 
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+			lpwork_process(lwq, wndx);
+#else
 			work_process((FAR struct wqueue_s *)lwq, wndx);
+#endif
 		} else
 #endif
 		{
@@ -174,7 +178,11 @@ static int work_lpthread(int argc, char *argv[])
 			 * period provided by g_lpwork.delay expires.
 			 */
 
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+			lpwork_process(lwq, 0);
+#else
 			work_process((FAR struct wqueue_s *)lwq, 0);
+#endif
 		}
 	}
 
@@ -213,9 +221,12 @@ int work_lpstart(void)
 	/* Initialize work queue data structures */
 
 	struct lp_wqueue_s *lwq = get_lpwork();
-	memset(lwq, 0, sizeof(struct wqueue_s));
+	memset(lwq, 0, sizeof(struct lp_wqueue_s));
 
 	dq_init(&lwq->q);
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+	lpwork_initialize(lwq);
+#endif
 
 	/* Don't permit any of the threads to run until we have fully initialized
 	 * g_lpwork.
@@ -242,6 +253,14 @@ int work_lpstart(void)
 
 		lwq->worker[wndx].pid = (pid_t)pid;
 		lwq->worker[wndx].busy = true;
+
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+		/* Each worker serves the deque of its own CPU first */
+
+		if (lpwork_setaffinity(wndx) < 0) {
+			sdbg("sched_setaffinity %d failed: %d\n", wndx, errno);
+		}
+#endif
 	}
 
 	sched_unlock();
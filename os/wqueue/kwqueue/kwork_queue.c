@@ -123,7 +123,7 @@
 
 int work_queue(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay)
 {
-#if defined(CONFIG_SCHED_HPWORK) || defined(CONFIG_SCHED_LPWORK)
+#if defined(CONFIG_SCHED_HPWORK) || (defined(CONFIG_SCHED_LPWORK) && !defined(CONFIG_SCHED_LPWORK_STEALING))
 	int result;
 #endif
 #ifdef CONFIG_SCHED_HPWORK
@@ -140,6 +140,11 @@ int work_queue(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg,
 #endif
 #ifdef CONFIG_SCHED_LPWORK
 		if (qid == LPWORK) {
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+			/* Queue low priority work on the deque of this CPU */
+
+			return lpwork_queue(work, worker, arg, delay, WORK_CPU_ANY);
+#else
 			/* Cancel low priority work */
 
 			struct lp_wqueue_s *lwq = get_lpwork();
@@ -148,9 +153,39 @@ int work_queue(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg,
 				return result;
 			}
 			return work_signal(LPWORK);
+#endif
 		} else
 #endif
 		{
 			return -EINVAL;
 		}
 }
+
+/****************************************************************************
+ * Name: work_queue_cpu
+ *
+ * Description:
+ *   Queue kernel-mode work like work_queue(), preferably to be performed on
+ *   'cpu'.  Only the low priority work queue with
+ *   CONFIG_SCHED_LPWORK_STEALING has per-CPU workers, the hint is ignored
+ *   otherwise.
+ *
+ * Input parameters:
+ *   qid, work, worker, arg, delay - As for work_queue()
+ *   cpu    - The preferred CPU, or WORK_CPU_ANY
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+int work_queue_cpu(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay, int cpu)
+{
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+	if (qid == LPWORK) {
+		return lpwork_queue(work, worker, arg, delay, cpu);
+	}
+#endif
+
+	return work_queue(qid, work, worker, arg, delay);
+}
@@ -0,0 +1,101 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <string.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/wqueue.h>
+
+#include "wqueue.h"
+
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: work_getstats
+ *
+ * Description:
+ *   Get the statistics of a kernel work queue.  For the low priority queue
+ *   with CONFIG_SCHED_LPWORK_STEALING, 'cpu' selects the deque of a CPU and
+ *   WORK_CPU_ANY the shared list of delayed work.
+ *
+ ****************************************************************************/
+
+int work_getstats(int qid, int cpu, FAR struct work_stats_s *stats)
+{
+	FAR struct work_stats_s *src = NULL;
+	irqstate_t flags;
+
+	DEBUGASSERT(stats != NULL);
+
+#ifdef CONFIG_SCHED_HPWORK
+	if (qid == HPWORK) {
+		src = &get_hpwork()->stats;
+	}
+#endif
+#ifdef CONFIG_SCHED_LPWORK
+	if (qid == LPWORK) {
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+		FAR struct lp_cpuqueue_s *cq;
+
+		if (cpu >= CONFIG_SMP_NCPUS) {
+			return -EINVAL;
+		}
+
+		if (cpu >= 0) {
+			/* The deques are updated under their own lock */
+
+			cq = &get_lpwork()->cpu[cpu];
+			flags = spin_lock_irqsave(&cq->lock);
+			memcpy(stats, &cq->stats, sizeof(struct work_stats_s));
+			spin_unlock_irqrestore(&cq->lock, flags);
+			return OK;
+		}
+
+		src = &get_lpwork()->stats;
+#else
+		src = &get_lpwork()->stats;
+#endif
+	}
+#endif
+
+	if (src == NULL) {
+		return -EINVAL;
+	}
+
+	/* The queues are updated within the critical section */
+
+	flags = enter_critical_section();
+	memcpy(stats, src, sizeof(struct work_stats_s));
+	leave_critical_section(flags);
+
+	return OK;
+}
+
+#endif							/* CONFIG_SCHED_WORKQUEUE_STATS */
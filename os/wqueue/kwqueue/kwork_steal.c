@@ -0,0 +1,526 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <tinyara/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <sched.h>
+#include <signal.h>
+#include <queue.h>
+#include <assert.h>
+#include <errno.h>
+
+#include <tinyara/arch.h>
+#include <tinyara/clock.h>
+#include <tinyara/spinlock.h>
+#include <tinyara/wqueue.h>
+
+#include "wqueue.h"
+
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+/* Worker threads are spread over the CPUs in turn */
+
+#define LPWORK_CPU(wndx) ((wndx) % CONFIG_SMP_NCPUS)
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lpwork_signal
+ *
+ * Description:
+ *   Wake up a worker for work that became ready in the deque of 'cpu'.  An
+ *   idle worker of that CPU is preferred, then an idle worker of any CPU,
+ *   which will steal the work.  If all workers are busy, the signal stays
+ *   pending on a worker of 'cpu' until it looks for more work.
+ *
+ ****************************************************************************/
+
+static int lpwork_signal(FAR struct lp_wqueue_s *lwq, int cpu)
+{
+	int wndx = -1;
+	int i;
+
+	for (i = 0; i < CONFIG_SCHED_LPNTHREADS; i++) {
+		if (!lwq->worker[i].busy) {
+			if (LPWORK_CPU(i) == cpu) {
+				wndx = i;
+				break;
+			}
+
+			if (wndx < 0) {
+				wndx = i;
+			}
+		}
+	}
+
+	if (wndx < 0) {
+		wndx = cpu < CONFIG_SCHED_LPNTHREADS ? cpu : 0;
+	}
+
+	return work_qsignal(lwq->worker[wndx].pid);
+}
+
+/****************************************************************************
+ * Name: lpwork_ready
+ *
+ * Description:
+ *   Add ready work to the tail of the deque of work->cpu.  Interrupts must
+ *   be disabled.
+ *
+ ****************************************************************************/
+
+static void lpwork_ready(FAR struct lp_wqueue_s *lwq, FAR struct work_s *work)
+{
+	FAR struct lp_cpuqueue_s *cq = &lwq->cpu[work->cpu];
+
+	spin_lock(&cq->lock);
+	dq_addlast((FAR dq_entry_t *)work, &cq->q);
+	work_stats_queued(&cq->stats);
+	spin_unlock(&cq->lock);
+}
+
+/****************************************************************************
+ * Name: lpwork_find
+ *
+ * Description:
+ *   Return true if 'work' is in the list 'q'.  The caller holds whatever
+ *   protects the list.
+ *
+ ****************************************************************************/
+
+static bool lpwork_find(FAR struct dq_queue_s *q, FAR struct work_s *work)
+{
+	FAR dq_entry_t *entry;
+
+	for (entry = dq_peek(q); entry != NULL; entry = dq_next(entry)) {
+		if (entry == (FAR dq_entry_t *)work) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/****************************************************************************
+ * Name: lpwork_pending
+ *
+ * Description:
+ *   Return true if 'work' is in the shared list of delayed work or in the
+ *   deque of work->cpu.  Work with a NULL worker is never queued, so the
+ *   lists are only searched when the worker is set; nothing else in the
+ *   work structure is trusted until the work is found.  Interrupts must be
+ *   disabled.
+ *
+ ****************************************************************************/
+
+static bool lpwork_pending(FAR struct lp_wqueue_s *lwq, FAR struct work_s *work)
+{
+	FAR struct lp_cpuqueue_s *cq;
+	bool found = false;
+	int cpu;
+
+	if (work->worker == NULL) {
+		return false;
+	}
+
+	if (lpwork_find(&lwq->q, work)) {
+		return true;
+	}
+
+	cpu = work->cpu;
+	if (cpu >= 0 && cpu < CONFIG_SMP_NCPUS) {
+		cq = &lwq->cpu[cpu];
+		spin_lock(&cq->lock);
+		found = lpwork_find(&cq->q, work);
+		spin_unlock(&cq->lock);
+	}
+
+	return found;
+}
+
+/****************************************************************************
+ * Name: lpwork_promote
+ *
+ * Description:
+ *   Move the delayed work whose time has come to the deques of their CPUs.
+ *
+ * Returned Value:
+ *   The ticks until the next delayed work is due, zero if there is none.
+ *   'cpus' receives the set of other CPUs that were given work.
+ *
+ ****************************************************************************/
+
+static clock_t lpwork_promote(FAR struct lp_wqueue_s *lwq, int mycpu, FAR cpu_set_t *cpus)
+{
+	FAR struct work_s *work;
+	irqstate_t flags;
+	clock_t elapsed;
+	clock_t ctick;
+	clock_t next = 0;
+
+	CPU_ZERO(cpus);
+
+	/* The delayed list is sorted by due time and shared with work_qqueue() */
+
+	flags = enter_critical_section();
+	ctick = clock();
+
+	while ((work = (FAR struct work_s *)dq_peek(&lwq->q)) != NULL) {
+		elapsed = ctick - work->qtime;
+		if (elapsed < work->delay) {
+			next = work->delay - elapsed;
+			break;
+		}
+
+		dq_rem((FAR dq_entry_t *)work, &lwq->q);
+		work_stats_removed(&lwq->stats);
+
+		if (work->worker == NULL) {
+			continue;
+		}
+
+		lpwork_ready(lwq, work);
+		if (work->cpu != mycpu) {
+			CPU_SET(work->cpu, cpus);
+		}
+	}
+
+	leave_critical_section(flags);
+	return next;
+}
+
+/****************************************************************************
+ * Name: lpwork_take
+ *
+ * Description:
+ *   Take the next work for a worker of 'mycpu': the oldest work of its own
+ *   deque or else the newest work of the deque of another CPU.  Taking from
+ *   opposite ends keeps the owner and the thief apart on a long deque.
+ *
+ * Returned Value:
+ *   True if work was taken, its callback and argument are returned in
+ *   'worker' and 'arg'.
+ *
+ ****************************************************************************/
+
+static bool lpwork_take(FAR struct lp_wqueue_s *lwq, int mycpu, FAR worker_t *worker, FAR void **arg)
+{
+	FAR struct lp_cpuqueue_s *cq;
+	FAR struct work_s *work;
+	irqstate_t flags;
+	int cpu;
+	int i;
+
+	for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
+		cpu = (mycpu + i) % CONFIG_SMP_NCPUS;
+		cq = &lwq->cpu[cpu];
+
+		/* Look before taking the lock, most deques are empty most of the time */
+
+		if (dq_peek(&cq->q) == NULL) {
+			continue;
+		}
+
+		flags = spin_lock_irqsave(&cq->lock);
+		if (i == 0) {
+			work = (FAR struct work_s *)dq_remfirst(&cq->q);
+		} else {
+			work = (FAR struct work_s *)dq_remlast(&cq->q);
+		}
+
+		if (work != NULL) {
+			work_stats_executed(&cq->stats, clock() - work->qtime - work->delay);
+#ifdef WORK_STATS
+			if (i != 0) {
+				cq->stats.stolen++;
+			}
+#endif
+
+			/* Extract the work description before the work may be re-used */
+
+			*worker = work->worker;
+			*arg = work->arg;
+			work->worker = NULL;
+		}
+
+		spin_unlock_irqrestore(&cq->lock, flags);
+
+		if (work != NULL) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: lpwork_initialize
+ *
+ * Description:
+ *   Initialize the deques of the CPUs.
+ *
+ ****************************************************************************/
+
+void lpwork_initialize(FAR struct lp_wqueue_s *lwq)
+{
+	int cpu;
+
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		spin_initialize(&lwq->cpu[cpu].lock, SP_UNLOCKED);
+		dq_init(&lwq->cpu[cpu].q);
+	}
+}
+
+/****************************************************************************
+ * Name: lpwork_setaffinity
+ *
+ * Description:
+ *   Pin a worker thread to its CPU.  The worker still runs the work of
+ *   other CPUs when it has none of its own.
+ *
+ ****************************************************************************/
+
+int lpwork_setaffinity(int wndx)
+{
+	cpu_set_t cpuset;
+
+	CPU_ZERO(&cpuset);
+	CPU_SET(LPWORK_CPU(wndx), &cpuset);
+
+	return sched_setaffinity(get_lpwork()->worker[wndx].pid, sizeof(cpu_set_t), &cpuset);
+}
+
+/****************************************************************************
+ * Name: lpwork_queue
+ *
+ * Description:
+ *   Queue work on the low priority work queue.  Work without delay goes
+ *   straight to the deque of 'cpu', taking only the lock of that deque.
+ *   Delayed work waits in the shared list of the queue until a worker moves
+ *   it to the deque of 'cpu' when it is due.  Work whose worker is still set
+ *   is looked up in the lists within the critical section before it is
+ *   queued, the work structure may come from uninitialized memory.
+ *
+ * Input parameters:
+ *   work, worker, arg, delay - As for work_queue()
+ *   cpu    - The preferred CPU, the CPU of the caller if WORK_CPU_ANY
+ *
+ * Returned Value:
+ *   Zero on success, a negated errno on failure
+ *
+ ****************************************************************************/
+
+int lpwork_queue(FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay, int cpu)
+{
+	FAR struct lp_wqueue_s *lwq = get_lpwork();
+	FAR struct lp_cpuqueue_s *cq;
+	irqstate_t flags;
+	int ret = OK;
+
+	DEBUGASSERT(work != NULL);
+
+	if (cpu < 0 || cpu >= CONFIG_SMP_NCPUS) {
+		cpu = sched_getcpu();
+	}
+
+	if (delay > 0 || work->worker != NULL) {
+		flags = enter_critical_section();
+		if (lpwork_pending(lwq, work)) {
+			ret = -EALREADY;
+		} else if (delay > 0) {
+			work->cpu = cpu;
+			ret = work_qqueue((FAR struct wqueue_s *)lwq, work, worker, arg, delay);
+		} else {
+			work->worker = worker;
+			work->arg = arg;
+			work->delay = 0;
+			work->qtime = clock();
+			work->cpu = cpu;
+			lpwork_ready(lwq, work);
+		}
+
+		leave_critical_section(flags);
+	} else {
+		cq = &lwq->cpu[cpu];
+		flags = spin_lock_irqsave(&cq->lock);
+		work->worker = worker;
+		work->arg = arg;
+		work->delay = 0;
+		work->qtime = clock();
+		work->cpu = cpu;
+		dq_addlast((FAR dq_entry_t *)work, &cq->q);
+		work_stats_queued(&cq->stats);
+		spin_unlock_irqrestore(&cq->lock, flags);
+	}
+
+	if (ret != OK) {
+		return ret;
+	}
+
+	return lpwork_signal(lwq, cpu);
+}
+
+/****************************************************************************
+ * Name: lpwork_cancel
+ *
+ * Description:
+ *   Cancel work queued with lpwork_queue().
+ *
+ * Returned Value:
+ *   Zero (OK) on success, -ENOENT if the work is not queued.
+ *
+ ****************************************************************************/
+
+int lpwork_cancel(FAR struct work_s *work)
+{
+	FAR struct lp_wqueue_s *lwq = get_lpwork();
+	FAR struct lp_cpuqueue_s *cq;
+	irqstate_t flags;
+	int ret = -ENOENT;
+	int cpu;
+
+	DEBUGASSERT(work != NULL);
+
+	/* Delayed work only leaves the shared list within the critical section,
+	 * ready work leaves its deque under the lock of the deque only.  Work is
+	 * only ever queued with its worker set.
+	 */
+
+	flags = enter_critical_section();
+
+	if (work->worker != NULL && lpwork_find(&lwq->q, work)) {
+		dq_rem((FAR dq_entry_t *)work, &lwq->q);
+		work_stats_removed(&lwq->stats);
+		work->worker = NULL;
+		ret = OK;
+	}
+
+	while (ret != OK && work->worker != NULL) {
+		/* The work may be taken and queued again on another CPU meanwhile */
+
+		cpu = work->cpu;
+		if (cpu < 0 || cpu >= CONFIG_SMP_NCPUS) {
+			break;
+		}
+
+		cq = &lwq->cpu[cpu];
+		spin_lock(&cq->lock);
+		if (lpwork_find(&cq->q, work)) {
+			dq_rem((FAR dq_entry_t *)work, &cq->q);
+			work_stats_removed(&cq->stats);
+			work->worker = NULL;
+			ret = OK;
+		} else if (work->cpu == cpu) {
+			/* Not queued, or being queued on another CPU right now */
+
+			spin_unlock(&cq->lock);
+			break;
+		}
+
+		spin_unlock(&cq->lock);
+	}
+
+	leave_critical_section(flags);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: lpwork_process
+ *
+ * Description:
+ *   The loop body of a low priority worker thread.  Runs one work item of
+ *   its own CPU or stolen from another CPU, or waits until there is some.
+ *
+ * Input parameters:
+ *   lwq  - The low priority work queue
+ *   wndx - The index of the worker thread
+ *
+ ****************************************************************************/
+
+void lpwork_process(FAR struct lp_wqueue_s *lwq, int wndx)
+{
+	int mycpu = LPWORK_CPU(wndx);
+	cpu_set_t cpus;
+	worker_t worker;
+	FAR void *arg;
+	irqstate_t flags;
+	sigset_t set;
+	clock_t next;
+	int cpu;
+	int i;
+
+	next = lpwork_promote(lwq, mycpu, &cpus);
+	for (cpu = 0; cpu < CONFIG_SMP_NCPUS; cpu++) {
+		if (CPU_ISSET(cpu, &cpus)) {
+			lpwork_signal(lwq, cpu);
+		}
+	}
+
+	if (lpwork_take(lwq, mycpu, &worker, &arg)) {
+		worker(arg);
+		return;
+	}
+
+	/* Nothing to do.  Check again within the critical section, work that
+	 * is queued after this leaves SIGWORK pending and sigwaitinfo() returns
+	 * at once.
+	 */
+
+	flags = enter_critical_section();
+
+	for (i = 0; i < CONFIG_SMP_NCPUS; i++) {
+		if (dq_peek(&lwq->cpu[i].q) != NULL) {
+			break;
+		}
+	}
+
+	if (i == CONFIG_SMP_NCPUS) {
+		lwq->worker[wndx].busy = false;
+		if (next > 0) {
+			usleep(next * USEC_PER_TICK);
+		} else {
+			sigemptyset(&set);
+			sigaddset(&set, SIGWORK);
+			DEBUGVERIFY(sigwaitinfo(&set, NULL));
+		}
+
+		lwq->worker[wndx].busy = true;
+	}
+
+	leave_critical_section(flags);
+}
+
+#endif							/* CONFIG_SCHED_LPWORK_STEALING */
@@ -135,3 +135,17 @@ int work_queue(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg,
 		return -EINVAL;
 	}
 }
+
+/****************************************************************************
+ * Name: work_queue_cpu
+ *
+ * Description:
+ *   Queue user-mode work like work_queue().  The user mode work queue has a
+ *   single worker thread, so the CPU hint is ignored.
+ *
+ ****************************************************************************/
+
+int work_queue_cpu(int qid, FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay, int cpu)
+{
+	return work_queue(qid, work, worker, arg, delay);
+}
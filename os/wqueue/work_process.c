@@ -185,6 +185,7 @@ void work_process(FAR struct wqueue_s *wqueue, int wndx)
 				/* Mark the work as no longer being queued */
 
 				work->worker = NULL;
+				work_stats_executed(&wqueue->stats, elapsed - work->delay);
 
 				/* Do the work.  Re-enable interrupts while the work is being
 				 * performed... we don't have any idea how long this will take!
@@ -218,6 +219,7 @@ void work_process(FAR struct wqueue_s *wqueue, int wndx)
 				 * interrupts still disabled.
 				 */
 
+				work_stats_removed(&wqueue->stats);
 				work = (FAR struct work_s *)work->dq.flink;
 			}
 		} else {				/* elapsed < work->delay */
@@ -165,6 +165,9 @@ int work_qqueue(FAR struct wqueue_s *wqueue, FAR struct work_s *work, worker_t w
 	} else {
 		dq_addlast((FAR dq_entry_t *)work, &wqueue->q);
 	}
+
+	work_stats_queued(&wqueue->stats);
+
 #if defined(CONFIG_SCHED_USRWORK) && !defined(__KERNEL__)
 	work_unlock();
 #else
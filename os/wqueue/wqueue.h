@@ -65,6 +65,9 @@
 #include <semaphore.h>
 
 #include <tinyara/wqueue.h>
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+#include <tinyara/spinlock.h>
+#endif
 
 #ifdef CONFIG_SCHED_WORKQUEUE
 
@@ -72,6 +75,45 @@
  * Public Type Definitions
  ****************************************************************************/
 
+/* Statistics are only kept for the kernel work queues */
+
+#if defined(CONFIG_SCHED_WORKQUEUE_STATS) && (defined(CONFIG_BUILD_FLAT) || defined(__KERNEL__))
+#define WORK_STATS 1
+#endif
+
+/* Update the statistics of a queue, with the queue locked */
+
+#ifdef WORK_STATS
+#define work_stats_queued(s) \
+	do { \
+		(s)->queued++; \
+		if (++(s)->depth > (s)->maxdepth) { \
+			(s)->maxdepth = (s)->depth; \
+		} \
+	} while (0)
+
+#define work_stats_removed(s) \
+	do { \
+		if ((s)->depth > 0) { \
+			(s)->depth--; \
+		} \
+	} while (0)
+
+#define work_stats_executed(s, late) \
+	do { \
+		work_stats_removed(s); \
+		(s)->executed++; \
+		(s)->latency += (late); \
+		if ((late) > (s)->maxlatency) { \
+			(s)->maxlatency = (late); \
+		} \
+	} while (0)
+#else
+#define work_stats_queued(s)
+#define work_stats_removed(s)
+#define work_stats_executed(s, late)
+#endif
+
 /* This represents one worker */
 
 struct worker_s {
@@ -83,6 +125,9 @@ struct worker_s {
 
 struct wqueue_s {
 	struct dq_queue_s q;		/* The queue of pending work */
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+	struct work_stats_s stats;	/* Latency and occupancy statistics */
+#endif
 	struct worker_s worker[1];	/* Describes a worker thread */
 };
 
@@ -93,6 +138,9 @@ struct wqueue_s {
 #ifdef CONFIG_SCHED_HPWORK
 struct hp_wqueue_s {
 	struct dq_queue_s q;		/* The queue of pending work */
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+	struct work_stats_s stats;	/* Latency and occupancy statistics */
+#endif
 	struct worker_s worker[1];	/* Describes the single high priority worker */
 };
 #endif
@@ -102,11 +150,32 @@ struct hp_wqueue_s {
  */
 
 #ifdef CONFIG_SCHED_LPWORK
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+/* The deque of ready work of one CPU.  Its workers take work from the
+ * head, workers of other CPUs steal from the tail.
+ */
+
+struct lp_cpuqueue_s {
+	spinlock_t lock;			/* Protects q and stats */
+	struct dq_queue_s q;		/* Work ready to run */
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+	struct work_stats_s stats;	/* Latency and occupancy statistics */
+#endif
+};
+#endif
+
 struct lp_wqueue_s {
-	struct dq_queue_s q;		/* The queue of pending work */
+	struct dq_queue_s q;		/* The queue of pending work (delayed work when stealing) */
+#ifdef CONFIG_SCHED_WORKQUEUE_STATS
+	struct work_stats_s stats;	/* Latency and occupancy statistics */
+#endif
 
 	/* Describes each thread in the low priority queue's thread pool */
 	struct worker_s worker[CONFIG_SCHED_LPNTHREADS];
+
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+	struct lp_cpuqueue_s cpu[CONFIG_SMP_NCPUS];
+#endif
 };
 #endif
 
@@ -265,5 +334,25 @@ void work_process(FAR struct wqueue_s *wqueue, int wdx);
 
 int work_qsignal(pid_t pid);
 
+/****************************************************************************
+ * Name: lpwork_initialize, lpwork_setaffinity, lpwork_queue, lpwork_cancel
+ *       and lpwork_process
+ *
+ * Description:
+ *   The low priority work queue with a deque of ready work per CPU.  Each
+ *   worker thread is pinned to a CPU and serves the deque of that CPU
+ *   first, then steals from the deques of the other CPUs.  Delayed work
+ *   waits in the shared list of the queue until it is due.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SCHED_LPWORK_STEALING
+void lpwork_initialize(FAR struct lp_wqueue_s *lwq);
+int lpwork_setaffinity(int wndx);
+int lpwork_queue(FAR struct work_s *work, worker_t worker, FAR void *arg, clock_t delay, int cpu);
+int lpwork_cancel(FAR struct work_s *work);
+void lpwork_process(FAR struct lp_wqueue_s *lwq, int wndx);
+#endif
+
 #endif							/* CONFIG_SCHED_WORKQUEUE */
 #endif							/* __OS_WQUEUE_WQUEUE_H */
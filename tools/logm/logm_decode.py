@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+###########################################################################
+#
+# Copyright 2026 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+# File : logm_decode.py
+# Description: Turn the raw binary records of logm back into text, taking
+#              the format strings from the TinyAra ELF.
+
+import argparse
+import re
+import struct
+import sys
+
+LOGM_MAGIC = b'LOGM'
+LOGM_HEADER = struct.Struct('<HBBIII')
+LOGM_TRUNCATED = 0x01
+
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+# Same conversion grammar as logm_nextconv() in os/logm/logm_binary.c
+CONV = re.compile(r'%%|%([-+ #0]*)(\*|\d*)(?:\.(\*|\d*))?((?:hh|h|ll|l|j|z|t|q|L)*)(.?)', re.S)
+
+
+class Elf32(object):
+    """Reads the strings of the allocated sections of an ELF32 file"""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1:
+            raise ValueError('%s is not an ELF32 file' % path)
+        endian = '<' if self.data[5] == 1 else '>'
+        shoff, = struct.unpack_from(endian + 'I', self.data, 0x20)
+        shentsize, shnum = struct.unpack_from(endian + 'HH', self.data, 0x2e)
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(endian + 'IIIIII', self.data, shoff + i * shentsize)
+            if flags & SHF_ALLOC and sh_type != SHT_NOBITS and size > 0:
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr):
+        for base, offset, size in self.sections:
+            if base <= addr < base + size:
+                start = offset + addr - base
+                end = self.data.find(b'\0', start, offset + size)
+                return self.data[start:end if end >= 0 else offset + size].decode('utf-8', 'replace')
+        return None
+
+
+class Record(object):
+    def __init__(self, header, data):
+        self.len, self.priority, self.flags, self.ticks, self.fmt, self.seq = header
+        self.data = data
+        self.pos = 0
+
+    def word(self):
+        if self.pos + 4 > len(self.data):
+            raise IndexError
+        value, = struct.unpack_from('<I', self.data, self.pos)
+        self.pos += 4
+        return value
+
+    def dword(self, fmt):
+        if self.pos + 8 > len(self.data):
+            raise IndexError
+        value, = struct.unpack_from('<' + fmt, self.data, self.pos)
+        self.pos += 8
+        return value
+
+    def string(self):
+        length = self.word()
+        text = self.data[self.pos:self.pos + length]
+        self.pos += (length + 4) // 4 * 4
+        if self.pos > len(self.data):
+            raise IndexError
+        return text.decode('utf-8', 'replace')
+
+
+def signed(value):
+    return value - (1 << 32) if value & 0x80000000 else value
+
+
+def format_record(fmt, rec):
+    out = []
+    last = 0
+    for m in CONV.finditer(fmt):
+        out.append(fmt[last:m.start()])
+        last = m.end()
+        if m.group(0) == '%%':
+            out.append('%')
+            continue
+        flags, width, prec, length, conv = m.groups()
+        try:
+            if width == '*':
+                width = str(signed(rec.word()))
+            if prec == '*':
+                prec = str(signed(rec.word()))
+            spec = '%' + flags + width + ('.' + prec if prec is not None else '')
+            if conv and conv in 'diuoxX':
+                if re.search(r'll|j|q|L', length):
+                    value = rec.dword('q' if conv in 'di' else 'Q')
+                else:
+                    value = rec.word()
+                    value = signed(value) if conv in 'di' else value
+                out.append((spec + ('d' if conv in 'iu' else conv)) % value)
+            elif conv == 'c':
+                out.append((spec + 'c') % chr(rec.word() & 0xff))
+            elif conv and conv in 'eEfFgG':
+                out.append((spec + conv) % rec.dword('d'))
+            elif conv and conv in 'aA':
+                text = float.hex(rec.dword('d'))
+                out.append(text.upper() if conv == 'A' else text)
+            elif conv == 'p':
+                out.append('0x%x' % rec.word())
+            elif conv == 's':
+                out.append((spec + 's') % rec.string())
+            elif conv == 'n':
+                pass
+            else:
+                out.append(m.group(0))
+        except IndexError:
+            out.append('...\n')
+            return ''.join(out)
+    out.append(fmt[last:])
+    return ''.join(out)
+
+
+def decode(stream, elf, tick_hz, timestamp):
+    data = stream.read()
+    pos = 0
+    while True:
+        start = data.find(LOGM_MAGIC, pos)
+        if start < 0:
+            sys.stdout.write(data[pos:].decode('utf-8', 'replace'))
+            break
+
+        # Text between the records, like the dropped messages notice
+        sys.stdout.write(data[pos:start].decode('utf-8', 'replace'))
+        pos = start + len(LOGM_MAGIC)
+        if pos + LOGM_HEADER.size > len(data):
+            break
+        header = LOGM_HEADER.unpack_from(data, pos)
+        length = header[0]
+        if length < LOGM_HEADER.size or pos + length > len(data):
+            sys.stdout.write(LOGM_MAGIC.decode())
+            continue
+
+        rec = Record(header, data[pos + LOGM_HEADER.size:pos + length])
+        pos += length
+        fmt = elf.string(rec.fmt)
+        if timestamp:
+            sys.stdout.write('[%4d.%4d] ' % (rec.ticks // tick_hz, (rec.ticks % tick_hz) * 10000 // tick_hz))
+        if fmt is None:
+            sys.stdout.write('<unknown format 0x%08x>\n' % rec.fmt)
+        else:
+            sys.stdout.write(format_record(fmt, rec))
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Decode the raw binary output of logm (CONFIG_LOGM_BINARY_RAW)')
+    parser.add_argument('elf', help='tinyara ELF file of the running binary')
+    parser.add_argument('log', nargs='?', help='captured output, stdin if not given')
+    parser.add_argument('--tick-hz', type=int, default=100, help='system ticks per second (default 100)')
+    parser.add_argument('--timestamp', action='store_true', help='prepend the time like CONFIG_LOGM_TIMESTAMP')
+    args = parser.parse_args()
+
+    elf = Elf32(args.elf)
+    if args.log:
+        with open(args.log, 'rb') as f:
+            decode(f, elf, args.tick_hz, args.timestamp)
+    else:
+        decode(sys.stdin.buffer, elf, args.tick_hz, args.timestamp)
+
+
+if __name__ == '__main__':
+    main()
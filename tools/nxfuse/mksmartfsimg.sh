@@ -31,6 +31,7 @@ POSTFIX=_smartfs.bin
 BINDIR=$BASE_DIR/build/output/bin
 BINNAME=$BOARDNAME$POSTFIX
 CONTENTSDIR=$BASE_DIR/tools/fs/contents-smartfs
+STAGEDIR=$BASE_DIR/build/output/smartfs-contents
 NXFUSEDIR=$NXFUSE_TOOL_PATH
 
 # For the below values check partition sizes in .config
@@ -60,11 +61,14 @@ echo "mksmartfsimg.sh : $BINNAME, Target Board: $BOARDNAME"
 echo " - block count := $blkcount (bs=$blksize)"
 echo "============================================================="
 
-if [ ! -d $CONTENTSDIR/$BOARDNAME/mnt ]; then
-mkdir -p $CONTENTSDIR/$BOARDNAME/mnt/
-if [[ "${CONFIG_APP_BINARY_SEPARATION}" == "y" ]]; then
-mkdir $CONTENTSDIR/$BOARDNAME/mnt/bins
+# Stage the contents under the build output, the source tree is left as is
+rm -rf $STAGEDIR
+mkdir -p $STAGEDIR
+if [ -d $CONTENTSDIR/$BOARDNAME/base-files ]; then
+cp -rf $CONTENTSDIR/$BOARDNAME/base-files/. $STAGEDIR/
 fi
+if [[ "${CONFIG_APP_BINARY_SEPARATION}" == "y" ]]; then
+mkdir -p $STAGEDIR/bins
 fi
 
 echo "make a dummy"
@@ -88,17 +92,10 @@ echo "Now format image"
 # Formatting
 ./nxfuse -p $pagesize -e $erasesize -l $blksize -t smartfs -m $BINDIR/$BINNAME || exit 1
 
-echo "mount binary"
-# Mounting mnt
-./nxfuse -o nonempty -p $pagesize -e $erasesize -l $blksize -t smartfs $CONTENTSDIR/$BOARDNAME/mnt $BINDIR/$BINNAME || exit 1
-
 echo "Copy files"
-# Copying files to smartfs file system
-cp -rf $CONTENTSDIR/$BOARDNAME/base-files/* $CONTENTSDIR/$BOARDNAME/mnt/
+# Copying files into the image directly, without a FUSE mount
+./nxfuse -p $pagesize -e $erasesize -l $blksize -t smartfs -C $STAGEDIR $BINDIR/$BINNAME || exit 1
 
-# Unmounting
-sleep 2
-fusermount -u $CONTENTSDIR/$BOARDNAME/mnt || exit 1
-rm -rf $CONTENTSDIR/$BOARDNAME/mnt/*
+rm -rf $STAGEDIR
 rm -rf nxfuse
 echo "DONE"
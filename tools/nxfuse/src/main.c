@@ -93,6 +93,7 @@ extern struct fuse_operations nxfuse_oper;
  * Invocation Format:
  *
  *     nxfuse [-e erasesize] [-s sectorsize] mount_point filename
+ *     nxfuse [-e erasesize] [-s sectorsize] -C contents_dir filename
  *
  ****************************************************************************/
 
@@ -106,6 +107,7 @@ int main(int argc, char *argv[])
 	int confirm = 0;
 	char *generic = "";
 	int opt_mkfs = 0;
+	const char *contents = NULL;
 	int no_mount = 0;
 	char **fuse_argv = NULL;
 	const char *filename;
@@ -131,7 +133,7 @@ int main(int argc, char *argv[])
 	 * as the standard FUSE -d -f -h -s -o and -V options.
 	 */
 
-	while ((opt = getopt(argc, argv, "cde:fg:ho:l:mp:st:Vv")) != -1) {
+	while ((opt = getopt(argc, argv, "C:cde:fg:ho:l:mp:st:Vv")) != -1) {
 		switch (opt) {
 		case 'd':
 			/* Add this arg to the fuse_main args */
@@ -247,6 +249,13 @@ int main(int argc, char *argv[])
 			generic = optarg;
 			break;
 
+			/* Populate the image from a host directory */
+
+		case 'C':
+			contents = optarg;
+			no_mount = 1;
+			break;
+
 		case 'v':
 			printf("nxfuse version %s\n", NXFUSE_VERSION);
 			printf("Copyright (C) 2016 Ken Pettit.  All rights reserved.\n");
@@ -265,7 +274,7 @@ int main(int argc, char *argv[])
 			return -1;
 		}
 
-		if (opt_mkfs) {
+		if (opt_mkfs || contents != NULL) {
 			filename = argv[optind];
 		} else {
 			mount_point = argv[optind];
@@ -285,10 +294,35 @@ int main(int argc, char *argv[])
 	/* Test for mkfs option */
 
 	if (opt_mkfs) {
+		/* The formatted image is populated by a separate invocation */
+
+		if (contents != NULL) {
+			printf("Format %s with -m first, then populate it with -C\n", filename);
+			return -1;
+		}
+
 		mkfs(filename, fs_type, erasesize, sectsize, pagesize, generic, confirm);
 		return 0;
 	}
 
+	/* Test for the populate option */
+
+	if (contents != NULL) {
+		pinode = vmount(filename, "/", fs_type, erasesize, sectsize, pagesize, generic);
+		if (pinode == NULL) {
+			printf("Unable to mount filesytem on %s of type %s\n", filename, fs_type);
+			return -1;
+		}
+
+		ret = populate(pinode, contents);
+		if (ret != OK) {
+			printf("Unable to populate %s from %s: %d\n", filename, contents, ret);
+			return -1;
+		}
+
+		return 0;
+	}
+
 	/* If no in help mode, mount the NuttX FS */
 
 	if (!no_mount) {
@@ -111,4 +111,15 @@ struct inode *vmount(const char *filename, const char *mount_point, const char *
  ****************************************************************************/
 int mkfs(const char *filename, const char *fs_type, uint32_t erasesize, uint16_t sectsize, int pagesize, char *generic, int confirm);
 
+/****************************************************************************
+ * Name: populate
+ *
+ * Description:
+ *   This is called from main when the -C 'contents' option is specified.
+ *   It copies a host directory tree into the virtually mounted filesystem
+ *   so that a ready-to-flash image is produced without a FUSE mount.
+ *
+ ****************************************************************************/
+int populate(struct inode *pinode, const char *contents);
+
 #endif							/* _SRC_NXFUSE_H */
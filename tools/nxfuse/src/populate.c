@@ -0,0 +1,201 @@
+/****************************************************************************
+ *
+ * Copyright 2026 Samsung Electronics All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing,
+ * software distributed under the License is distributed on an
+ * "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+ * either express or implied. See the License for the specific
+ * language governing permissions and limitations under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#define _XOPEN_SOURCE 500
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <debug.h>
+#include <ftw.h>
+#include <sys/stat.h>
+
+#include <tinyara/fs/fs.h>
+#include "nxfuse.h"
+
+/****************************************************************************
+ * Pre-processor Definitions
+ ****************************************************************************/
+
+#define POPULATE_BUFSIZE   4096
+#define POPULATE_MAXFDS    16
+
+/****************************************************************************
+ * Private Data
+ ****************************************************************************/
+
+/* nftw() has no argument for its callback */
+
+static struct inode *g_pinode;
+static size_t g_rootlen;
+static int g_result;
+
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: populate_file
+ *
+ *  Copy one host file into the mounted filesystem
+ *
+ ****************************************************************************/
+
+static int populate_file(const char *hostpath, const char *relpath, mode_t mode)
+{
+	char buf[POPULATE_BUFSIZE];
+	struct file *filep;
+	ssize_t nread;
+	ssize_t nwritten;
+	ssize_t n;
+	int ret;
+	int fd;
+
+	fd = open(hostpath, O_RDONLY);
+	if (fd < 0) {
+		return -errno;
+	}
+
+	filep = (struct file *)calloc(1, sizeof(struct file));
+	if (filep == NULL) {
+		close(fd);
+		return -ENOMEM;
+	}
+
+	filep->f_inode = g_pinode;
+	filep->f_oflags = O_WROK | O_CREAT | O_TRUNC;
+
+	ret = g_pinode->u.i_mops->open(filep, relpath, filep->f_oflags, mode & 0777);
+	if (ret != OK) {
+		free(filep);
+		close(fd);
+		return ret;
+	}
+
+	while (ret == OK && (nread = read(fd, buf, sizeof(buf))) != 0) {
+		if (nread < 0) {
+			ret = -errno;
+			break;
+		}
+
+		for (nwritten = 0; nwritten < nread; nwritten += n) {
+			n = g_pinode->u.i_mops->write(filep, buf + nwritten, nread - nwritten);
+			if (n <= 0) {
+				ret = n < 0 ? (int)n : -ENOSPC;
+				break;
+			}
+		}
+	}
+
+	/* Closing the file flushes the sector buffer to the image */
+
+	n = g_pinode->u.i_mops->close(filep);
+	if (ret == OK) {
+		ret = n;
+	}
+
+	free(filep);
+	close(fd);
+	return ret;
+}
+
+/****************************************************************************
+ * Name: populate_entry
+ *
+ *  The nftw() callback, directories are visited before their contents
+ *
+ ****************************************************************************/
+
+static int populate_entry(const char *fpath, const struct stat *sb, int typeflag, struct FTW *ftwbuf)
+{
+	const char *relpath = fpath + g_rootlen;
+	int ret;
+
+	while (*relpath == '/') {
+		relpath++;
+	}
+
+	/* The top directory is the root of the filesystem */
+
+	if (*relpath == '\0' || strcmp(fpath + ftwbuf->base, ".gitignore") == 0) {
+		return 0;
+	}
+
+	switch (typeflag) {
+	case FTW_D:
+		ret = g_pinode->u.i_mops->mkdir(g_pinode, relpath, sb->st_mode & 0777);
+		if (ret == -EEXIST) {
+			ret = OK;
+		}
+		break;
+
+	case FTW_F:
+		ret = populate_file(fpath, relpath, sb->st_mode);
+		break;
+
+	default:
+		ret = -EACCES;
+		break;
+	}
+
+	if (ret != OK) {
+		printf("Unable to copy %s: %d\n", fpath, ret);
+		g_result = ret;
+		return 1;
+	}
+
+	return 0;
+}
+
+/****************************************************************************
+ * Public Functions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Name: populate
+ *
+ *  Copy the host directory tree 'contents' into the virtually mounted
+ *  filesystem, so an image can be filled without mounting it with FUSE.
+ *
+ ****************************************************************************/
+
+int populate(struct inode *pinode, const char *contents)
+{
+	if (pinode->u.i_mops->open == NULL || pinode->u.i_mops->write == NULL || pinode->u.i_mops->mkdir == NULL) {
+		return -ENOSYS;
+	}
+
+	g_pinode = pinode;
+	g_rootlen = strlen(contents);
+	g_result = OK;
+
+	if (nftw(contents, populate_entry, POPULATE_MAXFDS, 0) < 0) {
+		printf("Unable to read %s: %d\n", contents, errno);
+		return -errno;
+	}
+
+	return g_result;
+}
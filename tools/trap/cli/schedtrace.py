@@ -0,0 +1,189 @@
+#!/usr/bin/env python
+###########################################################################
+#
+# Copyright 2026 Samsung Electronics All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND,
+# either express or implied. See the License for the specific
+# language governing permissions and limitations under the License.
+#
+###########################################################################
+# File : schedtrace.py
+# Description: Convert the output of 'cat /proc/schedtrace' into the Chrome
+#              trace event format, which chrome://tracing and
+#              https://ui.perfetto.dev open directly.
+#
+# Lines of the input, anything else (console prompts, logs) is skipped:
+#   C <cpu> <timestamp freq> <events recorded> <events lost>
+#   T <pid> <priority> <name>
+#   E <cpu> <timestamp> <type> <pid> <arg in hex>
+
+from __future__ import print_function
+import json
+import sys
+from getopt import GetoptError, getopt as GetOpt
+
+SWITCH = 1
+IRQ_ENTER = 2
+IRQ_LEAVE = 3
+SEM_WAIT = 4
+SEM_WAKE = 5
+MQ_WAITRECV = 6
+MQ_WAITSEND = 7
+MQ_WAKE = 8
+
+INSTANT_NAMES = {
+	SEM_WAIT: 'sem wait',
+	SEM_WAKE: 'sem wake',
+	MQ_WAITRECV: 'mq wait receive',
+	MQ_WAITSEND: 'mq wait send',
+	MQ_WAKE: 'mq wake',
+}
+
+TASKS_PID = 0		# Trace viewer process holding one thread per task
+IRQ_PID = 1		# Trace viewer process holding one thread per CPU for interrupts
+
+
+def usage():
+	print('Usage: %s [-o OUTPUT_FILE] [TRACE_FILE]' % sys.argv[0])
+	print('\tTRACE_FILE                      Output of \'cat /proc/schedtrace\', stdin if not given')
+	print('\t-o, --output                    Trace event JSON file, stdout if not given')
+	print('\t-h, --help                      Show help')
+
+
+def parse(lines):
+	freq = {}
+	lost = {}
+	tasks = {}
+	events = []
+
+	for line in lines:
+		fields = line.split()
+		try:
+			if len(fields) == 5 and fields[0] == 'C':
+				freq[int(fields[1])] = int(fields[2])
+				lost[int(fields[1])] = int(fields[4])
+			elif len(fields) >= 4 and fields[0] == 'T':
+				tasks[int(fields[1])] = ' '.join(fields[3:])
+			elif len(fields) == 6 and fields[0] == 'E':
+				events.append((int(fields[1]), int(fields[2]), int(fields[3]), int(fields[4]), int(fields[5], 16)))
+		except ValueError:
+			continue
+
+	return freq, lost, tasks, events
+
+
+def to_usec(events, freq):
+	# Timestamps are 32 bit counters, unwrap them per CPU and rebase them on
+	# the oldest event.
+	result = []
+	last = {}
+	high = {}
+	for cpu, time, etype, pid, arg in events:
+		if cpu in last and time < last[cpu]:
+			high[cpu] = high.get(cpu, 0) + (1 << 32)
+		last[cpu] = time
+		result.append((cpu, time + high.get(cpu, 0), etype, pid, arg))
+
+	if not result:
+		return result
+	base = min(e[1] for e in result)
+	return sorted([(cpu, (time - base) * 1000000.0 / freq.get(cpu, 1000000), etype, pid, arg)
+		for cpu, time, etype, pid, arg in result], key=lambda e: e[1])
+
+
+def convert(freq, lost, tasks, events):
+	trace = []
+	running = {}
+	irqs = {}
+	names = dict(tasks)
+
+	def task_name(pid):
+		return '%s (%d)' % (names.get(pid, 'pid'), pid)
+
+	events = to_usec(events, freq)
+	for cpu, ts, etype, pid, arg in events:
+		if etype == SWITCH:
+			if cpu in running:
+				prev, start, prio = running[cpu]
+				trace.append({'name': task_name(prev), 'ph': 'X', 'pid': TASKS_PID, 'tid': prev,
+					'ts': start, 'dur': ts - start, 'args': {'cpu': cpu, 'priority': prio}})
+			running[cpu] = (pid, ts, arg >> 16)
+		elif etype == IRQ_ENTER:
+			irqs.setdefault(cpu, []).append((arg, ts))
+		elif etype == IRQ_LEAVE:
+			if irqs.get(cpu):
+				irq, start = irqs[cpu].pop()
+				trace.append({'name': 'irq %d' % irq, 'ph': 'X', 'pid': IRQ_PID, 'tid': cpu,
+					'ts': start, 'dur': ts - start})
+		elif etype in INSTANT_NAMES:
+			trace.append({'name': INSTANT_NAMES[etype], 'ph': 'i', 's': 't', 'pid': TASKS_PID, 'tid': pid,
+				'ts': ts, 'args': {'object': '0x%08x' % arg, 'cpu': cpu}})
+
+	# Close what is still running at the end of the trace
+	if events:
+		end = events[-1][1]
+		for cpu, (pid, start, prio) in running.items():
+			trace.append({'name': task_name(pid), 'ph': 'X', 'pid': TASKS_PID, 'tid': pid,
+				'ts': start, 'dur': max(end - start, 0), 'args': {'cpu': cpu, 'priority': prio}})
+
+	pids = set(e['tid'] for e in trace if e['pid'] == TASKS_PID)
+	trace.append({'name': 'process_name', 'ph': 'M', 'pid': TASKS_PID, 'args': {'name': 'Tasks'}})
+	trace.append({'name': 'process_name', 'ph': 'M', 'pid': IRQ_PID, 'args': {'name': 'Interrupts'}})
+	for pid in pids:
+		trace.append({'name': 'thread_name', 'ph': 'M', 'pid': TASKS_PID, 'tid': pid, 'args': {'name': task_name(pid)}})
+	for cpu in freq:
+		trace.append({'name': 'thread_name', 'ph': 'M', 'pid': IRQ_PID, 'tid': cpu, 'args': {'name': 'CPU %d' % cpu}})
+
+	return {'traceEvents': trace, 'displayTimeUnit': 'ns',
+		'otherData': {'lost events': dict(('cpu%d' % cpu, n) for cpu, n in lost.items())}}
+
+
+def main():
+	output = None
+	try:
+		opts, args = GetOpt(sys.argv[1:], 'o:h', ['output=', 'help'])
+	except GetoptError as e:
+		print(e)
+		usage()
+		sys.exit(1)
+
+	for opt, arg in opts:
+		if opt in ('-o', '--output'):
+			output = arg
+		elif opt in ('-h', '--help'):
+			usage()
+			sys.exit(0)
+
+	if args:
+		with open(args[0]) as f:
+			freq, lost, tasks, events = parse(f)
+	else:
+		freq, lost, tasks, events = parse(sys.stdin)
+
+	if not events:
+		print('No scheduler trace events found', file=sys.stderr)
+		sys.exit(1)
+
+	for cpu, n in sorted(lost.items()):
+		if n:
+			print('CPU %d: %d older events were overwritten' % (cpu, n), file=sys.stderr)
+
+	result = convert(freq, lost, tasks, events)
+	if output:
+		with open(output, 'w') as f:
+			json.dump(result, f)
+	else:
+		json.dump(result, sys.stdout)
+
+
+if __name__ == '__main__':
+	main()